@@ -0,0 +1,135 @@
+#pragma once
+
+// English: LoadGenerator - multi-connection, open-loop load generator (TestClient --clients mode)
+// 한글: LoadGenerator - 다중 연결 open-loop 부하 생성기 (TestClient --clients 모드)
+//
+// English:
+//   - Each worker thread drives many non-blocking connections from one poller
+//     (epoll on Linux, poll()/WSAPoll elsewhere).
+//   - Open loop (mRate > 0): requests are issued on a fixed schedule regardless of
+//     responses. The intended send time travels in PKT_PingReq::clientTime (echoed
+//     by the server), so latency is measured from when the request *should* have
+//     been sent — coordinated-omission corrected. Send-to-response latency is
+//     reported alongside as "uncorrected".
+//     A scheduled request that finds no free connection / in-flight slot waits in a
+//     per-worker backlog and goes out as soon as one frees, still carrying its
+//     intended time — stalls show up in the tail instead of being dropped.
+//   - Closed loop (mRate == 0): one request in flight per connection; the next is
+//     sent as soon as the response arrives (maximum throughput probe).
+//   - Ramp-up grows both the open-connection count and the request rate linearly.
+//   - Churn closes random established connections at a fixed rate; the connection
+//     maintainer reopens them (connect + handshake under load).
+// 한글:
+//   - 워커 스레드 하나가 poller 하나(Linux epoll, 그 외 poll()/WSAPoll)로 다수의
+//     논블로킹 연결을 구동한다.
+//   - Open loop (mRate > 0): 응답과 무관하게 고정 일정으로 요청을 보낸다. 의도한 송신
+//     시각을 PKT_PingReq::clientTime에 실어 보내고(서버가 에코), 요청이 *나갔어야 할*
+//     시각부터 지연을 잰다 — coordinated omission 보정. 실제 송신 기준 지연은
+//     "uncorrected"로 함께 보고한다.
+//     가용 연결/진행 슬롯이 없을 때의 예정 요청은 워커별 대기열에 두었다가 슬롯이 나면
+//     의도 시각을 그대로 실어 보낸다 — 정체 구간이 버려지지 않고 꼬리 지연에 드러난다.
+//   - Closed loop (mRate == 0): 연결당 요청 1개만 진행, 응답 도착 즉시 다음 요청.
+//   - Ramp-up 동안 연결 수와 요청률을 선형으로 늘린다.
+//   - Churn은 수립된 연결을 일정 비율로 닫고, 연결 관리자가 다시 연다.
+
+#include "Utils/LatencyHistogram.h"
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace Network::TestClient
+{
+
+// =============================================================================
+// English: Load generator options
+// 한글: 부하 생성기 옵션
+// =============================================================================
+
+struct LoadOptions
+{
+	std::string mHost = "127.0.0.1";
+	uint16_t    mPort = 0;
+
+	uint32_t mConnections = 100;  // English: Total connections / 한글: 전체 연결 수
+	uint32_t mThreads     = 1;    // English: Worker threads (connections are split evenly) / 한글: 워커 스레드 수
+	double   mRate        = 0.0;  // English: Target requests/sec across all connections (0 = closed loop) / 한글: 전체 목표 요청률 (0 = closed loop)
+	uint32_t mDurationSec = 10;   // English: Total run time including ramp-up / 한글: ramp-up 포함 전체 실행 시간
+	uint32_t mRampUpSec   = 0;    // English: Linear ramp of connections and rate / 한글: 연결 수·요청률 선형 증가 구간
+	uint32_t mWarmupSec   = 0;    // English: Requests intended before this are not recorded / 한글: 이 시점 이전 요청은 기록 제외
+	double   mChurnPerSec = 0.0;  // English: Established connections closed+reopened per second / 한글: 초당 닫고 다시 여는 연결 수
+	uint32_t mMaxInflight = 256;  // English: Per-connection in-flight cap (open loop) / 한글: 연결당 진행 중 요청 상한
+	uint32_t mRequestBytes = 0;  // English: Request wire size, PingReq padded (0 = sizeof(PKT_PingReq)) / 한글: 요청 와이어 크기, PingReq 뒤를 채움 (0 = sizeof(PKT_PingReq))
+	uint32_t mRequestsPerConnection = 0;  // English: Requests per connection, then the run ends early (0 = until duration) / 한글: 연결당 요청 수, 모두 끝나면 조기 종료 (0 = 시간까지)
+
+	std::string mJsonPath;        // English: JSON summary path ("-" = stdout, empty = none) / 한글: JSON 요약 경로
+};
+
+// =============================================================================
+// English: Aggregated results (merged from all workers after the run)
+// 한글: 집계 결과 (실행 후 모든 워커에서 병합)
+// =============================================================================
+
+struct LoadReport
+{
+	uint64_t mConnectAttempts  = 0;  // English: connect() calls / 한글: connect() 호출 수
+	uint64_t mConnectFailures  = 0;  // English: connect or handshake failed / 한글: 연결·핸드셰이크 실패
+	uint64_t mSessions         = 0;  // English: Handshakes completed / 한글: 핸드셰이크 완료 수
+	uint64_t mDisconnects      = 0;  // English: Unexpected closes after handshake / 한글: 핸드셰이크 후 예기치 않은 종료
+	uint64_t mChurnCloses      = 0;  // English: Closes issued by churn / 한글: churn으로 닫은 연결
+	uint64_t mPeakConnections  = 0;  // English: Max concurrently established / 한글: 동시 수립 최대치
+
+	uint64_t mRequestsSent     = 0;
+	uint64_t mResponses        = 0;  // English: All responses (including warm-up) / 한글: 전체 응답 (워밍업 포함)
+	uint64_t mDeferred         = 0;  // English: Sent late from the backlog (no connection / in-flight cap at the intended time) / 한글: 대기열에서 늦게 송신 (의도 시각에 가용 연결·슬롯 없음)
+	uint64_t mMissed           = 0;  // English: Scheduled but never sent (backlog full or still queued at the end) / 한글: 예정됐으나 끝내 미송신 (대기열 초과 또는 종료 시 잔여)
+	uint64_t mLost             = 0;  // English: In flight when the connection closed or the run ended / 한글: 종료 시 진행 중이던 요청
+	uint64_t mBytesSent        = 0;
+	uint64_t mBytesReceived    = 0;
+
+	double mMeasuredSec = 0.0;  // English: Recording window (duration - warm-up) / 한글: 기록 구간 길이
+
+	Utils::LatencyHistogram mCorrected;    // English: Intended send → response (ns) / 한글: 의도 송신 → 응답
+	Utils::LatencyHistogram mUncorrected;  // English: Actual send → response (ns) / 한글: 실제 송신 → 응답
+};
+
+// =============================================================================
+// English: LoadGenerator
+// 한글: LoadGenerator
+// =============================================================================
+
+class LoadGenerator
+{
+  public:
+	explicit LoadGenerator(const LoadOptions &options);
+	~LoadGenerator();
+
+	LoadGenerator(const LoadGenerator &) = delete;
+	LoadGenerator &operator=(const LoadGenerator &) = delete;
+
+	// English: Run to completion (blocking). False if the address is invalid or no worker could start.
+	// 한글: 완료까지 실행 (블로킹). 주소가 잘못됐거나 워커를 시작하지 못하면 false.
+	bool Run();
+
+	// English: Stop early (signal handler safe — sets a flag only)
+	// 한글: 조기 중지 (시그널 핸들러에서 호출 가능 — 플래그만 설정)
+	void RequestStop();
+
+	const LoadReport &GetReport() const { return mReport; }
+
+	// English: Human-readable summary / JSON summary
+	// 한글: 사람이 읽는 요약 / JSON 요약
+	void PrintSummary(std::ostream &out) const;
+	void WriteJson(std::ostream &out) const;
+	bool WriteJson(const std::string &path) const;
+
+  private:
+	struct Worker;
+
+	LoadOptions       mOptions;
+	LoadReport        mReport;
+	std::atomic<bool> mStopRequested{false};
+};
+
+} // namespace Network::TestClient
@@ -80,6 +80,29 @@ inline void PlatformSetTcpNoDelay(SocketHandle s, bool enable)
 			   reinterpret_cast<const char *>(&nodelay), sizeof(nodelay));
 }
 
+// English: Switch socket to non-blocking mode (load generator)
+// 한글: 소켓을 논블로킹 모드로 전환 (부하 생성기)
+inline bool PlatformSetNonBlocking(SocketHandle s)
+{
+	u_long mode = 1;
+	return ioctlsocket(s, FIONBIO, &mode) == 0;
+}
+
+// English: Non-blocking connect() still in progress (not a failure)
+// 한글: 논블로킹 connect() 진행 중 (실패 아님)
+inline bool IsConnectInProgress(int err) { return err == WSAEWOULDBLOCK || err == WSAEINPROGRESS; }
+
+// English: Pending socket error (SO_ERROR) — result of a non-blocking connect()
+// 한글: 소켓의 대기 중 에러 (SO_ERROR) — 논블로킹 connect() 결과 확인용
+inline int PlatformGetSocketError(SocketHandle s)
+{
+	int err = 0;
+	int len = sizeof(err);
+	if (getsockopt(s, SOL_SOCKET, SO_ERROR, reinterpret_cast<char *>(&err), &len) != 0)
+		return WSAGetLastError();
+	return err;
+}
+
 #else
 // =============================================================================
 // POSIX (Linux, macOS)
@@ -91,6 +114,7 @@ inline void PlatformSetTcpNoDelay(SocketHandle s, bool enable)
 #include <netdb.h>
 #include <arpa/inet.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <cerrno>
 
 // English: Socket handle type (POSIX: int file descriptor)
@@ -152,4 +176,27 @@ inline void PlatformSetTcpNoDelay(SocketHandle s, bool enable)
 			   reinterpret_cast<const char *>(&nodelay), sizeof(nodelay));
 }
 
+// English: Switch socket to non-blocking mode (load generator)
+// 한글: 소켓을 논블로킹 모드로 전환 (부하 생성기)
+inline bool PlatformSetNonBlocking(SocketHandle s)
+{
+	const int flags = fcntl(s, F_GETFL, 0);
+	return flags != -1 && fcntl(s, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+// English: Non-blocking connect() still in progress (not a failure)
+// 한글: 논블로킹 connect() 진행 중 (실패 아님)
+inline bool IsConnectInProgress(int err) { return err == EINPROGRESS || err == EWOULDBLOCK; }
+
+// English: Pending socket error (SO_ERROR) — result of a non-blocking connect()
+// 한글: 소켓의 대기 중 에러 (SO_ERROR) — 논블로킹 connect() 결과 확인용
+inline int PlatformGetSocketError(SocketHandle s)
+{
+	int err = 0;
+	socklen_t len = sizeof(err);
+	if (getsockopt(s, SOL_SOCKET, SO_ERROR, &err, &len) != 0)
+		return errno;
+	return err;
+}
+
 #endif
@@ -2,6 +2,7 @@
 // 한글: TestClient 진입점 - 게임 서버에 접속하여 핑/퐁 실행
 
 #include "Utils/NetworkUtils.h"
+#include "include/LoadGenerator.h"
 #include "include/PlatformInput.h"
 #include "include/TestClient.h"
 #include <chrono>
@@ -24,6 +25,10 @@ using namespace Network::TestClient;
 // 한글: 시그널 처리용 전역 클라이언트 포인터
 static TestClient *g_pClient = nullptr;
 
+// English: Global load generator pointer (--clients mode)
+// 한글: 부하 생성기 전역 포인터 (--clients 모드)
+static LoadGenerator *g_pLoad = nullptr;
+
 void SignalHandler(int signum)
 {
 	Logger::Info("Signal received: " + std::to_string(signum));
@@ -31,6 +36,10 @@ void SignalHandler(int signum)
 	{
 		g_pClient->RequestStop();
 	}
+	if (g_pLoad)
+	{
+		g_pLoad->RequestStop();
+	}
 }
 
 #ifdef _WIN32
@@ -45,6 +54,8 @@ static BOOL WINAPI ConsoleCtrlHandler(DWORD ctrlType)
     case CTRL_SHUTDOWN_EVENT:
         if (g_pClient)
             g_pClient->RequestStop();
+        if (g_pLoad)
+            g_pLoad->RequestStop();
         // English: Give main thread up to 3s to finish Shutdown()
         // 한글: 메인 스레드가 Shutdown()을 완료할 때까지 최대 3초 대기
         std::this_thread::sleep_for(std::chrono::milliseconds(3000));
@@ -63,7 +74,18 @@ void PrintUsage(const char *programName)
 				  << std::endl;
 	std::cout << "  --port <port>   Server port (default: " << DEFAULT_TEST_SERVER_PORT << ")" << std::endl;
 	std::cout << "  --pings <n>     Exit after sending N pings (default: 0 = unlimited)" << std::endl;
-	std::cout << "  --clients <n>   Number of client instances (currently ignored)" << std::endl;
+	std::cout << "                  With --clients: N requests per connection, then exit early" << std::endl;
+	std::cout << "  --clients <n>   Load mode: open N connections (non-interactive)" << std::endl;
+	std::cout << "Load mode options (with --clients):" << std::endl;
+	std::cout << "  --threads <n>       Worker threads (default: 1)" << std::endl;
+	std::cout << "  --rate <req/s>      Open-loop target rate, all connections (default: 0 = closed loop)" << std::endl;
+	std::cout << "  --duration <sec>    Run time including ramp-up (default: 10)" << std::endl;
+	std::cout << "  --ramp-up <sec>     Linear ramp of connections and rate (default: 0)" << std::endl;
+	std::cout << "  --warmup <sec>      Exclude requests scheduled before this (default: 0)" << std::endl;
+	std::cout << "  --churn <n/s>       Close and reopen N connections per second (default: 0)" << std::endl;
+	std::cout << "  --max-inflight <n>  Per-connection in-flight cap (default: 256)" << std::endl;
+	std::cout << "  --payload <bytes>   Request packet size, PingReq padded (default: 16, max: 4096)" << std::endl;
+	std::cout << "  --json <path|->     Write JSON summary to file or stdout" << std::endl;
 	std::cout << "  -l <level>      Log level: DEBUG, INFO, WARN, ERROR "
 				 "(default: INFO)"
 				  << std::endl;
@@ -117,6 +139,8 @@ int main(int argc, char *argv[])
 	uint16_t port = DEFAULT_TEST_SERVER_PORT;
 	LogLevel logLevel = LogLevel::Info;
 	uint32_t maxPings = 0;
+	bool loadMode = false;
+	LoadOptions loadOptions;
 
 	// English: Parse command line arguments
 	// 한글: 커맨드라인 인자 파싱
@@ -153,7 +177,44 @@ int main(int argc, char *argv[])
 		}
 		else if (arg == "--clients" && i + 1 < argc)
 		{
-			++i; // English: ignored — single-connection mode / 한글: 무시 (단일 연결 모드)
+			loadMode = true;
+			loadOptions.mConnections = static_cast<uint32_t>(std::stoul(argv[++i]));
+		}
+		else if (arg == "--threads" && i + 1 < argc)
+		{
+			loadOptions.mThreads = static_cast<uint32_t>(std::stoul(argv[++i]));
+		}
+		else if (arg == "--rate" && i + 1 < argc)
+		{
+			loadOptions.mRate = std::stod(argv[++i]);
+		}
+		else if (arg == "--duration" && i + 1 < argc)
+		{
+			loadOptions.mDurationSec = static_cast<uint32_t>(std::stoul(argv[++i]));
+		}
+		else if (arg == "--ramp-up" && i + 1 < argc)
+		{
+			loadOptions.mRampUpSec = static_cast<uint32_t>(std::stoul(argv[++i]));
+		}
+		else if (arg == "--warmup" && i + 1 < argc)
+		{
+			loadOptions.mWarmupSec = static_cast<uint32_t>(std::stoul(argv[++i]));
+		}
+		else if (arg == "--churn" && i + 1 < argc)
+		{
+			loadOptions.mChurnPerSec = std::stod(argv[++i]);
+		}
+		else if (arg == "--max-inflight" && i + 1 < argc)
+		{
+			loadOptions.mMaxInflight = static_cast<uint32_t>(std::stoul(argv[++i]));
+		}
+		else if (arg == "--payload" && i + 1 < argc)
+		{
+			loadOptions.mRequestBytes = static_cast<uint32_t>(std::stoul(argv[++i]));
+		}
+		else if (arg == "--json" && i + 1 < argc)
+		{
+			loadOptions.mJsonPath = argv[++i];
 		}
 		else
 		{
@@ -182,6 +243,39 @@ int main(int argc, char *argv[])
 	// English: On Linux/macOS SIGINT/SIGTERM are sufficient; SIGBREAK does not exist.
 	// 한글: Linux/macOS에서는 SIGINT/SIGTERM으로 충분. SIGBREAK는 존재하지 않음.
 
+	// English: Load mode — no interactive loop, exit status reflects whether any response arrived
+	// 한글: 부하 모드 — 대화형 루프 없음, 응답을 하나라도 받았는지로 종료 코드 결정
+	if (loadMode)
+	{
+#if !defined(_WIN32)
+		RestoreTerminal();
+#endif
+		if (!PlatformSocketInit())
+		{
+			Logger::Error("Failed to initialize socket platform");
+			return 1;
+		}
+		loadOptions.mHost = host;
+		loadOptions.mPort = port;
+		loadOptions.mRequestsPerConnection = maxPings;
+
+		LoadGenerator generator(loadOptions);
+		g_pLoad = &generator;
+		const bool ran = generator.Run();
+		g_pLoad = nullptr;
+		if (ran)
+		{
+			generator.PrintSummary(std::cout);
+			if (!loadOptions.mJsonPath.empty())
+			{
+				generator.WriteJson(loadOptions.mJsonPath);
+			}
+		}
+		PlatformSocketCleanup();
+		Logger::Info("TestClient load run complete.");
+		return (ran && generator.GetReport().mResponses > 0) ? 0 : 1;
+	}
+
 	// English: Create and run client
 	// 한글: 클라이언트 생성 및 실행
 	TestClient client;
@@ -0,0 +1,1124 @@
+// English: LoadGenerator implementation - per-thread poller loop, open-loop scheduling, reporting
+// 한글: LoadGenerator 구현 - 스레드별 poller 루프, open-loop 스케줄링, 결과 보고
+
+#include "../include/LoadGenerator.h"
+#include "../include/PlatformSocket.h"
+#include "Network/Core/PacketDefine.h"
+#include "Utils/Logger.h"
+#include "Utils/Timer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#elif !defined(_WIN32)
+#include <poll.h>
+#endif
+
+#ifndef _WIN32
+#include <csignal>
+#include <sys/resource.h>
+#endif
+
+using namespace Network::Core;
+using namespace Network::Utils;
+
+namespace Network::TestClient
+{
+
+namespace
+{
+constexpr uint64_t kNsPerSec           = 1000000000ull;
+constexpr uint64_t kMaintainIntervalNs = 10000000ull;    // English: Connection maintainer pass (10ms) / 한글: 연결 관리 주기
+constexpr uint64_t kConnectTimeoutNs   = 5 * kNsPerSec;  // English: connect + handshake deadline / 한글: 연결+핸드셰이크 제한
+constexpr uint64_t kRetryDelayNs       = 100000000ull;   // English: Reopen delay after a failure (100ms) / 한글: 실패 후 재연결 지연
+constexpr uint64_t kDrainTimeoutNs     = 2 * kNsPerSec;  // English: Wait for in-flight responses at the end / 한글: 종료 시 응답 대기
+constexpr uint32_t kOpensPerPass       = 64;             // English: connect() calls per maintainer pass / 한글: 관리 주기당 connect() 상한
+constexpr size_t   kMaxBacklog         = 1u << 20;       // English: Deferred intended times per worker (8MB) / 한글: 워커별 지연 발행 대기열 상한 (8MB)
+constexpr size_t   kScratchSize        = 64 * 1024;
+
+#ifdef _WIN32
+constexpr int kSendFlags = 0;
+#elif defined(MSG_NOSIGNAL)
+constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+constexpr int kSendFlags = 0;  // English: SIGPIPE is ignored in Run() / 한글: Run()에서 SIGPIPE 무시
+#endif
+
+uint32_t NextPowerOfTwo(uint32_t value)
+{
+	uint32_t result = 1;
+	while (result < value)
+	{
+		result <<= 1;
+	}
+	return result;
+}
+
+// English: Poller token = (generation << 32) | slot — events for a closed-and-reopened slot are ignored
+// 한글: poller 토큰 = (세대 << 32) | 슬롯 — 닫고 다시 연 슬롯의 이전 이벤트는 무시된다
+uint64_t MakeToken(uint32_t slot, uint32_t generation)
+{
+	return (static_cast<uint64_t>(generation) << 32) | slot;
+}
+
+#ifndef _WIN32
+// English: thousands of sockets per process exceed the default soft limit (often 1024)
+// 한글: 수천 개 소켓은 기본 soft 한도(보통 1024)를 넘는다
+void RaiseFileLimit(uint32_t connections)
+{
+	struct rlimit limit;
+	if (getrlimit(RLIMIT_NOFILE, &limit) != 0)
+	{
+		return;
+	}
+	const rlim_t wanted = static_cast<rlim_t>(connections) + 64;
+	if (limit.rlim_cur >= wanted)
+	{
+		return;
+	}
+	limit.rlim_cur = (limit.rlim_max == RLIM_INFINITY) ? wanted : (std::min)(wanted, limit.rlim_max);
+	setrlimit(RLIMIT_NOFILE, &limit);
+	if (limit.rlim_cur < wanted)
+	{
+		Logger::Warn("LoadGenerator: RLIMIT_NOFILE hard limit {} < {} - some connections will fail",
+		             static_cast<uint64_t>(limit.rlim_max), static_cast<uint64_t>(wanted));
+	}
+}
+#endif
+
+// =============================================================================
+// English: Poller - epoll on Linux, poll()/WSAPoll elsewhere
+// 한글: Poller - Linux는 epoll, 그 외 poll()/WSAPoll
+// =============================================================================
+
+struct PollEvent
+{
+	uint64_t mToken;
+	bool     mReadable;
+	bool     mWritable;
+	bool     mError;
+};
+
+#ifdef __linux__
+class Poller
+{
+  public:
+	Poller() : mEpoll(epoll_create1(EPOLL_CLOEXEC)), mEvents(1024) {}
+	~Poller()
+	{
+		if (mEpoll >= 0)
+			close(mEpoll);
+	}
+
+	bool IsValid() const { return mEpoll >= 0; }
+
+	void Add(SocketHandle s, uint32_t slot, uint64_t token, bool wantWrite)
+	{
+		(void)slot;
+		epoll_event ev{};
+		ev.events   = EPOLLIN | (wantWrite ? EPOLLOUT : 0u);
+		ev.data.u64 = token;
+		epoll_ctl(mEpoll, EPOLL_CTL_ADD, s, &ev);
+	}
+
+	void Modify(SocketHandle s, uint32_t slot, uint64_t token, bool wantWrite)
+	{
+		(void)slot;
+		epoll_event ev{};
+		ev.events   = EPOLLIN | (wantWrite ? EPOLLOUT : 0u);
+		ev.data.u64 = token;
+		epoll_ctl(mEpoll, EPOLL_CTL_MOD, s, &ev);
+	}
+
+	void Remove(SocketHandle s, uint32_t slot)
+	{
+		(void)slot;
+		epoll_ctl(mEpoll, EPOLL_CTL_DEL, s, nullptr);
+	}
+
+	// English: Fills out; returns event count (0 on timeout/EINTR)
+	// 한글: out을 채우고 이벤트 수 반환 (타임아웃/EINTR이면 0)
+	size_t Wait(int timeoutMs, std::vector<PollEvent> &out)
+	{
+		out.clear();
+		const int n = epoll_wait(mEpoll, mEvents.data(), static_cast<int>(mEvents.size()), timeoutMs);
+		for (int i = 0; i < n; ++i)
+		{
+			const uint32_t e = mEvents[i].events;
+			out.push_back({mEvents[i].data.u64, (e & EPOLLIN) != 0, (e & EPOLLOUT) != 0,
+			               (e & (EPOLLERR | EPOLLHUP)) != 0});
+		}
+		return out.size();
+	}
+
+  private:
+	int                      mEpoll;
+	std::vector<epoll_event> mEvents;
+};
+#else
+class Poller
+{
+  public:
+	bool IsValid() const { return true; }
+
+	void Add(SocketHandle s, uint32_t slot, uint64_t token, bool wantWrite)
+	{
+		if (slot >= mEntries.size())
+			mEntries.resize(slot + 1);
+		mEntries[slot] = {s, token, wantWrite, true};
+	}
+
+	void Modify(SocketHandle s, uint32_t slot, uint64_t token, bool wantWrite)
+	{
+		Add(s, slot, token, wantWrite);
+	}
+
+	void Remove(SocketHandle, uint32_t slot)
+	{
+		if (slot < mEntries.size())
+			mEntries[slot].mUsed = false;
+	}
+
+	// English: O(connections) per call — fallback path only
+	// 한글: 호출당 O(연결 수) — 대체 경로 전용
+	size_t Wait(int timeoutMs, std::vector<PollEvent> &out)
+	{
+		out.clear();
+		mFds.clear();
+		mTokens.clear();
+		for (const Entry &entry : mEntries)
+		{
+			if (!entry.mUsed)
+				continue;
+#ifdef _WIN32
+			WSAPOLLFD fd{};
+#else
+			pollfd fd{};
+#endif
+			fd.fd     = entry.mSocket;
+			fd.events = static_cast<short>(POLLIN | (entry.mWantWrite ? POLLOUT : 0));
+			mFds.push_back(fd);
+			mTokens.push_back(entry.mToken);
+		}
+		if (mFds.empty())
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+			return 0;
+		}
+#ifdef _WIN32
+		const int n = WSAPoll(mFds.data(), static_cast<ULONG>(mFds.size()), timeoutMs);
+#else
+		const int n = poll(mFds.data(), static_cast<nfds_t>(mFds.size()), timeoutMs);
+#endif
+		for (size_t i = 0; n > 0 && i < mFds.size(); ++i)
+		{
+			const short e = mFds[i].revents;
+			if (e == 0)
+				continue;
+			out.push_back({mTokens[i], (e & POLLIN) != 0, (e & POLLOUT) != 0,
+			               (e & (POLLERR | POLLHUP | POLLNVAL)) != 0});
+		}
+		return out.size();
+	}
+
+  private:
+	struct Entry
+	{
+		SocketHandle mSocket    = INVALID_SOCKET_HANDLE;
+		uint64_t     mToken     = 0;
+		bool         mWantWrite = false;
+		bool         mUsed      = false;
+	};
+
+	std::vector<Entry> mEntries;
+#ifdef _WIN32
+	std::vector<WSAPOLLFD> mFds;
+#else
+	std::vector<pollfd> mFds;
+#endif
+	std::vector<uint64_t> mTokens;
+};
+#endif
+} // namespace
+
+// =============================================================================
+// English: Worker - one thread, one poller, a share of the connections
+// 한글: Worker - 스레드 하나, poller 하나, 연결 일부를 담당
+// =============================================================================
+
+struct LoadGenerator::Worker
+{
+	enum class ConnState : uint8_t
+	{
+		Idle,        // English: No socket (waiting for maintainer) / 한글: 소켓 없음 (관리자 대기)
+		Connecting,  // English: connect() in progress / 한글: connect() 진행 중
+		Handshake,   // English: SessionConnectReq sent / 한글: SessionConnectReq 송신됨
+		Active,      // English: Ready for requests / 한글: 요청 가능
+	};
+
+	struct Connection
+	{
+		SocketHandle mSocket     = INVALID_SOCKET_HANDLE;
+		ConnState    mState      = ConnState::Idle;
+		uint32_t     mGeneration = 0;
+		uint32_t     mSequence   = 0;
+		uint32_t     mInflight   = 0;
+		uint64_t     mDeadlineNs = 0;  // English: Connecting/Handshake deadline / 한글: 연결·핸드셰이크 제한 시각
+		uint64_t     mRetryAtNs  = 0;  // English: Idle: earliest reopen time / 한글: Idle: 재연결 가능 시각
+		uint64_t     mIssuedTotal = 0; // English: Requests sent from this slot (kept across reopen) / 한글: 이 슬롯의 누적 송신 요청 (재연결해도 유지)
+		bool         mWantWrite  = false;
+
+		std::vector<char>     mRecvPending;  // English: Partial packet carried between reads / 한글: 읽기 사이에 남은 부분 패킷
+		std::vector<char>     mSendPending;  // English: Unsent bytes (EAGAIN) / 한글: 미송신 바이트 (EAGAIN)
+		std::vector<uint64_t> mSentNs;       // English: Actual send time by sequence & mask / 한글: 시퀀스별 실제 송신 시각
+	};
+
+	const LoadOptions       &mOptions;
+	const sockaddr_storage  &mAddress;
+	int                      mAddressLen;
+	const std::atomic<bool> &mStop;
+	uint32_t                 mIndex;
+	uint32_t                 mTargetConnections;
+	double                   mRate;         // English: This worker's share (req/s) / 한글: 이 워커 몫 (req/s)
+	double                   mChurnPerSec;  // English: This worker's share / 한글: 이 워커 몫
+	uint64_t                 mStartNs;
+
+	Poller                  mPoller;
+	std::vector<Connection> mConnections;
+	std::vector<PollEvent>  mEvents;
+	std::vector<char>       mScratch;
+	std::vector<char>       mRequest;  // English: Padded request (--payload), empty = plain PingReq / 한글: 채운 요청 (--payload), 비면 PingReq 그대로
+	std::deque<uint64_t>    mBacklog;  // English: Intended send times waiting for a free slot (FIFO) / 한글: 가용 슬롯을 기다리는 의도 송신 시각 (FIFO)
+	std::mt19937            mRandom;
+	uint32_t                mRingMask      = 0;
+	uint32_t                mOpenCount     = 0;  // English: Non-Idle slots / 한글: Idle이 아닌 슬롯
+	uint32_t                mActiveCount   = 0;
+	uint32_t                mCursor        = 0;
+	uint64_t                mWarmupEndNs   = 0;
+	uint64_t                mLoopEndNs     = 0;
+	bool                    mIssuing       = true;
+
+	LoadReport mReport;
+
+	Worker(const LoadOptions &options, const sockaddr_storage &address, int addressLen,
+	       const std::atomic<bool> &stop, uint32_t index, uint64_t startNs)
+		: mOptions(options), mAddress(address), mAddressLen(addressLen), mStop(stop), mIndex(index),
+		  mStartNs(startNs), mScratch(kScratchSize), mRandom(0x9E3779B9u + index)
+	{
+		const uint32_t threads = options.mThreads;
+		mTargetConnections = options.mConnections / threads + (index < options.mConnections % threads ? 1 : 0);
+		mRate        = options.mRate / threads;
+		mChurnPerSec = options.mChurnPerSec / threads;
+		mConnections.resize(mTargetConnections);
+
+		// English: Closed loop needs one ring entry; open loop is capped by mMaxInflight
+		// 한글: closed loop는 1칸, open loop는 mMaxInflight가 상한
+		const uint32_t ringSize = NextPowerOfTwo(mRate > 0.0 ? (std::max)(options.mMaxInflight, 1u) : 1u);
+		mRingMask = ringSize - 1;
+		for (Connection &conn : mConnections)
+		{
+			conn.mSentNs.assign(ringSize, 0);
+		}
+		if (options.mRequestBytes > sizeof(PKT_PingReq))
+		{
+			mRequest.assign(options.mRequestBytes, 'x');
+		}
+	}
+
+	// English: Fraction of the ramp-up completed at now (1.0 without ramp-up)
+	// 한글: now 시점의 ramp-up 진행률 (ramp-up 없으면 1.0)
+	double RampFactor(uint64_t now) const
+	{
+		if (mOptions.mRampUpSec == 0)
+			return 1.0;
+		const double elapsed = static_cast<double>(now - mStartNs) / 1e9;
+		return (std::min)(1.0, elapsed / mOptions.mRampUpSec);
+	}
+
+	void Run()
+	{
+		const uint64_t durationNs = static_cast<uint64_t>(mOptions.mDurationSec) * kNsPerSec;
+		const uint64_t endNs      = mStartNs + durationNs;
+		mWarmupEndNs = mStartNs + static_cast<uint64_t>(mOptions.mWarmupSec) * kNsPerSec;
+
+		const bool openLoop = mRate > 0.0;
+		uint64_t nextSendNs     = mStartNs;
+		uint64_t nextMaintainNs = mStartNs;
+		const uint64_t churnIntervalNs =
+			mChurnPerSec > 0.0 ? static_cast<uint64_t>(1e9 / mChurnPerSec) : 0;
+		uint64_t nextChurnNs = mStartNs + churnIntervalNs;
+
+		uint64_t now = Timer::GetMonotonicNs();
+		while (!mStop.load(std::memory_order_relaxed) && now < endNs)
+		{
+			if (now >= nextMaintainNs)
+			{
+				if (mOptions.mRequestsPerConnection != 0 && QuotaDone())
+					break;
+				MaintainConnections(now);
+				nextMaintainNs = now + kMaintainIntervalNs;
+			}
+
+			// English: Issue every request whose intended time has passed — the schedule never
+			//          waits for responses, and lateness shows up in the corrected latency.
+			// 한글: 의도 시각이 지난 요청을 모두 발행 — 일정은 응답을 기다리지 않으며,
+			//       지연 발행은 보정 지연에 그대로 반영된다.
+			if (openLoop)
+			{
+				DrainBacklog(now);
+				while (nextSendNs <= now)
+				{
+					IssueScheduled(nextSendNs, now);
+					const double rate = mRate * (std::max)(0.01, RampFactor(nextSendNs));
+					nextSendNs += static_cast<uint64_t>(1e9 / rate);
+				}
+			}
+
+			if (churnIntervalNs != 0 && now >= nextChurnNs)
+			{
+				ChurnOne();
+				nextChurnNs += churnIntervalNs;
+			}
+
+			int timeoutMs = static_cast<int>((std::min)(nextMaintainNs, endNs) > now
+			                                     ? ((std::min)(nextMaintainNs, endNs) - now) / 1000000
+			                                     : 0);
+			if (openLoop)
+			{
+				const uint64_t untilSend = nextSendNs > now ? nextSendNs - now : 0;
+				timeoutMs = (std::min)(timeoutMs, static_cast<int>(untilSend / 1000000));
+			}
+			if (!mBacklog.empty())
+			{
+				timeoutMs = (std::min)(timeoutMs, 1);  // English: Retry the backlog promptly / 한글: 대기열 재시도를 늦추지 않는다
+			}
+			Poll(timeoutMs);
+			now = Timer::GetMonotonicNs();
+		}
+		mLoopEndNs = now;
+
+		// English: Never sent within the run — no latency sample exists for these
+		// 한글: 실행 중 끝내 보내지 못한 요청 — 지연 샘플이 없다
+		mReport.mMissed += mBacklog.size();
+		mBacklog.clear();
+
+		// English: Stop issuing; give outstanding requests a bounded time to complete
+		// 한글: 발행 중단 후 진행 중 요청이 끝나기를 제한 시간 동안 기다린다
+		mIssuing = false;
+		const uint64_t drainEndNs = now + kDrainTimeoutNs;
+		while (InflightTotal() > 0 && Timer::GetMonotonicNs() < drainEndNs)
+		{
+			Poll(10);
+		}
+
+		for (uint32_t slot = 0; slot < mConnections.size(); ++slot)
+		{
+			if (mConnections[slot].mState != ConnState::Idle)
+			{
+				CloseSlot(slot);
+			}
+		}
+	}
+
+	// English: --pings quota: a slot is finished once it sent its share and nothing is in flight
+	// 한글: --pings 할당량: 몫을 다 보내고 진행 중 요청이 없으면 슬롯 완료
+	bool HasQuota(const Connection &conn) const
+	{
+		return mOptions.mRequestsPerConnection == 0 || conn.mIssuedTotal < mOptions.mRequestsPerConnection;
+	}
+
+	bool QuotaDone() const
+	{
+		for (const Connection &conn : mConnections)
+		{
+			if (HasQuota(conn) || conn.mInflight != 0)
+				return false;
+		}
+		return true;
+	}
+
+	uint64_t InflightTotal() const
+	{
+		uint64_t total = 0;
+		for (const Connection &conn : mConnections)
+		{
+			total += conn.mInflight;
+		}
+		return total;
+	}
+
+	// =========================================================================
+	// English: Connection lifecycle
+	// 한글: 연결 수명 주기
+	// =========================================================================
+
+	void MaintainConnections(uint64_t now)
+	{
+		const uint32_t target = (std::max)(1u, static_cast<uint32_t>(
+			std::ceil(mTargetConnections * RampFactor(now))));
+		uint32_t opened = 0;
+
+		for (uint32_t slot = 0; slot < mConnections.size(); ++slot)
+		{
+			Connection &conn = mConnections[slot];
+			if ((conn.mState == ConnState::Connecting || conn.mState == ConnState::Handshake) &&
+			    now >= conn.mDeadlineNs)
+			{
+				++mReport.mConnectFailures;
+				CloseSlot(slot);
+				conn.mRetryAtNs = now + kRetryDelayNs;
+			}
+			else if (conn.mState == ConnState::Idle && mIssuing && HasQuota(conn) && mOpenCount < target &&
+			         opened < kOpensPerPass && now >= conn.mRetryAtNs)
+			{
+				OpenSlot(slot, now);
+				++opened;
+			}
+		}
+	}
+
+	void OpenSlot(uint32_t slot, uint64_t now)
+	{
+		Connection &conn = mConnections[slot];
+		++mReport.mConnectAttempts;
+
+		SocketHandle s = socket(mAddress.ss_family, SOCK_STREAM, IPPROTO_TCP);
+		if (s == INVALID_SOCKET_HANDLE)
+		{
+			++mReport.mConnectFailures;
+			conn.mRetryAtNs = now + kRetryDelayNs;
+			return;
+		}
+		PlatformSetNonBlocking(s);
+		PlatformSetTcpNoDelay(s, true);
+
+		const int ret = connect(s, reinterpret_cast<const sockaddr *>(&mAddress), mAddressLen);
+		if (ret == SOCKET_ERROR_VALUE && !IsConnectInProgress(PlatformGetLastError()))
+		{
+			++mReport.mConnectFailures;
+			PlatformCloseSocket(s);
+			conn.mRetryAtNs = now + kRetryDelayNs;
+			return;
+		}
+
+		conn.mSocket     = s;
+		conn.mState      = ConnState::Connecting;
+		conn.mGeneration += 1;
+		conn.mSequence   = 0;
+		conn.mInflight   = 0;
+		conn.mDeadlineNs = now + kConnectTimeoutNs;
+		conn.mWantWrite  = true;
+		conn.mRecvPending.clear();
+		conn.mSendPending.clear();
+		++mOpenCount;
+
+		// English: Completion (or failure) of connect() is reported as writability
+		// 한글: connect() 완료(또는 실패)는 쓰기 가능 이벤트로 알려진다
+		mPoller.Add(s, slot, MakeToken(slot, conn.mGeneration), true);
+	}
+
+	void CloseSlot(uint32_t slot)
+	{
+		Connection &conn = mConnections[slot];
+		mPoller.Remove(conn.mSocket, slot);
+		PlatformCloseSocket(conn.mSocket);
+		if (conn.mState == ConnState::Active)
+		{
+			--mActiveCount;
+		}
+		mReport.mLost += conn.mInflight;
+		conn.mSocket   = INVALID_SOCKET_HANDLE;
+		conn.mState    = ConnState::Idle;
+		conn.mInflight = 0;
+		conn.mGeneration += 1;  // English: Invalidate queued events / 한글: 대기 중 이벤트 무효화
+		--mOpenCount;
+	}
+
+	// English: Socket-level failure: classify by state, then close
+	// 한글: 소켓 수준 실패: 상태별로 분류 후 닫기
+	void FailSlot(uint32_t slot)
+	{
+		Connection &conn = mConnections[slot];
+		if (conn.mState == ConnState::Active)
+			++mReport.mDisconnects;
+		else
+			++mReport.mConnectFailures;
+		CloseSlot(slot);
+		conn.mRetryAtNs = Timer::GetMonotonicNs() + kRetryDelayNs;
+	}
+
+	void ChurnOne()
+	{
+		if (mActiveCount == 0)
+			return;
+		// English: Uniform pick among active connections (scan from a random slot)
+		// 한글: 활성 연결 중 무작위 선택 (무작위 슬롯부터 탐색)
+		const uint32_t size = static_cast<uint32_t>(mConnections.size());
+		const uint32_t start = static_cast<uint32_t>(mRandom() % size);
+		for (uint32_t i = 0; i < size; ++i)
+		{
+			const uint32_t slot = (start + i) % size;
+			if (mConnections[slot].mState == ConnState::Active)
+			{
+				++mReport.mChurnCloses;
+				CloseSlot(slot);
+				return;
+			}
+		}
+	}
+
+	// =========================================================================
+	// English: Send path
+	// 한글: 송신 경로
+	// =========================================================================
+
+	// English: Send or buffer; false if the connection failed
+	// 한글: 송신 또는 버퍼링; 연결이 실패했으면 false
+	bool SendBytes(uint32_t slot, const char *data, size_t size)
+	{
+		Connection &conn = mConnections[slot];
+		size_t offset = 0;
+		if (conn.mSendPending.empty())
+		{
+			while (offset < size)
+			{
+				const int sent = static_cast<int>(
+					send(conn.mSocket, data + offset, static_cast<int>(size - offset), kSendFlags));
+				if (sent > 0)
+				{
+					offset += static_cast<size_t>(sent);
+					continue;
+				}
+				if (sent == SOCKET_ERROR_VALUE && IsTimeoutOrWouldBlock(PlatformGetLastError()))
+					break;
+				FailSlot(slot);
+				return false;
+			}
+		}
+		mReport.mBytesSent += offset;
+		if (offset < size)
+		{
+			conn.mSendPending.insert(conn.mSendPending.end(), data + offset, data + size);
+			if (!conn.mWantWrite)
+			{
+				conn.mWantWrite = true;
+				mPoller.Modify(conn.mSocket, slot, MakeToken(slot, conn.mGeneration), true);
+			}
+		}
+		return true;
+	}
+
+	void FlushPending(uint32_t slot)
+	{
+		Connection &conn = mConnections[slot];
+		size_t offset = 0;
+		while (offset < conn.mSendPending.size())
+		{
+			const int sent = static_cast<int>(send(conn.mSocket, conn.mSendPending.data() + offset,
+			                                       static_cast<int>(conn.mSendPending.size() - offset),
+			                                       kSendFlags));
+			if (sent > 0)
+			{
+				offset += static_cast<size_t>(sent);
+				continue;
+			}
+			if (sent == SOCKET_ERROR_VALUE && IsTimeoutOrWouldBlock(PlatformGetLastError()))
+				break;
+			FailSlot(slot);
+			return;
+		}
+		mReport.mBytesSent += offset;
+		conn.mSendPending.erase(conn.mSendPending.begin(),
+		                        conn.mSendPending.begin() + static_cast<std::ptrdiff_t>(offset));
+		if (conn.mSendPending.empty())
+		{
+			conn.mWantWrite = false;
+			mPoller.Modify(conn.mSocket, slot, MakeToken(slot, conn.mGeneration), false);
+		}
+	}
+
+	void SendPing(uint32_t slot, uint64_t intendedNs, uint64_t now)
+	{
+		Connection &conn = mConnections[slot];
+		PKT_PingReq packet;
+		packet.clientTime = intendedNs;  // English: Echoed in PKT_PongRes / 한글: PKT_PongRes로 에코됨
+		packet.sequence   = conn.mSequence++;
+		conn.mSentNs[packet.sequence & mRingMask] = now;
+		++conn.mInflight;
+		++conn.mIssuedTotal;
+		++mReport.mRequestsSent;
+		if (mRequest.empty())
+		{
+			SendBytes(slot, reinterpret_cast<const char *>(&packet), sizeof(packet));
+			return;
+		}
+
+		// English: --payload: PingReq followed by filler; the server ignores bytes past sizeof(PKT_PingReq)
+		// 한글: --payload: PingReq 뒤에 채움 바이트 — 서버는 sizeof(PKT_PingReq) 이후를 무시한다
+		packet.header.size = static_cast<uint16_t>(mRequest.size());
+		std::memcpy(mRequest.data(), &packet, sizeof(packet));
+		SendBytes(slot, mRequest.data(), mRequest.size());
+	}
+
+	// English: Next connection that can take a request (round robin), or kNoSlot
+	// 한글: 요청을 받을 수 있는 다음 연결 (라운드 로빈), 없으면 kNoSlot
+	static constexpr uint32_t kNoSlot = UINT32_MAX;
+
+	uint32_t FindSendSlot()
+	{
+		const uint32_t size = static_cast<uint32_t>(mConnections.size());
+		if (mActiveCount == 0)
+			return kNoSlot;
+		for (uint32_t i = 0; i < size; ++i)
+		{
+			const uint32_t slot = mCursor;
+			mCursor = (mCursor + 1) % size;
+			const Connection &conn = mConnections[slot];
+			if (conn.mState == ConnState::Active && conn.mInflight < mOptions.mMaxInflight && HasQuota(conn))
+				return slot;
+		}
+		return kNoSlot;
+	}
+
+	// English: Open loop: hand one scheduled request to the next available connection.
+	//          With none free it joins the backlog (behind older deferred requests) —
+	//          dropping it would discard exactly the slow samples CO correction keeps.
+	// 한글: Open loop: 예정된 요청 하나를 다음 가용 연결에 배정. 가용 연결이 없으면
+	//       (앞선 지연 요청 뒤에) 대기열에 넣는다 — 버리면 CO 보정이 지키려는 느린 샘플이 사라진다.
+	void IssueScheduled(uint64_t intendedNs, uint64_t now)
+	{
+		if (mBacklog.empty())
+		{
+			const uint32_t slot = FindSendSlot();
+			if (slot != kNoSlot)
+			{
+				SendPing(slot, intendedNs, now);
+				return;
+			}
+		}
+		if (mBacklog.size() >= kMaxBacklog)
+		{
+			++mReport.mMissed;
+			return;
+		}
+		mBacklog.push_back(intendedNs);
+	}
+
+	// English: Send deferred requests while slots are free; latency still counts from intendedNs
+	// 한글: 가용 슬롯이 있는 동안 지연 요청 송신 — 지연은 여전히 intendedNs부터 잰다
+	void DrainBacklog(uint64_t now)
+	{
+		while (!mBacklog.empty())
+		{
+			const uint32_t slot = FindSendSlot();
+			if (slot == kNoSlot)
+				return;
+			SendPing(slot, mBacklog.front(), now);
+			mBacklog.pop_front();
+			++mReport.mDeferred;
+		}
+	}
+
+	// =========================================================================
+	// English: Event handling
+	// 한글: 이벤트 처리
+	// =========================================================================
+
+	void Poll(int timeoutMs)
+	{
+		mPoller.Wait((std::max)(timeoutMs, 0), mEvents);
+		for (const PollEvent &event : mEvents)
+		{
+			const uint32_t slot       = static_cast<uint32_t>(event.mToken & 0xFFFFFFFFu);
+			const uint32_t generation = static_cast<uint32_t>(event.mToken >> 32);
+			if (slot >= mConnections.size() || mConnections[slot].mGeneration != generation ||
+			    mConnections[slot].mState == ConnState::Idle)
+			{
+				continue;
+			}
+
+			Connection &conn = mConnections[slot];
+			if (conn.mState == ConnState::Connecting)
+			{
+				if (event.mWritable || event.mError)
+					CompleteConnect(slot);
+				continue;
+			}
+			if (event.mReadable || event.mError)
+			{
+				if (!ReadSlot(slot))
+					continue;
+			}
+			if (event.mWritable && conn.mGeneration == generation && !conn.mSendPending.empty())
+			{
+				FlushPending(slot);
+			}
+		}
+	}
+
+	void CompleteConnect(uint32_t slot)
+	{
+		Connection &conn = mConnections[slot];
+		if (PlatformGetSocketError(conn.mSocket) != 0)
+		{
+			FailSlot(slot);
+			return;
+		}
+		conn.mState     = ConnState::Handshake;
+		conn.mWantWrite = false;
+		mPoller.Modify(conn.mSocket, slot, MakeToken(slot, conn.mGeneration), false);
+
+		PKT_SessionConnectReq request;
+		request.clientVersion = 1;
+		SendBytes(slot, reinterpret_cast<const char *>(&request), sizeof(request));
+	}
+
+	// English: Drain the socket and dispatch complete packets; false if the slot was closed
+	// 한글: 소켓을 비우고 완성된 패킷을 처리; 슬롯이 닫혔으면 false
+	bool ReadSlot(uint32_t slot)
+	{
+		Connection &conn = mConnections[slot];
+		const uint32_t generation = conn.mGeneration;
+		for (;;)
+		{
+			const int received = static_cast<int>(
+				recv(conn.mSocket, mScratch.data(), static_cast<int>(mScratch.size()), 0));
+			if (received == 0)
+			{
+				FailSlot(slot);
+				return false;
+			}
+			if (received < 0)
+			{
+				if (IsTimeoutOrWouldBlock(PlatformGetLastError()))
+					return true;
+				FailSlot(slot);
+				return false;
+			}
+			mReport.mBytesReceived += static_cast<uint64_t>(received);
+
+			// English: Parse in place when nothing is carried over (common case)
+			// 한글: 이월 데이터가 없으면 제자리에서 파싱 (일반적인 경우)
+			const char *data = mScratch.data();
+			size_t size = static_cast<size_t>(received);
+			if (!conn.mRecvPending.empty())
+			{
+				conn.mRecvPending.insert(conn.mRecvPending.end(), data, data + size);
+				data = conn.mRecvPending.data();
+				size = conn.mRecvPending.size();
+			}
+
+			size_t offset = 0;
+			while (size - offset >= sizeof(PacketHeader))
+			{
+				PacketHeader header;
+				std::memcpy(&header, data + offset, sizeof(header));
+				if (header.size < sizeof(PacketHeader) || header.size > MAX_PACKET_SIZE)
+				{
+					Logger::Warn("LoadGenerator: invalid packet size {} - closing connection", header.size);
+					FailSlot(slot);
+					return false;
+				}
+				if (size - offset < header.size)
+					break;
+				HandlePacket(slot, header, data + offset);
+				if (conn.mGeneration != generation)
+					return false;  // English: Closed by handler / 한글: 핸들러에서 닫힘
+				offset += header.size;
+			}
+
+			if (data == mScratch.data())
+			{
+				conn.mRecvPending.assign(data + offset, data + size);
+			}
+			else
+			{
+				conn.mRecvPending.erase(conn.mRecvPending.begin(),
+				                        conn.mRecvPending.begin() + static_cast<std::ptrdiff_t>(offset));
+			}
+		}
+	}
+
+	void HandlePacket(uint32_t slot, const PacketHeader &header, const char *data)
+	{
+		Connection &conn = mConnections[slot];
+		const uint64_t now = Timer::GetMonotonicNs();
+
+		switch (static_cast<PacketType>(header.id))
+		{
+		case PacketType::SessionConnectRes:
+		{
+			if (conn.mState != ConnState::Handshake || header.size < sizeof(PKT_SessionConnectRes))
+				return;
+			PKT_SessionConnectRes response;
+			std::memcpy(&response, data, sizeof(response));
+			if (response.result != static_cast<uint8_t>(ConnectResult::Success))
+			{
+				FailSlot(slot);
+				return;
+			}
+			conn.mState = ConnState::Active;
+			++mActiveCount;
+			++mReport.mSessions;
+			mReport.mPeakConnections = (std::max)(mReport.mPeakConnections, static_cast<uint64_t>(mActiveCount));
+			if (mRate <= 0.0 && mIssuing && HasQuota(conn))
+			{
+				SendPing(slot, now, now);
+			}
+			return;
+		}
+		case PacketType::PongRes:
+		{
+			if (conn.mState != ConnState::Active || header.size < sizeof(PKT_PongRes) || conn.mInflight == 0)
+				return;
+			PKT_PongRes response;
+			std::memcpy(&response, data, sizeof(response));
+			--conn.mInflight;
+			++mReport.mResponses;
+
+			const uint64_t intendedNs = response.clientTime;
+			const uint64_t sentNs     = conn.mSentNs[response.sequence & mRingMask];
+			if (intendedNs >= mWarmupEndNs && intendedNs <= now)
+			{
+				mReport.mCorrected.Record(now - intendedNs);
+				mReport.mUncorrected.Record(now >= sentNs ? now - sentNs : 0);
+			}
+			if (mRate <= 0.0 && mIssuing && HasQuota(conn))
+			{
+				SendPing(slot, now, now);
+			}
+			return;
+		}
+		default:
+			return;
+		}
+	}
+};
+
+// =============================================================================
+// English: LoadGenerator
+// 한글: LoadGenerator
+// =============================================================================
+
+LoadGenerator::LoadGenerator(const LoadOptions &options) : mOptions(options)
+{
+	mOptions.mThreads     = (std::max)(1u, (std::min)(mOptions.mThreads, (std::max)(1u, mOptions.mConnections)));
+	mOptions.mMaxInflight = (std::max)(1u, mOptions.mMaxInflight);
+	mOptions.mWarmupSec   = (std::min)(mOptions.mWarmupSec, mOptions.mDurationSec);
+	if (mOptions.mRequestBytes != 0)
+	{
+		mOptions.mRequestBytes = (std::max)(static_cast<uint32_t>(sizeof(PKT_PingReq)),
+		                                    (std::min)(mOptions.mRequestBytes, MAX_PACKET_TOTAL_SIZE));
+	}
+}
+
+LoadGenerator::~LoadGenerator() = default;
+
+void LoadGenerator::RequestStop()
+{
+	mStopRequested.store(true, std::memory_order_relaxed);
+}
+
+bool LoadGenerator::Run()
+{
+	if (mOptions.mConnections == 0 || mOptions.mDurationSec == 0)
+	{
+		Logger::Error("LoadGenerator: connections and duration must be > 0");
+		return false;
+	}
+
+	struct addrinfo hints = {};
+	hints.ai_family   = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	hints.ai_protocol = IPPROTO_TCP;
+	struct addrinfo *addrResult = nullptr;
+	const std::string portStr = std::to_string(mOptions.mPort);
+	if (getaddrinfo(mOptions.mHost.c_str(), portStr.c_str(), &hints, &addrResult) != 0 || !addrResult)
+	{
+		Logger::Error("LoadGenerator: cannot resolve {}:{}", mOptions.mHost, mOptions.mPort);
+		return false;
+	}
+	sockaddr_storage address{};
+	std::memcpy(&address, addrResult->ai_addr, addrResult->ai_addrlen);
+	const int addressLen = static_cast<int>(addrResult->ai_addrlen);
+	freeaddrinfo(addrResult);
+
+#ifndef _WIN32
+	std::signal(SIGPIPE, SIG_IGN);
+	RaiseFileLimit(mOptions.mConnections);
+#endif
+
+	Logger::Info("LoadGenerator: {} connections on {} thread(s) -> {}:{}, {} for {}s "
+	             "(ramp-up {}s, warm-up {}s, churn {}/s)",
+	             mOptions.mConnections, mOptions.mThreads, mOptions.mHost, mOptions.mPort,
+	             mOptions.mRate > 0.0 ? std::to_string(static_cast<uint64_t>(mOptions.mRate)) + " req/s"
+	                                  : std::string("closed loop"),
+	             mOptions.mDurationSec, mOptions.mRampUpSec, mOptions.mWarmupSec, mOptions.mChurnPerSec);
+
+	const uint64_t startNs = Timer::GetMonotonicNs();
+	std::vector<std::unique_ptr<Worker>> workers;
+	workers.reserve(mOptions.mThreads);
+	for (uint32_t i = 0; i < mOptions.mThreads; ++i)
+	{
+		workers.push_back(std::make_unique<Worker>(mOptions, address, addressLen, mStopRequested, i, startNs));
+		if (!workers.back()->mPoller.IsValid())
+		{
+			Logger::Error("LoadGenerator: poller creation failed");
+			return false;
+		}
+	}
+
+	std::vector<std::thread> threads;
+	threads.reserve(workers.size());
+	for (auto &worker : workers)
+	{
+		threads.emplace_back([&worker]() { worker->Run(); });
+	}
+	for (auto &thread : threads)
+	{
+		thread.join();
+	}
+
+	// English: Merge per-thread results (peak connections is the sum of per-thread peaks)
+	// 한글: 스레드별 결과 병합 (최대 연결 수는 스레드별 최대치의 합)
+	mReport = LoadReport();
+	uint64_t loopEndNs = startNs;
+	for (const auto &worker : workers)
+	{
+		const LoadReport &r = worker->mReport;
+		mReport.mConnectAttempts += r.mConnectAttempts;
+		mReport.mConnectFailures += r.mConnectFailures;
+		mReport.mSessions        += r.mSessions;
+		mReport.mDisconnects     += r.mDisconnects;
+		mReport.mChurnCloses     += r.mChurnCloses;
+		mReport.mPeakConnections += r.mPeakConnections;
+		mReport.mRequestsSent    += r.mRequestsSent;
+		mReport.mResponses       += r.mResponses;
+		mReport.mDeferred        += r.mDeferred;
+		mReport.mMissed          += r.mMissed;
+		mReport.mLost            += r.mLost;
+		mReport.mBytesSent       += r.mBytesSent;
+		mReport.mBytesReceived   += r.mBytesReceived;
+		mReport.mCorrected.Merge(r.mCorrected);
+		mReport.mUncorrected.Merge(r.mUncorrected);
+		loopEndNs = (std::max)(loopEndNs, worker->mLoopEndNs);
+	}
+	const uint64_t warmupEndNs = startNs + static_cast<uint64_t>(mOptions.mWarmupSec) * kNsPerSec;
+	mReport.mMeasuredSec = loopEndNs > warmupEndNs ? static_cast<double>(loopEndNs - warmupEndNs) / 1e9 : 0.0;
+	return true;
+}
+
+// =============================================================================
+// English: Reporting
+// 한글: 결과 보고
+// =============================================================================
+
+namespace
+{
+double ToUs(uint64_t ns)
+{
+	return static_cast<double>(ns) / 1000.0;
+}
+
+void PrintLatencyRow(std::ostream &out, const char *label, const LatencyHistogram &h)
+{
+	out << "  " << std::left << std::setw(12) << label << std::right << std::fixed << std::setprecision(1)
+	    << std::setw(10) << ToUs(h.Percentile(0.50)) << std::setw(10) << ToUs(h.Percentile(0.90))
+	    << std::setw(10) << ToUs(h.Percentile(0.99)) << std::setw(10) << ToUs(h.Percentile(0.999))
+	    << std::setw(11) << ToUs(h.Max()) << std::setw(10) << ToUs(h.Mean()) << std::endl;
+}
+
+void WriteLatencyJson(std::ostream &out, const LatencyHistogram &h)
+{
+	out << "{\"count\": " << h.Count() << std::fixed << std::setprecision(1)
+	    << ", \"p50\": " << ToUs(h.Percentile(0.50)) << ", \"p90\": " << ToUs(h.Percentile(0.90))
+	    << ", \"p99\": " << ToUs(h.Percentile(0.99)) << ", \"p999\": " << ToUs(h.Percentile(0.999))
+	    << ", \"max\": " << ToUs(h.Max()) << ", \"mean\": " << ToUs(h.Mean()) << "}";
+}
+} // namespace
+
+void LoadGenerator::PrintSummary(std::ostream &out) const
+{
+	const LoadReport &r = mReport;
+	const double throughput = r.mMeasuredSec > 0.0 ? static_cast<double>(r.mCorrected.Count()) / r.mMeasuredSec : 0.0;
+
+	out << std::endl;
+	out << "--- Load Summary ---" << std::endl;
+	out << "  Connections : " << mOptions.mConnections << " target, " << r.mPeakConnections << " peak, "
+	    << r.mSessions << " sessions, " << r.mConnectFailures << " failed, " << r.mDisconnects
+	    << " dropped, " << r.mChurnCloses << " churned" << std::endl;
+	out << "  Requests    : " << r.mRequestsSent << " sent, " << r.mResponses << " recv, " << r.mDeferred
+	    << " deferred, " << r.mMissed << " missed, " << r.mLost << " lost" << std::endl;
+	out << "  Measured    : " << r.mCorrected.Count() << " in " << std::fixed << std::setprecision(2)
+	    << r.mMeasuredSec << "s = " << std::setprecision(0) << throughput << " req/s";
+	if (mOptions.mRate > 0.0)
+		out << " (target " << mOptions.mRate << ")";
+	out << std::endl;
+	out << "  Latency (us)      p50       p90       p99     p99.9        max      mean" << std::endl;
+	PrintLatencyRow(out, "corrected", r.mCorrected);
+	PrintLatencyRow(out, "uncorrected", r.mUncorrected);
+	out << "--------------------" << std::endl;
+	out.unsetf(std::ios::floatfield);
+}
+
+void LoadGenerator::WriteJson(std::ostream &out) const
+{
+	const LoadReport &r = mReport;
+	const double throughput = r.mMeasuredSec > 0.0 ? static_cast<double>(r.mCorrected.Count()) / r.mMeasuredSec : 0.0;
+
+	out << std::fixed << std::setprecision(1);
+	out << "{\n";
+	out << "  \"config\": {\"host\": \"" << mOptions.mHost << "\", \"port\": " << mOptions.mPort
+	    << ", \"connections\": " << mOptions.mConnections << ", \"threads\": " << mOptions.mThreads
+	    << ", \"rate\": " << mOptions.mRate << ", \"duration_sec\": " << mOptions.mDurationSec
+	    << ", \"ramp_up_sec\": " << mOptions.mRampUpSec << ", \"warmup_sec\": " << mOptions.mWarmupSec
+	    << ", \"churn_per_sec\": " << mOptions.mChurnPerSec << ", \"max_inflight\": " << mOptions.mMaxInflight
+	    << ", \"request_bytes\": "
+	    << (mOptions.mRequestBytes ? mOptions.mRequestBytes : static_cast<uint32_t>(sizeof(PKT_PingReq)))
+	    << ", \"requests_per_connection\": " << mOptions.mRequestsPerConnection
+	    << "},\n";
+	out << "  \"connections\": {\"attempts\": " << r.mConnectAttempts << ", \"failures\": " << r.mConnectFailures
+	    << ", \"sessions\": " << r.mSessions << ", \"peak\": " << r.mPeakConnections
+	    << ", \"disconnects\": " << r.mDisconnects << ", \"churn_closes\": " << r.mChurnCloses << "},\n";
+	out << "  \"requests\": {\"sent\": " << r.mRequestsSent << ", \"responses\": " << r.mResponses
+	    << ", \"deferred\": " << r.mDeferred << ", \"missed\": " << r.mMissed << ", \"lost\": " << r.mLost << ", \"bytes_sent\": " << r.mBytesSent
+	    << ", \"bytes_received\": " << r.mBytesReceived << "},\n";
+	out << std::fixed << std::setprecision(3);
+	out << "  \"measured_sec\": " << r.mMeasuredSec << ",\n";
+	out << "  \"throughput_rps\": " << throughput << ",\n";
+	out << "  \"latency_us\": {\n    \"corrected\": ";
+	WriteLatencyJson(out, r.mCorrected);
+	out << ",\n    \"uncorrected\": ";
+	WriteLatencyJson(out, r.mUncorrected);
+	out << "\n  }\n}\n";
+	out.unsetf(std::ios::floatfield);
+}
+
+bool LoadGenerator::WriteJson(const std::string &path) const
+{
+	if (path == "-")
+	{
+		WriteJson(std::cout);
+		return true;
+	}
+	std::ofstream file(path);
+	if (!file)
+	{
+		Logger::Error("LoadGenerator: cannot write JSON summary to {}", path);
+		return false;
+	}
+	WriteJson(file);
+	return static_cast<bool>(file);
+}
+
+} // namespace Network::TestClient
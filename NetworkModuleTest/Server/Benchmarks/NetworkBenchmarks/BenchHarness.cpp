@@ -0,0 +1,327 @@
+// 벤치마크 하네스 구현 — 반복 횟수 보정, 반복 측정, 표/JSON 출력
+
+#include "BenchHarness.h"
+#include "Utils/Timer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace Network::Bench
+{
+
+namespace
+{
+struct BenchCase
+{
+	std::string   mName;
+	BenchFunction mFunction;
+};
+
+std::vector<BenchCase> &Registry()
+{
+	static std::vector<BenchCase> sCases;
+	return sCases;
+}
+
+struct RunOptions
+{
+	std::string mFilter;
+	std::string mJsonPath;
+	double      mMinTimeSec  = 0.2;
+	uint32_t    mRepetitions = 5;
+	bool        mList        = false;
+};
+
+struct BenchResult
+{
+	std::string mName;
+	std::string mError;
+	uint64_t    mIterations = 0;
+	double      mNsPerOpMedian = 0.0;
+	double      mNsPerOpMin    = 0.0;
+	double      mNsPerOpMax    = 0.0;
+	double      mItemsPerSec   = 0.0;
+	double      mBytesPerSec   = 0.0;
+};
+
+// 함수 1회 실행 — 측정 구간(ns)과 상태 반환
+uint64_t RunOnce(const BenchCase &benchCase, BenchState &state)
+{
+	const uint64_t begin = Utils::Timer::GetMonotonicNs();
+	benchCase.mFunction(state);
+	const uint64_t end = Utils::Timer::GetMonotonicNs();
+	return state.UsedTimer() ? state.TimedNs() : end - begin;
+}
+
+BenchResult Run(const BenchCase &benchCase, const RunOptions &options)
+{
+	BenchResult result;
+	result.mName = benchCase.mName;
+
+	// 보정: 1회부터 시작해 한 번의 실행이 min-time을 넘을 때까지 늘린다.
+	const uint64_t minNs = static_cast<uint64_t>(options.mMinTimeSec * 1e9);
+	uint64_t iterations = 1;
+	for (;;)
+	{
+		BenchState state(iterations);
+		const uint64_t elapsed = RunOnce(benchCase, state);
+		if (!state.Error().empty())
+		{
+			result.mError = state.Error();
+			return result;
+		}
+		if (elapsed >= minNs || iterations >= 1000000000ull)
+		{
+			break;
+		}
+		const double scale = elapsed > 0 ? 1.4 * static_cast<double>(minNs) / static_cast<double>(elapsed) : 10.0;
+		iterations = (std::max)(iterations + 1,
+		                        static_cast<uint64_t>(static_cast<double>(iterations) * (std::min)(scale, 10.0)));
+	}
+
+	std::vector<double> nsPerOp;
+	std::vector<double> itemsPerSec;
+	std::vector<double> bytesPerSec;
+	for (uint32_t rep = 0; rep < options.mRepetitions; ++rep)
+	{
+		BenchState state(iterations);
+		const uint64_t elapsed = (std::max)(RunOnce(benchCase, state), uint64_t{1});
+		if (!state.Error().empty())
+		{
+			result.mError = state.Error();
+			return result;
+		}
+		nsPerOp.push_back(static_cast<double>(elapsed) / static_cast<double>(state.Items()));
+		itemsPerSec.push_back(static_cast<double>(state.Items()) * 1e9 / static_cast<double>(elapsed));
+		bytesPerSec.push_back(static_cast<double>(state.Bytes()) * 1e9 / static_cast<double>(elapsed));
+	}
+
+	auto median = [](std::vector<double> values)
+	{
+		std::sort(values.begin(), values.end());
+		const size_t mid = values.size() / 2;
+		return values.size() % 2 ? values[mid] : (values[mid - 1] + values[mid]) / 2.0;
+	};
+	result.mIterations    = iterations;
+	result.mNsPerOpMedian = median(nsPerOp);
+	result.mNsPerOpMin    = *std::min_element(nsPerOp.begin(), nsPerOp.end());
+	result.mNsPerOpMax    = *std::max_element(nsPerOp.begin(), nsPerOp.end());
+	result.mItemsPerSec   = median(itemsPerSec);
+	result.mBytesPerSec   = median(bytesPerSec);
+	return result;
+}
+
+std::string JsonEscape(const std::string &value)
+{
+	std::string out;
+	for (char c : value)
+	{
+		if (c == '"' || c == '\\')
+		{
+			out += '\\';
+			out += c;
+		}
+		else if (static_cast<unsigned char>(c) < 0x20)
+		{
+			char buffer[8];
+			std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+			out += buffer;
+		}
+		else
+		{
+			out += c;
+		}
+	}
+	return out;
+}
+
+std::string CompilerString()
+{
+#if defined(__clang__)
+	return "clang " __clang_version__;
+#elif defined(__GNUC__)
+	return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+	return "msvc " + std::to_string(_MSC_VER);
+#else
+	return "unknown";
+#endif
+}
+
+std::string UtcTimestamp()
+{
+	const std::time_t now = std::time(nullptr);
+	std::tm tm{};
+#if defined(_WIN32)
+	gmtime_s(&tm, &now);
+#else
+	gmtime_r(&now, &tm);
+#endif
+	char buffer[32];
+	std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &tm);
+	return buffer;
+}
+
+void WriteJson(std::ostream &out, const RunOptions &options, const std::vector<BenchResult> &results)
+{
+	out << "{\n";
+	out << "  \"suite\": \"NetworkBenchmarks\",\n";
+	out << "  \"context\": {\"timestamp\": \"" << UtcTimestamp() << "\", \"compiler\": \""
+	    << JsonEscape(CompilerString()) << "\", \"build\": \""
+#ifdef NDEBUG
+	    << "release"
+#else
+	    << "debug"
+#endif
+	    << "\", \"hardware_threads\": " << std::thread::hardware_concurrency()
+	    << ", \"min_time_sec\": " << options.mMinTimeSec << ", \"repetitions\": " << options.mRepetitions
+	    << "},\n";
+	out << "  \"benchmarks\": [";
+	out << std::fixed << std::setprecision(3);
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const BenchResult &r = results[i];
+		out << (i ? ",\n" : "\n") << "    {\"name\": \"" << JsonEscape(r.mName) << "\"";
+		if (!r.mError.empty())
+		{
+			out << ", \"error\": \"" << JsonEscape(r.mError) << "\"}";
+			continue;
+		}
+		out << ", \"iterations\": " << r.mIterations << ", \"ns_per_op\": " << r.mNsPerOpMedian
+		    << ", \"ns_per_op_min\": " << r.mNsPerOpMin << ", \"ns_per_op_max\": " << r.mNsPerOpMax
+		    << ", \"items_per_sec\": " << r.mItemsPerSec << ", \"bytes_per_sec\": " << r.mBytesPerSec << "}";
+	}
+	out << "\n  ]\n}\n";
+	out.unsetf(std::ios::floatfield);
+}
+
+void PrintUsage(const char *program)
+{
+	std::cout << "Usage: " << program << " [options]\n"
+	          << "  --filter <text>     Run cases whose name contains <text>\n"
+	          << "  --min-time <sec>    Minimum time per measured run (default: 0.2)\n"
+	          << "  --repetitions <n>   Measured runs per case; the median is reported (default: 5)\n"
+	          << "  --json <path|->     Write results as JSON to a file or stdout\n"
+	          << "  --list              List case names and exit\n";
+}
+} // namespace
+
+void BenchState::StartTimer()
+{
+	if (!mRunning)
+	{
+		mRunning   = true;
+		mTimerUsed = true;
+		mStartNs   = Utils::Timer::GetMonotonicNs();
+	}
+}
+
+void BenchState::StopTimer()
+{
+	if (mRunning)
+	{
+		mTimedNs += Utils::Timer::GetMonotonicNs() - mStartNs;
+		mRunning = false;
+	}
+}
+
+bool RegisterBenchmark(const std::string &name, BenchFunction function)
+{
+	Registry().push_back({name, std::move(function)});
+	return true;
+}
+
+int RunBenchmarks(int argc, char *argv[])
+{
+	RunOptions options;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		if (arg == "--filter" && i + 1 < argc)
+			options.mFilter = argv[++i];
+		else if (arg == "--min-time" && i + 1 < argc)
+			options.mMinTimeSec = std::stod(argv[++i]);
+		else if (arg == "--repetitions" && i + 1 < argc)
+			options.mRepetitions = (std::max)(1, std::stoi(argv[++i]));
+		else if (arg == "--json" && i + 1 < argc)
+			options.mJsonPath = argv[++i];
+		else if (arg == "--list")
+			options.mList = true;
+		else
+		{
+			PrintUsage(argv[0]);
+			return (arg == "-h" || arg == "--help") ? 0 : 1;
+		}
+	}
+
+	std::vector<const BenchCase *> selected;
+	for (const BenchCase &benchCase : Registry())
+	{
+		if (options.mFilter.empty() || benchCase.mName.find(options.mFilter) != std::string::npos)
+			selected.push_back(&benchCase);
+	}
+	std::sort(selected.begin(), selected.end(),
+	          [](const BenchCase *a, const BenchCase *b) { return a->mName < b->mName; });
+
+	if (options.mList)
+	{
+		for (const BenchCase *benchCase : selected)
+			std::cout << benchCase->mName << "\n";
+		return 0;
+	}
+
+	// JSON을 stdout으로 쓰면 표는 stderr로 보내 파이프 출력을 깨끗하게 유지한다.
+	std::ostream &table = options.mJsonPath == "-" ? std::cerr : std::cout;
+	table << std::left << std::setw(52) << "Benchmark" << std::right << std::setw(14) << "ns/op"
+	      << std::setw(14) << "min" << std::setw(14) << "max" << std::setw(16) << "items/s" << "\n";
+	table << std::string(110, '-') << "\n";
+
+	std::vector<BenchResult> results;
+	bool anyError = false;
+	for (const BenchCase *benchCase : selected)
+	{
+		const BenchResult result = Run(*benchCase, options);
+		table << std::left << std::setw(52) << result.mName << std::right;
+		if (!result.mError.empty())
+		{
+			table << "  ERROR: " << result.mError << "\n";
+			anyError = true;
+		}
+		else
+		{
+			table << std::fixed << std::setprecision(1) << std::setw(14) << result.mNsPerOpMedian << std::setw(14)
+			      << result.mNsPerOpMin << std::setw(14) << result.mNsPerOpMax << std::setprecision(0)
+			      << std::setw(16) << result.mItemsPerSec << "\n";
+			table.unsetf(std::ios::floatfield);
+		}
+		table.flush();
+		results.push_back(result);
+	}
+
+	if (!options.mJsonPath.empty())
+	{
+		if (options.mJsonPath == "-")
+		{
+			WriteJson(std::cout, options, results);
+		}
+		else
+		{
+			std::ofstream file(options.mJsonPath);
+			if (!file)
+			{
+				std::cerr << "Cannot write " << options.mJsonPath << "\n";
+				return 1;
+			}
+			WriteJson(file, options, results);
+		}
+	}
+	return anyError ? 1 : 0;
+}
+
+} // namespace Network::Bench
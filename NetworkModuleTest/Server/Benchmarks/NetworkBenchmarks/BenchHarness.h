@@ -0,0 +1,90 @@
+#pragma once
+
+// English: Minimal built-in microbenchmark harness for NetworkBenchmarks (no external dependency).
+// 한글: NetworkBenchmarks용 최소 내장 마이크로벤치마크 하네스 (외부 의존성 없음).
+//
+// 사용법:
+//   static const bool sRegistered = Network::Bench::RegisterBenchmark(
+//       "ExecutionQueue/TryPushPop", [](Network::Bench::BenchState &state)
+//       {
+//           ExecutionQueue<int> queue(...);              // 준비 (StartTimer 이전 — 측정 제외)
+//           state.StartTimer();
+//           for (uint64_t i = 0; i < state.Iterations(); ++i) { ... }
+//           state.StopTimer();
+//       });
+//
+// 측정:
+//   - 반복 횟수는 한 번의 실행이 --min-time 이상 걸리도록 보정한 뒤 --repetitions회 반복한다.
+//   - StartTimer/StopTimer를 호출하지 않으면 함수 호출 전체를 잰다. 여러 번 호출하면 구간을 합산한다.
+//   - 결과는 ns/op의 중앙값(min/max 포함)과 초당 처리량. SetItemsProcessed/SetBytesProcessed로
+//     처리 단위를 바꿀 수 있다 (기본: 반복 1회 = 항목 1개).
+//   - --json으로 실행 환경과 함께 JSON을 기록한다 — 최적화 전후 비교용.
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Network::Bench
+{
+
+class BenchState
+{
+  public:
+	explicit BenchState(uint64_t iterations) : mIterations(iterations) {}
+
+	uint64_t Iterations() const { return mIterations; }
+
+	void StartTimer();
+	void StopTimer();
+
+	// English: Units processed by the whole run (default: Iterations())
+	// 한글: 실행 전체가 처리한 단위 수 (기본값: Iterations())
+	void SetItemsProcessed(uint64_t items) { mItems = items; }
+	void SetBytesProcessed(uint64_t bytes) { mBytes = bytes; }
+
+	// English: Abort this benchmark (setup failure); reported as an error, not a number
+	// 한글: 벤치마크 중단 (준비 실패) — 수치 대신 오류로 보고된다
+	void SkipWithError(const std::string &message) { mError = message; }
+
+	// 하네스 내부용
+	bool     UsedTimer() const { return mTimerUsed; }
+	uint64_t TimedNs() const { return mTimedNs; }
+	uint64_t Items() const { return mItems ? mItems : mIterations; }
+	uint64_t Bytes() const { return mBytes; }
+	const std::string &Error() const { return mError; }
+
+  private:
+	uint64_t    mIterations;
+	uint64_t    mItems     = 0;
+	uint64_t    mBytes     = 0;
+	uint64_t    mStartNs   = 0;
+	uint64_t    mTimedNs   = 0;
+	bool        mTimerUsed = false;
+	bool        mRunning   = false;
+	std::string mError;
+};
+
+using BenchFunction = std::function<void(BenchState &)>;
+
+// English: Register a case. Name convention: "Component/Operation[/param]". Returns true (for static init).
+// 한글: 케이스 등록. 이름 규칙: "컴포넌트/동작[/파라미터]". 정적 초기화용으로 true 반환.
+bool RegisterBenchmark(const std::string &name, BenchFunction function);
+
+// English: Parse options, run matching cases, print the table and optional JSON. Returns the exit code.
+// 한글: 옵션 파싱 후 일치하는 케이스 실행, 표와 (선택) JSON 출력. 종료 코드 반환.
+int RunBenchmarks(int argc, char *argv[]);
+
+// English: Keep a computed value alive so the optimiser cannot drop the work producing it
+// 한글: 계산된 값을 살려 두어 최적화기가 그 값을 만드는 작업을 제거하지 못하게 한다
+template <typename T> inline void DoNotOptimize(const T &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static volatile const void *sSink;
+	sSink = &value;
+#endif
+}
+
+} // namespace Network::Bench
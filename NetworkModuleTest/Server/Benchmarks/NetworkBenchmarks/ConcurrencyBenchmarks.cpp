@@ -0,0 +1,233 @@
+// KeyedDispatcher / ExecutionQueue 다중 생산자 처리량, 우선순위 레인 지연, TimerQueue 등록·취소 벤치마크
+
+#include "BenchHarness.h"
+#include "Concurrency/ExecutionQueue.h"
+#include "Concurrency/KeyedDispatcher.h"
+#include "Concurrency/TimerQueue.h"
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace Network::Concurrency;
+
+namespace Network::Bench
+{
+
+namespace
+{
+// =============================================================================
+// KeyedDispatcher — N 생산자 Dispatch → 워커 실행 완료까지
+// =============================================================================
+
+void RegisterDispatcher(uint32_t producers, size_t workers)
+{
+	const std::string name = "KeyedDispatcher/Dispatch/producers:" + std::to_string(producers) +
+	                         "/workers:" + std::to_string(workers);
+	RegisterBenchmark(name, [producers, workers](BenchState &state)
+	{
+		KeyedDispatcher dispatcher;
+		KeyedDispatcher::Options options;
+		options.mWorkerCount = workers;
+		options.mName        = "BenchDispatcher";
+		options.mQueueOptions.mBackpressure = BackpressurePolicy::Block;
+		options.mQueueOptions.mCapacity     = 8192;
+		if (!dispatcher.Initialize(options))
+		{
+			state.SkipWithError("KeyedDispatcher::Initialize failed");
+			return;
+		}
+
+		const uint64_t perProducer = state.Iterations() / producers + 1;
+		const uint64_t total       = perProducer * producers;
+		std::atomic<uint64_t> executed{0};
+
+		std::vector<std::thread> threads;
+		state.StartTimer();
+		for (uint32_t p = 0; p < producers; ++p)
+		{
+			threads.emplace_back([&, p]()
+			{
+				// 생산자마다 서로 다른 키 64개를 순환 (세션 64개에 해당)
+				for (uint64_t i = 0; i < perProducer; ++i)
+				{
+					dispatcher.Dispatch(p * 64 + (i & 63),
+					                    [&executed]() { executed.fetch_add(1, std::memory_order_relaxed); });
+				}
+			});
+		}
+		for (auto &thread : threads)
+			thread.join();
+		while (executed.load(std::memory_order_acquire) < total)
+			std::this_thread::yield();
+		state.StopTimer();
+
+		state.SetItemsProcessed(total);
+		dispatcher.Shutdown();
+	});
+}
+
+// =============================================================================
+// KeyedDispatcher — 워커 큐에 Normal 작업이 밀린 상태에서 프로브 1개의 대기 시간
+//   반복마다: 워커를 게이트 작업으로 막고 → Normal 백로그 적재 → 프로브 제출 →
+//   게이트 종료부터 프로브 실행까지만 측정 (control ≈ 백로그 무관, normal ≈ 백로그 전체).
+//   타이머는 워커 스레드에서 켜고 끈다 — 코어가 적어도 생산자 스케줄링이 수치에 섞이지 않는다.
+// =============================================================================
+
+void RegisterControlUnderLoad(TaskPriority lane)
+{
+	const std::string name = std::string("KeyedDispatcher/ControlUnderLoad/lane:") + TaskPriorityName(lane);
+	RegisterBenchmark(name, [lane](BenchState &state)
+	{
+		constexpr uint64_t kBacklog = 256;
+
+		KeyedDispatcher dispatcher;
+		KeyedDispatcher::Options options;
+		options.mWorkerCount = 1;
+		options.mName        = "BenchDispatcher";
+		options.mQueueOptions.mLaneBurstLimit = 8;
+		if (!dispatcher.Initialize(options))
+		{
+			state.SkipWithError("KeyedDispatcher::Initialize failed");
+			return;
+		}
+
+		std::atomic<bool>     gate{false};
+		std::atomic<uint64_t> drained{0};
+		uint64_t sink = 0;
+
+		for (uint64_t i = 0; i < state.Iterations(); ++i)
+		{
+			gate.store(false, std::memory_order_relaxed);
+			drained.store(0, std::memory_order_relaxed);
+
+			dispatcher.Dispatch(0, [&gate, &state]()
+			{
+				while (!gate.load(std::memory_order_acquire))
+					std::this_thread::yield();
+				state.StartTimer();
+			});
+			for (uint64_t n = 0; n < kBacklog; ++n)
+			{
+				dispatcher.Dispatch(0, [&drained, &sink]()
+				{
+					// 핸들러 1개 분량의 작업
+					for (uint32_t k = 0; k < 256; ++k)
+						sink += k;
+					drained.fetch_add(1, std::memory_order_release);
+				});
+			}
+			dispatcher.Dispatch(0, lane, [&state]() { state.StopTimer(); });
+
+			gate.store(true, std::memory_order_release);
+			while (drained.load(std::memory_order_acquire) < kBacklog)
+				std::this_thread::yield();
+		}
+
+		dispatcher.Shutdown();
+		DoNotOptimize(sink);
+	});
+}
+
+// =============================================================================
+// ExecutionQueue — N 생산자 TryPush/Push, 단일 소비자 Pop
+// =============================================================================
+
+void RegisterExecutionQueue(uint32_t producers, bool bounded)
+{
+	const std::string name = std::string("ExecutionQueue/MPSC/") + (bounded ? "bounded" : "unbounded") +
+	                         "/producers:" + std::to_string(producers);
+	RegisterBenchmark(name, [producers, bounded](BenchState &state)
+	{
+		ExecutionQueueOptions<uint64_t> options;
+		options.mBackpressure = bounded ? BackpressurePolicy::Block : BackpressurePolicy::RejectNewest;
+		options.mCapacity     = bounded ? 1024 : 0;
+		ExecutionQueue<uint64_t> queue(options);
+
+		const uint64_t perProducer = state.Iterations() / producers + 1;
+		const uint64_t total       = perProducer * producers;
+		uint64_t checksum = 0;
+
+		std::vector<std::thread> threads;
+		state.StartTimer();
+		std::thread consumer([&]()
+		{
+			uint64_t value = 0;
+			for (uint64_t received = 0; received < total; ++received)
+			{
+				if (!queue.Pop(value))
+					break;
+				checksum += value;
+			}
+		});
+		for (uint32_t p = 0; p < producers; ++p)
+		{
+			threads.emplace_back([&]()
+			{
+				for (uint64_t i = 0; i < perProducer; ++i)
+					queue.Push(i);
+			});
+		}
+		for (auto &thread : threads)
+			thread.join();
+		consumer.join();
+		state.StopTimer();
+
+		state.SetItemsProcessed(total);
+		DoNotOptimize(checksum);
+	});
+}
+
+// =============================================================================
+// TimerQueue — ScheduleOnce + Cancel (발화 전 취소: 세션 타임아웃 재설정 패턴)
+// =============================================================================
+
+void RegisterTimerQueue()
+{
+	RegisterBenchmark("TimerQueue/ScheduleCancel", [](BenchState &state)
+	{
+		TimerQueue timers;
+		timers.Initialize();
+
+		state.StartTimer();
+		for (uint64_t i = 0; i < state.Iterations(); ++i)
+		{
+			const TimerQueue::TimerHandle handle = timers.ScheduleOnce([]() {}, 60000);
+			timers.Cancel(handle);
+		}
+		state.StopTimer();
+		timers.Shutdown();
+	});
+
+	RegisterBenchmark("TimerQueue/Schedule", [](BenchState &state)
+	{
+		TimerQueue timers;
+		timers.Initialize();
+
+		state.StartTimer();
+		for (uint64_t i = 0; i < state.Iterations(); ++i)
+		{
+			DoNotOptimize(timers.ScheduleOnce([]() {}, 60000));
+		}
+		state.StopTimer();
+		timers.Shutdown();
+	});
+}
+
+const bool sRegistered = []
+{
+	for (uint32_t producers : {1u, 4u})
+		RegisterDispatcher(producers, 4);
+	for (TaskPriority lane : {TaskPriority::Control, TaskPriority::Normal})
+		RegisterControlUnderLoad(lane);
+	for (uint32_t producers : {1u, 4u})
+	{
+		RegisterExecutionQueue(producers, false);
+		RegisterExecutionQueue(producers, true);
+	}
+	RegisterTimerQueue();
+	return true;
+}();
+} // namespace
+
+} // namespace Network::Bench
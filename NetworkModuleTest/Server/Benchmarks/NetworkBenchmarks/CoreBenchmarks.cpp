@@ -0,0 +1,133 @@
+// IBufferPool Acquire/Release, NetworkEventBus Publish 벤치마크
+
+#include "BenchHarness.h"
+#include "Core/Memory/StandardBufferPool.h"
+#include "Network/Core/NetworkEventBus.h"
+#include "Network/Core/PacketDefine.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Network::Core;
+
+namespace Network::Bench
+{
+
+namespace
+{
+// =============================================================================
+// IBufferPool — Acquire + Release 왕복 (StandardBufferPool; 스레드 수별 경합)
+// =============================================================================
+
+void RegisterBufferPool(uint32_t threads)
+{
+	RegisterBenchmark("BufferPool/AcquireRelease/threads:" + std::to_string(threads), [threads](BenchState &state)
+	{
+		Memory::StandardBufferPool pool;
+		Memory::IBufferPool &bufferPool = pool;  // 엔진과 같이 인터페이스 경유로 호출
+		if (!bufferPool.Initialize(1024, RECV_BUFFER_SIZE))
+		{
+			state.SkipWithError("StandardBufferPool::Initialize failed");
+			return;
+		}
+
+		const uint64_t perThread = state.Iterations() / threads + 1;
+		std::atomic<uint64_t> exhausted{0};
+		std::vector<std::thread> workers;
+		state.StartTimer();
+		for (uint32_t t = 0; t < threads; ++t)
+		{
+			workers.emplace_back([&]()
+			{
+				uint64_t misses = 0;
+				for (uint64_t i = 0; i < perThread; ++i)
+				{
+					const Memory::BufferSlot slot = bufferPool.Acquire();
+					if (slot.ptr == nullptr)
+					{
+						++misses;
+						continue;
+					}
+					DoNotOptimize(slot.ptr);
+					bufferPool.Release(slot.index);
+				}
+				exhausted.fetch_add(misses, std::memory_order_relaxed);
+			});
+		}
+		for (auto &worker : workers)
+			worker.join();
+		state.StopTimer();
+
+		state.SetItemsProcessed(perThread * threads);
+		if (exhausted.load() != 0)
+			state.SkipWithError("pool exhausted during run");
+		bufferPool.Shutdown();
+	});
+}
+
+// =============================================================================
+// NetworkEventBus::Publish — 구독자 수별 팬아웃 비용 (소비자 스레드가 채널을 드레인)
+// =============================================================================
+
+void RegisterEventBus(uint32_t subscribers)
+{
+	RegisterBenchmark("NetworkEventBus/Publish/subscribers:" + std::to_string(subscribers),
+	                  [subscribers](BenchState &state)
+	{
+		NetworkEventBus &bus = NetworkEventBus::Instance();
+
+		std::vector<std::shared_ptr<NetworkEventBus::EventChannel>> channels;
+		std::vector<NetworkEventBus::SubscriberHandle> handles;
+		std::vector<std::thread> consumers;
+		std::atomic<bool> stop{false};
+		for (uint32_t s = 0; s < subscribers; ++s)
+		{
+			NetworkEventBus::EventChannel::Options options;
+			options.mCapacity     = 4096;
+			options.mBackpressure = Concurrency::BackpressurePolicy::RejectNewest;
+			channels.push_back(std::make_shared<NetworkEventBus::EventChannel>(options));
+			handles.push_back(bus.Subscribe(NetworkEvent::DataReceived, channels.back()));
+			consumers.emplace_back([channel = channels.back(), &stop]()
+			{
+				NetworkBusEventData event;
+				while (!stop.load(std::memory_order_relaxed))
+				{
+					channel->Receive(event, 10);
+				}
+			});
+		}
+
+		// 엔진 FireEvent와 같은 형태 — 64바이트 페이로드 복사 포함
+		NetworkBusEventData data;
+		data.eventType    = NetworkEvent::DataReceived;
+		data.connectionId = 1;
+		data.data.assign(64, 0x5a);
+		data.dataSize = data.data.size();
+
+		state.StartTimer();
+		for (uint64_t i = 0; i < state.Iterations(); ++i)
+		{
+			bus.Publish(NetworkEvent::DataReceived, data);
+		}
+		state.StopTimer();
+
+		for (auto handle : handles)
+			bus.Unsubscribe(handle);
+		stop.store(true);
+		for (auto &consumer : consumers)
+			consumer.join();
+	});
+}
+
+const bool sRegistered = []
+{
+	for (uint32_t threads : {1u, 4u})
+		RegisterBufferPool(threads);
+	for (uint32_t subscribers : {0u, 1u, 4u})
+		RegisterEventBus(subscribers);
+	return true;
+}();
+} // namespace
+
+} // namespace Network::Bench
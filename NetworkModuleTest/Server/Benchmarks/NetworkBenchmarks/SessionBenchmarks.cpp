@@ -0,0 +1,276 @@
+// Session 수신 재조립(ProcessRawRecv)과 SessionManager 조회/브로드캐스트 벤치마크
+
+#include "BenchHarness.h"
+#include "Network/Core/PacketDefine.h"
+#include "Network/Core/Session.h"
+#include "Network/Core/SessionManager.h"
+#include "Network/Core/SessionPool.h"
+#include "Network/Core/SharedSendBuffer.h"
+#include "Utils/NetworkTypes.h"
+#include <atomic>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace Network::Core;
+
+namespace Network::Bench
+{
+
+namespace
+{
+#if defined(_WIN32)
+const SocketHandle kNoSocket = INVALID_SOCKET;
+#else
+const SocketHandle kNoSocket = -1;
+#endif
+
+// =============================================================================
+// Session::ProcessRawRecv — recv 청크 구성별 재조립 비용
+// =============================================================================
+
+// 헤더 + payloadSize 바이트 패킷 1개를 stream 뒤에 붙인다.
+void AppendPacket(std::vector<char> &stream, uint16_t totalSize)
+{
+	PacketHeader header;
+	header.size = totalSize;
+	header.id   = static_cast<uint16_t>(PacketType::PingReq);
+	const size_t offset = stream.size();
+	stream.resize(offset + totalSize, 'x');
+	std::memcpy(stream.data() + offset, &header, sizeof(header));
+}
+
+// 패킷 스트림 + recv 청크 경계 — 엔진의 recv 완료 1회가 청크 1개에 해당한다.
+struct RecvScenario
+{
+	std::vector<char>     mStream;
+	std::vector<uint32_t> mChunkSizes;
+	uint64_t              mPackets = 0;
+};
+
+// single    : 청크 = 16B 패킷 1개 (fast path)
+// coalesced : 청크 = 16B 패킷 8개 (Nagle/배치 수신)
+// split     : 64B 패킷 1개를 두 청크로 나눔 (헤더 경계 분할 포함)
+// mixed     : 16~1024B 무작위 패킷을 1~4096B 무작위 청크로 자름
+RecvScenario BuildScenario(const std::string &mix)
+{
+	RecvScenario scenario;
+	std::mt19937 random(42);
+	constexpr size_t kStreamBytes = 256 * 1024;
+
+	if (mix == "single" || mix == "coalesced")
+	{
+		const uint32_t perChunk = mix == "single" ? 1 : 8;
+		while (scenario.mStream.size() < kStreamBytes)
+		{
+			for (uint32_t i = 0; i < perChunk; ++i)
+				AppendPacket(scenario.mStream, sizeof(PKT_PingReq));
+			scenario.mChunkSizes.push_back(perChunk * static_cast<uint32_t>(sizeof(PKT_PingReq)));
+			scenario.mPackets += perChunk;
+		}
+	}
+	else if (mix == "split")
+	{
+		while (scenario.mStream.size() < kStreamBytes)
+		{
+			AppendPacket(scenario.mStream, 64);
+			scenario.mChunkSizes.push_back(3);  // 헤더 도중에서 끊김
+			scenario.mChunkSizes.push_back(61);
+			++scenario.mPackets;
+		}
+	}
+	else
+	{
+		std::uniform_int_distribution<uint32_t> packetSize(PACKET_HEADER_SIZE, 1024);
+		while (scenario.mStream.size() < kStreamBytes)
+		{
+			AppendPacket(scenario.mStream, static_cast<uint16_t>(packetSize(random)));
+			++scenario.mPackets;
+		}
+		std::uniform_int_distribution<uint32_t> chunkSize(1, 4096);
+		size_t remaining = scenario.mStream.size();
+		while (remaining > 0)
+		{
+			const uint32_t chunk = static_cast<uint32_t>((std::min)(static_cast<size_t>(chunkSize(random)), remaining));
+			scenario.mChunkSizes.push_back(chunk);
+			remaining -= chunk;
+		}
+	}
+	return scenario;
+}
+
+// batch=true: SetOnRecvBatch — 청크당 콜백 1회 (SetOnRecv는 패킷당 1회)
+void RegisterProcessRawRecv(const std::string &mix, bool batch)
+{
+	RegisterBenchmark("Session/ProcessRawRecv/" + mix + (batch ? "/batch" : ""), [mix, batch](BenchState &state)
+	{
+		static const RecvScenario sScenarios[] = {BuildScenario("single"), BuildScenario("coalesced"),
+		                                          BuildScenario("split"), BuildScenario("mixed")};
+		const RecvScenario &scenario = mix == "single"      ? sScenarios[0]
+		                               : mix == "coalesced" ? sScenarios[1]
+		                               : mix == "split"     ? sScenarios[2]
+		                                                    : sScenarios[3];
+
+		Session session;
+		session.Initialize(1, kNoSocket);
+		uint64_t delivered = 0;
+		if (batch)
+			session.SetOnRecvBatch([&delivered](Session *, const Session::RecvPacket *, size_t count)
+			                       { delivered += count; });
+		else
+			session.SetOnRecv([&delivered](Session *, const char *, uint32_t) { ++delivered; });
+
+		// 반복 1회 = 청크 1개. 시나리오 끝에 도달하면 처음부터 다시 (패킷 경계에서 끝나므로 안전).
+		const size_t chunkCount = scenario.mChunkSizes.size();
+		size_t chunkIndex = 0;
+		size_t offset     = 0;
+		uint64_t bytes    = 0;
+		state.StartTimer();
+		for (uint64_t i = 0; i < state.Iterations(); ++i)
+		{
+			const uint32_t size = scenario.mChunkSizes[chunkIndex];
+			session.ProcessRawRecv(scenario.mStream.data() + offset, size);
+			bytes  += size;
+			offset += size;
+			if (++chunkIndex == chunkCount)
+			{
+				chunkIndex = 0;
+				offset     = 0;
+			}
+		}
+		state.StopTimer();
+		DoNotOptimize(delivered);
+
+		// 처리 단위 = 전달된 패킷 (청크당 패킷 수가 시나리오마다 다르므로)
+		state.SetItemsProcessed((std::max)(delivered, uint64_t{1}));
+		state.SetBytesProcessed(bytes);
+		session.Close();
+	});
+}
+
+// =============================================================================
+// SessionManager::GetSession — 세션 맵 조회 (mutex + shared_ptr 복사)
+// =============================================================================
+
+// 세션 테이블은 프로세스당 1회 채운다 (MAX_CONNECTIONS개, 소켓 없는 세션).
+const std::vector<Utils::ConnectionId> &SessionTable()
+{
+	static const std::vector<Utils::ConnectionId> sIds = []
+	{
+		std::vector<Utils::ConnectionId> ids;
+		SessionPool::Instance().Initialize(Utils::MAX_CONNECTIONS);
+		for (size_t i = 0; i < Utils::MAX_CONNECTIONS; ++i)
+		{
+			SessionRef session = SessionManager::Instance().CreateSession(kNoSocket);
+			if (!session)
+				break;
+			ids.push_back(session->GetId());
+		}
+		return ids;
+	}();
+	return sIds;
+}
+
+void RegisterSessionLookup(uint32_t threads)
+{
+	RegisterBenchmark("SessionManager/GetSession/threads:" + std::to_string(threads), [threads](BenchState &state)
+	{
+		const std::vector<Utils::ConnectionId> &sIds = SessionTable();
+		if (sIds.empty())
+		{
+			state.SkipWithError("SessionManager::CreateSession failed");
+			return;
+		}
+
+		const uint64_t perThread = state.Iterations() / threads + 1;
+		std::atomic<uint64_t> found{0};
+		std::vector<std::thread> workers;
+		state.StartTimer();
+		for (uint32_t t = 0; t < threads; ++t)
+		{
+			workers.emplace_back([&, t]()
+			{
+				uint64_t hits = 0;
+				size_t index = t * 7919u;
+				for (uint64_t i = 0; i < perThread; ++i)
+				{
+					index = (index + 31) % sIds.size();
+					if (SessionManager::Instance().GetSession(sIds[index]))
+						++hits;
+				}
+				found.fetch_add(hits, std::memory_order_relaxed);
+			});
+		}
+		for (auto &worker : workers)
+			worker.join();
+		state.StopTimer();
+		state.SetItemsProcessed(perThread * threads);
+		DoNotOptimize(found);
+	});
+}
+
+// =============================================================================
+// SessionManager::Broadcast — 수신자별 복사(Send(data, size)) vs 공유 버퍼 참조
+// =============================================================================
+// 소켓 없는 세션이라 PostSend는 공급자 없이 바로 반환한다 — 스냅샷 + 큐잉 + 페이로드 준비 비용만 잰다.
+// 엔진이 없어 팬아웃 디스패처가 없으므로 Broadcast는 호출 스레드에서 인라인으로 돈다.
+
+void RegisterBroadcast(uint32_t payloadSize, bool shared)
+{
+	const std::string name = std::string("SessionManager/Broadcast/") + (shared ? "shared" : "copy") +
+	                         "/bytes:" + std::to_string(payloadSize);
+	RegisterBenchmark(name, [payloadSize, shared](BenchState &state)
+	{
+		if (SessionTable().empty())
+		{
+			state.SkipWithError("SessionManager::CreateSession failed");
+			return;
+		}
+
+		std::vector<char> payload(payloadSize, 'x');
+		const size_t recipients = SessionManager::Instance().GetSessionCount();
+		const uint64_t rounds = state.Iterations() / recipients + 1;
+		uint64_t sent = 0;
+		state.StartTimer();
+		for (uint64_t round = 0; round < rounds; ++round)
+		{
+			if (shared)
+			{
+				// 직렬화 1회 + 수신자당 참조 카운트 +1
+				sent += SessionManager::Instance().Broadcast(SharedSendBuffer::Create(payload.data(), payloadSize));
+			}
+			else
+			{
+				// 수신자마다 Send(data, size) — 수신자당 할당 + 복사
+				for (const SessionRef &session : SessionManager::Instance().GetAllSessions())
+				{
+					session->Send(payload.data(), payloadSize);
+					++sent;
+				}
+			}
+		}
+		state.StopTimer();
+		state.SetItemsProcessed(rounds * recipients);
+		DoNotOptimize(sent);
+	});
+}
+
+const bool sRegistered = []
+{
+	for (const char *mix : {"single", "coalesced", "split", "mixed"})
+		RegisterProcessRawRecv(mix, false);
+	for (const char *mix : {"coalesced", "mixed"})
+		RegisterProcessRawRecv(mix, true);
+	for (uint32_t threads : {1u, 4u})
+		RegisterSessionLookup(threads);
+	for (uint32_t payloadSize : {64u, 1024u})
+	{
+		RegisterBroadcast(payloadSize, false);
+		RegisterBroadcast(payloadSize, true);
+	}
+	return true;
+}();
+} // namespace
+
+} // namespace Network::Bench
@@ -0,0 +1,15 @@
+// NetworkBenchmarks 진입점 — 엔진 기본 구성 요소 마이크로벤치마크
+//
+//   NetworkBenchmarks [--filter <text>] [--min-time <sec>] [--repetitions <n>] [--json <path|->] [--list]
+//
+// 케이스는 각 *Benchmarks.cpp의 정적 등록으로 추가된다 (BenchHarness.h 참조).
+
+#include "BenchHarness.h"
+#include "Utils/Logger.h"
+
+int main(int argc, char *argv[])
+{
+	// 세션 생성 등 준비 단계의 Info 로그가 측정을 방해하지 않도록 한다.
+	Network::Utils::Logger::SetLevel(Network::Utils::LogLevel::Warn);
+	return Network::Bench::RunBenchmarks(argc, argv);
+}
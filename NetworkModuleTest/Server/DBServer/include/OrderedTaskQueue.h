@@ -8,6 +8,7 @@
 #include "Utils/NetworkUtils.h"
 #include "Concurrency/ExecutionQueue.h"
 #include "Concurrency/KeyedDispatcher.h"
+#include "Utils/Metrics.h"
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -36,14 +37,20 @@ namespace Network::DBServer
 
         // key(serverId) 기반 라우팅 enqueue.
         //   같은 key는 항상 같은 워커로 배정되므로 per-key 순서가 보장된다.
-        void EnqueueTask(uint32_t key, std::function<void()> taskFunc);
+        //   dropPolicy: 워커가 과부하(대기 시간 목표 초과)일 때 오래 기다린 이 작업의 처리 —
+        //   Drop은 실행하지 않고, Reject는 Concurrency::IsShedding()이 true인 채로 실행한다.
+        //   반환값 false = 큐가 받지 않음 (미실행/종료 중/큐 한도) — 작업은 실행되지 않는다.
+        bool EnqueueTask(uint32_t key, std::function<void()> taskFunc,
+                         Network::Concurrency::DropPolicy dropPolicy = Network::Concurrency::DropPolicy::Never);
 
         // 큐 실행 상태 조회
         bool IsRunning() const { return mIsRunning.load(std::memory_order_acquire); }
 
         // 통계 조회 (atomic, lock-free)
-        size_t GetTotalEnqueuedCount() const { return mTotalEnqueued.load(std::memory_order_relaxed); }
-        size_t GetTotalProcessedCount() const { return mTotalProcessed.load(std::memory_order_relaxed); }
+        size_t GetTotalEnqueuedCount() const { return mTotalEnqueued.Value(); }
+        size_t GetTotalProcessedCount() const { return mTotalProcessed.Value(); }
+        size_t GetTotalFailedCount() const { return mTotalFailed.Value(); }
+        size_t GetTotalShedCount() const { return mDispatcher.GetStats().mShed; }  // Drop + Reject 처리된 stale 작업
 
         // 워커 수 및 특정 워커의 현재 큐 길이 조회
         size_t GetWorkerCount() const { return mWorkerCount; }
@@ -55,9 +62,9 @@ namespace Network::DBServer
         Network::Concurrency::KeyedDispatcher mDispatcher;  // 내부 키 친화도 라우팅 엔진 (소유)
 
         // 전역 통계 (atomic, lock-free)
-        std::atomic<size_t>             mTotalEnqueued;   // Dispatch 호출 성공 횟수 (relaxed)
-        std::atomic<size_t>             mTotalProcessed;  // 작업 정상 완료 횟수 (relaxed)
-        std::atomic<size_t>             mTotalFailed;     // 예외 또는 drop된 작업 횟수 (relaxed)
+        Utils::MetricCounter            mTotalEnqueued;   // Dispatch 호출 성공 횟수 (스레드별 셀)
+        Utils::MetricCounter            mTotalProcessed;  // 작업 정상 완료 횟수 (스레드별 셀)
+        Utils::MetricCounter            mTotalFailed;     // 예외 또는 drop된 작업 횟수 (스레드별 셀)
     };
 
 } // namespace Network::DBServer
@@ -3,12 +3,13 @@
 // TestDBServer용 서버 패킷 핸들러
 
 #include "Network/Core/Session.h"
-#include "Network/Core/ServerPacketDefine.h"
+#include "Network/Core/PacketRegistry.h"
 #include "ServerLatencyManager.h"   // 통합 레이턴시 + 핑 시간 관리자 (DBPingTimeManager 통합됨)
 #include "Utils/NetworkUtils.h"
-#include <functional>
-#include <unordered_map>
+#include "Interfaces/ResultCode.h"
+#include <string>
 #include <memory>
+#include <vector>
 
 // Forward declaration
 namespace Network::DBServer { class OrderedTaskQueue; }
@@ -18,7 +19,8 @@ namespace Network::DBServer
     using Utils::ConnectionId;
 
     // =============================================================================
-    // ServerPacketHandler - 펑터 맵을 사용하여 게임 서버 패킷 처리.
+    // ServerPacketHandler - 컴파일 타임 디스패치 테이블로 게임 서버 패킷 처리.
+    //   테이블(DispatchTable)은 프로세스 전역 constexpr — 인스턴스는 주입된 의존성만 가진다.
     //
     //   의존성 (모두 주입됨, 소유 아님):
     //     - ServerLatencyManager  : 통합 RTT 통계 + 핑 시간 저장
@@ -31,9 +33,6 @@ namespace Network::DBServer
     class ServerPacketHandler
     {
     public:
-        // 패킷 핸들러 펑터 타입
-        using PacketHandlerFunc = std::function<void(Core::Session*, const char*, uint32_t)>;
-
         ServerPacketHandler();
         virtual ~ServerPacketHandler();
 
@@ -42,19 +41,44 @@ namespace Network::DBServer
         void Initialize(ServerLatencyManager* latencyManager,
                         OrderedTaskQueue* orderedTaskQueue);
 
-        // 게임 서버로부터 받은 패킷 처리 (펑터 맵 디스패치)
+        // 게임 서버로부터 받은 패킷 처리 (헤더/크기 검증 → 테이블 인덱스 → 직접 호출)
         void ProcessPacket(Core::Session* session, const char* data, uint32_t size);
 
+        // 패킷 ID → 로직 디스패처 레인 (Session::SetPacketPriority). 핑은 Control, 배치 쿼리는 Bulk.
+        static Concurrency::TaskPriority PacketPriority(uint16_t packetId)
+        {
+            return DispatchTable::PriorityOf(packetId);
+        }
+
     private:
-        // 패킷 핸들러 펑터 맵 (ServerPacketType → Handler)
-        std::unordered_map<uint16_t, PacketHandlerFunc> mHandlers;  // 생성자에서 1회 구성 후 read-only (stateless)
+        // 개별 패킷 핸들러 — 테이블이 크기 검증을 마친 뒤 타입 있는 참조로 호출
+        void HandleServerPingRequest(Core::Session* session, const Core::PKT_ServerPingReq& packet);
+        void HandleDBSavePingTimeRequest(Core::Session* session, const Core::PKT_DBSavePingTimeReq& packet);
+        // 단일(PKT_DBQueryReq)/배치(PKT_DBQueryBatchReq) 쿼리 요청 — 가변 길이 프레임 디코드 후 배치 응답.
+        //   size는 검증된 header.size
+        template <typename Packet>
+        void HandleDBQueryRequest(Core::Session* session, const Packet& packet, uint32_t size);
+
+        using DispatchTable = Core::PacketDispatchTable<ServerPacketHandler, Core::ServerPacketHeader,
+            &ServerPacketHandler::HandleServerPingRequest,
+            &ServerPacketHandler::HandleDBSavePingTimeRequest,
+            &ServerPacketHandler::HandleDBQueryRequest<Core::PKT_DBQueryReq>,
+            &ServerPacketHandler::HandleDBQueryRequest<Core::PKT_DBQueryBatchReq>>;
+
+        // 디코드된 쿼리 1건 (수신 버퍼와 분리된 소유 복사본)
+        struct DBQueryItem
+        {
+            uint64_t    queryId  = 0;   // 요청 ID (응답에 그대로 에코)
+            uint8_t     taskType = 0;   // TestServer DBServerTaskType 값
+            std::string data;           // JSON 페이로드
+        };
 
-        // 생성자에서 모든 패킷 핸들러를 등록
-        void RegisterHandlers();
+        // 쿼리 1건 실행 — OrderedTaskQueue 워커에서 호출
+        static ResultCode ExecuteDBQuery(const DBQueryItem& item, std::string& outDetail);
 
-        // 개별 패킷 핸들러
-        void HandleServerPingRequest(Core::Session* session, const Core::PKT_ServerPingReq* packet);
-        void HandleDBSavePingTimeRequest(Core::Session* session, const Core::PKT_DBSavePingTimeReq* packet);
+        // 배치 결과를 DBQueryRes 프레임(가득 차면 분할)으로 응답.
+        //   reject = true이면 쿼리를 실행하지 않고 전 항목을 Timeout("server overloaded")으로 응답
+        static void SendDBQueryResults(Core::Session& session, const std::vector<DBQueryItem>& items, bool reject);
 
     private:
         ServerLatencyManager* mLatencyManager;        // non-owning — 통합 RTT + 핑 시간 관리자; Initialize로 주입
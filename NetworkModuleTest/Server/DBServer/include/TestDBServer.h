@@ -5,9 +5,11 @@
 #include "ServerLatencyManager.h"
 #include "ServerPacketHandler.h"
 #include "OrderedTaskQueue.h"
+#include "Network/Core/AdminHttpServer.h"
 #include "Network/Core/NetworkEngine.h"
 #include "Network/Core/Session.h"
 #include "Network/Core/SessionManager.h"
+#include "Utils/Metrics.h"
 #include "Utils/NetworkUtils.h"
 #include <memory>
 #include <atomic>
@@ -57,12 +59,18 @@ namespace Network::DBServer
         void Stop();
         bool IsRunning() const;
 
+        // 관리 포트 Prometheus 엔드포인트 (GET /metrics). Start() 이후 호출.
+        bool StartAdminEndpoint(uint16_t port, const std::string& bindAddress = "127.0.0.1");
+
     private:
         // 네트워크 이벤트 핸들러
         void OnConnectionEstablished(const Core::NetworkEventData& eventData);
         void OnConnectionClosed(const Core::NetworkEventData& eventData);
         void OnDataReceived(const Core::NetworkEventData& eventData);
 
+        // 서버별 RTT와 순서 보장 큐 통계를 메트릭 레지스트리로 내보내는 컬렉터
+        void CollectMetrics(Utils::MetricsWriter& writer) const;
+
 
     private:
         // ─────────────────────────────────────────────
@@ -88,6 +96,10 @@ namespace Network::DBServer
         // 캡처한 람다들을 모두 드레인한다. 순서가 반전되면 use-after-free 발생.
         std::unique_ptr<OrderedTaskQueue>           mOrderedTaskQueue;  // 소멸 순서 보장: mLatencyManager보다 먼저 소멸
 
+        // 관리 엔드포인트 — mEngine의 추가 리스너, 엔진 Stop 전에 먼저 정지
+        Core::AdminHttpServer                       mAdminServer;             // GET /metrics (AdminPort 0이면 미시작)
+        Utils::MetricsRegistry::CollectorId         mMetricsCollectorId = 0;  // Start에서 등록, Stop에서 해제
+
         // ─────────────────────────────────────────────
         // 서버 상태
         // ─────────────────────────────────────────────
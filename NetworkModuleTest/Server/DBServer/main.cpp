@@ -65,11 +65,14 @@ void PrintUsage(const char* programName)
     std::cout << "Options:" << std::endl;
     std::cout << "  -p <port>       Server port (default: " << Network::Utils::DEFAULT_TEST_DB_PORT << ")" << std::endl;
     std::cout << "  -l <level>      Log level: DEBUG, INFO, WARN, ERROR (default: INFO)" << std::endl;
+    std::cout << "  --admin-port <p> Prometheus /metrics port (default: 0 = disabled)" << std::endl;
     std::cout << "  -h              Show this help" << std::endl;
     std::cout << std::endl;
     std::cout << "Environment Variables (override defaults):" << std::endl;
     std::cout << "  NETMOD_LISTEN_PORT        Server listen port" << std::endl;
     std::cout << "  NETMOD_LOG_LEVEL          Log level (DEBUG/INFO/WARN/ERROR)" << std::endl;
+    std::cout << "  NETMOD_ADMIN_PORT         Prometheus /metrics port (0=disabled)" << std::endl;
+    std::cout << "  NETMOD_ADMIN_BIND         Admin endpoint bind address (default: 127.0.0.1)" << std::endl;
     std::cout << "  NETMOD_GRACEFUL_TIMEOUT   Shutdown timeout in seconds" << std::endl;
 }
 
@@ -109,6 +112,7 @@ int main(int argc, char* argv[])
     // Korean: 기본 설정 (ConfigManager/환경 변수로 덮어쓰기 가능)
     uint16_t port = Network::Utils::ConfigManager::Instance().GetNetwork().ListenPort;
     Network::Utils::LogLevel logLevel = Network::Utils::LogLevel::Info;
+    uint16_t adminPort = Network::Utils::ConfigManager::Instance().GetNetwork().AdminPort;
 
     // English: Parse command line arguments (override ConfigManager settings)
     // Korean: 커맨드라인 인자 파싱 (ConfigManager 설정 덮어쓰기)
@@ -129,6 +133,10 @@ int main(int argc, char* argv[])
         {
             logLevel = ParseLogLevel(argv[++i]);
         }
+        else if (arg == "--admin-port" && i + 1 < argc)
+        {
+            adminPort = static_cast<uint16_t>(std::stoi(argv[++i]));
+        }
         else
         {
             std::cerr << "Unknown option: " << arg << std::endl;
@@ -141,6 +149,11 @@ int main(int argc, char* argv[])
     // Korean: 로깅 설정
     Network::Utils::Logger::SetLevel(logLevel);
 
+    // English: Reflect CLI overrides so the dump shows the values actually used
+    // Korean: 설정 출력이 실제 사용 값과 같도록 CLI 덮어쓰기를 반영
+    Network::Utils::ConfigManager::Instance().Network().ListenPort = port;
+    Network::Utils::ConfigManager::Instance().Network().AdminPort = adminPort;
+
     // English: Print current configuration
     // Korean: 현재 설정 출력
     Network::Utils::ConfigManager::Instance().PrintConfig();
@@ -181,6 +194,12 @@ int main(int argc, char* argv[])
         return 1;
     }
 
+    if (adminPort != 0 &&
+        !server.StartAdminEndpoint(adminPort, Network::Utils::ConfigManager::Instance().GetNetwork().AdminBindAddress))
+    {
+        Network::Utils::Logger::Warn("Admin endpoint unavailable - continuing without /metrics");
+    }
+
     Network::Utils::Logger::Info("TestDBServer is running. Press Ctrl+C to stop.");
 
     // English: Main loop — waits for SIGINT/SIGTERM, ConsoleCtrlHandler, or Named Event.
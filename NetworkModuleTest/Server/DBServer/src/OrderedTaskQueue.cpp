@@ -11,9 +11,6 @@ namespace Network::DBServer
     OrderedTaskQueue::OrderedTaskQueue()
         : mWorkerCount(0)
         , mIsRunning(false)
-        , mTotalEnqueued(0)
-        , mTotalProcessed(0)
-        , mTotalFailed(0)
     {
     }
 
@@ -46,6 +43,12 @@ namespace Network::DBServer
 
         options.mQueueOptions.mCapacity = 8192;
 
+        // 용량(8192)은 메모리 상한일 뿐 — 그 아래에서도 작업이 몇 초씩 밀릴 수 있다.
+        //   대기 시간이 500ms 창 내내 50ms를 넘으면 과부하로 보고 stale 작업을 DropPolicy대로 처리.
+        //   DB 쿼리 1건이 수 ms라 로직 디스패처(5ms)보다 목표를 넉넉히 잡는다.
+        options.mSojourn.mTargetMs   = 50;
+        options.mSojourn.mIntervalMs = 500;
+
         if (!mDispatcher.Initialize(options))
         {
             Logger::Error("OrderedTaskQueue: dispatcher initialize failed");
@@ -53,9 +56,9 @@ namespace Network::DBServer
         }
 
         mWorkerCount = workerCount;
-        mTotalEnqueued.store(0, std::memory_order_relaxed);
-        mTotalProcessed.store(0, std::memory_order_relaxed);
-        mTotalFailed.store(0, std::memory_order_relaxed);
+        mTotalEnqueued.Reset();
+        mTotalProcessed.Reset();
+        mTotalFailed.Reset();
         mIsRunning.store(true, std::memory_order_release);
 
         Logger::Info("OrderedTaskQueue initialized successfully");
@@ -77,19 +80,22 @@ namespace Network::DBServer
         mDispatcher.Shutdown();
 
         Logger::Info("OrderedTaskQueue shutdown complete - Enqueued: " +
-                     std::to_string(mTotalEnqueued.load(std::memory_order_relaxed)) +
+                     std::to_string(mTotalEnqueued.Value()) +
                      ", Processed: " +
-                     std::to_string(mTotalProcessed.load(std::memory_order_relaxed)) +
+                     std::to_string(mTotalProcessed.Value()) +
                      ", Failed: " +
-                     std::to_string(mTotalFailed.load(std::memory_order_relaxed)));
+                     std::to_string(mTotalFailed.Value()) +
+                     ", Shed: " +
+                     std::to_string(GetTotalShedCount()));
     }
 
-    void OrderedTaskQueue::EnqueueTask(uint32_t key, std::function<void()> taskFunc)
+    bool OrderedTaskQueue::EnqueueTask(uint32_t key, std::function<void()> taskFunc,
+                                       Network::Concurrency::DropPolicy dropPolicy)
     {
         if (!mIsRunning.load(std::memory_order_acquire))
         {
             Logger::Error("Cannot enqueue task - OrderedTaskQueue not running");
-            return;
+            return false;
         }
 
         // mTotalProcessed / mTotalFailed는 이 래퍼에서만 집계된다.
@@ -97,6 +103,8 @@ namespace Network::DBServer
         //   dispatcher 수준 메트릭은 GetStats(), 큐 수준은 GetTotalProcessedCount()로 조회.
         bool queued = mDispatcher.Dispatch(
             key,
+            Network::Concurrency::TaskPriority::Normal,
+            dropPolicy,
             [this, workerKey = key, task = std::move(taskFunc)]() mutable {
                 try
                 {
@@ -104,17 +112,17 @@ namespace Network::DBServer
                     {
                         task();
                     }
-                    mTotalProcessed.fetch_add(1, std::memory_order_relaxed);
+                    mTotalProcessed.Add();
                 }
                 catch (const std::exception& e)
                 {
-                    mTotalFailed.fetch_add(1, std::memory_order_relaxed);
+                    mTotalFailed.Add();
                     Logger::Error("OrderedTaskQueue task exception - key: " +
                                   std::to_string(workerKey) + ", error: " + e.what());
                 }
                 catch (...)
                 {
-                    mTotalFailed.fetch_add(1, std::memory_order_relaxed);
+                    mTotalFailed.Add();
                     Logger::Error("OrderedTaskQueue unknown task exception - key: " +
                                   std::to_string(workerKey));
                 }
@@ -122,14 +130,15 @@ namespace Network::DBServer
 
         if (queued)
         {
-            mTotalEnqueued.fetch_add(1, std::memory_order_relaxed);
-            return;
+            mTotalEnqueued.Add();
+            return true;
         }
 
         // 조용히 드롭된 태스크도 집계하여 셧다운 통계에 실제 실패가 반영되도록 함
-        mTotalFailed.fetch_add(1, std::memory_order_relaxed);
+        mTotalFailed.Add();
         Logger::Warn("OrderedTaskQueue enqueue rejected - key: " +
                      std::to_string(key));
+        return false;
     }
 
     size_t OrderedTaskQueue::GetWorkerQueueSize(size_t workerIndex) const
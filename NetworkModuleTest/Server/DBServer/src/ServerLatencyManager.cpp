@@ -99,8 +99,7 @@ namespace Network::DBServer
         }
         catch (const std::exception& e)
         {
-            Logger::Error("ServerLatencyManager bootstrap failed: " +
-                          std::string(e.what()));
+            Logger::Error("ServerLatencyManager bootstrap failed: {}", e.what());
             return false;
         }
 
@@ -124,8 +123,7 @@ namespace Network::DBServer
             }
             catch (const std::exception& e)
             {
-                Logger::Error("ServerLatencyManager bootstrap failed on SetDatabase: " +
-                              std::string(e.what()));
+                Logger::Error("ServerLatencyManager bootstrap failed on SetDatabase: {}", e.what());
             }
         }
     }
@@ -198,13 +196,9 @@ namespace Network::DBServer
             updatedInfo = info;
         }
 
-        Logger::Info("Latency recorded - ServerId: " + std::to_string(serverId) +
-                     ", ServerName: " + serverName +
-                     ", RTT: " + std::to_string(rttMs) + "ms" +
-                     ", Avg: " + std::to_string(static_cast<uint64_t>(updatedInfo.avgRttMs)) + "ms" +
-                     ", Min: " + std::to_string(updatedInfo.minRttMs) + "ms" +
-                     ", Max: " + std::to_string(updatedInfo.maxRttMs) + "ms" +
-                     ", Count: " + std::to_string(updatedInfo.pingCount));
+        Logger::Info("Latency recorded - ServerId: {}, ServerName: {}, RTT: {}ms, Avg: {}ms, Min: {}ms, Max: {}ms, Count: {}",
+                     serverId, serverName, rttMs, static_cast<uint64_t>(updatedInfo.avgRttMs),
+                     updatedInfo.minRttMs, updatedInfo.maxRttMs, updatedInfo.pingCount);
 
         // English: FormatTimestamp is pure computation — done outside the lock.
         //          One lock acquisition covers the null-check and the DB call together.
@@ -235,8 +229,7 @@ namespace Network::DBServer
         }
         catch (const std::exception& e)
         {
-            Logger::Error("ServerLatencyManager latency persist failed: " +
-                          std::string(e.what()));
+            Logger::Error("ServerLatencyManager latency persist failed: {}", e.what());
         }
     }
 
@@ -276,9 +269,8 @@ namespace Network::DBServer
         }
 
         const std::string pingTime = FormatTimestamp(timestamp);
-        Logger::Debug("SavePingTime - ServerId: " + std::to_string(serverId) +
-                      ", ServerName: " + serverName +
-                      ", GMT: " + pingTime);
+        Logger::Debug("SavePingTime - ServerId: {}, ServerName: {}, GMT: {}",
+                      serverId, serverName, pingTime);
 
         try
         {
@@ -299,8 +291,7 @@ namespace Network::DBServer
         }
         catch (const std::exception& e)
         {
-            Logger::Error("ServerLatencyManager ping persist failed: " +
-                          std::string(e.what()));
+            Logger::Error("ServerLatencyManager ping persist failed: {}", e.what());
             return false;
         }
     }
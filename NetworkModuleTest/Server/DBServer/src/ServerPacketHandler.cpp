@@ -3,6 +3,8 @@
 #include "../include/ServerPacketHandler.h"
 #include "../include/OrderedTaskQueue.h"
 #include "Utils/PingPongConfig.h"
+#include "Interfaces/ResultCode.h"
+#include "Network/Core/ServerPacketCodec.h"
 // DBPingTimeManager include 제거 — 기능이 ServerLatencyManager에 통합됨
 #include <cstring>
 
@@ -15,8 +17,6 @@ namespace Network::DBServer
         : mLatencyManager(nullptr)
         , mOrderedTaskQueue(nullptr)
     {
-        // 생성 시 모든 패킷 핸들러 등록
-        RegisterHandlers();
     }
 
     ServerPacketHandler::~ServerPacketHandler()
@@ -31,25 +31,9 @@ namespace Network::DBServer
         mOrderedTaskQueue = orderedTaskQueue;
     }
 
-    void ServerPacketHandler::RegisterHandlers()
-    {
-        // 각 패킷 타입에 대한 핸들러 펑터 등록
-        mHandlers[static_cast<uint16_t>(ServerPacketType::ServerPingReq)] =
-            [this](Core::Session* session, const char* data, uint32_t size)
-            {
-                HandleServerPingRequest(session, reinterpret_cast<const PKT_ServerPingReq*>(data));
-            };
-
-        mHandlers[static_cast<uint16_t>(ServerPacketType::DBSavePingTimeReq)] =
-            [this](Core::Session* session, const char* data, uint32_t size)
-            {
-                HandleDBSavePingTimeRequest(session, reinterpret_cast<const PKT_DBSavePingTimeReq*>(data));
-            };
-    }
-
     void ServerPacketHandler::ProcessPacket(Core::Session* session, const char* data, uint32_t size)
     {
-        if (!session || !data || size < sizeof(ServerPacketHeader))
+        if (!session)
         {
             Logger::Warn("Invalid server packet data");
             return;
@@ -62,89 +46,45 @@ namespace Network::DBServer
             return;
         }
 
-        const ServerPacketHeader* header = reinterpret_cast<const ServerPacketHeader*>(data);
-
-        if (header->size < sizeof(ServerPacketHeader) || header->size > 4096)
-        {
-            Logger::Warn("Server packet size out of range: " + std::to_string(header->size));
-            return;
-        }
-
-        if (header->size > size)
-        {
-            Logger::Warn("Incomplete server packet - expected: " + std::to_string(header->size) +
-                ", received: " + std::to_string(size));
-            return;
-        }
-
-        // 서버 패킷 ID별 최소 길이 검증
-        uint32_t requiredSize = sizeof(ServerPacketHeader);
-        switch (static_cast<ServerPacketType>(header->id))
-        {
-        case ServerPacketType::ServerPingReq:
-            requiredSize = sizeof(PKT_ServerPingReq);
-            break;
-        case ServerPacketType::DBSavePingTimeReq:
-            requiredSize = sizeof(PKT_DBSavePingTimeReq);
-            break;
-        default:
-            break;
-        }
-
-        if (header->size < requiredSize)
-        {
-            Logger::Warn("Server packet too small for id " + std::to_string(header->id) +
-                " - expected at least: " + std::to_string(requiredSize) +
-                ", actual: " + std::to_string(header->size));
-            return;
-        }
-
-        // 펑터 맵을 사용하여 패킷 핸들러 디스패치
-        auto it = mHandlers.find(header->id);
-        if (it != mHandlers.end())
-        {
-            it->second(session, data, size);
-        }
-        else
+        // 헤더 범위, 패킷 ID별 [최소, 최대] 크기 검증 후 핸들러 직접 호출
+        const PacketDispatchResult result = DispatchTable::Dispatch(this, session, data, size);
+        if (result != PacketDispatchResult::Handled)
         {
-            Logger::Warn("Unknown packet type from game server: " + std::to_string(header->id));
+            Logger::Warn("Server packet rejected: " + DispatchTable::Describe(result, data, size));
         }
     }
 
-    void ServerPacketHandler::HandleServerPingRequest(Core::Session* session, const PKT_ServerPingReq* packet)
+    void ServerPacketHandler::HandleServerPingRequest(Core::Session* session, const PKT_ServerPingReq& packet)
     {
-        if (!session || !packet)
-        {
-            Logger::Error("HandleServerPingRequest: null pointer");
-            return;
-        }
-
         // RTT 계산 — 요청 타임스탬프와 현재 시간으로 레이턴시 측정
         uint64_t receiveTime = Timer::GetCurrentTimestamp();
-        uint64_t rttMs = receiveTime - packet->timestamp;
+        uint64_t rttMs = receiveTime - packet.timestamp;
+
+        // 서버 간 링크도 엔진 세션 타임아웃 점검 대상이므로 핑 수신 시각을 갱신
+        session->SetLastPingTime(receiveTime);
 
 #ifdef ENABLE_PINGPONG_VERBOSE_LOG
-        Logger::Debug("Server ping received - Seq: " + std::to_string(packet->sequence) +
+        Logger::Debug("Server ping received - Seq: " + std::to_string(packet.sequence) +
                      ", Latency: " + std::to_string(rttMs) + "ms");
 #else
-        if (packet->sequence % PINGPONG_LOG_INTERVAL == 0)
+        if (packet.sequence % PINGPONG_LOG_INTERVAL == 0)
         {
             Logger::Info("[DBServer] Ping received (every " + std::to_string(PINGPONG_LOG_INTERVAL) +
-                "th) - Seq: " + std::to_string(packet->sequence) +
+                "th) - Seq: " + std::to_string(packet.sequence) +
                 ", Latency: " + std::to_string(rttMs) + "ms");
         }
 #endif
 
         // 퐁 응답 즉시 전송 (저지연 경로 — OrderedTaskQueue 통과 없이 직접 send)
-        PKT_ServerPongRes response;
-        response.sequence = packet->sequence;
-        response.requestTimestamp = packet->timestamp;
-        response.responseTimestamp = receiveTime;
-
-        session->Send(response);
+        session->SendInPlace<PKT_ServerPongRes>([&packet, receiveTime](PKT_ServerPongRes& response)
+        {
+            response.sequence = packet.sequence;
+            response.requestTimestamp = packet.timestamp;
+            response.responseTimestamp = receiveTime;
+        });
 
 #ifdef ENABLE_PINGPONG_VERBOSE_LOG
-        Logger::Debug("Server pong sent - Seq: " + std::to_string(packet->sequence));
+        Logger::Debug("Server pong sent - Seq: " + std::to_string(packet.sequence));
 #endif
 
         // 서버별 추적을 위해 세션의 연결 ID에서 serverId 유도
@@ -167,7 +107,9 @@ namespace Network::DBServer
                     latencyMgr->RecordLatency(capturedServerId,
                                               "Server_" + std::to_string(capturedServerId),
                                               capturedRtt, capturedTime);
-                });
+                },
+                // 통계 샘플 — 과부하 중 오래 기다린 샘플은 버려도 다음 핑이 채운다
+                Network::Concurrency::DropPolicy::Drop);
         }
         else
         {
@@ -181,28 +123,22 @@ namespace Network::DBServer
         }
     }
 
-    void ServerPacketHandler::HandleDBSavePingTimeRequest(Core::Session* session, const PKT_DBSavePingTimeReq* packet)
+    void ServerPacketHandler::HandleDBSavePingTimeRequest(Core::Session* session, const PKT_DBSavePingTimeReq& packet)
     {
-        if (!session || !packet)
-        {
-            Logger::Error("HandleDBSavePingTimeRequest: null pointer");
-            return;
-        }
-
-        Logger::Info("DB save ping time request - ServerId: " + std::to_string(packet->serverId) +
-            ", ServerName: " + std::string(packet->serverName));
+        Logger::Info("DB save ping time request - ServerId: " + std::to_string(packet.serverId) +
+            ", ServerName: " + std::string(packet.serverName));
 
         PKT_DBSavePingTimeRes response;
-        response.serverId = packet->serverId;
+        response.serverId = packet.serverId;
 
         // serverId별 순서 보장을 위해 OrderedTaskQueue를 통해 라우팅.
         //   SavePingTime은 ServerLatencyManager에 통합됨 (DBPingTimeManager 병합).
         //   큐를 사용할 수 없으면 동기 처리로 폴백.
         if (mOrderedTaskQueue && mLatencyManager)
         {
-            const uint32_t    capturedServerId   = packet->serverId;
-            const std::string capturedServerName(packet->serverName);
-            const uint64_t    capturedTimestamp  = packet->timestamp;
+            const uint32_t    capturedServerId   = packet.serverId;
+            const std::string capturedServerName(packet.serverName);
+            const uint64_t    capturedTimestamp  = packet.timestamp;
             ServerLatencyManager* latencyMgr     = mLatencyManager;
             auto sessionRef = session->shared_from_this();
 
@@ -255,7 +191,7 @@ namespace Network::DBServer
             if (mLatencyManager && mLatencyManager->IsInitialized())
             {
                 const bool ok = mLatencyManager->SavePingTime(
-                    packet->serverId, std::string(packet->serverName), packet->timestamp);
+                    packet.serverId, std::string(packet.serverName), packet.timestamp);
 
                 if (ok)
                 {
@@ -281,4 +217,148 @@ namespace Network::DBServer
         }
     }
 
+    template <typename Packet>
+    void ServerPacketHandler::HandleDBQueryRequest(Core::Session* session, const Packet& packet, uint32_t size)
+    {
+        const char* data = reinterpret_cast<const char*>(&packet);
+
+        // 프레임을 디코드하여 소유 복사본으로 옮긴다 (수신 버퍼는 핸들러 반환 후 재사용됨)
+        std::vector<DBQueryItem> items;
+        const bool ok = ForEachDBQueryReq(data, size,
+            [&items](const DBQueryReqEntry& entry, const char* payload, uint16_t payloadLength)
+            {
+                items.push_back({entry.queryId, entry.taskType,
+                                 std::string(payload, payloadLength)});
+            });
+
+        if (!ok)
+        {
+            Logger::Warn("HandleDBQueryRequest: malformed DBQueryReq frame (" +
+                         std::to_string(size) + " bytes)");
+        }
+        if (items.empty())
+        {
+            return;
+        }
+
+        // 연결 단위 순서 보장 — 같은 게임 서버의 요청은 같은 워커에서 순서대로 처리.
+        //   배치 1개 = 작업 1개 → 응답도 배치 1프레임(가득 차면 분할)으로 전송.
+        //   배치는 shared_ptr로 공유 — 큐가 작업을 거절하면 호출 측에서 거절 응답을 보낸다.
+        auto sessionRef = session->shared_from_this();
+        auto batch      = std::make_shared<std::vector<DBQueryItem>>(std::move(items));
+        auto work = [sessionRef, batch]()
+        {
+            // 과부하로 오래 기다린 배치 — 요청자는 이미 타임아웃했을 수 있다.
+            //   쿼리를 실행하지 않고 전 항목을 Timeout(재시도 가능)으로 즉시 응답한다.
+            SendDBQueryResults(*sessionRef, *batch, Network::Concurrency::IsShedding());
+        };
+
+        if (!mOrderedTaskQueue)
+        {
+            work();
+            return;
+        }
+
+        if (!mOrderedTaskQueue->EnqueueTask(static_cast<uint32_t>(session->GetId()), std::move(work),
+                                            Network::Concurrency::DropPolicy::Reject))
+        {
+            // 큐가 받지 않았다 (종료 중 / 큐 한도) — 응답이 없으면 요청자는 자체 타임아웃까지 기다린다
+            SendDBQueryResults(*session, *batch, true);
+        }
+    }
+
+    void ServerPacketHandler::SendDBQueryResults(Core::Session& session,
+                                                 const std::vector<DBQueryItem>& items, bool reject)
+    {
+        DBQueryResBuilder builder;
+        // 송신이 한 번 실패하면 (미연결 / 송신 큐 포화) 이후 프레임은 보내지 않는다 —
+        // 쿼리는 끝까지 실행하고, 응답을 못 받은 요청자는 자체 타임아웃으로 처리한다.
+        bool sendFailed = false;
+        size_t droppedEntries = 0;
+        auto flush = [&]()
+        {
+            if (builder.Empty()) return;
+            if (!sendFailed)
+            {
+                uint32_t frameSize = 0;
+                const char* frame  = builder.Finish(frameSize);
+                const Session::SendResult result = session.Send(frame, frameSize);
+                if (result != Session::SendResult::Ok)
+                {
+                    sendFailed = true;
+                    // 요청 서버가 끊긴 것은 정상 경로 — 송신 큐 포화/잘못된 프레임만 경고
+                    if (result != Session::SendResult::NotConnected)
+                    {
+                        static LogRateLimiter sSendFailLog(1000);
+                        Logger::Warn(sSendFailLog, "DBQueryRes send failed (result {}) - Session {}",
+                                     static_cast<int>(result), session.GetId());
+                    }
+                }
+            }
+            if (sendFailed)
+            {
+                droppedEntries += builder.Count();
+            }
+            builder.Reset();
+        };
+
+        for (const auto& item : items)
+        {
+            std::string detail;
+            DBQueryResEntry entry{};
+            entry.queryId = item.queryId;
+            if (reject)
+            {
+                detail       = "server overloaded";
+                entry.result = static_cast<int32_t>(ResultCode::Timeout);
+            }
+            else
+            {
+                entry.result = static_cast<int32_t>(ExecuteDBQuery(item, detail));
+            }
+
+            if (!builder.Append(entry, detail.data(), detail.size()))
+            {
+                flush();
+                if (!builder.Append(entry, detail.data(), detail.size()))
+                {
+                    // detail이 프레임보다 크면 잘라서 전송
+                    detail.resize(DBQueryResBuilder::kMaxEntryPayload);
+                    builder.Append(entry, detail.data(), detail.size());
+                }
+            }
+        }
+        flush();
+
+        if (droppedEntries > 0)
+        {
+            Logger::Debug("DBQueryRes: {} of {} results not delivered - Session {}",
+                          droppedEntries, items.size(), session.GetId());
+        }
+    }
+
+    ResultCode ServerPacketHandler::ExecuteDBQuery(const DBQueryItem& item, std::string& outDetail)
+    {
+        // 작업 타입은 TestServer의 DBServerTaskType과 값이 같다
+        //   0 = SavePlayerProgress, 1 = LoadPlayerData
+        // DBServer에는 아직 플레이어 테이블이 없으므로 요청 형식만 검증하고 수신을 확인한다.
+        switch (item.taskType)
+        {
+        case 0:
+            if (item.data.empty())
+            {
+                outDetail = "Empty payload";
+                return ResultCode::InvalidRequest;
+            }
+            return ResultCode::Success;
+
+        case 1:
+            return ResultCode::Success;
+
+        default:
+            outDetail = "Unknown task type " + std::to_string(item.taskType);
+            return ResultCode::InvalidRequest;
+        }
+    }
+
 } // namespace Network::DBServer
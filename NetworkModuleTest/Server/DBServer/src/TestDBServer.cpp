@@ -102,6 +102,7 @@ namespace Network::DBServer
                         {
                             handlerPtr->ProcessPacket(s, data, size);
                         });
+                    session->SetPacketPriority(&ServerPacketHandler::PacketPriority);
                 });
         }
 
@@ -148,11 +149,55 @@ namespace Network::DBServer
             return false;
         }
 
+        mMetricsCollectorId = MetricsRegistry::Instance().AddCollector(
+            [this](MetricsWriter& writer) { CollectMetrics(writer); });
+
         mIsRunning.store(true);
         Logger::Info("TestDBServer started");
         return true;
     }
 
+    bool TestDBServer::StartAdminEndpoint(uint16_t port, const std::string& bindAddress)
+    {
+        if (!mEngine || !mIsRunning.load())
+        {
+            Logger::Error("StartAdminEndpoint: server not running");
+            return false;
+        }
+        return mAdminServer.Start(*mEngine, port, bindAddress);
+    }
+
+    void TestDBServer::CollectMetrics(MetricsWriter& writer) const
+    {
+        if (mOrderedTaskQueue)
+        {
+            const char* help = "Ordered task queue tasks by result";
+            writer.Counter("dbserver_ordered_tasks_total", help,
+                           mOrderedTaskQueue->GetTotalEnqueuedCount(), {{"result", "enqueued"}});
+            writer.Counter("dbserver_ordered_tasks_total", help,
+                           mOrderedTaskQueue->GetTotalProcessedCount(), {{"result", "processed"}});
+            writer.Counter("dbserver_ordered_tasks_total", help,
+                           mOrderedTaskQueue->GetTotalFailedCount(), {{"result", "failed"}});
+        }
+
+        if (mLatencyManager)
+        {
+            // RTT는 ms 단위로 집계되므로 초로 환산한 게이지로 내보낸다.
+            for (const auto& entry : mLatencyManager->GetAllLatencyInfos())
+            {
+                const auto& info = entry.second;
+                const MetricLabels labels = {{"server_id", std::to_string(info.serverId)},
+                                             {"server", info.serverName}};
+                writer.Gauge("dbserver_peer_rtt_last_seconds", "Most recent ping RTT per game server",
+                             static_cast<double>(info.lastRttMs) / 1000.0, labels);
+                writer.Gauge("dbserver_peer_rtt_avg_seconds", "Average ping RTT per game server",
+                             info.avgRttMs / 1000.0, labels);
+                writer.Counter("dbserver_peer_pings_total", "Pings recorded per game server",
+                               info.pingCount, labels);
+            }
+        }
+    }
+
     void TestDBServer::Stop()
     {
         if (!mIsRunning.load())
@@ -162,6 +207,11 @@ namespace Network::DBServer
 
         mIsRunning.store(false);
 
+        // 관리 연결을 먼저 닫고 컬렉터 해제 — 이후 종료되는 큐/관리자를 스크레이프가 읽지 않도록
+        mAdminServer.Stop();
+        MetricsRegistry::Instance().RemoveCollector(mMetricsCollectorId);
+        mMetricsCollectorId = 0;
+
         // 새로운 연결 수락을 먼저 중지
         if (mEngine)
         {
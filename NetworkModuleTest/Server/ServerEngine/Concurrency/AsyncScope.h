@@ -3,6 +3,7 @@
 // 구조화된 비동기 스코프: 태스크 인플라이트 추적 + 협력 취소.
 
 #include "KeyedDispatcher.h"
+#include "Utils/AllocationTag.h"
 #include <atomic>
 #include <cassert>
 #include <chrono>
@@ -72,6 +73,14 @@ class AsyncScope
 	template <typename Fn>
 	bool Submit(KeyedDispatcher &dispatcher, uint64_t key, Fn &&task, int timeoutMs = -1)
 	{
+		return Submit(dispatcher, key, TaskPriority::Normal, std::forward<Fn>(task), timeoutMs);
+	}
+
+	// priority 레인으로 제출 (KeyedDispatcher::Dispatch 참고 — 레인이 다르면 순서 보장 없음)
+	template <typename Fn>
+	bool Submit(KeyedDispatcher &dispatcher, uint64_t key, TaskPriority priority, Fn &&task, int timeoutMs = -1)
+	{
+		Utils::AllocTagScope allocTag(Utils::AllocTag::Dispatch);
 		BeginTask();
 
 		// 패스트패스: 이미 취소된 경우 no-op 태스크 디스패치를 피한다.
@@ -91,7 +100,7 @@ class AsyncScope
 			EndTask();
 		};
 
-		if (!dispatcher.Dispatch(key, std::move(wrapped), timeoutMs))
+		if (!dispatcher.Dispatch(key, priority, std::move(wrapped), timeoutMs))
 		{
 			EndTask();
 			return false;
@@ -126,10 +135,17 @@ class AsyncScope
 		return mInFlight.load(std::memory_order_acquire);
 	}
 
-  private:
-	void BeginTask()
+	// 디스패처 람다가 아닌 작업(코루틴 프레임 등)을 스코프에 등록한다.
+	// 취소된 스코프면 false (등록 안 함). true면 작업이 끝날 때 반드시 EndTask()를 호출해야 한다.
+	bool TryBeginTask()
 	{
-		mInFlight.fetch_add(1, std::memory_order_acq_rel);
+		BeginTask();
+		if (IsCancelled())
+		{
+			EndTask();
+			return false;
+		}
+		return true;
 	}
 
 	void EndTask()
@@ -144,6 +160,12 @@ class AsyncScope
 		}
 	}
 
+  private:
+	void BeginTask()
+	{
+		mInFlight.fetch_add(1, std::memory_order_acq_rel);
+	}
+
 	// ─────────────────────────────────────────────
 	// 취소 & 인플라이트 추적
 	// ─────────────────────────────────────────────
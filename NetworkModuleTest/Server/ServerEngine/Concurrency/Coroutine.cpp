@@ -0,0 +1,206 @@
+// 코루틴 프레임 풀 / 실행 문맥 구현
+
+#include "Coroutine.h"
+
+#if NETWORK_ENABLE_COROUTINES
+
+#include "Utils/Logger.h"
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace Network::Concurrency
+{
+
+namespace
+{
+// 프레임 크기 등급 — 핸들러 체인 한 단계는 보통 수백 바이트
+constexpr size_t kFrameSizeClasses[] = {128, 256, 512, 1024, 2048, 4096};
+constexpr size_t kFrameSizeClassCount = sizeof(kFrameSizeClasses) / sizeof(kFrameSizeClasses[0]);
+// 스레드 캐시 등급별 상한 — 넘치면 kFrameTransferBatch개를 전역 풀로 보낸다
+constexpr size_t kFrameCacheMax = 64;
+// 스레드 캐시 ↔ 전역 풀 이동 단위. Spawn한 스레드와 루트가 끝나는 워커가 다르면
+// 프레임이 한쪽으로만 흐르므로 묶음으로 되돌린다 (SharedSendBuffer 블록 풀과 같은 구조)
+constexpr size_t kFrameTransferBatch = 32;
+// 전역 풀 등급별 보관 상한 — 넘치는 프레임은 해제
+constexpr size_t kGlobalFrameMax = 4096;
+
+struct GlobalFramePool
+{
+	std::mutex          mMutex;
+	std::vector<void *> mFree[kFrameSizeClassCount];
+};
+
+// 의도적 누수 — 정적 소멸 이후에 끝나는 프레임도 안전하게 반납
+GlobalFramePool &GlobalPool()
+{
+	static GlobalFramePool *sPool = new GlobalFramePool();
+	return *sPool;
+}
+
+// 캐시 소멸 후(스레드 종료 중)에는 풀을 거치지 않는다. 자명한 타입이라 항상 읽을 수 있다.
+thread_local bool tFrameCacheDestroyed = false;
+
+// 스레드 종료 시 남은 프레임을 전역 풀로 넘긴다 (상한 초과분은 해제)
+struct FrameCache
+{
+	std::vector<void *> mFree[kFrameSizeClassCount];
+
+	~FrameCache()
+	{
+		tFrameCacheDestroyed = true;
+		GlobalFramePool &pool = GlobalPool();
+		std::lock_guard<std::mutex> lock(pool.mMutex);
+		for (size_t sizeClass = 0; sizeClass < kFrameSizeClassCount; ++sizeClass)
+		{
+			for (void *frame : mFree[sizeClass])
+			{
+				if (pool.mFree[sizeClass].size() < kGlobalFrameMax)
+					pool.mFree[sizeClass].push_back(frame);
+				else
+					::operator delete(frame);
+			}
+		}
+	}
+};
+
+thread_local FrameCache tFrameCache;
+
+size_t FrameSizeClassOf(size_t size)
+{
+	for (size_t i = 0; i < kFrameSizeClassCount; ++i)
+	{
+		if (size <= kFrameSizeClasses[i])
+			return i;
+	}
+	return kFrameSizeClassCount;
+}
+} // namespace
+
+void *CoroutineFramePool::Allocate(size_t size)
+{
+	const size_t sizeClass = FrameSizeClassOf(size);
+	if (sizeClass == kFrameSizeClassCount || tFrameCacheDestroyed)
+		return ::operator new(size);
+
+	std::vector<void *> &cache = tFrameCache.mFree[sizeClass];
+	if (cache.empty())
+	{
+		GlobalFramePool &pool = GlobalPool();
+		std::lock_guard<std::mutex> lock(pool.mMutex);
+		std::vector<void *> &global = pool.mFree[sizeClass];
+		const size_t take = global.size() < kFrameTransferBatch ? global.size() : kFrameTransferBatch;
+		cache.insert(cache.end(), global.end() - take, global.end());
+		global.resize(global.size() - take);
+	}
+	if (cache.empty())
+		return ::operator new(kFrameSizeClasses[sizeClass]);
+
+	void *frame = cache.back();
+	cache.pop_back();
+	return frame;
+}
+
+void CoroutineFramePool::Deallocate(void *frame, size_t size)
+{
+	const size_t sizeClass = FrameSizeClassOf(size);
+	if (sizeClass == kFrameSizeClassCount || tFrameCacheDestroyed)
+	{
+		::operator delete(frame);
+		return;
+	}
+
+	std::vector<void *> &cache = tFrameCache.mFree[sizeClass];
+	if (cache.size() >= kFrameCacheMax)
+	{
+		GlobalFramePool &pool = GlobalPool();
+		std::lock_guard<std::mutex> lock(pool.mMutex);
+		std::vector<void *> &global = pool.mFree[sizeClass];
+		for (size_t i = 0; i < kFrameTransferBatch; ++i)
+		{
+			void *cached = cache.back();
+			cache.pop_back();
+			if (global.size() < kGlobalFrameMax)
+				global.push_back(cached);
+			else
+				::operator delete(cached);
+		}
+	}
+	cache.push_back(frame);
+}
+
+bool CoExecutor::Resume(std::coroutine_handle<> handle) const
+{
+	// 캡처는 포인터 + 핸들 16바이트 — std::function 내부 버퍼에 들어가 할당이 없다.
+	// this는 대기 중인 프레임의 promise 안에 있으므로 재개 전까지 유효하다.
+	const CoExecutor *executor = this;
+	const bool queued = mDispatcher->Dispatch(mKey, [executor, handle]() {
+		if (executor->mScope->IsCancelled())
+			executor->DestroyRoot();
+		else
+			handle.resume();
+	});
+	if (!queued)
+		DestroyRoot();
+	return queued;
+}
+
+void CoExecutor::Abandon() const
+{
+	// 같은 키의 다른 작업과 직렬화 — 세션 워커가 이 프레임의 지역 상태를 쓰는 중일 수 있다
+	const CoExecutor *executor = this;
+	if (!mDispatcher->Dispatch(mKey, [executor]() { executor->DestroyRoot(); }))
+		DestroyRoot();
+}
+
+void CoExecutor::DestroyRoot() const
+{
+	AsyncScope *scope = mScope;
+	std::shared_ptr<void> keepAlive = mKeepAlive;
+	std::coroutine_handle<> root = mRoot;
+
+	root.destroy();
+	scope->EndTask();
+	// keepAlive는 여기서 마지막으로 해제 — 세션 풀 반납(Reset)은 스코프 in-flight 0을 요구한다
+}
+
+bool Spawn(KeyedDispatcher &dispatcher, uint64_t key, AsyncScope &scope, Task<void> task,
+           std::shared_ptr<void> keepAlive)
+{
+	if (!task.mHandle || !scope.TryBeginTask())
+		return false;
+
+	// 이후 루트 프레임은 스스로를 소유한다 (완료·취소 시 DestroyRoot)
+	const auto handle = std::exchange(task.mHandle, nullptr);
+	CoExecutor &executor = handle.promise().mExecutor;
+	executor.mDispatcher = &dispatcher;
+	executor.mKey        = key;
+	executor.mScope      = &scope;
+	executor.mRoot       = handle;
+	executor.mKeepAlive  = std::move(keepAlive);
+	return executor.Resume(handle);
+}
+
+namespace Detail
+{
+void LogUnhandledException(std::exception_ptr exception)
+{
+	try
+	{
+		std::rethrow_exception(exception);
+	}
+	catch (const std::exception &e)
+	{
+		Utils::Logger::Error("Coroutine terminated by exception: " + std::string(e.what()));
+	}
+	catch (...)
+	{
+		Utils::Logger::Error("Coroutine terminated by unknown exception");
+	}
+}
+} // namespace Detail
+
+} // namespace Network::Concurrency
+
+#endif // NETWORK_ENABLE_COROUTINES
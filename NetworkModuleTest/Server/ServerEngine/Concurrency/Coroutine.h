@@ -0,0 +1,210 @@
+#pragma once
+
+// C++20 코루틴 기반 비동기 흐름 (선택 빌드: CMake ENABLE_COROUTINES → NETWORK_ENABLE_COROUTINES).
+//
+// 콜백 체인(단계마다 std::function 클로저 힙 할당)을 코루틴 프레임 하나로 바꾼다.
+//   Task<T>    지연 시작 코루틴. co_await 하면 부모의 실행 문맥을 물려받아 대칭 전송으로 실행된다.
+//   Spawn()    루트 Task를 KeyedDispatcher 키의 워커에서 시작하고 AsyncScope에 등록한다.
+//   Yield()    같은 키 워커 큐의 뒤로 재개 (긴 루프에서 다른 세션에 양보).
+//
+// 재개: 모든 awaitable은 CoExecutor::Resume으로 루트의 디스패처 키에서 재개한다 — 같은 키의
+//       다른 작업(세션 recv/이벤트)과 직렬화되므로 세션 상태에 락이 필요 없다.
+// 할당: 프레임은 CoroutineFramePool(스레드별 크기 등급 캐시)에서 온다 — 정상 상태 0회.
+//       재개 클로저는 (실행 문맥 포인터, 핸들) 16바이트라 std::function 내부 버퍼에 들어간다.
+// 취소: 재개 시점마다 AsyncScope를 확인해 취소됐으면 재개 대신 루트 프레임을 파괴한다
+//       (지역 변수·자식 프레임 소멸자 실행). co_await 사이의 동기 구간은 중단되지 않는다.
+
+#if NETWORK_ENABLE_COROUTINES
+
+#include "AsyncScope.h"
+#include "KeyedDispatcher.h"
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Network::Concurrency
+{
+
+// 코루틴 프레임 풀 — 크기 등급별 스레드 캐시 + 묶음 단위로 주고받는 전역 풀.
+// 최대 등급보다 큰 프레임은 operator new/delete.
+struct CoroutineFramePool
+{
+	static void *Allocate(size_t size);
+	static void Deallocate(void *frame, size_t size);
+};
+
+// 루트 코루틴의 실행 문맥. 자식 Task는 co_await 될 때 값으로 복사해 간다.
+struct CoExecutor
+{
+	KeyedDispatcher        *mDispatcher = nullptr;
+	uint64_t                mKey        = 0;
+	AsyncScope             *mScope      = nullptr;
+	std::coroutine_handle<> mRoot;
+	std::shared_ptr<void>   mKeepAlive;  // 스코프 EndTask 뒤에 놓는 참조 (예: SessionRef)
+
+	// handle을 mKey의 워커에서 재개. 그때 스코프가 취소됐으면 재개 대신 루트를 파괴한다.
+	// 디스패처가 거부하면(종료 중) 호출 스레드에서 루트를 파괴하고 false.
+	bool Resume(std::coroutine_handle<> handle) const;
+
+	// 재개하지 않고 mKey의 워커에서 루트를 파괴한다 (기다리던 awaitable이 폐기될 때 — 예: 타이머 큐 종료).
+	// 디스패처가 거부하면(종료 중) 호출 스레드에서 파괴한다.
+	void Abandon() const;
+
+	// 루트 프레임 파괴 → 스코프 EndTask → keep-alive 해제 순서.
+	// *this가 파괴되는 프레임 안에 있어도 안전하다 (필요한 값을 먼저 복사).
+	void DestroyRoot() const;
+};
+
+namespace Detail
+{
+// 루트까지 올라온 예외 로그 (await 하는 부모가 없어 전달할 곳이 없다)
+void LogUnhandledException(std::exception_ptr exception);
+
+class TaskPromiseBase
+{
+  public:
+	static void *operator new(size_t size) { return CoroutineFramePool::Allocate(size); }
+	static void operator delete(void *frame, size_t size) { CoroutineFramePool::Deallocate(frame, size); }
+
+	std::suspend_always initial_suspend() const noexcept { return {}; }
+
+	// 자식: 기다리던 부모로 대칭 전송. 루트: 프레임 파괴 + 스코프 종료.
+	struct FinalAwaiter
+	{
+		bool await_ready() const noexcept { return false; }
+
+		template <typename Promise>
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) const noexcept
+		{
+			TaskPromiseBase &promise = handle.promise();
+			if (promise.mContinuation)
+				return promise.mContinuation;
+			if (promise.mException)
+				LogUnhandledException(promise.mException);
+			promise.mExecutor.DestroyRoot();
+			return std::noop_coroutine();
+		}
+
+		void await_resume() const noexcept {}
+	};
+
+	FinalAwaiter final_suspend() const noexcept { return {}; }
+
+	void unhandled_exception() noexcept { mException = std::current_exception(); }
+
+	const CoExecutor &Executor() const { return mExecutor; }
+
+	CoExecutor              mExecutor;
+	std::coroutine_handle<> mContinuation;  // co_await 한 부모 (루트면 비어 있음)
+	std::exception_ptr      mException;
+};
+
+template <typename T> class TaskPromise : public TaskPromiseBase
+{
+  public:
+	template <typename U> void return_value(U &&value) { mValue.emplace(std::forward<U>(value)); }
+
+	std::optional<T> mValue;
+};
+
+template <> class TaskPromise<void> : public TaskPromiseBase
+{
+  public:
+	void return_void() const noexcept {}
+};
+} // namespace Detail
+
+template <typename T = void> class [[nodiscard]] Task
+{
+  public:
+	struct promise_type : Detail::TaskPromise<T>
+	{
+		Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+	};
+
+	Task() = default;
+	Task(Task &&other) noexcept : mHandle(std::exchange(other.mHandle, nullptr)) {}
+	Task &operator=(Task &&other) noexcept
+	{
+		if (this != &other)
+		{
+			if (mHandle)
+				mHandle.destroy();
+			mHandle = std::exchange(other.mHandle, nullptr);
+		}
+		return *this;
+	}
+	Task(const Task &) = delete;
+	Task &operator=(const Task &) = delete;
+
+	~Task()
+	{
+		if (mHandle)
+			mHandle.destroy();
+	}
+
+	struct Awaiter
+	{
+		std::coroutine_handle<promise_type> mHandle;
+
+		bool await_ready() const noexcept { return !mHandle || mHandle.done(); }
+
+		template <typename Promise>
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> parent) const noexcept
+		{
+			mHandle.promise().mExecutor     = parent.promise().Executor();
+			mHandle.promise().mContinuation = parent;
+			return mHandle;
+		}
+
+		T await_resume() const
+		{
+			auto &promise = mHandle.promise();
+			if (promise.mException)
+				std::rethrow_exception(promise.mException);
+			if constexpr (!std::is_void_v<T>)
+				return std::move(*promise.mValue);
+		}
+	};
+
+	// 자식 Task는 부모 프레임의 임시 객체로 남아 부모가 재개된 뒤 파괴된다
+	Awaiter operator co_await() && noexcept { return Awaiter{mHandle}; }
+
+  private:
+	explicit Task(std::coroutine_handle<promise_type> handle) : mHandle(handle) {}
+
+	friend bool Spawn(KeyedDispatcher &, uint64_t, AsyncScope &, Task<void>, std::shared_ptr<void>);
+
+	std::coroutine_handle<promise_type> mHandle;
+};
+
+// task를 dispatcher의 key 워커에서 시작한다. 루트는 스스로를 소유하며, 완료·취소 시
+// 프레임을 파괴한 뒤 scope.EndTask(), 마지막으로 keepAlive를 놓는다.
+// scope가 이미 취소됐거나 디스패처가 거부하면 false (프레임은 파괴된다).
+bool Spawn(KeyedDispatcher &dispatcher, uint64_t key, AsyncScope &scope, Task<void> task,
+           std::shared_ptr<void> keepAlive = nullptr);
+
+// co_await Yield() — 같은 키 워커 큐의 뒤에서 재개
+class YieldAwaiter
+{
+  public:
+	bool await_ready() const noexcept { return false; }
+
+	template <typename Promise> void await_suspend(std::coroutine_handle<Promise> handle) const
+	{
+		handle.promise().Executor().Resume(handle);
+	}
+
+	void await_resume() const noexcept {}
+};
+
+inline YieldAwaiter Yield() { return {}; }
+
+} // namespace Network::Concurrency
+
+#endif // NETWORK_ENABLE_COROUTINES
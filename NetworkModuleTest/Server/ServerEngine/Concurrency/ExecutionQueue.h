@@ -1,7 +1,8 @@
 #pragma once
 
-// 백프레셔 제어를 지원하는 mutex 기반 실행 큐.
+// 백프레셔 제어와 우선순위 레인을 지원하는 mutex 기반 실행 큐.
 
+#include "TaskPriority.h"
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
@@ -34,7 +35,8 @@ template <typename T>
 struct ExecutionQueueOptions
 {
 	BackpressurePolicy mBackpressure = BackpressurePolicy::RejectNewest;  // 큐 포화 시 동작 정책
-	size_t mCapacity = 0;                                                  // 최대 수용 항목 수 (0 = 무제한)
+	size_t mCapacity = 0;                                                  // 레인별 최대 수용 항목 수 (0 = 무제한)
+	size_t mLaneBurstLimit = 8;                                            // 하위 레인이 기다리는 동안 상위 레인 연속 처리 상한 (0 = 엄격한 우선순위)
 };
 
 // =============================================================================
@@ -42,6 +44,10 @@ struct ExecutionQueueOptions
 //
 // - TryPush/TryPop은 항상 논블로킹.
 // - Push/Pop은 BackpressurePolicy::Block이고 큐가 가득 찼을 때 블로킹.
+// - 우선순위 레인 (TaskPriority): Pop은 비어 있지 않은 가장 높은 레인에서 꺼낸다.
+//   하위 레인에 항목이 있는데 mLaneBurstLimit번 연속으로 밀렸으면 그 레인을 한 번 먼저 처리한다
+//   (대기 상한 ≈ 상한 × 상위 작업 1개 시간). 순서는 레인 안에서만 FIFO.
+//   용량은 레인별이라 Normal이 가득 차도 Control 제출은 거부되지 않는다.
 // =============================================================================
 template <typename T>
 class ExecutionQueue
@@ -55,41 +61,41 @@ class ExecutionQueue
 	ExecutionQueue(const ExecutionQueue &) = delete;
 	ExecutionQueue &operator=(const ExecutionQueue &) = delete;
 
-	bool TryPush(const T &value)
+	bool TryPush(const T &value, TaskPriority priority = TaskPriority::Normal)
 	{
 		T copy(value);
-		return TryPush(std::move(copy));
+		return TryPush(std::move(copy), priority);
 	}
 
-	bool TryPush(T &&value)
+	bool TryPush(T &&value, TaskPriority priority = TaskPriority::Normal)
 	{
 		if (mShutdown.load(std::memory_order_acquire))
 			return false;
-		return TryPushImpl(std::move(value));
+		return TryPushImpl(std::move(value), LaneOf(priority));
 	}
 
-	bool Push(const T &value, int timeoutMs = -1)
+	bool Push(const T &value, int timeoutMs = -1, TaskPriority priority = TaskPriority::Normal)
 	{
 		T copy(value);
-		return Push(std::move(copy), timeoutMs);
+		return Push(std::move(copy), timeoutMs, priority);
 	}
 
-	bool Push(T &&value, int timeoutMs = -1)
+	bool Push(T &&value, int timeoutMs = -1, TaskPriority priority = TaskPriority::Normal)
 	{
 		if (mOptions.mBackpressure == BackpressurePolicy::RejectNewest)
-			return TryPush(std::move(value));
-		return PushBlocking(std::move(value), timeoutMs);
+			return TryPush(std::move(value), priority);
+		return PushBlocking(std::move(value), timeoutMs, LaneOf(priority));
 	}
 
 	bool TryPop(T &out)
 	{
-		std::lock_guard<std::mutex> lock(mMutex);
-		if (mQueue.empty())
-			return false;
-		out = std::move(mQueue.front());
-		mQueue.pop();
-		mSize.fetch_sub(1, std::memory_order_release);
-		mNotFullCV.notify_one();
+		size_t wakeLane = kTaskPriorityCount;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (!PopLocked(out, wakeLane))
+				return false;
+		}
+		NotifyNotFull(wakeLane);
 		return true;
 	}
 
@@ -109,7 +115,8 @@ class ExecutionQueue
 				expected, true, std::memory_order_acq_rel))
 			return;
 		mNotEmptyCV.notify_all();
-		mNotFullCV.notify_all();
+		for (auto &cv : mNotFullCV)
+			cv.notify_all();
 	}
 
 	bool IsShutdown() const { return mShutdown.load(std::memory_order_acquire); }
@@ -117,50 +124,112 @@ class ExecutionQueue
 	bool   Empty()     const { return Size() == 0; }
 	size_t Capacity()  const { return mOptions.mCapacity; }
 
+	// 레인 하나의 항목 수 (모니터링용 — 락 1회)
+	size_t Size(TaskPriority priority) const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mLanes[LaneOf(priority)].size();
+	}
+
   private:
-	bool TryPushImpl(T &&value)
+	static size_t LaneOf(TaskPriority priority)
+	{
+		const size_t lane = static_cast<size_t>(priority);
+		return lane < kTaskPriorityCount ? lane : static_cast<size_t>(TaskPriority::Normal);
+	}
+
+	// mMutex 보유 상태에서 호출. 꺼낼 레인 선택 → 하위 레인 기아 카운트 갱신.
+	// wakeLane: 가득 찼던 레인에서 꺼냈고 그 레인에 대기 생산자가 있으면 그 레인, 아니면 kTaskPriorityCount.
+	bool PopLocked(T &out, size_t &wakeLane)
+	{
+		size_t top = 0;
+		while (top < kTaskPriorityCount && mLanes[top].empty())
+			++top;
+		if (top == kTaskPriorityCount)
+			return false;
+
+		size_t lane = top;
+		for (size_t i = top + 1; i < kTaskPriorityCount; ++i)
+		{
+			if (mLanes[i].empty())
+			{
+				mLaneSkips[i] = 0;
+				continue;
+			}
+			// 가장 높은 "굶은" 하위 레인 하나만 양보받는다. 나머지는 계속 센다.
+			if (lane == top && mOptions.mLaneBurstLimit > 0 && mLaneSkips[i] >= mOptions.mLaneBurstLimit)
+				lane = i;
+			else
+				++mLaneSkips[i];
+		}
+		mLaneSkips[lane] = 0;
+
+		const bool wasFull = mOptions.mCapacity > 0 && mLanes[lane].size() >= mOptions.mCapacity;
+		out = std::move(mLanes[lane].front());
+		mLanes[lane].pop();
+		mSize.fetch_sub(1, std::memory_order_release);
+		wakeLane = (wasFull && mNotFullWaiters[lane] > 0) ? lane : kTaskPriorityCount;
+		return true;
+	}
+
+	// 락 밖에서 호출. 빈자리가 생긴 레인의 생산자 하나만 깨운다 — 빈자리가 더 있으면
+	// 깨어난 생산자가 다음 대기자에게 넘긴다 (PushBlocking).
+	void NotifyNotFull(size_t lane)
+	{
+		if (lane < kTaskPriorityCount)
+			mNotFullCV[lane].notify_one();
+	}
+
+	bool TryPushImpl(T &&value, size_t lane)
 	{
 		{
 			std::lock_guard<std::mutex> lock(mMutex);
 			if (mShutdown.load(std::memory_order_acquire))
 				return false;
-			if (mOptions.mCapacity > 0 && mQueue.size() >= mOptions.mCapacity)
+			if (mOptions.mCapacity > 0 && mLanes[lane].size() >= mOptions.mCapacity)
 				return false;
-			mQueue.push(std::move(value));
+			mLanes[lane].push(std::move(value));
 			mSize.fetch_add(1, std::memory_order_release);
 		}
 		mNotEmptyCV.notify_one();
 		return true;
 	}
 
-	bool PushBlocking(T &&value, int timeoutMs)
+	bool PushBlocking(T &&value, int timeoutMs, size_t lane)
 	{
 		std::unique_lock<std::mutex> lock(mMutex);
 		// 람다 조건식으로 spurious wakeup을 방어한다.
 		// OS는 notify 없이도 wait를 깨울 수 있으므로(spurious wakeup),
 		// 람다가 false를 반환하면 wait/wait_until이 자동으로 재대기한다.
-		auto canPush = [this] {
+		auto canPush = [this, lane] {
 			return mShutdown.load(std::memory_order_acquire) ||
 			       mOptions.mCapacity == 0 ||
-			       mQueue.size() < mOptions.mCapacity;
+			       mLanes[lane].size() < mOptions.mCapacity;
 		};
+		bool ready = true;
+		++mNotFullWaiters[lane];
 		if (timeoutMs < 0)
 		{
-			mNotFullCV.wait(lock, canPush);
+			mNotFullCV[lane].wait(lock, canPush);
 		}
 		else
 		{
 			const auto deadline = std::chrono::steady_clock::now() +
 			                      std::chrono::milliseconds(timeoutMs);
-			if (!mNotFullCV.wait_until(lock, deadline, canPush))
-				return false;
+			ready = mNotFullCV[lane].wait_until(lock, deadline, canPush);
 		}
-		if (mShutdown.load(std::memory_order_acquire))
+		--mNotFullWaiters[lane];
+		if (!ready || mShutdown.load(std::memory_order_acquire))
 			return false;
-		mQueue.push(std::move(value));
+		mLanes[lane].push(std::move(value));
 		mSize.fetch_add(1, std::memory_order_release);
+		// Pop은 가득 찬 레인에서 꺼낼 때만 깨우므로, 연속 Pop으로 빈자리가 여럿 생겼으면 다음 대기자에게 넘긴다.
+		const bool passOn = mNotFullWaiters[lane] > 0 && mOptions.mCapacity > 0 &&
+		                    mLanes[lane].size() < mOptions.mCapacity;
 		lock.unlock();
 		mNotEmptyCV.notify_one();
+		if (passOn)
+			mNotFullCV[lane].notify_one();
 		return true;
 	}
 
@@ -178,7 +247,7 @@ class ExecutionQueue
 			std::unique_lock<std::mutex> lock(mMutex);
 			auto hasItem = [this] {
 				return mShutdown.load(std::memory_order_acquire) ||
-				       !mQueue.empty();
+				       mSize.load(std::memory_order_relaxed) > 0;
 			};
 			if (timeoutMs < 0)
 				mNotEmptyCV.wait(lock, hasItem);
@@ -187,26 +256,19 @@ class ExecutionQueue
 
 			if (mShutdown.load(std::memory_order_acquire))
 				break;
-			if (!mQueue.empty())
+			size_t wakeLane = kTaskPriorityCount;
+			if (PopLocked(out, wakeLane))
 			{
-				out = std::move(mQueue.front());
-				mQueue.pop();
-				mSize.fetch_sub(1, std::memory_order_release);
 				lock.unlock();
-				mNotFullCV.notify_one();
+				NotifyNotFull(wakeLane);
 				return true;
 			}
 		}
 		// shutdown 이후 잔여 아이템 drain: Shutdown() 전에 이미 큐에 들어온 작업을 버리지 않는다.
+		// (shutdown 후 Push는 모두 실패하므로 깨울 생산자가 없다)
 		std::lock_guard<std::mutex> lock(mMutex);
-		if (!mQueue.empty())
-		{
-			out = std::move(mQueue.front());
-			mQueue.pop();
-			mSize.fetch_sub(1, std::memory_order_release);
-			return true;
-		}
-		return false;
+		size_t wakeLane = kTaskPriorityCount;
+		return PopLocked(out, wakeLane);
 	}
 
 	// ─────────────────────────────────────────────
@@ -214,15 +276,17 @@ class ExecutionQueue
 	// ─────────────────────────────────────────────
 	ExecutionQueueOptions<T>    mOptions;    // 백프레셔 정책 및 용량 한도
 	std::atomic<bool>           mShutdown;  // true → Push/Pop 즉시 거부; acq_rel 쌍으로 가시성 보장
-	std::atomic<size_t>         mSize;      // 현재 큐 항목 수; Size()/Empty() 논블로킹 조회용
+	std::atomic<size_t>         mSize;      // 전체 레인 항목 수 합; Size()/Empty() 논블로킹 조회용 (mMutex 하에서만 변경)
 
 	// ─────────────────────────────────────────────
 	// 저장소 & 동기화
 	// ─────────────────────────────────────────────
-	std::queue<T>               mQueue;       // 실제 항목을 보관하는 FIFO 컨테이너 (mMutex 보호)
-	mutable std::mutex          mMutex;       // mQueue 접근 직렬화
+	std::queue<T>               mLanes[kTaskPriorityCount];      // 우선순위별 FIFO (mMutex 보호)
+	size_t                      mLaneSkips[kTaskPriorityCount] = {};  // 레인별 연속으로 밀린 Pop 횟수 (mMutex 보호)
+	mutable std::mutex          mMutex;       // mLanes 접근 직렬화
 	std::condition_variable     mNotEmptyCV;  // 항목 추가 시 notify → Pop 대기자 깨움
-	std::condition_variable     mNotFullCV;   // 항목 제거 시 notify → Block 정책 Push 대기자 깨움
+	std::condition_variable     mNotFullCV[kTaskPriorityCount];  // 레인별 — 가득 찬 레인에서 꺼낼 때 notify_one → 그 레인의 Block 정책 Push 대기자 깨움
+	size_t                      mNotFullWaiters[kTaskPriorityCount] = {};  // 레인별 Push 대기자 수 (mMutex 보호)
 };
 
 } // namespace Network::Concurrency
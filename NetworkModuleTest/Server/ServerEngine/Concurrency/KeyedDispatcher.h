@@ -3,7 +3,12 @@
 // 키 친화도 기반 순서 보장 비동기 디스패처.
 
 #include "ExecutionQueue.h"
+#include "SojournControl.h"
+#include "Utils/AllocationTag.h"
+#include "Utils/CpuTopology.h"
 #include "Utils/Logger.h"
+#include "Utils/Metrics.h"
+#include "Utils/Timer.h"
 #include <atomic>
 #include <cstdint>
 #include <exception>
@@ -26,18 +31,38 @@ namespace Network::Concurrency
 //
 // 세션 ID를 key로 사용하면 동일 세션의 DB 작업이 항상 같은 worker에
 // 직렬화되어, 별도의 락 없이 세션 단위 순서 보장을 얻을 수 있다.
+//
+// 워커 큐는 우선순위 레인(TaskPriority)으로 나뉜다. Control 작업은 같은 워커에 쌓인
+// Normal/Bulk 작업을 앞질러 실행되고, 하위 레인은 mLaneBurstLimit 만큼만 밀린다.
+// per-key FIFO는 레인 안에서만 성립한다.
+//
+// mSojourn.mTargetMs > 0 이면 작업마다 제출 시각을 기록하고 워커별 SojournController가
+// 대기 시간으로 과부하를 판정한다. 과부하 중 stale 작업은 제출 시 지정한 DropPolicy대로
+// 버리거나(Drop) 거절 모드로 실행한다(Reject). IsOverloaded(key)로 생산자가 유입을 줄인다.
+// 판정에는 Normal/Bulk 작업만 들어간다 — Control 작업은 적체를 앞질러 바로 꺼내지므로
+// 창 최소값을 0 근처로 끌어내려 적체를 가린다 (Control 작업은 stale 판정도 받지 않는다).
 // =============================================================================
 
 class KeyedDispatcher
 {
   public:
+	// 워커 큐 항목 — 작업 + 대기 시간 판정용 제출 시각
+	struct QueuedTask
+	{
+		std::function<void()> mFn;
+		uint64_t              mEnqueueNs  = 0;                  // 0 = 기록 안 함 (SojournControl 꺼짐)
+		DropPolicy            mDropPolicy = DropPolicy::Never;
+	};
+
 	struct Options
 	{
 		// 0 이면 std::thread::hardware_concurrency() 값을 사용;
 		// hardware_concurrency()도 0을 반환하면 4로 폴백.
 		size_t mWorkerCount = 0;                                       // 생성할 워커 스레드 수
-		ExecutionQueueOptions<std::function<void()>> mQueueOptions;   // 각 워커 큐의 백프레셔/용량 설정
+		ExecutionQueueOptions<QueuedTask> mQueueOptions;               // 각 워커 큐의 백프레셔/용량 설정
+		SojournControlOptions mSojourn;                                // 대기 시간 기반 과부하 판정 (기본 끔)
 		std::string mName = "KeyedDispatcher";                         // 로그 식별용 이름
+		std::vector<int> mCpuAffinity;                                 // 워커 i → CPU [i % 크기]에 고정 (비면 고정 안 함)
 	};
 
 	struct StatsSnapshot
@@ -46,14 +71,11 @@ class KeyedDispatcher
 		size_t mRejected  = 0;  // 누적 거부(큐 포화 / 미실행) 수
 		size_t mCompleted = 0;  // 누적 완료(예외 없음) 수
 		size_t mFailed    = 0;  // 누적 실패(예외 발생) 수
+		size_t mShed      = 0;  // 누적 과부하 처리(stale 작업 Drop + Reject) 수
 	};
 
 	KeyedDispatcher()
-		: mRunning(false),
-		  mSubmitted(0),
-		  mRejected(0),
-		  mCompleted(0),
-		  mFailed(0)
+		: mRunning(false)
 	{
 	}
 
@@ -84,11 +106,12 @@ class KeyedDispatcher
 		}
 
 		mName = resolvedOptions.mName;
+		mCpuAffinity = resolvedOptions.mCpuAffinity;
 		mWorkers.clear();
 		mWorkers.reserve(resolvedOptions.mWorkerCount);
 		for (size_t i = 0; i < resolvedOptions.mWorkerCount; ++i)
 		{
-			mWorkers.push_back(std::make_unique<Worker>(resolvedOptions.mQueueOptions));
+			mWorkers.push_back(std::make_unique<Worker>(resolvedOptions.mQueueOptions, resolvedOptions.mSojourn));
 		}
 
 		mRunning.store(true, std::memory_order_release);
@@ -126,13 +149,15 @@ class KeyedDispatcher
 		}
 
 		Utils::Logger::Info(mName + ": shutdown complete - submitted=" +
-							std::to_string(mSubmitted.load(std::memory_order_relaxed)) +
+							std::to_string(mSubmitted.Value()) +
 							", completed=" +
-							std::to_string(mCompleted.load(std::memory_order_relaxed)) +
+							std::to_string(mCompleted.Value()) +
 							", failed=" +
-							std::to_string(mFailed.load(std::memory_order_relaxed)) +
+							std::to_string(mFailed.Value()) +
 							", rejected=" +
-							std::to_string(mRejected.load(std::memory_order_relaxed)));
+							std::to_string(mRejected.Value()) +
+							", shed=" +
+							std::to_string(mShed.Value()));
 
 		{
 			// exclusive lock: clear 진행 중 Dispatch()가 mWorkers에 접근하지 못하도록 막음.
@@ -144,6 +169,21 @@ class KeyedDispatcher
 
 	bool Dispatch(uint64_t key, std::function<void()> task, int timeoutMs = -1)
 	{
+		return Dispatch(key, TaskPriority::Normal, std::move(task), timeoutMs);
+	}
+
+	// priority 레인으로 제출. 같은 key의 다른 레인 작업과는 순서가 보장되지 않는다.
+	bool Dispatch(uint64_t key, TaskPriority priority, std::function<void()> task, int timeoutMs = -1)
+	{
+		return Dispatch(key, priority, DropPolicy::Never, std::move(task), timeoutMs);
+	}
+
+	// dropPolicy: 과부하 중 이 작업이 stale로 판정됐을 때의 처리 (SojournControl 켜진 경우만)
+	bool Dispatch(uint64_t key, TaskPriority priority, DropPolicy dropPolicy, std::function<void()> task,
+	              int timeoutMs = -1)
+	{
+		Utils::AllocTagScope allocTag(Utils::AllocTag::Dispatch);
+
 		// shared lock: 다수의 Dispatch() 호출이 동시에 진행될 수 있도록 허용하면서,
 		// Shutdown()의 mWorkers.clear()와의 TOCTOU 경쟁을 방지한다.
 		// mRunning 확인과 mWorkers 접근이 동일 lock 범위 안에 있으므로
@@ -152,20 +192,26 @@ class KeyedDispatcher
 
 		if (!mRunning.load(std::memory_order_acquire) || !task || mWorkers.empty())
 		{
-			mRejected.fetch_add(1, std::memory_order_relaxed);
+			mRejected.Add();
 			return false;
 		}
 
-		const size_t workerIndex = KeyToWorkerIndex(key);
+		Worker &worker = *mWorkers[KeyToWorkerIndex(key)];
+		QueuedTask item;
+		item.mFn         = std::move(task);
+		item.mEnqueueNs  = (worker.mSojourn.Enabled() && priority != TaskPriority::Control)
+		                       ? Utils::Timer::GetMonotonicNs()
+		                       : 0;
+		item.mDropPolicy = dropPolicy;
 
-		bool queued = mWorkers[workerIndex]->mQueue.Push(std::move(task), timeoutMs);
+		bool queued = worker.mQueue.Push(std::move(item), timeoutMs, priority);
 		if (queued)
 		{
-			mSubmitted.fetch_add(1, std::memory_order_relaxed);
+			mSubmitted.Add();
 			return true;
 		}
 
-		mRejected.fetch_add(1, std::memory_order_relaxed);
+		mRejected.Add();
 		return false;
 	}
 
@@ -190,27 +236,71 @@ class KeyedDispatcher
 		return mWorkers[workerIndex]->mQueue.Size();
 	}
 
+	size_t GetWorkerQueueSize(size_t workerIndex, TaskPriority priority) const
+	{
+		std::shared_lock<std::shared_mutex> sharedLock(mWorkersMutex);
+		if (workerIndex >= mWorkers.size())
+		{
+			return 0;
+		}
+		return mWorkers[workerIndex]->mQueue.Size(priority);
+	}
+
+	// key가 배정된 워커가 과부하 상태인가 (SojournControl 꺼져 있으면 항상 false)
+	bool IsOverloaded(uint64_t key) const
+	{
+		std::shared_lock<std::shared_mutex> sharedLock(mWorkersMutex);
+		if (mWorkers.empty())
+		{
+			return false;
+		}
+		return mWorkers[KeyToWorkerIndex(key)]->mSojourn.IsOverloaded();
+	}
+
+	bool IsWorkerOverloaded(size_t workerIndex) const
+	{
+		std::shared_lock<std::shared_mutex> sharedLock(mWorkersMutex);
+		if (workerIndex >= mWorkers.size())
+		{
+			return false;
+		}
+		return mWorkers[workerIndex]->mSojourn.IsOverloaded();
+	}
+
+	// 워커의 직전 관찰 창 최소 대기 시간 (ns)
+	uint64_t GetWorkerMinSojournNs(size_t workerIndex) const
+	{
+		std::shared_lock<std::shared_mutex> sharedLock(mWorkersMutex);
+		if (workerIndex >= mWorkers.size())
+		{
+			return 0;
+		}
+		return mWorkers[workerIndex]->mSojourn.MinSojournNs();
+	}
+
 	StatsSnapshot GetStats() const
 	{
 		StatsSnapshot snapshot;
-		snapshot.mSubmitted = mSubmitted.load(std::memory_order_relaxed);
-		snapshot.mRejected = mRejected.load(std::memory_order_relaxed);
-		snapshot.mCompleted = mCompleted.load(std::memory_order_relaxed);
-		snapshot.mFailed = mFailed.load(std::memory_order_relaxed);
+		snapshot.mSubmitted = mSubmitted.Value();
+		snapshot.mRejected = mRejected.Value();
+		snapshot.mCompleted = mCompleted.Value();
+		snapshot.mFailed = mFailed.Value();
+		snapshot.mShed = mShed.Value();
 		return snapshot;
 	}
 
   private:
 	struct Worker
 	{
-		explicit Worker(
-			const ExecutionQueueOptions<std::function<void()>> &queueOptions)
-			: mQueue(queueOptions)
+		Worker(const ExecutionQueueOptions<QueuedTask> &queueOptions,
+		       const SojournControlOptions &sojournOptions)
+			: mQueue(queueOptions), mSojourn(sojournOptions)
 		{
 		}
 
-		ExecutionQueue<std::function<void()>> mQueue;  // 이 워커 전용 태스크 큐 (단일 스레드 소비)
-		std::thread mThread;                           // 이 워커를 구동하는 백그라운드 스레드
+		ExecutionQueue<QueuedTask> mQueue;  // 이 워커 전용 태스크 큐 (단일 스레드 소비)
+		SojournController mSojourn;         // 이 워커 큐의 대기 시간 판정 (워커 스레드만 갱신)
+		std::thread mThread;                // 이 워커를 구동하는 백그라운드 스레드
 	};
 
 	size_t KeyToWorkerIndex(uint64_t key) const
@@ -228,42 +318,70 @@ class KeyedDispatcher
 		// join이 clear()보다 먼저 완료되므로, 이 함수의 생명주기 동안
 		// worker 참조는 항상 유효하다.
 		Worker &worker = *mWorkers[workerIndex];
-		std::function<void()> task;
+		QueuedTask item;
+		Utils::PinCurrentThread(mCpuAffinity, workerIndex, mName.c_str());
 
 		for (;;)
 		{
-			if (!worker.mQueue.Pop(task, 100))
+			if (!worker.mQueue.TryPop(item))
+			{
+				// 큐가 비었다 — 적체 해소
+				worker.mSojourn.OnIdle();
+				if (!worker.mQueue.Pop(item, 100))
+				{
+					if (!mRunning.load(std::memory_order_acquire) &&
+						worker.mQueue.Empty())
+					{
+						break;
+					}
+					continue;
+				}
+			}
+
+			bool stale = false;
+			if (item.mEnqueueNs != 0)
+			{
+				const uint64_t nowNs = Utils::Timer::GetMonotonicNs();
+				stale = worker.mSojourn.OnDequeue(nowNs - item.mEnqueueNs, nowNs) &&
+				        item.mDropPolicy != DropPolicy::Never;
+			}
+			if (stale)
 			{
-				if (!mRunning.load(std::memory_order_acquire) &&
-					worker.mQueue.Empty())
+				mShed.Add();
+				if (item.mDropPolicy == DropPolicy::Drop)
 				{
-					break;
+					item.mFn = nullptr;  // 캡처(세션 참조 등)를 지금 놓는다
+					continue;
 				}
-				continue;
 			}
 
+			Detail::tShedding = stale;
 			try
 			{
-				if (task)
+				if (item.mFn)
 				{
-					task();
+					item.mFn();
 				}
-				mCompleted.fetch_add(1, std::memory_order_relaxed);
+				mCompleted.Add();
 			}
 			catch (const std::exception &e)
 			{
-				mFailed.fetch_add(1, std::memory_order_relaxed);
+				mFailed.Add();
 				Utils::Logger::Error(mName + ": worker[" +
 									 std::to_string(workerIndex) +
 									 "] task exception: " + std::string(e.what()));
 			}
 			catch (...)
 			{
-				mFailed.fetch_add(1, std::memory_order_relaxed);
+				mFailed.Add();
 				Utils::Logger::Error(mName + ": worker[" +
 									 std::to_string(workerIndex) +
 									 "] unknown task exception");
 			}
+			Detail::tShedding = false;
+			// item은 반복마다 재사용된다 — 캡처(세션 참조 등)를 다음 태스크까지 붙잡지 않도록 지금 놓는다.
+			// 유휴 워커가 닫힌 세션의 풀 슬롯을 무기한 잡고 있지 않게 한다.
+			item.mFn = nullptr;
 		}
 	}
 
@@ -271,6 +389,7 @@ class KeyedDispatcher
 	// 식별 & 생명주기
 	// ─────────────────────────────────────────────
 	std::string mName;                                // 로그 출력에 사용되는 인스턴스 식별자
+	std::vector<int> mCpuAffinity;                    // 워커 고정 CPU 집합 (Initialize에서 설정, 이후 읽기 전용)
 	std::atomic<bool> mRunning;                       // true → 실행 중; acq_rel로 Dispatch/Shutdown 간 가시성 보장
 
 	// ─────────────────────────────────────────────
@@ -283,10 +402,12 @@ class KeyedDispatcher
 	// ─────────────────────────────────────────────
 	// 통계 카운터 (relaxed: 정확한 순서 불필요, 최종 집계 목적)
 	// ─────────────────────────────────────────────
-	std::atomic<size_t> mSubmitted;  // 큐 등록 성공 누계
-	std::atomic<size_t> mRejected;   // 큐 등록 실패(포화/미실행) 누계
-	std::atomic<size_t> mCompleted;  // 태스크 정상 완료 누계
-	std::atomic<size_t> mFailed;     // 태스크 예외 발생 누계
+	// 워커/제출 스레드마다 셀이 나뉜 카운터 — 로직 워커끼리 캐시 라인을 다투지 않는다.
+	Utils::MetricCounter mSubmitted;  // 큐 등록 성공 누계
+	Utils::MetricCounter mRejected;   // 큐 등록 실패(포화/미실행) 누계
+	Utils::MetricCounter mCompleted;  // 태스크 정상 완료 누계
+	Utils::MetricCounter mFailed;     // 태스크 예외 발생 누계
+	Utils::MetricCounter mShed;       // 과부하 stale 작업 Drop/Reject 누계
 };
 
 } // namespace Network::Concurrency
@@ -0,0 +1,109 @@
+#pragma once
+
+// 큐 대기 시간(sojourn) 기반 과부하 판정 — CoDel 방식.
+
+#include <atomic>
+#include <cstdint>
+
+namespace Network::Concurrency
+{
+
+// =============================================================================
+// DropPolicy
+//
+// 과부하 상태에서 오래 기다린(stale) 작업을 어떻게 처리할지 — 작업 종류마다 제출 시 지정.
+//
+// Never : 항상 실행. 연결/종료, 스트림 재조립(recv 청크), 상태를 바꾸는 쓰기.
+// Drop  : 실행하지 않고 버린다. 결과를 기다리는 쪽이 없는 작업 (통계 샘플, 캐시 갱신 등).
+// Reject: 실행하되 IsShedding()이 true — 작업이 본 처리 대신 빠른 거절 응답만 보낸다
+//         (요청자가 이미 타임아웃했을 DB 쿼리 등).
+// =============================================================================
+enum class DropPolicy : uint8_t
+{
+	Never,
+	Drop,
+	Reject,
+};
+
+struct SojournControlOptions
+{
+	uint32_t mTargetMs   = 0;    // 허용 대기 시간 (0 = 끔 — 시각 기록도 하지 않는다)
+	uint32_t mIntervalMs = 100;  // 최소 대기 시간 관찰 창
+};
+
+// =============================================================================
+// SojournController
+//
+// 큐 길이 대신 대기 시간으로 과부하를 판정한다 — 깊이 한도 바로 아래에 걸린 채 모든 작업이
+// 몇 초씩 기다리는 상태를 잡아낸다.
+//
+// - 창(mIntervalMs)마다 꺼낸 작업의 최소 대기 시간을 본다. 최소값이 목표를 넘으면 창 전체에서
+//   큐가 한 번도 비지 않은 것(상시 적체) → 다음 창 동안 과부하. 순간 버스트는 최소값을 올리지
+//   않으므로 과부하로 보지 않는다.
+// - 과부하 중 대기 시간이 목표의 2배를 넘은 작업이 stale — DropPolicy에 따라 버리거나 거절.
+// - 큐가 비면(OnIdle) 즉시 해제 — 적체가 사라졌다.
+//
+// OnDequeue/OnIdle은 큐 소비자(워커 1개) 전용. IsOverloaded/MinSojournNs는 어느 스레드에서나.
+// =============================================================================
+class SojournController
+{
+  public:
+	explicit SojournController(const SojournControlOptions &options)
+		: mTargetNs(static_cast<uint64_t>(options.mTargetMs) * 1000000ull),
+		  mIntervalNs(static_cast<uint64_t>(options.mIntervalMs > 0 ? options.mIntervalMs : 1) * 1000000ull)
+	{
+	}
+
+	bool Enabled() const { return mTargetNs > 0; }
+
+	// 꺼낸 작업 1개의 대기 시간 보고. true = 이 작업은 stale.
+	bool OnDequeue(uint64_t sojournNs, uint64_t nowNs)
+	{
+		if (nowNs >= mWindowEndNs)
+		{
+			const bool overloaded = mWindowEndNs != 0 && mWindowMinNs > mTargetNs;
+			mOverloaded.store(overloaded, std::memory_order_relaxed);
+			mLastMinNs.store(mWindowMinNs, std::memory_order_relaxed);
+			mWindowEndNs = nowNs + mIntervalNs;
+			mWindowMinNs = sojournNs;
+		}
+		else if (sojournNs < mWindowMinNs)
+		{
+			mWindowMinNs = sojournNs;
+		}
+		return mOverloaded.load(std::memory_order_relaxed) && sojournNs > 2 * mTargetNs;
+	}
+
+	// 소비자가 빈 큐를 만났다 — 창 최소값 0, 과부하 해제.
+	void OnIdle()
+	{
+		mWindowMinNs = 0;
+		mOverloaded.store(false, std::memory_order_relaxed);
+	}
+
+	bool IsOverloaded() const { return mOverloaded.load(std::memory_order_relaxed); }
+
+	// 직전 창의 최소 대기 시간 (모니터링용)
+	uint64_t MinSojournNs() const { return mLastMinNs.load(std::memory_order_relaxed); }
+
+  private:
+	const uint64_t mTargetNs;
+	const uint64_t mIntervalNs;
+
+	uint64_t mWindowEndNs = 0;  // 현재 창 종료 시각 (소비자 전용)
+	uint64_t mWindowMinNs = 0;  // 현재 창의 최소 대기 시간 (소비자 전용)
+
+	std::atomic<bool>     mOverloaded{false};  // 직전 창 판정 결과
+	std::atomic<uint64_t> mLastMinNs{0};       // 직전 창 최소 대기 시간
+};
+
+namespace Detail
+{
+// KeyedDispatcher 워커가 Reject 정책의 stale 작업을 실행하는 동안 true
+inline thread_local bool tShedding = false;
+} // namespace Detail
+
+// 현재 작업이 과부하로 거절 처리돼야 하는가 (DropPolicy::Reject 작업 안에서 확인)
+inline bool IsShedding() { return Detail::tShedding; }
+
+} // namespace Network::Concurrency
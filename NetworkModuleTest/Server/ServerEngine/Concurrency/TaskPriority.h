@@ -0,0 +1,48 @@
+#pragma once
+
+// 디스패처 우선순위 레인.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Network::Concurrency
+{
+
+// =============================================================================
+// TaskPriority
+//
+// ExecutionQueue / KeyedDispatcher 워커 큐의 레인. 값이 작을수록 먼저 꺼낸다.
+// 레인마다 FIFO이고, 하위 레인은 기아 방지 상한(mLaneBurstLimit)만큼만 밀린다.
+//
+// Control: 핑/퐁, 연결/종료 — 데이터 부하와 무관하게 지연이 일정해야 하는 제어 작업.
+// Normal : 기본 (패킷 핸들러, 일반 로직).
+// Bulk   : 지연에 둔감한 대량 작업 (배치 쿼리, 통계 집계 등).
+//
+// 같은 key라도 레인이 다르면 제출 순서가 보장되지 않는다 — 앞선 작업과 순서가
+// 상관없는 작업만 Normal 밖으로 보낸다.
+// =============================================================================
+enum class TaskPriority : uint8_t
+{
+	Control = 0,
+	Normal  = 1,
+	Bulk    = 2,
+};
+
+constexpr size_t kTaskPriorityCount = 3;
+
+inline const char *TaskPriorityName(TaskPriority priority)
+{
+	switch (priority)
+	{
+	case TaskPriority::Control:
+		return "control";
+	case TaskPriority::Normal:
+		return "normal";
+	case TaskPriority::Bulk:
+		return "bulk";
+	default:
+		return "?";
+	}
+}
+
+} // namespace Network::Concurrency
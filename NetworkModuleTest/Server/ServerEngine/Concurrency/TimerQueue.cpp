@@ -42,16 +42,27 @@ void TimerQueue::Shutdown()
 		mWorkerThread.join();
 	}
 
+	// 남은 항목은 락 밖에서 폐기 — 폐기 콜백이 다른 큐(디스패처)로 들어가므로
+	std::vector<TimerEntry> discarded;
 	{
 		std::lock_guard<std::mutex> lock(mMutex);
-		mHeap.clear();
+		discarded.swap(mHeap);
 		mCancelledHandles.clear();
 	}
+	for (TimerEntry &entry : discarded)
+	{
+		Discard(entry);
+	}
 
 	Utils::Logger::Info("TimerQueue: shutdown complete");
 }
 
 TimerQueue::TimerHandle TimerQueue::ScheduleOnce(TimerCallback cb, uint32_t delayMs)
+{
+	return ScheduleOnce(std::move(cb), delayMs, nullptr);
+}
+
+TimerQueue::TimerHandle TimerQueue::ScheduleOnce(TimerCallback cb, uint32_t delayMs, TimerCallback onDiscard)
 {
 	const TimerHandle handle = mNextHandle.fetch_add(1, std::memory_order_relaxed);
 
@@ -67,6 +78,7 @@ TimerQueue::TimerHandle TimerQueue::ScheduleOnce(TimerCallback cb, uint32_t dela
 	entry.nextFire   = std::chrono::steady_clock::now() + std::chrono::milliseconds(delayMs);
 	entry.intervalMs = 0;
 	entry.cb         = std::move(wrapped);
+	entry.onDiscard  = std::move(onDiscard);
 
 	PushEntry(std::move(entry));
 	return handle;
@@ -110,14 +122,47 @@ bool TimerQueue::Cancel(TimerHandle handle)
 
 void TimerQueue::PushEntry(TimerEntry e)
 {
+	bool queued = false;
 	{
 		std::lock_guard<std::mutex> lock(mMutex);
-		mHeap.push_back(std::move(e));
-		std::push_heap(mHeap.begin(), mHeap.end(), EntryCompare{});
+		// 폐기 콜백이 있는 항목은 정지 후에 받지 않는다 — Shutdown의 힙 정리가 이미 지나갔으면
+		// 아무도 폐기하지 않는다. mRunning을 락 안에서 보므로 둘 중 한쪽에서만 폐기된다.
+		if (!e.onDiscard || mRunning.load(std::memory_order_acquire))
+		{
+			mHeap.push_back(std::move(e));
+			std::push_heap(mHeap.begin(), mHeap.end(), EntryCompare{});
+			queued = true;
+		}
+	}
+	if (!queued)
+	{
+		Discard(e);
+		return;
 	}
 	mCV.notify_one();
 }
 
+void TimerQueue::Discard(TimerEntry &e)
+{
+	if (!e.onDiscard)
+	{
+		return;
+	}
+
+	try
+	{
+		e.onDiscard();
+	}
+	catch (const std::exception &ex)
+	{
+		Utils::Logger::Error("TimerQueue: discard callback exception: " + std::string(ex.what()));
+	}
+	catch (...)
+	{
+		Utils::Logger::Error("TimerQueue: discard callback unknown exception");
+	}
+}
+
 TimerQueue::TimerEntry TimerQueue::PopTop()
 {
 	// 호출자가 mMutex를 보유 중이어야 하며 mHeap은 비어있지 않아야 한다.
@@ -157,9 +202,12 @@ void TimerQueue::WorkerLoop()
 		{
 			// 가장 이른 예약 시각까지 대기한다. 새 항목 삽입이나 Cancel() 알림이
 			// 오면 더 일찍 깨어나 루프 상단에서 재평가한다.
-			mCV.wait_until(lock, fireTime, [this] {
+			// 더 이른 항목이 힙 최상단에 들어온 경우에도 깨어나야 한다 — 그렇지 않으면
+			// 기존 fireTime까지 잠들어 짧은 단발 타이머(재연결 등)가 지연된다.
+			mCV.wait_until(lock, fireTime, [this, fireTime] {
 				return !mRunning.load(std::memory_order_acquire) ||
 				       mHeap.empty() ||
+				       mHeap.front().nextFire < fireTime ||
 				       mHeap.front().nextFire <= std::chrono::steady_clock::now();
 			});
 			continue; // re-evaluate at top of loop
@@ -173,6 +221,8 @@ void TimerQueue::WorkerLoop()
 		const bool wasCancelled = mCancelledHandles.erase(entry.handle) > 0;
 		if (wasCancelled)
 		{
+			lock.unlock();
+			Discard(entry);
 			continue;
 		}
 
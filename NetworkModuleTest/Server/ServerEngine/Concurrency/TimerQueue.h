@@ -7,6 +7,7 @@
 //   - 콜백은 워커 스레드에서 실행; 짧게 유지하거나 풀로 오프로드할 것.
 //   - ScheduleRepeat: 콜백이 true를 반환하면 재등록, false를 반환하면 자동 해제.
 //   - Cancel(): 핸들을 취소 표시; 동시 호출 안전.
+//   - After(): 코루틴 빌드(NETWORK_ENABLE_COROUTINES)에서 co_await timer.After(ms).
 
 #include <algorithm>
 #include <atomic>
@@ -19,6 +20,10 @@
 #include <unordered_set>
 #include <vector>
 
+#if NETWORK_ENABLE_COROUTINES
+#include "Coroutine.h"
+#endif
+
 namespace Network::Concurrency
 {
 
@@ -38,6 +43,7 @@ class TimerQueue
 	bool Initialize();
 
 	// 워커 스레드를 정지하고 대기 중인 모든 항목을 폐기한다.
+	// 폐기 콜백이 있는 항목(After 대기)은 폐기 콜백을 호출한다.
 	void Shutdown();
 
 	// delayMs 밀리초 후 콜백을 1회 실행한다.
@@ -56,6 +62,15 @@ class TimerQueue
 		return mRunning.load(std::memory_order_acquire);
 	}
 
+#if NETWORK_ENABLE_COROUTINES
+	class AfterAwaiter;
+
+	// co_await timer.After(ms) — delayMs 후 코루틴의 디스패처 키에서 재개.
+	// 큐가 정지 상태면 바로 재개한다. Shutdown()이 대기 중인 항목을 폐기하면
+	// 기다리던 코루틴은 재개하지 않고 취소 경로(CoExecutor::Abandon)로 루트를 파괴한다.
+	AfterAwaiter After(uint32_t delayMs);
+#endif
+
   private:
 	struct TimerEntry
 	{
@@ -63,6 +78,7 @@ class TimerQueue
 		std::chrono::steady_clock::time_point nextFire; // 다음 실행 예정 시각 (min-heap 정렬 기준)
 		uint32_t intervalMs{0};                         // 반복 간격 ms; 0 = 단발(one-shot)
 		std::function<bool()> cb;                       // 실행할 콜백; true 반환 시 재등록, false 시 해제
+		TimerCallback onDiscard;                        // 실행되지 못하고 폐기(Cancel/Shutdown)될 때 호출; 선택
 	};
 
 	// min-heap 비교자: nextFire가 가장 이른 항목이 heap front에 위치한다.
@@ -74,9 +90,16 @@ class TimerQueue
 		}
 	};
 
+	// 단발 항목 등록 — onDiscard는 실행 대신 폐기될 때 호출된다 (After 대기 정리).
+	TimerHandle ScheduleOnce(TimerCallback cb, uint32_t delayMs, TimerCallback onDiscard);
+
 	// 힙에 항목을 삽입하고 워커를 깨운다.
+	// 폐기 콜백이 있는 항목이 정지 후 들어오면 넣지 않고 폐기 콜백을 호출한다.
 	void PushEntry(TimerEntry e);
 
+	// 폐기되는 항목의 onDiscard 호출 (락 밖에서)
+	static void Discard(TimerEntry &e);
+
 	// 힙 최상단(가장 이른) 항목을 꺼낸다.
 	// 호출자가 mMutex를 보유 중이어야 하며 힙이 비어있지 않아야 한다.
 	TimerEntry PopTop();
@@ -107,4 +130,42 @@ class TimerQueue
 	std::unordered_set<TimerHandle> mCancelledHandles;  // 실행 전 폐기할 핸들 집합
 };
 
+#if NETWORK_ENABLE_COROUTINES
+class TimerQueue::AfterAwaiter
+{
+  public:
+	AfterAwaiter(TimerQueue &timer, uint32_t delayMs)
+		: mTimer(timer),
+		  mDelayMs(delayMs)
+	{
+	}
+
+	bool await_ready() const noexcept { return false; }
+
+	template <typename Promise> void await_suspend(std::coroutine_handle<Promise> handle) const
+	{
+		const CoExecutor *executor = &handle.promise().Executor();
+		if (!mTimer.IsRunning())
+		{
+			executor->Resume(handle);
+			return;
+		}
+		std::coroutine_handle<> resumeHandle = handle;
+		mTimer.ScheduleOnce([executor, resumeHandle]() { executor->Resume(resumeHandle); }, mDelayMs,
+		                    [executor]() { executor->Abandon(); });
+	}
+
+	void await_resume() const noexcept {}
+
+  private:
+	TimerQueue &mTimer;
+	uint32_t    mDelayMs;
+};
+
+inline TimerQueue::AfterAwaiter TimerQueue::After(uint32_t delayMs)
+{
+	return AfterAwaiter(*this, delayMs);
+}
+#endif
+
 } // namespace Network::Concurrency
@@ -3,6 +3,7 @@
 #include "ConnectionPool.h"
 #include "DatabaseFactory.h"
 #include <algorithm>
+#include <cmath>
 #include <thread>
 
 namespace Network
@@ -10,10 +11,40 @@ namespace Network
 namespace Database
 {
 
+namespace
+{
+// 풀 ID 발급기 — thread_local 힌트가 어느 풀의 슬롯인지 구분하는 데 사용
+std::atomic<uint64_t> sNextPoolId{1};
+
+// 스레드 친화도 힌트 — 이 스레드가 마지막으로 대여한 (풀, 슬롯).
+// 한 스레드가 여러 풀을 번갈아 쓰면 힌트가 덮어써질 뿐 정확성에는 영향 없다.
+struct AffinityHint
+{
+	uint64_t mPoolId = 0;
+	size_t mSlot = static_cast<size_t>(-1);
+};
+
+thread_local AffinityHint tAffinityHint;
+
+// µs 값을 log2 버킷 인덱스로 변환 (0 → 0, [2^(i-1), 2^i) → i)
+size_t WaitBucketIndex(uint64_t us, size_t bucketCount)
+{
+	size_t index = 0;
+	while (us != 0 && index + 1 < bucketCount)
+	{
+		us >>= 1;
+		++index;
+	}
+	return index;
+}
+} // namespace
+
 ConnectionPool::ConnectionPool()
 	: mInitialized(false), mActiveConnections(0), mMaxPoolSize(10),
 		  mMinPoolSize(2), mConnectionTimeout(std::chrono::seconds(30)),
-		  mIdleTimeout(std::chrono::seconds(300))
+		  mIdleTimeout(std::chrono::seconds(300)),
+		  mMaintenanceInterval(std::chrono::seconds(5)),
+		  mPoolId(sNextPoolId.fetch_add(1, std::memory_order_relaxed))
 {
 }
 
@@ -44,21 +75,43 @@ bool ConnectionPool::Initialize(const DatabaseConfig &config)
 		mDatabase->Connect(config);
 
 		// mMinPoolSize만큼 연결을 미리 생성하여 첫 GetConnection() 대기를 줄인다
+		mConnections.reserve(mMaxPoolSize);
+		mFreeStack.reserve(mMaxPoolSize);
 		for (size_t i = 0; i < mMinPoolSize; ++i)
 		{
 			auto pConn = CreateNewConnection();
 			if (pConn)
 			{
-				mConnections.emplace_back(pConn);
+				const size_t slot = ReserveEmptySlotLocked();
+				++mLiveConnections;
+				InstallLocked(slot, std::move(pConn));
+				PushFreeLocked(slot);
 			}
 		}
 
 		mInitialized.store(true);
+		mStopMaintenance = false;
+		mMaintenanceThread =
+			std::thread(&ConnectionPool::MaintenanceThreadFunc, this);
 		return true;
 	}
 	catch (const DatabaseException &)
 	{
+		// 미리 만든 연결과 백엔드 연결을 모두 정리 — 실패한 풀이 DB 세션을 붙잡지 않도록
+		for (auto &pooled : mConnections)
+		{
+			if (pooled.mConnection)
+			{
+				pooled.mConnection->Close();
+			}
+		}
 		mConnections.clear();
+		mFreeStack.clear();
+		mEmptySlots.clear();
+		mSlotByConnection.clear();
+		mLiveConnections = 0;
+		mDatabase->Disconnect();
+		mDatabase.reset();
 		return false;
 	}
 }
@@ -70,6 +123,17 @@ void ConnectionPool::Shutdown()
 		return;
 	}
 
+	// 유지보수 스레드를 먼저 멈춘다 — 이후 슬롯 정리와 경쟁하지 않도록
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStopMaintenance = true;
+	}
+	mMaintenanceCV.notify_all();
+	if (mMaintenanceThread.joinable())
+	{
+		mMaintenanceThread.join();
+	}
+
 	// 모든 활성 연결이 반환될 때까지 최대 5초 대기
 	{
 		std::unique_lock<std::mutex> lock(mMutex);
@@ -81,21 +145,29 @@ void ConnectionPool::Shutdown()
 	// Clear() 대신 ClearLocked() 호출: 비재귀 mutex 재락킹은 UB(통상 데드락).
 	// 5초 대기 타임아웃 후에도 in-use 연결이 남으면 강제 종료하여 리소스 누수 방지.
 	{
-		std::lock_guard<std::mutex> lock(mMutex);
+		std::unique_lock<std::mutex> lock(mMutex);
 
 		// 락 내부에서 먼저 미초기화 표시.
 		// GetConnection()이 mInitialized.load() 체크를 통과한 뒤 mutex를 획득해도
 		// false를 보고 즉시 반환 — 이미 클리어된 mConnections 접근을 방지.
+		// 세대를 올려 생성 중이던 호출이 재락 후 자기 예약이 무효임을 알게 한다.
 		mInitialized.store(false);
+		++mGeneration;
+
+		// 락 밖에서 mDatabase로 연결을 만드는 중인 호출이 끝날 때까지 대기.
+		// 새 생성은 mInitialized=false를 보고 시작하지 않으므로 이 대기는 유한하다.
+		mCondition.wait(lock, [this] { return mPendingCreates == 0; });
 
 		if (mActiveConnections.load() > 0)
 		{
 			// 대기 타임아웃: in-use 여부에 무관하게 남은 연결 전체를 강제 종료
 			for (auto &pooled : mConnections)
 			{
-				pooled.mConnection->Close();
+				if (pooled.mConnection)
+				{
+					pooled.mConnection->Close();
+				}
 			}
-			mConnections.clear();
 			mActiveConnections.store(0);
 		}
 		else
@@ -103,12 +175,22 @@ void ConnectionPool::Shutdown()
 			ClearLocked();
 		}
 
+		// 슬롯 테이블 초기화 — 늦게 도착한 ReturnConnection은 역매핑 실패로 무시된다.
+		mConnections.clear();
+		mFreeStack.clear();
+		mEmptySlots.clear();
+		mSlotByConnection.clear();
+		mLiveConnections = 0;
+
 		if (mDatabase)
 		{
 			mDatabase->Disconnect();
 			mDatabase.reset();
 		}
 	}
+
+	// 풀 종료 대기 중인 GetConnection() 호출자를 깨워 예외로 빠져나가게 한다
+	mCondition.notify_all();
 }
 
 std::shared_ptr<IConnection> ConnectionPool::CreateNewConnection()
@@ -128,70 +210,200 @@ std::shared_ptr<IConnection> ConnectionPool::CreateNewConnection()
 	return std::shared_ptr<IConnection>(std::move(pConn));
 }
 
+// =============================================================================
+// 슬롯 헬퍼 — 모두 mMutex 보유 상태에서 호출
+// =============================================================================
+
+void ConnectionPool::PushFreeLocked(size_t slot)
+{
+	mConnections[slot].mFreePos = mFreeStack.size();
+	mFreeStack.push_back(slot);
+}
+
+void ConnectionPool::RemoveFreeLocked(size_t slot)
+{
+	// swap-with-top: 스택 중간 원소를 O(1)로 제거 (LIFO 순서는 근사적으로만 유지)
+	const size_t pos = mConnections[slot].mFreePos;
+	const size_t last = mFreeStack.back();
+	mFreeStack[pos] = last;
+	mConnections[last].mFreePos = pos;
+	mFreeStack.pop_back();
+	mConnections[slot].mFreePos = kNoFreePos;
+}
+
+size_t ConnectionPool::AcquireSlotLocked()
+{
+	// 1) 스레드 친화도 힌트 — 같은 워커가 직전에 쓴 연결이 유휴이면 그것을 재사용
+	if (tAffinityHint.mPoolId == mPoolId &&
+		tAffinityHint.mSlot < mConnections.size())
+	{
+		const size_t hinted = tAffinityHint.mSlot;
+		if (mConnections[hinted].mFreePos != kNoFreePos)
+		{
+			RemoveFreeLocked(hinted);
+			mAffinityHits.fetch_add(1, std::memory_order_relaxed);
+			return hinted;
+		}
+	}
+
+	// 2) 일반 경로 — 스택 top (가장 최근 반환된 연결)
+	if (mFreeStack.empty())
+	{
+		return kNoFreePos;
+	}
+
+	const size_t slot = mFreeStack.back();
+	mFreeStack.pop_back();
+	mConnections[slot].mFreePos = kNoFreePos;
+	return slot;
+}
+
+size_t ConnectionPool::ReserveEmptySlotLocked()
+{
+	if (!mEmptySlots.empty())
+	{
+		const size_t slot = mEmptySlots.back();
+		mEmptySlots.pop_back();
+		return slot;
+	}
+
+	mConnections.emplace_back();
+	return mConnections.size() - 1;
+}
+
+void ConnectionPool::InstallLocked(size_t slot,
+								   std::shared_ptr<IConnection> pConn)
+{
+	auto &pooled = mConnections[slot];
+	mSlotByConnection[pConn.get()] = slot;
+	pooled.mConnection = std::move(pConn);
+	pooled.mLastUsed = std::chrono::steady_clock::now();
+	pooled.mInUse = false;
+	pooled.mFreePos = kNoFreePos;
+}
+
+std::shared_ptr<IConnection> ConnectionPool::ReleaseSlotLocked(size_t slot)
+{
+	auto &pooled = mConnections[slot];
+	std::shared_ptr<IConnection> pConn = std::move(pooled.mConnection);
+	if (pConn)
+	{
+		mSlotByConnection.erase(pConn.get());
+	}
+	pooled.mConnection.reset();
+	pooled.mInUse = false;
+	pooled.mFreePos = kNoFreePos;
+	mEmptySlots.push_back(slot);
+	--mLiveConnections;
+	return pConn;
+}
+
+// =============================================================================
+// 체크아웃 / 반환
+// =============================================================================
+
 std::shared_ptr<IConnection> ConnectionPool::GetConnection()
 {
+	const auto start = std::chrono::steady_clock::now();
+
 	if (!mInitialized.load())
 	{
 		throw DatabaseException("Connection pool not initialized");
 	}
 
 	std::unique_lock<std::mutex> lock(mMutex);
+	const auto deadline = start + mConnectionTimeout;
 
-	// 락 획득 후 mInitialized 재확인.
-	// Shutdown()이 동일 mutex 내부 첫 동작으로 false로 설정하므로,
-	// 위의 선락킹 load() 체크를 통과한 스레드가 Shutdown()과 경쟁할 수 있다.
-	// 재확인 없으면 wait_for 진행 후 nullptr mDatabase에서 CreateNewConnection() 호출
-	// → null 포인터 역참조가 된다.
-	if (!mInitialized.load(std::memory_order_relaxed))
+	for (;;)
 	{
-		throw DatabaseException("Connection pool is shutting down");
-	}
+		// 락 획득(또는 대기 후 재획득) 후 mInitialized 재확인.
+		// Shutdown()이 동일 mutex 내부에서 false로 설정하므로,
+		// 위의 선락킹 load() 체크를 통과한 스레드가 Shutdown()과 경쟁할 수 있다.
+		// 재확인 없으면 nullptr mDatabase에서 CreateNewConnection() 호출
+		// → null 포인터 역참조가 된다.
+		if (!mInitialized.load(std::memory_order_relaxed))
+		{
+			throw DatabaseException("Connection pool is shutting down");
+		}
 
-	// 사용 가능한 연결이 생길 때까지 mConnectionTimeout 동안 대기
-	bool acquired = mCondition.wait_for(
-		lock, mConnectionTimeout,
-		[this]
+		// 유휴 슬롯 대여 — O(1), IsOpen() 검증은 유지보수 스레드 몫
+		const size_t slot = AcquireSlotLocked();
+		if (slot != kNoFreePos)
 		{
-			for (auto &pooled : mConnections)
+			auto &pooled = mConnections[slot];
+			pooled.mInUse = true;
+			pooled.mLastUsed = std::chrono::steady_clock::now();
+			mActiveConnections.fetch_add(1);
+			std::shared_ptr<IConnection> pConn = pooled.mConnection;
+			lock.unlock();
+
+			tAffinityHint.mPoolId = mPoolId;
+			tAffinityHint.mSlot = slot;
+			RecordWait(start);
+			return pConn;
+		}
+
+		// 유휴 연결 없고 풀 상한 미만이면 슬롯을 예약한 뒤 락 밖에서 새 연결 생성.
+		// 생성(네트워크 왕복)이 다른 스레드의 체크아웃/반환을 막지 않도록 한다.
+		// 생성 중인 호출은 mPendingCreates로 세어 Shutdown()이 mDatabase 해제 전에 기다리게 한다.
+		if (mLiveConnections < mMaxPoolSize)
+		{
+			const size_t newSlot = ReserveEmptySlotLocked();
+			const uint64_t generation = mGeneration;
+			++mLiveConnections;
+			++mPendingCreates;
+			lock.unlock();
+
+			std::shared_ptr<IConnection> pConn;
+			try
 			{
-				if (!pooled.mInUse && pooled.mConnection->IsOpen())
+				pConn = CreateNewConnection();
+			}
+			catch (...)
+			{
+				lock.lock();
+				--mPendingCreates;
+				if (generation == mGeneration)
 				{
-					return true;
+					mEmptySlots.push_back(newSlot);
+					--mLiveConnections;
 				}
+				// 슬롯 대기자 + Shutdown()의 mPendingCreates 대기를 함께 깨운다
+				mCondition.notify_all();
+				throw;
 			}
-			// 풀 상한 미만이면 새 연결 생성 가능 — 대기 해제
-			return mConnections.size() < mMaxPoolSize;
-		});
 
-	if (!acquired)
-	{
-		throw DatabaseException(
-			"Connection pool timeout - no connections available");
-	}
+			lock.lock();
+			--mPendingCreates;
+			if (generation != mGeneration)
+			{
+				// 생성 중 Shutdown — 슬롯 테이블이 이미 초기화됨 (재 Initialize됐어도 이전 세대 예약)
+				mCondition.notify_all();
+				lock.unlock();
+				pConn->Close();
+				throw DatabaseException("Connection pool is shutting down");
+			}
 
-	// 유휴 연결(mInUse=false, IsOpen=true)을 먼저 찾아 반환
-	for (auto &pooled : mConnections)
-	{
-		if (!pooled.mInUse && pooled.mConnection->IsOpen())
-		{
-			pooled.mInUse = true;
-			pooled.mLastUsed = std::chrono::steady_clock::now();
+			InstallLocked(newSlot, pConn);
+			mConnections[newSlot].mInUse = true;
 			mActiveConnections.fetch_add(1);
-			return pooled.mConnection;
+			lock.unlock();
+
+			tAffinityHint.mPoolId = mPoolId;
+			tAffinityHint.mSlot = newSlot;
+			RecordWait(start);
+			return pConn;
 		}
-	}
 
-	// 유휴 연결 없고 풀 상한 미만이면 새 연결 생성
-	if (mConnections.size() < mMaxPoolSize)
-	{
-		auto pConn = CreateNewConnection();
-		mConnections.emplace_back(pConn);
-		mConnections.back().mInUse = true;
-		mActiveConnections.fetch_add(1);
-		return pConn;
+		// 사용 가능한 연결이 생길 때까지 deadline까지 대기
+		if (std::chrono::steady_clock::now() >= deadline)
+		{
+			mWaitTimeouts.fetch_add(1, std::memory_order_relaxed);
+			throw DatabaseException(
+				"Connection pool timeout - no connections available");
+		}
+		mCondition.wait_until(lock, deadline);
 	}
-
-	throw DatabaseException("No connections available");
 }
 
 void ConnectionPool::ReturnConnection(std::shared_ptr<IConnection> pConnection)
@@ -203,34 +415,50 @@ void ConnectionPool::ReturnConnection(std::shared_ptr<IConnection> pConnection)
 
 	std::lock_guard<std::mutex> lock(mMutex);
 
-	for (auto &pooled : mConnections)
+	// 역매핑으로 O(1) 슬롯 조회 — 풀에 없는 연결(Shutdown 이후 등)은 무시
+	auto it = mSlotByConnection.find(pConnection.get());
+	if (it == mSlotByConnection.end())
 	{
-		if (pooled.mConnection == pConnection)
-		{
-			pooled.mInUse = false;
-			pooled.mLastUsed = std::chrono::steady_clock::now();
-			mActiveConnections.fetch_sub(1);
-			mCondition.notify_one();
-			return;
-		}
+		return;
+	}
+
+	const size_t slot = it->second;
+	auto &pooled = mConnections[slot];
+	if (!pooled.mInUse)
+	{
+		return;
+	}
+
+	pooled.mInUse = false;
+	pooled.mLastUsed = std::chrono::steady_clock::now();
+	PushFreeLocked(slot);
+
+	// 마지막 연결 반환이면 Shutdown() 대기자도 깨워야 하므로 notify_all
+	if (mActiveConnections.fetch_sub(1) == 1)
+	{
+		mCondition.notify_all();
+	}
+	else
+	{
+		mCondition.notify_one();
 	}
 }
 
 void ConnectionPool::ClearLocked()
 {
 	// 호출자가 이미 mMutex를 보유해야 한다 — 여기서 락 획득 안 함.
-	for (auto it = mConnections.begin(); it != mConnections.end();)
+	// 유휴 슬롯(스택에 있는 것)만 닫는다. 대여/검증 중 슬롯은 건드리지 않는다.
+	for (size_t slot : mFreeStack)
 	{
-		if (!it->mInUse)
+		mConnections[slot].mFreePos = kNoFreePos;
+		auto pConn = ReleaseSlotLocked(slot);
+		if (pConn)
 		{
-			it->mConnection->Close();
-			it = mConnections.erase(it);
-		}
-		else
-		{
-			++it;
+			pConn->Close();
 		}
 	}
+	mFreeStack.clear();
+	mCondition.notify_all();
 }
 
 void ConnectionPool::Clear()
@@ -247,21 +475,14 @@ size_t ConnectionPool::GetActiveConnections() const
 size_t ConnectionPool::GetAvailableConnections() const
 {
 	std::lock_guard<std::mutex> lock(mMutex);
-	size_t available = 0;
-	for (const auto &pooled : mConnections)
-	{
-		if (!pooled.mInUse && pooled.mConnection->IsOpen())
-		{
-			++available;
-		}
-	}
-	return available;
+	return mFreeStack.size();
 }
 
 void ConnectionPool::SetMaxPoolSize(size_t size)
 {
 	std::lock_guard<std::mutex> lock(mMutex);
 	mMaxPoolSize = size;
+	mCondition.notify_all();
 }
 
 void ConnectionPool::SetMinPoolSize(size_t size)
@@ -280,36 +501,182 @@ void ConnectionPool::SetIdleTimeout(int seconds)
 	mIdleTimeout = std::chrono::seconds(seconds);
 }
 
-size_t ConnectionPool::GetTotalConnections() const
+void ConnectionPool::SetMaintenanceInterval(int seconds)
 {
 	std::lock_guard<std::mutex> lock(mMutex);
-	return mConnections.size();
+	mMaintenanceInterval = std::chrono::seconds(std::max(1, seconds));
 }
 
-void ConnectionPool::CleanupIdleConnections()
+size_t ConnectionPool::GetTotalConnections() const
 {
 	std::lock_guard<std::mutex> lock(mMutex);
+	return mSlotByConnection.size();
+}
+
+// =============================================================================
+// 백그라운드 유지보수
+// =============================================================================
+
+void ConnectionPool::MaintenanceThreadFunc()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	while (!mStopMaintenance)
+	{
+		mMaintenanceCV.wait_for(lock, mMaintenanceInterval,
+								[this] { return mStopMaintenance; });
+		if (mStopMaintenance)
+		{
+			break;
+		}
 
-	auto now = std::chrono::steady_clock::now();
+		lock.unlock();
+		CleanupIdleConnections();
+		lock.lock();
+	}
+}
 
-	for (auto it = mConnections.begin(); it != mConnections.end();)
+void ConnectionPool::CleanupIdleConnections()
+{
+	std::vector<size_t> candidates;
 	{
-		if (!it->mInUse)
+		std::lock_guard<std::mutex> lock(mMutex);
+		candidates = mFreeStack;
+	}
+
+	// 슬롯을 하나씩 꺼내 검증한다 — 한 번에 최대 1개만 풀에서 빠지므로
+	// 체크아웃 경로의 가용 연결이 크게 줄지 않는다.
+	for (size_t slot : candidates)
+	{
+		std::shared_ptr<IConnection> pConn;
+		bool expired = false;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (mStopMaintenance)
+			{
+				return;
+			}
+			if (slot >= mConnections.size() ||
+				mConnections[slot].mFreePos == kNoFreePos)
+			{
+				continue; // 그 사이 대여되었거나 Clear됨
+			}
+
+			auto &pooled = mConnections[slot];
+			const auto idleDuration = std::chrono::duration_cast<std::chrono::seconds>(
+				std::chrono::steady_clock::now() - pooled.mLastUsed);
+			// 수립된 연결 수로 비교한다 — mLiveConnections에는 생성 중인 예약이 섞여 있어
+			// 생성이 실패하면 mMinPoolSize 아래로 회수될 수 있다.
+			expired = idleDuration > mIdleTimeout &&
+					  mSlotByConnection.size() > mMinPoolSize;
+
+			RemoveFreeLocked(slot);
+			if (expired)
+			{
+				pConn = ReleaseSlotLocked(slot);
+			}
+			else
+			{
+				pooled.mInUse = true; // 검증 중 — 대여 불가
+				pConn = pooled.mConnection;
+			}
+		}
+
+		if (expired)
 		{
-			auto idleDuration =
-				std::chrono::duration_cast<std::chrono::seconds>(now -
-																 it->mLastUsed);
+			pConn->Close();
+			continue;
+		}
+
+		// 락 밖에서 검증 — 백엔드에 따라 IsOpen()이 왕복을 유발할 수 있다
+		const bool alive = pConn->IsOpen();
 
-			if (idleDuration > mIdleTimeout &&
-				mConnections.size() > mMinPoolSize)
+		std::shared_ptr<IConnection> pDead;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (alive)
+			{
+				mConnections[slot].mInUse = false;
+				PushFreeLocked(slot);
+			}
+			else
 			{
-				it->mConnection->Close();
-				it = mConnections.erase(it);
-				continue;
+				// 죽은 연결 폐기 — 빈 자리는 다음 GetConnection()이 새로 채운다
+				pDead = ReleaseSlotLocked(slot);
 			}
+			mCondition.notify_one();
+		}
+
+		if (pDead)
+		{
+			pDead->Close();
+		}
+	}
+}
+
+// =============================================================================
+// 대기 시간 히스토그램
+// =============================================================================
+
+void ConnectionPool::RecordWait(std::chrono::steady_clock::time_point start)
+{
+	const uint64_t us = static_cast<uint64_t>(
+		std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - start)
+			.count());
+
+	mWaitCount.fetch_add(1, std::memory_order_relaxed);
+	mWaitTotalUs.fetch_add(us, std::memory_order_relaxed);
+	mWaitBuckets[WaitBucketIndex(us, kWaitBucketCount)].fetch_add(
+		1, std::memory_order_relaxed);
+
+	uint64_t prevMax = mWaitMaxUs.load(std::memory_order_relaxed);
+	while (us > prevMax &&
+		   !mWaitMaxUs.compare_exchange_weak(prevMax, us,
+											 std::memory_order_relaxed))
+	{
+	}
+}
+
+ConnectionPool::WaitHistogram ConnectionPool::GetWaitHistogram() const
+{
+	WaitHistogram snapshot;
+	snapshot.mCount = mWaitCount.load(std::memory_order_relaxed);
+	snapshot.mTimeouts = mWaitTimeouts.load(std::memory_order_relaxed);
+	snapshot.mTotalWaitUs = mWaitTotalUs.load(std::memory_order_relaxed);
+	snapshot.mMaxWaitUs = mWaitMaxUs.load(std::memory_order_relaxed);
+	snapshot.mAffinityHits = mAffinityHits.load(std::memory_order_relaxed);
+	for (size_t i = 0; i < kWaitBucketCount; ++i)
+	{
+		snapshot.mBuckets[i] = mWaitBuckets[i].load(std::memory_order_relaxed);
+	}
+	return snapshot;
+}
+
+uint64_t ConnectionPool::WaitHistogram::Percentile(double p) const
+{
+	uint64_t total = 0;
+	for (uint64_t count : mBuckets)
+	{
+		total += count;
+	}
+	if (total == 0)
+	{
+		return 0;
+	}
+
+	const uint64_t target = std::max<uint64_t>(
+		1, static_cast<uint64_t>(std::ceil(p * static_cast<double>(total))));
+	uint64_t cumulative = 0;
+	for (size_t i = 0; i < kWaitBucketCount; ++i)
+	{
+		cumulative += mBuckets[i];
+		if (cumulative >= target)
+		{
+			// 버킷 상한 (µs): 버킷 0 = 1µs 미만, 버킷 i = 2^i µs 미만
+			return (i == 0) ? 1 : std::min<uint64_t>(uint64_t(1) << i, mMaxWaitUs);
 		}
-		++it;
 	}
+	return mMaxWaitUs;
 }
 
 } // namespace Database
@@ -2,6 +2,29 @@
 
 // 연결 풀(connection pool) 구현.
 //
+// 체크아웃 경로 (O(1)):
+//   - 유휴 슬롯 인덱스를 mFreeStack(LIFO)에 보관한다. GetConnection()은 스택 top을
+//     pop, ReturnConnection()은 push만 하므로 mMutex 보유 구간이 상수 시간이다.
+//   - 슬롯마다 mFreePos(스택 내 위치)를 기록하여 임의 슬롯을 O(1)로 꺼낼 수 있다
+//     (swap-with-top). 스레드 친화도 힌트 경로가 이를 사용한다.
+//   - 반환 시 연결 → 슬롯 매핑은 mSlotByConnection(해시)으로 O(1) 조회한다.
+//   - 체크아웃 경로에서 IsOpen()을 호출하지 않는다. 검증은 백그라운드 스레드 담당.
+//
+// 스레드 친화도 (affinity hint):
+//   - 스레드별(thread_local)로 "이 풀에서 마지막으로 반환한 슬롯"을 기억한다.
+//     해당 슬롯이 유휴이면 스택 top 대신 그 슬롯을 우선 대여하여 같은 워커가
+//     같은 연결을 재사용하도록 한다 (연결별 statement 캐시 유지).
+//   - 힌트 슬롯이 다른 스레드에 대여 중이면 일반 경로(스택 top)로 폴백.
+//
+// 백그라운드 유지보수 스레드 (mMaintenanceThread):
+//   - mMaintenanceInterval마다 유휴 연결만 꺼내 mMutex 밖에서 IsOpen()으로 검증한다.
+//     죽은 연결은 폐기하고, mIdleTimeout을 넘긴 유휴 연결은 mMinPoolSize까지 회수한다.
+//   - 검증 중인 슬롯은 스택에서 빠져 있으므로 체크아웃 경로와 경쟁하지 않는다.
+//
+// 대기 시간 히스토그램:
+//   - GetConnection() 진입 ~ 대여 완료까지의 시간을 log2(µs) 버킷에 누적한다.
+//     GetWaitHistogram()으로 스냅샷 조회 (락 없음, relaxed atomic).
+//
 // Thread-safety 보장 방식:
 //   - mMutex(std::mutex) + mCondition(std::condition_variable)으로
 //     GetConnection() 대기 및 ReturnConnection() 알림을 처리한다.
@@ -11,12 +34,17 @@
 //     Shutdown()과의 경쟁 조건(null dereference)을 방지한다.
 //   - ClearLocked()는 이미 mMutex를 보유한 호출자(Shutdown 등)만 사용하여
 //     비재귀 mutex의 재진입으로 인한 데드락을 원천 차단한다.
+//   - 새 연결 생성(CreateNewConnection)은 슬롯을 먼저 예약한 뒤 mMutex 밖에서 수행한다.
+//     진행 중인 생성은 mPendingCreates로 센다 — Shutdown()은 이 값이 0이 될 때까지
+//     기다린 뒤에 mDatabase를 해제한다 (생성 스레드가 해제된 DB를 쓰지 않도록).
+//     생성 도중의 Shutdown(및 재 Initialize)은 mGeneration 비교로 판별한다.
 //
 // 풀 크기 기본값 (DatabaseConfig에서 오버라이드 가능):
 //   - mMaxPoolSize = 10: 동시 active 연결 상한. 초과 시 타임아웃까지 블록.
 //   - mMinPoolSize = 2: 초기화 시 미리 생성하는 연결 수 (워밍업).
 //   - mConnectionTimeout = 30초: GetConnection() 대기 최대 시간.
 //   - mIdleTimeout = 300초: 유휴 연결 회수 기준 시간 (mMinPoolSize 미만으로는 회수 안 함).
+//   - mMaintenanceInterval = 5초: 백그라운드 검증/회수 주기.
 
 #include "../Interfaces/DatabaseConfig.h"
 #include "../Interfaces/DatabaseException.h"
@@ -26,7 +54,8 @@
 #include <chrono>
 #include <condition_variable>
 #include <mutex>
-#include <queue>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace Network
@@ -65,37 +94,76 @@ class ConnectionPool : public IConnectionPool
 	// 타임아웃은 atomic 없이 단순 대입 (조정 시 동시 GetConnection 없다고 가정)
 	void SetConnectionTimeout(int seconds);
 	void SetIdleTimeout(int seconds);
+	// 백그라운드 검증/회수 주기 (다음 주기부터 적용)
+	void SetMaintenanceInterval(int seconds);
 
 	bool IsInitialized() const { return mInitialized.load(); }
 
 	size_t GetTotalConnections() const;
 
+	// 대기 시간 히스토그램 — 버킷 i는 [2^(i-1), 2^i) µs 구간 (버킷 0은 1µs 미만).
+	// 마지막 버킷은 그 이상 전부를 포함한다.
+	static constexpr size_t kWaitBucketCount = 32;
+
+	struct WaitHistogram
+	{
+		uint64_t mCount = 0;                          // 누적 GetConnection() 성공 횟수
+		uint64_t mTimeouts = 0;                       // 타임아웃으로 실패한 횟수
+		uint64_t mTotalWaitUs = 0;                    // 대기 시간 합계 (평균 계산용)
+		uint64_t mMaxWaitUs = 0;                      // 관측된 최대 대기 시간
+		uint64_t mAffinityHits = 0;                   // 스레드 친화도 힌트로 같은 슬롯을 재사용한 횟수
+		uint64_t mBuckets[kWaitBucketCount] = {};     // log2(µs) 버킷별 횟수
+
+		// 백분위 근사값 (버킷 상한 µs). p는 0.0~1.0.
+		uint64_t Percentile(double p) const;
+	};
+
+	WaitHistogram GetWaitHistogram() const;
+
   private:
 	// ClearLocked — 호출자가 이미 mMutex를 보유한 상태에서만 호출.
 	// 비재귀 mutex 재진입으로 인한 데드락을 방지하기 위해 Clear()와 분리.
 	void ClearLocked();
 
-	// 풀링된 연결 항목 — 연결 객체, 마지막 사용 시각, 사용 중 여부를 묶음
+	static constexpr size_t kNoFreePos = static_cast<size_t>(-1);
+
+	// 풀링된 연결 슬롯 — 인덱스가 고정되어 스레드 친화도 힌트와 역매핑에 사용된다.
+	// mConnection이 null이면 빈 슬롯(회수됨/생성 중)이며 mEmptySlots에 보관된다.
 	struct PooledConnection
 	{
-		std::shared_ptr<IConnection> mConnection;              // 풀링된 연결 인스턴스
+		std::shared_ptr<IConnection> mConnection;              // 풀링된 연결 인스턴스 (null = 빈 슬롯)
 		std::chrono::steady_clock::time_point mLastUsed;       // 마지막으로 GetConnection/ReturnConnection된 시각 (아이들 타임아웃 기준)
-		bool mInUse;                                           // true이면 현재 대여 중, false이면 유휴
-
-		PooledConnection(std::shared_ptr<IConnection> pConn)
-			: mConnection(std::move(pConn)),
-				  mLastUsed(std::chrono::steady_clock::now()), mInUse(false)
-		{
-		}
+		bool mInUse = false;                                   // true이면 현재 대여 중(또는 검증 중), false이면 유휴
+		size_t mFreePos = kNoFreePos;                          // mFreeStack 내 위치 (kNoFreePos = 스택에 없음)
 	};
 
+	// 슬롯 조작 헬퍼 — 모두 mMutex 보유 상태에서만 호출
+	void PushFreeLocked(size_t slot);
+	void RemoveFreeLocked(size_t slot);
+	size_t AcquireSlotLocked();     // 유휴 슬롯 1개 대여 (없으면 kNoFreePos)
+	size_t ReserveEmptySlotLocked(); // 새 연결을 담을 빈 슬롯 확보
+	void InstallLocked(size_t slot, std::shared_ptr<IConnection> pConn);
+	// 슬롯의 연결을 분리하고 빈 슬롯으로 되돌린다. 분리된 연결을 반환 (Close는 락 밖에서).
+	std::shared_ptr<IConnection> ReleaseSlotLocked(size_t slot);
+
+	void MaintenanceThreadFunc();
+	void RecordWait(std::chrono::steady_clock::time_point start);
+
 	std::shared_ptr<IConnection> CreateNewConnection();
+	// CleanupIdleConnections — 유지보수 스레드 전용. 유휴 슬롯을 하나씩 꺼내 락 밖에서
+	// IsOpen()으로 검증하고, 죽었거나 mIdleTimeout을 넘긴 연결(mMinPoolSize 초과분)을 회수한다.
 	void CleanupIdleConnections();
 
   private:
 	DatabaseConfig mConfig;                          // Initialize() 시 전달된 설정 복사본
 	std::unique_ptr<IDatabase> mDatabase;            // 백엔드 DB 인스턴스 (DatabaseFactory로 생성) — 연결 팩토리 역할
-	std::vector<PooledConnection> mConnections;      // 풀에 등록된 모든 연결 항목 목록 (mMutex로 보호)
+	std::vector<PooledConnection> mConnections;      // 연결 슬롯 목록 — 인덱스 고정, 축소하지 않음 (mMutex로 보호)
+	std::vector<size_t> mFreeStack;                  // 유휴 슬롯 인덱스 스택 (LIFO — 최근 반환 연결 우선)
+	std::vector<size_t> mEmptySlots;                 // 연결이 없는 빈 슬롯 인덱스 (재사용 대기)
+	std::unordered_map<const IConnection *, size_t> mSlotByConnection; // 연결 → 슬롯 역매핑 (ReturnConnection O(1)); size() = 수립된 연결 수 (회수 하한 비교용)
+	size_t mLiveConnections = 0;                     // 연결 보유 슬롯 수 + 생성 중인 예약 수 (mMaxPoolSize 비교용)
+	size_t mPendingCreates = 0;                      // mMutex 밖에서 CreateNewConnection() 중인 호출 수 (mMutex로 보호)
+	uint64_t mGeneration = 0;                        // Shutdown()마다 증가 — 생성 중 종료/재초기화 판별 (mMutex로 보호)
 	mutable std::mutex mMutex;                       // mConnections 접근 및 condition wait/notify 보호
 	std::condition_variable mCondition;              // GetConnection() 대기 및 ReturnConnection() 알림
 	std::atomic<bool> mInitialized;                  // Initialize() 성공 후 true; Shutdown() 시 false
@@ -106,6 +174,24 @@ class ConnectionPool : public IConnectionPool
 	size_t mMinPoolSize;                             // 초기 미리 생성 연결 수 (기본 2)
 	std::chrono::seconds mConnectionTimeout;         // GetConnection() 최대 대기 시간 (기본 30초)
 	std::chrono::seconds mIdleTimeout;               // 유휴 연결 회수 기준 경과 시간 (기본 300초)
+	std::chrono::seconds mMaintenanceInterval;       // 백그라운드 검증/회수 주기 (기본 5초)
+
+	// 백그라운드 유지보수 스레드 — Initialize()에서 시작, Shutdown()에서 join
+	std::thread mMaintenanceThread;                  // 유휴 연결 IsOpen 검증 + 아이들 회수 담당
+	std::condition_variable mMaintenanceCV;          // Shutdown 시 즉시 깨움 (mMutex와 함께 사용)
+	bool mStopMaintenance = false;                   // 유지보수 스레드 종료 요청 (mMutex로 보호)
+
+	// 풀 고유 ID — thread_local 친화도 힌트가 다른 풀(또는 같은 주소에 재생성된 풀)의
+	// 슬롯 번호를 잘못 쓰지 않도록 구분한다.
+	uint64_t mPoolId;
+
+	// 대기 시간 통계 (relaxed atomic — 체크아웃 경로에서 락 없이 갱신)
+	std::atomic<uint64_t> mWaitCount{0};
+	std::atomic<uint64_t> mWaitTimeouts{0};
+	std::atomic<uint64_t> mWaitTotalUs{0};
+	std::atomic<uint64_t> mWaitMaxUs{0};
+	std::atomic<uint64_t> mAffinityHits{0};
+	std::atomic<uint64_t> mWaitBuckets[kWaitBucketCount] = {};
 };
 
 // =============================================================================
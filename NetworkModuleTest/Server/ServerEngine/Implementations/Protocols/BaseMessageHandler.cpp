@@ -49,18 +49,49 @@ BaseMessageHandler::CreateMessage(Interfaces::MessageType type,
 								  Interfaces::ConnectionId connectionId,
 								  const void *data, size_t size)
 {
-	Interfaces::Message message;
-	message.type = type;
-	message.connectionId = connectionId;
-	message.timestamp = GetCurrentTimestamp();
+	// 출력 버퍼에 바로 직렬화 — 페이로드를 Message에 한 번 더 복사하지 않는다
+	std::vector<uint8_t> buffer(GetMessageSize(size));
+	WriteFrame(type, connectionId, GetCurrentTimestamp(), data, size,
+			   buffer.data(), buffer.size());
+	return buffer;
+}
+
+size_t BaseMessageHandler::GetMessageSize(size_t size)
+{
+	return sizeof(MessageHeader) + size;
+}
 
-	if (data && size > 0)
+size_t BaseMessageHandler::WriteMessage(Interfaces::MessageType type,
+										Interfaces::ConnectionId connectionId,
+										const void *data, size_t size,
+										uint8_t *out, size_t capacity) const
+{
+	return WriteFrame(type, connectionId, GetCurrentTimestamp(), data, size, out,
+					  capacity);
+}
+
+size_t BaseMessageHandler::WriteFrame(Interfaces::MessageType type,
+									  Interfaces::ConnectionId connectionId,
+									  uint64_t timestamp, const void *data,
+									  size_t size, uint8_t *out, size_t capacity)
+{
+	if (!out || capacity < GetMessageSize(size) || (!data && size > 0))
 	{
-		message.data.resize(size);
-		std::memcpy(message.data.data(), data, size);
+		return 0;
 	}
 
-	return SerializeMessage(message);
+	MessageHeader header;
+	header.type = static_cast<uint32_t>(type);
+	header.connectionId = connectionId;
+	header.timestamp = timestamp;
+	header.dataSize = static_cast<uint32_t>(size);
+
+	std::memcpy(out, &header, sizeof(MessageHeader));
+	if (size > 0)
+	{
+		std::memcpy(out + sizeof(MessageHeader), data, size);
+	}
+	return GetMessageSize(size);
 }
 
 uint64_t BaseMessageHandler::GetCurrentTimestamp() const
@@ -130,22 +161,10 @@ bool BaseMessageHandler::ParseMessage(Interfaces::ConnectionId connectionId,
 std::vector<uint8_t>
 BaseMessageHandler::SerializeMessage(const Interfaces::Message &message)
 {
-	MessageHeader header;
-	header.type = static_cast<uint32_t>(message.type);
-	header.connectionId = message.connectionId;
-	header.timestamp = message.timestamp;
-	header.dataSize = static_cast<uint32_t>(message.data.size());
-
-	std::vector<uint8_t> buffer;
-	buffer.resize(sizeof(MessageHeader) + message.data.size());
-
-	std::memcpy(buffer.data(), &header, sizeof(MessageHeader));
-	if (!message.data.empty())
-	{
-		std::memcpy(buffer.data() + sizeof(MessageHeader), message.data.data(),
-					message.data.size());
-	}
-
+	std::vector<uint8_t> buffer(GetMessageSize(message.data.size()));
+	WriteFrame(message.type, message.connectionId, message.timestamp,
+			   message.data.data(), message.data.size(), buffer.data(),
+			   buffer.size());
 	return buffer;
 }
 
@@ -37,6 +37,22 @@ class BaseMessageHandler : public Interfaces::IMessageHandler
 
 	bool ValidateMessage(const uint8_t *data, size_t size) const override;
 
+	/**
+	 * 페이로드 size 바이트 메시지의 직렬화 크기 (헤더 포함).
+	 */
+	static size_t GetMessageSize(size_t size);
+
+	/**
+	 * CreateMessage와 같은 바이트열을 호출자 버퍼에 바로 쓴다 — 중간 Message/vector 없음.
+	 * Session::ReserveSend로 받은 송신 버퍼 영역에 쓰면 복사·할당 없이 CommitSend할 수 있다.
+	 * @param out      기록 대상 (GetMessageSize(size) 바이트 이상)
+	 * @param capacity out 크기
+	 * @return 기록한 바이트 수, 용량 부족이면 0
+	 */
+	size_t WriteMessage(Interfaces::MessageType type,
+						Interfaces::ConnectionId connectionId, const void *data,
+						size_t size, uint8_t *out, size_t capacity) const;
+
 	/**
 	 * 특정 메시지 타입에 대한 콜백을 등록한다.
 	 * 같은 타입으로 재등록하면 이전 콜백이 덮어씌워진다.
@@ -73,6 +89,14 @@ class BaseMessageHandler : public Interfaces::IMessageHandler
 	static Interfaces::MessageType GetMessageType(const uint8_t *data,
 												  size_t size);
 
+	/**
+	 * 헤더 + 페이로드를 out에 기록 (CreateMessage/SerializeMessage/WriteMessage 공용).
+	 */
+	static size_t WriteFrame(Interfaces::MessageType type,
+							 Interfaces::ConnectionId connectionId,
+							 uint64_t timestamp, const void *data, size_t size,
+							 uint8_t *out, size_t capacity);
+
   private:
 	std::unordered_map<Interfaces::MessageType, MessageCallback> mHandlers; // 타입별 콜백 맵 — mMutex로 보호
 	mutable std::mutex                                           mMutex;    // mHandlers 접근 직렬화 (ProcessMessage/Register/Unregister)
@@ -0,0 +1,321 @@
+// AdminHttpServer 구현 — 요청 헤더 파싱과 송신 완료에 맞춘 청크 단위 응답 송신
+
+#include "AdminHttpServer.h"
+#include "PacketDefine.h"
+#include "Session.h"
+#include "../../Utils/Logger.h"
+#include "../../Utils/Metrics.h"
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <mutex>
+
+namespace Network::Core
+{
+
+namespace
+{
+// 한 번에 세션에 넣는 응답 조각 수 — 백프레셔 임계값 아래에 머물러 QueueFull 경고를 피한다.
+constexpr size_t kSendWindow = Utils::SEND_QUEUE_BACKPRESSURE_THRESHOLD / 2;
+
+// 연결 1개의 파싱/송신 상태 (스트림 콜백과 송신 드레인 콜백이 shared_ptr로 공유)
+struct HttpConnection
+{
+	std::mutex  mMutex;              // 스트림 콜백(로직 워커) ↔ 드레인 콜백(I/O 스레드)
+	std::string mBuffer;
+	std::string mPending;            // 아직 세션에 넘기지 못한 응답 바이트
+	size_t      mPendingOffset = 0;
+	bool        mDraining = false;   // Connection: close / 405 응답 후 — 이후 입력 무시, 송신이 끝나면 닫는다
+};
+
+struct HttpResponse
+{
+	int         mStatus = 200;
+	const char *mReason = "OK";
+	const char *mContentType = "text/plain; charset=utf-8";
+	std::string mBody;
+};
+
+void CountRequest(int status)
+{
+	static const char *kHelp = "Admin HTTP requests by status code";
+	static auto &s200 = Utils::MetricsRegistry::Instance().Counter(
+		"netmod_admin_http_requests_total", kHelp, {{"code", "200"}});
+	static auto &s404 = Utils::MetricsRegistry::Instance().Counter(
+		"netmod_admin_http_requests_total", kHelp, {{"code", "404"}});
+	static auto &s405 = Utils::MetricsRegistry::Instance().Counter(
+		"netmod_admin_http_requests_total", kHelp, {{"code", "405"}});
+	switch (status)
+	{
+	case 200:
+		s200.Add();
+		break;
+	case 404:
+		s404.Add();
+		break;
+	default:
+		s405.Add();
+		break;
+	}
+}
+
+bool EqualsIgnoreCase(const std::string &lhs, const char *rhs)
+{
+	size_t i = 0;
+	for (; i < lhs.size() && rhs[i] != '\0'; ++i)
+	{
+		if (std::tolower(static_cast<unsigned char>(lhs[i])) !=
+			std::tolower(static_cast<unsigned char>(rhs[i])))
+		{
+			return false;
+		}
+	}
+	return i == lhs.size() && rhs[i] == '\0';
+}
+
+// HTTP/1.0 기본 종료, HTTP/1.1 기본 유지 — Connection 헤더가 있으면 그 값을 따른다.
+bool WantsClose(const std::string &head, const std::string &version)
+{
+	bool close = (version == "HTTP/1.0");
+	size_t lineStart = head.find("\r\n");
+	while (lineStart != std::string::npos)
+	{
+		lineStart += 2;
+		const size_t lineEnd = head.find("\r\n", lineStart);
+		const std::string line = head.substr(lineStart, lineEnd == std::string::npos
+		                                                    ? std::string::npos
+		                                                    : lineEnd - lineStart);
+		const size_t colon = line.find(':');
+		if (colon != std::string::npos && EqualsIgnoreCase(line.substr(0, colon), "connection"))
+		{
+			std::string value = line.substr(colon + 1);
+			value.erase(0, value.find_first_not_of(" \t"));
+			value.erase(value.find_last_not_of(" \t") + 1);
+			if (EqualsIgnoreCase(value, "close"))
+			{
+				close = true;
+			}
+			else if (EqualsIgnoreCase(value, "keep-alive"))
+			{
+				close = false;
+			}
+		}
+		lineStart = lineEnd;
+	}
+	return close;
+}
+
+HttpResponse Route(const std::string &method, const std::string &target)
+{
+	HttpResponse response;
+	const std::string path = target.substr(0, target.find('?'));
+	if (method != "GET")
+	{
+		response.mStatus = 405;
+		response.mReason = "Method Not Allowed";
+		response.mBody   = "method not allowed\n";
+	}
+	else if (path == "/metrics")
+	{
+		response.mContentType = "text/plain; version=0.0.4; charset=utf-8";
+		response.mBody        = Utils::MetricsRegistry::Instance().RenderPrometheus();
+	}
+	else if (path == "/healthz")
+	{
+		response.mBody = "ok\n";
+	}
+	else
+	{
+		response.mStatus = 404;
+		response.mReason = "Not Found";
+		response.mBody   = "not found\n";
+	}
+	return response;
+}
+
+// mPending을 한도 단위로 잘라 최대 kSendWindow 조각까지 송신한다. 나머지는 송신 큐가
+// 비었을 때(OnSendDrained) 이어 보낸다. 미연결/잘못된 인자면 false.
+bool PumpPending(HttpConnection &connection, Session *session)
+{
+	for (size_t queued = 0;
+	     queued < kSendWindow && connection.mPendingOffset < connection.mPending.size(); ++queued)
+	{
+		const uint32_t chunk = static_cast<uint32_t>((std::min)(
+			connection.mPending.size() - connection.mPendingOffset,
+			static_cast<size_t>(MAX_PACKET_TOTAL_SIZE)));
+		const Session::SendResult result =
+			session->Send(connection.mPending.data() + connection.mPendingOffset, chunk);
+		if (result == Session::SendResult::QueueFull)
+		{
+			break;
+		}
+		if (result != Session::SendResult::Ok)
+		{
+			return false;
+		}
+		connection.mPendingOffset += chunk;
+	}
+
+	if (connection.mPendingOffset == connection.mPending.size())
+	{
+		connection.mPending.clear();
+		connection.mPendingOffset = 0;
+	}
+	return true;
+}
+
+// I/O 스레드 — 직전 송신이 모두 끝나고 큐가 비었다.
+void HandleSendDrained(INetworkEngine *engine, HttpConnection &connection, Session *session)
+{
+	std::lock_guard<std::mutex> lock(connection.mMutex);
+	if (!connection.mPending.empty())
+	{
+		if (!PumpPending(connection, session))
+		{
+			engine->CloseConnection(session->GetId());
+		}
+		return;
+	}
+	// 남은 응답도, 진행 중인 송신도 없다 — 종료 응답이었으면 이제 닫는다.
+	if (connection.mDraining)
+	{
+		engine->CloseConnection(session->GetId());
+	}
+}
+
+void HandleStream(INetworkEngine *engine, HttpConnection &connection, Session *session,
+                  const char *data, uint32_t size)
+{
+	std::lock_guard<std::mutex> lock(connection.mMutex);
+	if (connection.mDraining)
+	{
+		return;
+	}
+	connection.mBuffer.append(data, size);
+
+	size_t headEnd;
+	while ((headEnd = connection.mBuffer.find("\r\n\r\n")) != std::string::npos)
+	{
+		const std::string head = connection.mBuffer.substr(0, headEnd);
+		connection.mBuffer.erase(0, headEnd + 4);
+
+		// 요청 줄: METHOD SP TARGET SP VERSION
+		const size_t lineEnd  = head.find("\r\n");
+		const std::string requestLine = head.substr(0, lineEnd);
+		const size_t firstSp  = requestLine.find(' ');
+		const size_t secondSp = firstSp == std::string::npos
+		                            ? std::string::npos
+		                            : requestLine.find(' ', firstSp + 1);
+		if (secondSp == std::string::npos)
+		{
+			Utils::Logger::Warn("AdminHttp: malformed request line - Session {}", session->GetId());
+			engine->CloseConnection(session->GetId());
+			return;
+		}
+		const std::string method  = requestLine.substr(0, firstSp);
+		const std::string target  = requestLine.substr(firstSp + 1, secondSp - firstSp - 1);
+		const std::string version = requestLine.substr(secondSp + 1);
+		const bool close = WantsClose(head, version);
+
+		const HttpResponse response = Route(method, target);
+		CountRequest(response.mStatus);
+
+		std::string out;
+		out.reserve(response.mBody.size() + 160);
+		out += "HTTP/1.1 ";
+		out += std::to_string(response.mStatus);
+		out += ' ';
+		out += response.mReason;
+		out += "\r\nContent-Type: ";
+		out += response.mContentType;
+		out += "\r\nContent-Length: ";
+		out += std::to_string(response.mBody.size());
+		out += close ? "\r\nConnection: close\r\n\r\n" : "\r\nConnection: keep-alive\r\n\r\n";
+		out += response.mBody;
+
+		// 앞선 응답이 아직 남아 있으면 그 뒤에 이어 붙여 순서를 지킨다.
+		connection.mPending += out;
+		if (!PumpPending(connection, session))
+		{
+			Utils::Logger::Warn("AdminHttp: response send failed ({} bytes) - Session {}",
+			                    out.size(), session->GetId());
+			engine->CloseConnection(session->GetId());
+			return;
+		}
+
+		// 본문이 있을 수 있는 요청(405)이나 종료 요청 뒤의 입력은 해석하지 않는다.
+		// 연결은 남은 응답까지 송신이 끝난 뒤 HandleSendDrained가 닫는다.
+		if (close || response.mStatus == 405)
+		{
+			connection.mDraining = true;
+			connection.mBuffer.clear();
+			return;
+		}
+	}
+
+	if (connection.mBuffer.size() > AdminHttpServer::kMaxRequestBytes)
+	{
+		Utils::Logger::Warn("AdminHttp: request header exceeds {} bytes - Session {}",
+		                    AdminHttpServer::kMaxRequestBytes, session->GetId());
+		engine->CloseConnection(session->GetId());
+	}
+}
+} // namespace
+
+AdminHttpServer::~AdminHttpServer()
+{
+	Stop();
+}
+
+bool AdminHttpServer::Start(INetworkEngine &engine, uint16_t port, const std::string &bindAddress)
+{
+	if (mListenerId != 0)
+	{
+		return true;
+	}
+
+	INetworkEngine *enginePtr = &engine;
+	ListenerOptions options;
+	options.mBindAddress  = bindAddress;
+	options.mPort         = port;
+	options.mConfigurator = [enginePtr](Session *session)
+	{
+		auto connection = std::make_shared<HttpConnection>();
+		session->SetOnStreamRecv(
+			[enginePtr, connection](Session *s, const char *data, uint32_t size)
+			{
+				HandleStream(enginePtr, *connection, s, data, size);
+			});
+		session->SetOnSendDrained(
+			[enginePtr, connection](Session *s)
+			{
+				HandleSendDrained(enginePtr, *connection, s);
+			});
+	};
+
+	mListenerId = engine.AddListener(options);
+	if (mListenerId == 0)
+	{
+		Utils::Logger::Error("AdminHttp: failed to listen on {}:{}", bindAddress, port);
+		return false;
+	}
+
+	mEngine = &engine;
+	mPort   = port;
+	Utils::Logger::Info("AdminHttp: serving /metrics on http://{}:{}/metrics", bindAddress, port);
+	return true;
+}
+
+void AdminHttpServer::Stop()
+{
+	if (mListenerId == 0)
+	{
+		return;
+	}
+	mEngine->RemoveListener(mListenerId);
+	mListenerId = 0;
+	mEngine     = nullptr;
+	Utils::Logger::Info("AdminHttp: stopped (port {})", mPort);
+}
+
+} // namespace Network::Core
@@ -0,0 +1,56 @@
+#pragma once
+
+// 관리 포트 HTTP 엔드포인트 — 엔진 추가 리스너(AddListener) 위에서 동작하는 최소 HTTP/1.1 서버.
+//
+//   GET /metrics   MetricsRegistry::RenderPrometheus() (text/plain; version=0.0.4)
+//   GET /healthz   "ok"
+//   그 외 경로 404, GET 외 메서드 405
+//
+// 동작:
+//   - 세션은 스트림 모드(SetOnStreamRecv)로 받아 PacketHeader 프레이밍을 거치지 않는다.
+//   - 요청 헤더는 kMaxRequestBytes까지 버퍼링한다. 초과하면 연결을 닫는다.
+//   - 응답은 Session::Send 한도(MAX_PACKET_TOTAL_SIZE) 단위로 잘라, 송신 큐 임계값의 절반만큼씩
+//     넣는다. 나머지는 송신 큐가 비었을 때(Session::SetOnSendDrained) 이어 보내므로
+//     송신 큐보다 큰 /metrics 응답도 잘리지 않는다.
+//   - keep-alive 연결은 유지한다 (유휴 연결은 엔진 세션 타임아웃이 정리).
+//     "Connection: close"(HTTP/1.0 기본)나 405 응답 뒤에는 이후 입력을 무시하고,
+//     응답의 마지막 바이트까지 송신이 끝나면 서버가 연결을 닫는다.
+//
+// 스레드: 요청 처리는 로직 디스패처 워커에서 실행된다 (세션 키 FIFO).
+// 처리 람다는 이 객체를 캡처하지 않으므로 Stop() 직후 소멸해도 안전하다.
+
+#include "NetworkEngine.h"
+#include <cstdint>
+#include <string>
+
+namespace Network::Core
+{
+
+class AdminHttpServer
+{
+  public:
+	static constexpr size_t kMaxRequestBytes = 8 * 1024;
+
+	AdminHttpServer() = default;
+	~AdminHttpServer();
+
+	AdminHttpServer(const AdminHttpServer &) = delete;
+	AdminHttpServer &operator=(const AdminHttpServer &) = delete;
+
+	// engine은 Initialize() 이후여야 하며 Stop()까지 살아 있어야 한다.
+	// 바인드 실패 등으로 리스너를 만들지 못하면 false.
+	bool Start(INetworkEngine &engine, uint16_t port, const std::string &bindAddress = "127.0.0.1");
+
+	// 리스너 제거 + 관리 연결 종료. 여러 번 호출해도 안전하다.
+	void Stop();
+
+	bool IsRunning() const { return mListenerId != 0; }
+	uint16_t GetPort() const { return mPort; }
+
+  private:
+	INetworkEngine *mEngine     = nullptr;
+	ListenerId      mListenerId = 0;
+	uint16_t        mPort       = 0;
+};
+
+} // namespace Network::Core
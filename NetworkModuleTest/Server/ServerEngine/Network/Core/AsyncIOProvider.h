@@ -18,6 +18,8 @@
 //   - Session 생명주기 관리 필요 (IOCPNetworkEngine + Session 사용)
 // =============================================================================
 
+#include "../../Utils/LatencyHistogram.h"
+#include "SharedSendBuffer.h"
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -122,7 +124,7 @@ struct CompletionEntry
 	AsyncIOType    mType;          // 작업 타입 (Send/Recv 등)
 	int32_t        mResult;        // 전송된 바이트 수. 0 이하면 연결 종료 또는 에러.
 	OSError        mOsError;       // OS 에러 코드 (0 = 성공)
-	uint64_t       mCompletionTime;// 완료 시간 (나노초, 선택사항 — 0이면 미측정)
+	uint64_t       mCompletionTime;// 완료 시각 (단조 시계 나노초, Utils::Timer::GetMonotonicNs 기준 — 0이면 미측정)
 };
 
 // 송수신 버퍼 구조체
@@ -147,16 +149,44 @@ struct ProviderInfo
 };
 
 // 공급자 통계 구조체
+// 레이턴시 (나노초):
+//   Send: 제출(SendAsync) → 완료 항목 생성. 커널 송신 버퍼 여유 대기 + 공급자 큐잉
+//   Recv: 완료 항목 생성(데이터 수신) → 엔진이 세션 처리로 넘기는 시점 (RecordRecvDispatch).
+//         같은 완료 배치의 앞선 항목 처리 대기를 포함하고, 상대가 보낼 때까지의 대기는 제외한다.
+// 측정하지 않는 공급자는 히스토그램이 비어 있고 mAvgLatency/mP99Latency가 0이다.
 struct ProviderStats
 {
 	uint64_t mTotalRequests;   // 전체 요청 수
 	uint64_t mTotalCompletions;// 전체 완료 수
 	uint64_t mPendingRequests; // 현재 대기 중인 요청 수
-	uint64_t mAvgLatency;      // 평균 레이턴시 (나노초)
-	double   mP99Latency;      // P99 레이턴시 (나노초)
+	uint64_t mAvgLatency;      // 평균 레이턴시 (나노초, send+recv)
+	double   mP99Latency;      // P99 레이턴시 (나노초, send+recv)
 	uint64_t mErrorCount;      // 에러 수
+	Network::Utils::LatencyHistogram mSendLatency; // 송신 제출→완료 분포 (나노초)
+	Network::Utils::LatencyHistogram mRecvLatency; // 수신 완료→디스패치 분포 (나노초)
 };
 
+// 히스토그램을 제외한 카운터 필드만 복사 (히스토그램은 공급자가 out에 직접 채운다)
+inline void CopyStatCounters(ProviderStats &out, const ProviderStats &in)
+{
+	out.mTotalRequests    = in.mTotalRequests;
+	out.mTotalCompletions = in.mTotalCompletions;
+	out.mPendingRequests  = in.mPendingRequests;
+	out.mAvgLatency       = in.mAvgLatency;
+	out.mP99Latency       = in.mP99Latency;
+	out.mErrorCount       = in.mErrorCount;
+}
+
+// mSendLatency/mRecvLatency를 합친 분포로 요약 필드(mAvgLatency, mP99Latency)를 채운다.
+// 히스토그램을 수집하는 공급자가 GetStats()에서 호출한다.
+inline void FillLatencySummary(ProviderStats &stats)
+{
+	Network::Utils::LatencyHistogram combined = stats.mSendLatency;
+	combined.Merge(stats.mRecvLatency);
+	stats.mAvgLatency = combined.Mean();
+	stats.mP99Latency = static_cast<double>(combined.Percentile(0.99));
+}
+
 // 플랫폼 정보 (런타임 감지용)
 struct PlatformInfo
 {
@@ -239,6 +269,33 @@ class AsyncIOProvider
 	virtual AsyncIOError AssociateSocket(SocketHandle socket,
 										 RequestContext context) = 0;
 
+	/**
+	 * 비동기 아웃바운드 연결 (서버 간 링크 등).
+	 * socket은 논블로킹이어야 하며, 완료는 AsyncIOType::Connect 항목으로 보고된다
+	 * (mResult == 0 && mOsError == 0 이면 성공, 그 외에는 mOsError에 SO_ERROR 값).
+	 * 연결 요청이 소켓 등록을 겸하므로 성공 완료 후 AssociateSocket 없이
+	 * 바로 RecvAsync/SendAsync를 호출한다.
+	 *
+	 * 플랫폼별 동작:
+	 * - epoll: connect() → EINPROGRESS → EPOLLOUT 대기 후 SO_ERROR 확인
+	 * - io_uring: IORING_OP_CONNECT
+	 * - 그 외: PlatformNotSupported (기본 구현)
+	 *
+	 * @param address       연결 대상 주소 — 완료 전까지 공급자가 복사본을 보관한다
+	 * @param addressLength address 바이트 수
+	 */
+	virtual AsyncIOError ConnectAsync(SocketHandle socket,
+									  const struct sockaddr *address,
+									  size_t addressLength,
+									  RequestContext context)
+	{
+		(void)socket;
+		(void)address;
+		(void)addressLength;
+		(void)context;
+		return AsyncIOError::PlatformNotSupported;
+	}
+
 	// =====================================================================
 	// 비동기 I/O 요청
 	// =====================================================================
@@ -254,6 +311,18 @@ class AsyncIOProvider
 									   size_t size, RequestContext context,
 									   uint32_t flags = 0) = 0;
 
+	/**
+	 * 공유 버퍼 비동기 송신 — 공급자가 완료까지 핸들을 보관하므로 페이로드를 복사하지 않는다.
+	 * 내용이 불변이라 같은 버퍼를 여러 소켓에 동시에 제출해도 된다 (브로드캐스트).
+	 * 기본 구현은 SendAsync 복사 송신 — IOCP/RIO (RIO는 등록 버퍼로의 복사가 필수).
+	 */
+	virtual AsyncIOError SendSharedAsync(SocketHandle socket,
+										 const Core::SharedSendBuffer &buffer,
+										 RequestContext context)
+	{
+		return SendAsync(socket, buffer.Data(), buffer.Size(), context);
+	}
+
 	/** 비동기 수신 작업 */
 	virtual AsyncIOError RecvAsync(SocketHandle socket, void *buffer,
 									   size_t size, RequestContext context,
@@ -286,8 +355,15 @@ class AsyncIOProvider
 	/** 공급자 정보 조회 */
 	virtual const ProviderInfo &GetInfo() const = 0;
 
-	/** 공급자 통계 조회 */
-	virtual ProviderStats GetStats() const = 0;
+	/** 공급자 통계 조회 — out을 덮어쓴다 (히스토그램 2개, 약 18KB를 값으로 반환하지 않도록 호출자 버퍼에 채움) */
+	virtual void GetStats(ProviderStats &out) const = 0;
+
+	/**
+	 * 엔진이 recv 완료 항목을 세션 처리로 넘기기 직전 호출 — 완료→디스패치 지연 기록.
+	 * @param completionNs CompletionEntry::mCompletionTime (0이면 미측정 — 무시)
+	 * 기본 구현은 아무것도 하지 않는다 (지연을 측정하지 않는 공급자).
+	 */
+	virtual void RecordRecvDispatch(uint64_t completionNs) { (void)completionNs; }
 
 	/** 마지막 에러 메시지 조회 */
 	virtual const char *GetLastError() const = 0;
@@ -3,16 +3,52 @@
 
 #include "BaseNetworkEngine.h"
 #include "NetworkEventBus.h"
+#include "PacketTrace.h"
 #include "SessionPool.h"
+#include "../../Utils/AllocationTag.h"
 #include "../../Utils/ConfigManager.h"
+#include "../../Utils/CpuTopology.h"
 #include "../../Utils/Logger.h"
 #include "../../Utils/Timer.h"
+#include <algorithm>
+
+#if defined(IS_WINDOWS)
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
 
 namespace Network::Core
 {
 
+namespace
+{
+#if defined(IS_WINDOWS)
+const SocketHandle kInvalidConnectSocket = INVALID_SOCKET;
+constexpr OSError  kConnRefused          = WSAECONNREFUSED;
+
+void CloseConnectSocket(SocketHandle socket) { closesocket(socket); }
+void AbortConnectSocket(SocketHandle socket) { shutdown(socket, SD_BOTH); }
+OSError LastSocketError() { return static_cast<OSError>(WSAGetLastError()); }
+#else
+const SocketHandle kInvalidConnectSocket = -1;
+constexpr OSError  kConnRefused          = ECONNREFUSED;
+
+void CloseConnectSocket(SocketHandle socket) { ::close(socket); }
+// 연결 중인 소켓을 shutdown하면 커널이 connect를 중단하고 완료(에러)를 보고한다.
+void AbortConnectSocket(SocketHandle socket) { ::shutdown(socket, SHUT_RDWR); }
+OSError LastSocketError() { return errno; }
+#endif
+} // namespace
+
 BaseNetworkEngine::BaseNetworkEngine()
-	: mPort(0), mMaxConnections(0), mRunning(false), mInitialized(false)
+	: mPort(0), mMaxConnections(0), mRunToCompletion(false), mIoThreadCount(0), mSojournIntervalMs(0), mRunning(false), mInitialized(false)
 {
 	std::memset(&mStats, 0, sizeof(mStats));
 }
@@ -20,6 +56,15 @@ BaseNetworkEngine::BaseNetworkEngine()
 BaseNetworkEngine::~BaseNetworkEngine()
 {
 	Stop();
+
+	// English: Initialized but never started — Stop() returned early, so release the
+	//          collector, listeners and fan-out registration here (all reference this).
+	// 한글: 초기화 후 시작하지 않은 경우 Stop()이 바로 반환하므로 여기서 컬렉터,
+	//       리스너, 팬아웃 등록을 해제한다 (모두 this를 참조).
+	SessionManager::Instance().ClearFanoutDispatcher(&mLogicDispatcher);
+	Utils::MetricsRegistry::Instance().RemoveCollector(mMetricsCollectorId);
+	mMetricsCollectorId = 0;
+	RetireListeners();
 }
 
 // =============================================================================
@@ -51,16 +96,54 @@ bool BaseNetworkEngine::Initialize(size_t maxConnections, uint16_t port)
 	// 한글: 로직 디스패처 초기화 (KeyedDispatcher — 세션 친화도 워커 풀).
 	{
 		const auto& cfg = Utils::ConfigManager::Instance().GetNetwork();
+
+		// English: Thread sizing and CPU placement. Auto sizes come from the CPUs this process
+		//          may run on (affinity mask / cgroup cpuset), not the machine total.
+		//          Auto I/O count leaves the logic workers' share so the auto logic set has CPUs.
+		// 한글: 스레드 수와 CPU 배치. 자동 크기는 머신 전체가 아니라 이 프로세스가 쓸 수 있는
+		//       CPU(affinity 마스크 / cgroup cpuset) 기준.
+		//       자동 I/O 수는 로직 워커 몫을 뺀 CPU 수 — 그래야 auto 로직 집합에 남는 CPU가 있다.
+		const auto &topology = Utils::CpuTopology::Get();
 		Network::Concurrency::KeyedDispatcher::Options opts;
-		opts.mWorkerCount = 4;
+		opts.mWorkerCount = cfg.LogicThreadCount > 0 ? cfg.LogicThreadCount : 4;
+
+		const size_t cpuCount = topology.mCpus.size();
+		mIoThreadCount = cfg.WorkerThreadCount > 0
+		                     ? cfg.WorkerThreadCount
+		                     : static_cast<uint32_t>(cpuCount > opts.mWorkerCount ? cpuCount - opts.mWorkerCount : 1);
+		mIoCpus = Utils::ResolveCpuSet(cfg.IoCpuSet, Utils::AutoIoCpuSet(mIoThreadCount), "I/O");
+
+		opts.mCpuAffinity = Utils::ResolveCpuSet(cfg.LogicCpuSet, Utils::AutoLogicCpuSet(mIoThreadCount), "Logic");
+		Utils::Logger::Info("Threads: {} I/O ({}), {} logic ({}), {} CPUs on {} NUMA node(s)", mIoThreadCount,
+		                    mIoCpus.empty() ? "unpinned" : "pinned", opts.mWorkerCount,
+		                    opts.mCpuAffinity.empty() ? "unpinned" : "pinned", topology.mCpus.size(),
+		                    topology.mNodeCount);
 		opts.mQueueOptions.mCapacity    = cfg.MaxLogicQueueDepth;
+		opts.mQueueOptions.mLaneBurstLimit = cfg.LogicLaneBurstLimit;
 		opts.mQueueOptions.mBackpressure = Network::Concurrency::BackpressurePolicy::RejectNewest;
+		opts.mSojourn.mTargetMs   = cfg.LogicSojournTargetMs;
+		opts.mSojourn.mIntervalMs = cfg.LogicSojournIntervalMs;
+		mSojournIntervalMs = cfg.LogicSojournIntervalMs > 0 ? cfg.LogicSojournIntervalMs : 1;
 		opts.mName = "LogicDispatcher";
 		if (!mLogicDispatcher.Initialize(opts))
 		{
 			Utils::Logger::Error("LogicDispatcher initialization failed");
 			return false;
 		}
+
+		// English: Broadcast/Multicast fan out across the same session-affinity workers.
+		// 한글: Broadcast/Multicast는 같은 세션 친화도 워커로 분산된다.
+		SessionManager::Instance().SetFanoutDispatcher(&mLogicDispatcher);
+
+		// English: Run-to-completion — handlers run on the session's I/O thread; the
+		//          dispatcher above stays for blocking sessions, disconnects and fan-out.
+		// 한글: run-to-completion — 핸들러를 세션의 I/O 스레드에서 실행. 위 디스패처는
+		//       블로킹 세션, 연결 종료, 팬아웃용으로 유지된다.
+		mRunToCompletion = cfg.RunToCompletion;
+		if (mRunToCompletion)
+		{
+			Utils::Logger::Info("Run-to-completion mode: handlers run inline on I/O threads");
+		}
 	}
 
 	// English: Initialize engine-level timer queue.
@@ -94,8 +177,7 @@ bool BaseNetworkEngine::Initialize(size_t maxConnections, uint16_t port)
 				const auto lastPing = session->GetLastPingTime();
 				if (lastPing != 0 && (now - lastPing) > pingTimeoutMs)
 				{
-					Utils::Logger::Warn(
-						"Session timeout - ID: " + std::to_string(session->GetId()));
+					Utils::Logger::Warn("Session timeout - ID: {}", session->GetId());
 					CloseConnection(session->GetId());
 				}
 			}
@@ -111,9 +193,13 @@ bool BaseNetworkEngine::Initialize(size_t maxConnections, uint16_t port)
 		return false;
 	}
 
+	// English: Export engine statistics on every metrics scrape (removed in Stop / destructor).
+	// 한글: 메트릭 스크레이프마다 엔진 통계를 내보낸다 (Stop / 소멸자에서 해제).
+	mMetricsCollectorId = Utils::MetricsRegistry::Instance().AddCollector(
+		[this](Utils::MetricsWriter &writer) { CollectMetrics(writer); });
+
 	mInitialized.store(true, std::memory_order_release);
-	Utils::Logger::Info("BaseNetworkEngine initialized on port " +
-						std::to_string(mPort));
+	Utils::Logger::Info("BaseNetworkEngine initialized on port {}", mPort);
 	return true;
 }
 
@@ -155,22 +241,67 @@ void BaseNetworkEngine::Stop()
 
 	mRunning.store(false, std::memory_order_release);
 
-	// English: Stop timer queue first (cancels periodic session-timeout checks).
-	// 한글: 타이머 큐 먼저 종료 (주기 세션 타임아웃 점검 취소).
+	// English: Detach the metrics collector first — waits for an in-flight scrape to finish.
+	// 한글: 메트릭 컬렉터를 먼저 해제 — 진행 중인 스크레이프가 끝날 때까지 기다린다.
+	Utils::MetricsRegistry::Instance().RemoveCollector(mMetricsCollectorId);
+	mMetricsCollectorId = 0;
+
+	// English: Stop extra listeners before platform I/O so no new session is attached
+	//          to a provider that is shutting down. Their sessions close below.
+	// 한글: 플랫폼 I/O보다 먼저 추가 리스너를 멈춰 종료 중인 공급자에 새 세션이 붙지
+	//       않게 한다. 리스너 세션은 아래 CloseAllSessions에서 닫힌다.
+	RetireListeners();
+
+	// English: Stop timer queue (cancels periodic session-timeout checks). Coroutines parked
+	//          in After() are destroyed on their key worker — the logic dispatcher is still
+	//          running here and drains those before it shuts down below.
+	// 한글: 타이머 큐 종료 (주기 세션 타임아웃 점검 취소). After()에서 대기 중인 코루틴은
+	//       키 워커에서 파괴된다 — 로직 디스패처는 아직 살아 있고 아래에서 종료되기 전에 이를 처리한다.
 	mTimerQueue.Shutdown();
 
 	// English: Stop platform-specific I/O
 	// 한글: 플랫폼별 I/O 중지
 	StopPlatformIO();
 
+	// English: Retire connectors — no completion will arrive any more, so close
+	//          in-flight connect sockets here and suppress reconnects.
+	// 한글: 커넥터 정리 — 더 이상 완료가 오지 않으므로 진행 중 connect 소켓을 여기서
+	//       닫고 재연결을 막는다.
+	{
+		std::lock_guard<std::mutex> lock(mConnectorMutex);
+		for (auto &entry : mConnectors)
+		{
+			auto &state = entry.second;
+			state->mRemoved = true;
+			if (state->mPendingSocket != kInvalidConnectSocket)
+			{
+				CloseConnectSocket(state->mPendingSocket);
+				state->mPendingSocket = kInvalidConnectSocket;
+			}
+		}
+		mConnectors.clear();
+	}
+
 	// English: Close all sessions
 	// 한글: 모든 세션 종료
 	SessionManager::Instance().CloseAllSessions();
 
 	// English: Shutdown logic dispatcher after all sessions are closed.
+	//          Unregister it from SessionManager fan-out first (waits for an in-progress fan-out).
 	// 한글: 모든 세션 종료 후 로직 디스패처 종료.
+	//       먼저 SessionManager 팬아웃에서 해제 (진행 중인 팬아웃이 끝날 때까지 대기).
+	SessionManager::Instance().ClearFanoutDispatcher(&mLogicDispatcher);
 	mLogicDispatcher.Shutdown();
 
+	{
+		std::lock_guard<std::mutex> lock(mConnectorMutex);
+		mOutboundSessions.clear();
+	}
+	{
+		std::lock_guard<std::mutex> lock(mListenerMutex);
+		mListenerSessions.clear();
+	}
+
 	// English: Shutdown platform resources
 	// 한글: 플랫폼 리소스 종료
 	ShutdownPlatform();
@@ -220,8 +351,8 @@ bool BaseNetworkEngine::SendData(Utils::ConnectionId connectionId,
 		return false;
 	}
 
-	mTotalBytesSent.fetch_add(size, std::memory_order_relaxed);
-
+	// English: Bytes are counted on send completion (covers Session::Send callers too).
+	// 한글: 바이트 수는 송신 완료 시 집계 (Session::Send 직접 호출 경로 포함).
 	return true;
 }
 
@@ -242,6 +373,9 @@ void BaseNetworkEngine::CloseConnection(Utils::ConnectionId connectionId)
 	//       Close()와 ProcessRawRecv가 항상 세션 단위로 직렬화됨.
 	//       세션 shared_ptr이 작업 실행 전까지 객체를 살아있게 유지.
 	auto sessionCopy = session;
+	// English: Connector and listener sessions raise no Disconnected NetworkEvent.
+	// 한글: 커넥터/리스너 세션은 Disconnected NetworkEvent를 발행하지 않는다.
+	const bool silent = DetachOutboundSession(connectionId) || DetachListenerSession(connectionId);
 	// English: Route through AsyncScope — consistent with ProcessRecvCompletion disconnect path.
 	//          If Close() was already called (Cancel() set), the event is silently dropped.
 	// 한글: AsyncScope 경유 — ProcessRecvCompletion disconnect path와 일관성 유지.
@@ -249,14 +383,18 @@ void BaseNetworkEngine::CloseConnection(Utils::ConnectionId connectionId)
 	if (!session->mAsyncScope.Submit(
 			mLogicDispatcher,
 			connectionId,
-			[this, sessionCopy, connectionId]()
+			Network::Concurrency::TaskPriority::Control,
+			[this, sessionCopy, connectionId, silent]()
 			{
 				sessionCopy->OnDisconnected();
-				FireEvent(NetworkEvent::Disconnected, connectionId);
+				if (!silent)
+				{
+					FireEvent(NetworkEvent::Disconnected, connectionId);
+				}
 			}))
 	{
-		Utils::Logger::Warn("LogicDispatcher full or scope cancelled - disconnect event dropped, Session: " +
-		                    std::to_string(connectionId));
+		Utils::Logger::Warn("LogicDispatcher full or scope cancelled - disconnect event dropped, Session: {}",
+		                    connectionId);
 	}
 
 	// English: Remove from manager immediately (caller's thread) — same as ProcessRecvCompletion
@@ -277,27 +415,814 @@ BaseNetworkEngine::GetConnectionInfo(Utils::ConnectionId connectionId) const
 			   "] State=" + std::to_string(static_cast<int>(session->GetState()));
 }
 
+// =============================================================================
+// English: Outbound connectors
+// 한글: 아웃바운드 커넥터
+// =============================================================================
+
+ConnectorId BaseNetworkEngine::AddConnector(const ConnectorOptions &options)
+{
+	if (!mInitialized.load(std::memory_order_acquire) || !mProvider)
+	{
+		Utils::Logger::Error("AddConnector: engine not initialized");
+		return 0;
+	}
+
+	auto state = std::make_shared<ConnectorState>();
+	state->mOptions       = options;
+	state->mPendingSocket = kInvalidConnectSocket;
+	state->mBackoffMs     = (std::max)(options.mInitialBackoffMs, 1u);
+
+	sockaddr_in address{};
+	address.sin_family = AF_INET;
+	address.sin_port   = htons(options.mPort);
+	if (options.mPort == 0 ||
+		inet_pton(AF_INET, options.mHost.c_str(), &address.sin_addr) <= 0)
+	{
+		Utils::Logger::Error("AddConnector: invalid address {}:{}", options.mHost, options.mPort);
+		return 0;
+	}
+	std::memcpy(&state->mAddress, &address, sizeof(address));
+	state->mAddressLength = sizeof(address);
+
+	state->mId = mNextConnectorId.fetch_add(1, std::memory_order_relaxed);
+	{
+		std::lock_guard<std::mutex> lock(mConnectorMutex);
+		mConnectors[state->mId] = state;
+	}
+
+	AsyncIO::AsyncIOError error = AsyncIO::AsyncIOError::Success;
+	const OSError osError = StartConnectAttempt(state, error);
+	if (error == AsyncIO::AsyncIOError::PlatformNotSupported)
+	{
+		Utils::Logger::Error("AddConnector: async connect not supported by {}",
+		                     mProvider->GetInfo().mName ? mProvider->GetInfo().mName : "provider");
+		std::lock_guard<std::mutex> lock(mConnectorMutex);
+		mConnectors.erase(state->mId);
+		return 0;
+	}
+
+	Utils::Logger::Info("Connector {} added - {}:{}", state->mId, options.mHost, options.mPort);
+	if (osError != 0)
+	{
+		ScheduleReconnect(state, osError);
+	}
+	return state->mId;
+}
+
+void BaseNetworkEngine::RemoveConnector(ConnectorId connectorId)
+{
+	Utils::ConnectionId sessionId = 0;
+	Network::Concurrency::TimerQueue::TimerHandle retryTimer = 0;
+	SocketHandle pendingSocket = kInvalidConnectSocket;
+	{
+		std::lock_guard<std::mutex> lock(mConnectorMutex);
+		auto it = mConnectors.find(connectorId);
+		if (it == mConnectors.end())
+		{
+			return;
+		}
+		auto &state = it->second;
+		state->mRemoved   = true;
+		retryTimer        = state->mRetryTimer;
+		state->mRetryTimer = 0;
+		sessionId         = state->mSessionId;
+		pendingSocket     = state->mPendingSocket;
+
+		// English: With a connect in flight the state stays registered so the
+		//          completion can close the socket; otherwise drop it now.
+		// 한글: connect가 진행 중이면 완료 처리에서 소켓을 닫도록 상태를 남기고,
+		//       아니면 바로 제거한다.
+		if (pendingSocket == kInvalidConnectSocket)
+		{
+			mConnectors.erase(it);
+		}
+	}
+
+	if (retryTimer != 0)
+	{
+		mTimerQueue.Cancel(retryTimer);
+	}
+	if (pendingSocket != kInvalidConnectSocket)
+	{
+		AbortConnectSocket(pendingSocket);
+	}
+	if (sessionId != 0)
+	{
+		CloseConnection(sessionId);
+	}
+
+	Utils::Logger::Info("Connector {} removed", connectorId);
+}
+
+// =============================================================================
+// English: Extra listeners (admin / monitoring ports)
+// 한글: 추가 리스너 (관리 / 모니터링 포트)
+// =============================================================================
+
+ListenerId BaseNetworkEngine::AddListener(const ListenerOptions &options)
+{
+	if (!mInitialized.load(std::memory_order_acquire) || !mProvider)
+	{
+		Utils::Logger::Error("AddListener: engine not initialized");
+		return 0;
+	}
+
+	sockaddr_in address{};
+	address.sin_family = AF_INET;
+	address.sin_port   = htons(options.mPort);
+	if (options.mPort == 0 ||
+		inet_pton(AF_INET, options.mBindAddress.c_str(), &address.sin_addr) <= 0)
+	{
+		Utils::Logger::Error("AddListener: invalid address {}:{}", options.mBindAddress, options.mPort);
+		return 0;
+	}
+
+#if defined(IS_WINDOWS)
+	// English: Accepted sockets inherit the listen socket flags; RIO needs REGISTERED_IO.
+	// 한글: accept된 소켓은 listen 소켓 플래그를 상속 — RIO는 REGISTERED_IO가 필요하다.
+	SocketHandle socket = WSASocket(AF_INET, SOCK_STREAM, IPPROTO_TCP, nullptr, 0,
+	                                WSA_FLAG_OVERLAPPED | WSA_FLAG_REGISTERED_IO);
+#else
+	SocketHandle socket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+#endif
+	if (socket == kInvalidConnectSocket)
+	{
+		Utils::Logger::Error("AddListener: socket() failed - OS error: {}",
+		                     static_cast<uint32_t>(LastSocketError()));
+		return 0;
+	}
+
+	int reuseAddr = 1;
+	setsockopt(socket, SOL_SOCKET, SO_REUSEADDR,
+	           reinterpret_cast<const char *>(&reuseAddr), sizeof(reuseAddr));
+
+	if (::bind(socket, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0 ||
+		::listen(socket, SOMAXCONN) != 0)
+	{
+		Utils::Logger::Error("AddListener: bind/listen {}:{} failed - OS error: {}",
+		                     options.mBindAddress, options.mPort,
+		                     static_cast<uint32_t>(LastSocketError()));
+		CloseConnectSocket(socket);
+		return 0;
+	}
+
+	auto state = std::make_unique<ListenerState>();
+	state->mId      = mNextListenerId.fetch_add(1, std::memory_order_relaxed);
+	state->mOptions = options;
+	state->mSocket  = socket;
+	state->mRunning.store(true, std::memory_order_release);
+	state->mThread  = std::thread(&BaseNetworkEngine::ListenerAcceptLoop, this, state.get());
+
+	const ListenerId id = state->mId;
+	{
+		std::lock_guard<std::mutex> lock(mListenerMutex);
+		mListeners[id] = std::move(state);
+	}
+
+	Utils::Logger::Info("Listener {} added - {}:{}", id, options.mBindAddress, options.mPort);
+	return id;
+}
+
+void BaseNetworkEngine::RemoveListener(ListenerId listenerId)
+{
+	std::unique_ptr<ListenerState> state;
+	std::vector<Utils::ConnectionId> sessions;
+	{
+		std::lock_guard<std::mutex> lock(mListenerMutex);
+		auto it = mListeners.find(listenerId);
+		if (it == mListeners.end())
+		{
+			return;
+		}
+		state = std::move(it->second);
+		mListeners.erase(it);
+	}
+
+	ShutdownListener(*state);
+
+	// English: Collect after the accept thread has exited so no session slips in.
+	// 한글: accept 스레드 종료 후 수집해야 새 세션이 빠지지 않는다.
+	{
+		std::lock_guard<std::mutex> lock(mListenerMutex);
+		for (const auto &entry : mListenerSessions)
+		{
+			if (entry.second == listenerId)
+			{
+				sessions.push_back(entry.first);
+			}
+		}
+	}
+	for (const auto connId : sessions)
+	{
+		CloseConnection(connId);
+	}
+
+	Utils::Logger::Info("Listener {} removed", listenerId);
+}
+
+void BaseNetworkEngine::RetireListeners()
+{
+	std::unordered_map<ListenerId, std::unique_ptr<ListenerState>> listeners;
+	{
+		std::lock_guard<std::mutex> lock(mListenerMutex);
+		listeners.swap(mListeners);
+	}
+	for (auto &entry : listeners)
+	{
+		ShutdownListener(*entry.second);
+	}
+}
+
+void BaseNetworkEngine::ShutdownListener(ListenerState &state)
+{
+	state.mRunning.store(false, std::memory_order_release);
+	if (state.mThread.joinable())
+	{
+		state.mThread.join();
+	}
+	if (state.mSocket != kInvalidConnectSocket)
+	{
+		CloseConnectSocket(state.mSocket);
+		state.mSocket = kInvalidConnectSocket;
+	}
+}
+
+void BaseNetworkEngine::ListenerAcceptLoop(ListenerState *state)
+{
+	// English: poll() with a short timeout instead of a blocking accept(): closing a
+	//          socket does not reliably wake a blocked accept() on every platform.
+	// 한글: 블로킹 accept() 대신 짧은 타임아웃 poll(): 소켓을 닫아도 모든 플랫폼에서
+	//       블로킹된 accept()가 깨어난다는 보장이 없다.
+	while (state->mRunning.load(std::memory_order_acquire))
+	{
+#if defined(IS_WINDOWS)
+		WSAPOLLFD pfd{};
+		pfd.fd     = state->mSocket;
+		pfd.events = POLLRDNORM;
+		const int ready = WSAPoll(&pfd, 1, 100);
+#else
+		pollfd pfd{};
+		pfd.fd     = state->mSocket;
+		pfd.events = POLLIN;
+		const int ready = ::poll(&pfd, 1, 100);
+#endif
+		if (ready <= 0)
+		{
+			continue;
+		}
+
+		SocketHandle client = ::accept(state->mSocket, nullptr, nullptr);
+		if (client == kInvalidConnectSocket)
+		{
+			continue;
+		}
+		AcceptListenerSession(*state, client);
+	}
+}
+
+void BaseNetworkEngine::AcceptListenerSession(const ListenerState &state, SocketHandle socket)
+{
+#if !defined(IS_WINDOWS)
+	const int flags = fcntl(socket, F_GETFL, 0);
+	if (flags != -1)
+	{
+		fcntl(socket, F_SETFL, flags | O_NONBLOCK);
+	}
+#endif
+
+	SessionRef session = SessionManager::Instance().CreateSession(socket);
+	if (!session)
+	{
+		CloseConnectSocket(socket);
+		return;
+	}
+	if (state.mOptions.mConfigurator)
+	{
+		state.mOptions.mConfigurator(session.get());
+	}
+	session->SetLogicDispatcher(&mLogicDispatcher);
+	session->SetRecvEngine(this);
+
+	const auto connId = session->GetId();
+	{
+		std::lock_guard<std::mutex> lock(mListenerMutex);
+		mListenerSessions[connId] = state.mId;
+	}
+	mTotalConnections.Add();
+
+	auto sessionCopy = session;
+	RunSessionTask(session, [sessionCopy]() { sessionCopy->OnConnected(); });
+
+	if (!AttachListenerSession(session))
+	{
+		DetachListenerSession(connId);
+		// English: The session owns the socket — RemoveSession closes it.
+		// 한글: 세션이 소켓을 소유 — RemoveSession이 닫는다.
+		SessionManager::Instance().RemoveSession(session);
+		return;
+	}
+
+	Utils::Logger::Debug("Listener {} accepted Session {}", state.mId, connId);
+}
+
+bool BaseNetworkEngine::AttachListenerSession(const SessionRef &session)
+{
+	const auto context = static_cast<AsyncIO::RequestContext>(session->GetId());
+	if (mProvider->AssociateSocket(session->GetSocket(), context) != AsyncIO::AsyncIOError::Success)
+	{
+		Utils::Logger::Error("Listener - AssociateSocket failed, Session {}: {}",
+		                     session->GetId(), mProvider->GetLastError());
+		return false;
+	}
+	session->SetAsyncProvider(mProvider);
+
+	if (mProvider->RecvAsync(session->GetSocket(), session->GetRecvBuffer(),
+	                         session->GetRecvBufferSize(), context) !=
+	    AsyncIO::AsyncIOError::Success)
+	{
+		Utils::Logger::Error("Listener - RecvAsync failed, Session {}: {}",
+		                     session->GetId(), mProvider->GetLastError());
+		return false;
+	}
+	return true;
+}
+
+void BaseNetworkEngine::RearmParkedRecv(const SessionRef &session)
+{
+	if (!session || !session->IsConnected())
+	{
+		return;
+	}
+	if (!RearmRecv(session))
+	{
+		ProcessErrorCompletion(session, AsyncIO::AsyncIOType::Recv, 0);
+	}
+}
+
+bool BaseNetworkEngine::RearmRecv(const SessionRef &session)
+{
+	std::shared_ptr<AsyncIO::AsyncIOProvider> provider;
+	{
+		std::lock_guard<std::mutex> lock(session->mSendMutex);
+		provider = session->mAsyncProvider;
+	}
+	if (!provider)
+	{
+		return session->PostRecv();
+	}
+
+	if (provider->RecvAsync(session->GetSocket(), session->GetRecvBuffer(), session->GetRecvBufferSize(),
+	                        static_cast<AsyncIO::RequestContext>(session->GetId())) !=
+	    AsyncIO::AsyncIOError::Success)
+	{
+		Utils::Logger::Error("Resume - RecvAsync failed, Session {}: {}", session->GetId(),
+		                     provider->GetLastError());
+		return false;
+	}
+	provider->FlushRequests();
+	return true;
+}
+
+void BaseNetworkEngine::PauseRecvOnOverload(const SessionRef &session)
+{
+	// English: A single late chunk is not a standing queue — pause only sessions that keep
+	//          feeding an overloaded worker. Called on the session's I/O thread, so the
+	//          IsRecvPaused check and PauseRecv cannot race another pause of the same session.
+	// 한글: 늦은 청크 하나는 상시 적체가 아니다 — 과부하 워커에 계속 밀어 넣는 세션만 멈춘다.
+	//       세션의 I/O 스레드에서 호출되므로 IsRecvPaused 확인과 PauseRecv 사이에
+	//       같은 세션의 다른 일시 중지가 끼어들지 않는다.
+	if (session->GetRecvBacklog() < 2 || session->IsRecvPaused(RecvPauseReason::Overload))
+	{
+		return;
+	}
+	const auto connId = session->GetId();
+	if (!mLogicDispatcher.IsOverloaded(connId))
+	{
+		return;
+	}
+
+	session->PauseRecv(RecvPauseReason::Overload);
+	mRecvOverloadPauses.Add();
+	Utils::Logger::Debug("Logic worker overloaded - recv paused, Session: {}", connId);
+
+	std::weak_ptr<Session> weakSession = session;
+	mTimerQueue.ScheduleRepeat(
+		[this, weakSession, connId]() -> bool
+		{
+			auto locked = weakSession.lock();
+			if (!locked || locked->GetId() != connId || !locked->IsConnected())
+			{
+				return false;
+			}
+			if (mRunning.load(std::memory_order_acquire) && mLogicDispatcher.IsOverloaded(connId))
+			{
+				return true;
+			}
+			locked->ResumeRecv(RecvPauseReason::Overload);
+			return false;
+		},
+		mSojournIntervalMs);
+}
+
+bool BaseNetworkEngine::DetachListenerSession(Utils::ConnectionId connId)
+{
+	std::lock_guard<std::mutex> lock(mListenerMutex);
+	return mListenerSessions.erase(connId) != 0;
+}
+
+OSError BaseNetworkEngine::StartConnectAttempt(const ConnectorStateRef &state,
+                                               AsyncIO::AsyncIOError &outError)
+{
+	outError = AsyncIO::AsyncIOError::Success;
+
+	SocketHandle socket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (socket == kInvalidConnectSocket)
+	{
+		outError = AsyncIO::AsyncIOError::OperationFailed;
+		return LastSocketError();
+	}
+
+	// English: Non-blocking before connect; server links want low latency over batching.
+	// 한글: connect 전에 논블로킹 설정; 서버 간 링크는 배칭보다 지연을 우선한다.
+#if defined(IS_WINDOWS)
+	u_long nonBlocking = 1;
+	ioctlsocket(socket, FIONBIO, &nonBlocking);
+#else
+	const int flags = fcntl(socket, F_GETFL, 0);
+	if (flags != -1)
+	{
+		fcntl(socket, F_SETFL, flags | O_NONBLOCK);
+	}
+#endif
+	int noDelay = 1;
+	setsockopt(socket, IPPROTO_TCP, TCP_NODELAY,
+	           reinterpret_cast<const char *>(&noDelay), sizeof(noDelay));
+
+	AsyncIO::RequestContext context = 0;
+	{
+		std::lock_guard<std::mutex> lock(mConnectorMutex);
+		if (state->mRemoved)
+		{
+			CloseConnectSocket(socket);
+			return 0;
+		}
+		++state->mAttempt;
+		state->mPendingSocket = socket;
+		state->mRetryTimer    = 0;
+		context = kConnectContextTag |
+		          (static_cast<AsyncIO::RequestContext>(state->mAttempt) << 32) |
+		          state->mId;
+	}
+
+	outError = mProvider->ConnectAsync(
+		socket, reinterpret_cast<const sockaddr *>(&state->mAddress),
+		state->mAddressLength, context);
+	if (outError == AsyncIO::AsyncIOError::Success)
+	{
+		return 0;
+	}
+
+	// English: Capture errno before any other call can clobber it.
+	// 한글: 다른 호출이 덮어쓰기 전에 errno 확보.
+	OSError osError = LastSocketError();
+	if (osError == 0)
+	{
+		osError = EIO;
+	}
+	{
+		std::lock_guard<std::mutex> lock(mConnectorMutex);
+		if (state->mPendingSocket == socket)
+		{
+			state->mPendingSocket = kInvalidConnectSocket;
+		}
+	}
+	CloseConnectSocket(socket);
+	return osError;
+}
+
+void BaseNetworkEngine::ScheduleReconnect(const ConnectorStateRef &state, OSError lastError)
+{
+	if (!mInitialized.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	// English: Exponential backoff, except ECONNREFUSED (peer restarting) which
+	//          retries at a short fixed interval so a quick restart is not missed.
+	// 한글: 지수 백오프. 단, ECONNREFUSED(상대 재기동 중)는 빠른 재기동을 놓치지
+	//       않도록 짧은 고정 간격으로 재시도한다.
+	uint32_t delayMs = 0;
+	{
+		std::lock_guard<std::mutex> lock(mConnectorMutex);
+		if (state->mRemoved)
+		{
+			return;
+		}
+		if (lastError == kConnRefused)
+		{
+			delayMs = state->mOptions.mRefusedRetryMs;
+		}
+		else
+		{
+			delayMs = state->mBackoffMs;
+			state->mBackoffMs = (std::min)(state->mBackoffMs * 2,
+			                               (std::max)(state->mOptions.mMaxBackoffMs, 1u));
+		}
+	}
+
+	Utils::Logger::Info("Connector {} reconnect in {}ms (last error: {})",
+	                    state->mId, delayMs, static_cast<uint32_t>(lastError));
+
+	std::weak_ptr<ConnectorState> weakState = state;
+	const auto handle = mTimerQueue.ScheduleOnce(
+		[this, weakState]()
+		{
+			auto locked = weakState.lock();
+			if (!locked)
+			{
+				return;
+			}
+			AsyncIO::AsyncIOError error = AsyncIO::AsyncIOError::Success;
+			const OSError osError = StartConnectAttempt(locked, error);
+			if (osError != 0)
+			{
+				ScheduleReconnect(locked, osError);
+			}
+		},
+		delayMs);
+
+	std::lock_guard<std::mutex> lock(mConnectorMutex);
+	if (!state->mRemoved)
+	{
+		state->mRetryTimer = handle;
+	}
+}
+
+void BaseNetworkEngine::ProcessConnectCompletion(const AsyncIO::CompletionEntry &entry)
+{
+	if ((entry.mContext & kConnectContextTag) == 0)
+	{
+		return;
+	}
+	const auto connectorId = static_cast<ConnectorId>(entry.mContext & 0xFFFFFFFFull);
+	const auto attempt     = static_cast<uint32_t>((entry.mContext & ~kConnectContextTag) >> 32);
+
+	ConnectorStateRef state;
+	SocketHandle socket = kInvalidConnectSocket;
+	bool removed = false;
+	{
+		std::lock_guard<std::mutex> lock(mConnectorMutex);
+		auto it = mConnectors.find(connectorId);
+		if (it == mConnectors.end() || it->second->mAttempt != attempt ||
+			it->second->mPendingSocket == kInvalidConnectSocket)
+		{
+			// English: Stale completion (older attempt, or already retired by Stop()).
+			// 한글: 지난 완료 (이전 시도이거나 Stop()에서 이미 정리됨).
+			return;
+		}
+		state  = it->second;
+		socket = state->mPendingSocket;
+		state->mPendingSocket = kInvalidConnectSocket;
+		removed = state->mRemoved;
+		if (removed)
+		{
+			mConnectors.erase(it);
+		}
+	}
+
+	if (removed)
+	{
+		CloseConnectSocket(socket);
+		return;
+	}
+
+	if (entry.mOsError != 0 || entry.mResult < 0)
+	{
+		CloseConnectSocket(socket);
+		Utils::Logger::Warn("Connector {} connect to {}:{} failed - OS error: {}",
+		                    connectorId, state->mOptions.mHost, state->mOptions.mPort,
+		                    static_cast<uint32_t>(entry.mOsError));
+		ScheduleReconnect(state, entry.mOsError);
+		return;
+	}
+
+	// English: From here on the socket is an ordinary pooled session — same buffers,
+	//          I/O workers and KeyedDispatcher affinity as accepted connections.
+	//          ConnectAsync already registered the socket, so no AssociateSocket.
+	// 한글: 이후 소켓은 일반 풀 세션 — accept된 연결과 같은 버퍼, I/O 워커,
+	//       KeyedDispatcher 친화도를 쓴다. ConnectAsync가 이미 소켓을 등록했으므로
+	//       AssociateSocket은 호출하지 않는다.
+	SessionRef session = SessionManager::Instance().CreateSession(socket);
+	if (!session)
+	{
+		CloseConnectSocket(socket);
+		ScheduleReconnect(state, 0);
+		return;
+	}
+	if (state->mOptions.mConfigurator)
+	{
+		state->mOptions.mConfigurator(session.get());
+	}
+	session->SetAsyncProvider(mProvider);
+	session->SetLogicDispatcher(&mLogicDispatcher);
+	session->SetRecvEngine(this);
+
+	const auto connId = session->GetId();
+	{
+		std::lock_guard<std::mutex> lock(mConnectorMutex);
+		state->mSessionId = connId;
+		state->mBackoffMs = (std::max)(state->mOptions.mInitialBackoffMs, 1u);
+		mOutboundSessions[connId] = connectorId;
+	}
+	mTotalConnections.Add();
+
+	auto sessionCopy = session;
+	RunSessionTask(session,
+		[sessionCopy, state, connId]()
+		{
+			sessionCopy->OnConnected();
+			if (state->mOptions.mOnConnected)
+			{
+				state->mOptions.mOnConnected(connId);
+			}
+		});
+
+	Utils::Logger::Info("Connector {} connected to {}:{} (Session {})",
+	                    connectorId, state->mOptions.mHost, state->mOptions.mPort, connId);
+
+	if (mProvider->RecvAsync(session->GetSocket(), session->GetRecvBuffer(),
+	                         session->GetRecvBufferSize(),
+	                         static_cast<AsyncIO::RequestContext>(connId)) !=
+	    AsyncIO::AsyncIOError::Success)
+	{
+		Utils::Logger::Error("Connector {} - RecvAsync failed: {}", connectorId, mProvider->GetLastError());
+		ProcessErrorCompletion(session, AsyncIO::AsyncIOType::Recv, 0);
+	}
+}
+
+bool BaseNetworkEngine::DetachOutboundSession(Utils::ConnectionId connId)
+{
+	ConnectorStateRef state;
+	{
+		std::lock_guard<std::mutex> lock(mConnectorMutex);
+		auto it = mOutboundSessions.find(connId);
+		if (it == mOutboundSessions.end())
+		{
+			return false;
+		}
+		auto cit = mConnectors.find(it->second);
+		if (cit != mConnectors.end() && !cit->second->mRemoved)
+		{
+			state = cit->second;
+			if (state->mSessionId == connId)
+			{
+				state->mSessionId = 0;
+			}
+		}
+		mOutboundSessions.erase(it);
+	}
+
+	// English: Outbound link dropped — tell the owner and start the backoff cycle.
+	//          Dispatched outside the session AsyncScope: RemoveSession() cancels that
+	//          scope right after, and a lost notification would stall the reconnect.
+	//          No state means the connector was removed; stay quiet.
+	// 한글: 아웃바운드 링크 끊김 — 소유자에게 알리고 백오프 재연결을 시작한다.
+	//       세션 AsyncScope 밖으로 디스패치: 직후 RemoveSession()이 스코프를 취소하므로
+	//       통지가 유실되면 재연결이 멈춘다. state가 없으면 커넥터가 제거된 것이다.
+	if (state)
+	{
+		if (state->mOptions.mOnDisconnected)
+		{
+			mLogicDispatcher.Dispatch(connId, Network::Concurrency::TaskPriority::Control,
+				[state, connId]()
+				{
+					state->mOptions.mOnDisconnected(connId);
+				});
+		}
+		ScheduleReconnect(state, 0);
+	}
+	return true;
+}
+
 INetworkEngine::Statistics BaseNetworkEngine::GetStatistics() const
 {
 	std::lock_guard<std::mutex> lock(mStatsMutex);
 	Statistics stats = mStats;
-	stats.totalBytesSent = mTotalBytesSent.load(std::memory_order_relaxed);
-	stats.totalBytesReceived = mTotalBytesReceived.load(std::memory_order_relaxed);
-	stats.totalConnections = mTotalConnections.load(std::memory_order_relaxed);
+	stats.totalBytesSent = mTotalBytesSent.Value();
+	stats.totalBytesReceived = mTotalBytesReceived.Value();
+	stats.totalConnections = mTotalConnections.Value();
+	stats.totalSendErrors = mTotalSendErrors.Value();
+	stats.totalRecvErrors = mTotalRecvErrors.Value();
+	stats.totalErrors = stats.totalSendErrors + stats.totalRecvErrors;
 	stats.activeConnections = SessionManager::Instance().GetSessionCount();
 	return stats;
 }
 
+void BaseNetworkEngine::CollectMetrics(Utils::MetricsWriter &writer) const
+{
+	// 엔진 누적 통계
+	writer.Counter("netmod_connections_total", "Accepted and connected sessions",
+	               mTotalConnections.Value());
+	writer.Gauge("netmod_sessions_active", "Sessions currently registered",
+	             static_cast<double>(SessionManager::Instance().GetSessionCount()));
+	writer.Counter("netmod_bytes_sent_total", "Bytes sent", mTotalBytesSent.Value());
+	writer.Counter("netmod_bytes_received_total", "Bytes received", mTotalBytesReceived.Value());
+	writer.Counter("netmod_io_errors_total", "Socket I/O errors", mTotalSendErrors.Value(),
+	               {{"direction", "send"}});
+	writer.Counter("netmod_io_errors_total", "Socket I/O errors", mTotalRecvErrors.Value(),
+	               {{"direction", "recv"}});
+
+	const auto &pool = SessionPool::Instance();
+	writer.Gauge("netmod_session_pool_capacity", "Preallocated session slots",
+	             static_cast<double>(pool.Capacity()));
+	writer.Gauge("netmod_session_pool_active", "Session slots in use",
+	             static_cast<double>(pool.ActiveCount()));
+
+	// 로직 디스패처
+	const auto dispatcher = mLogicDispatcher.GetStats();
+	const char *taskHelp  = "Logic dispatcher tasks by result";
+	writer.Counter("netmod_dispatcher_tasks_total", taskHelp, dispatcher.mSubmitted,
+	               {{"dispatcher", "logic"}, {"result", "submitted"}});
+	writer.Counter("netmod_dispatcher_tasks_total", taskHelp, dispatcher.mRejected,
+	               {{"dispatcher", "logic"}, {"result", "rejected"}});
+	writer.Counter("netmod_dispatcher_tasks_total", taskHelp, dispatcher.mCompleted,
+	               {{"dispatcher", "logic"}, {"result", "completed"}});
+	writer.Counter("netmod_dispatcher_tasks_total", taskHelp, dispatcher.mFailed,
+	               {{"dispatcher", "logic"}, {"result", "failed"}});
+	writer.Counter("netmod_dispatcher_tasks_total", taskHelp, dispatcher.mShed,
+	               {{"dispatcher", "logic"}, {"result", "shed"}});
+	writer.Counter("netmod_recv_overload_pauses_total", "Session recv paused by logic worker overload",
+	               mRecvOverloadPauses.Value());
+	const size_t workerCount = mLogicDispatcher.GetWorkerCount();
+	for (size_t i = 0; i < workerCount; ++i)
+	{
+		const std::string worker = std::to_string(i);
+		writer.Gauge("netmod_dispatcher_overloaded", "Dispatcher worker over its sojourn target (1 = overloaded)",
+		             mLogicDispatcher.IsWorkerOverloaded(i) ? 1.0 : 0.0,
+		             {{"dispatcher", "logic"}, {"worker", worker}});
+		writer.Gauge("netmod_dispatcher_sojourn_min_seconds", "Minimum queue wait in the last sojourn interval",
+		             static_cast<double>(mLogicDispatcher.GetWorkerMinSojournNs(i)) / 1e9,
+		             {{"dispatcher", "logic"}, {"worker", worker}});
+		for (size_t lane = 0; lane < Network::Concurrency::kTaskPriorityCount; ++lane)
+		{
+			const auto priority = static_cast<Network::Concurrency::TaskPriority>(lane);
+			writer.Gauge("netmod_dispatcher_queue_depth", "Pending tasks per dispatcher worker and priority lane",
+			             static_cast<double>(mLogicDispatcher.GetWorkerQueueSize(i, priority)),
+			             {{"dispatcher", "logic"}, {"worker", worker},
+			              {"lane", Network::Concurrency::TaskPriorityName(priority)}});
+		}
+	}
+
+	// 비동기 I/O 공급자
+	if (mProvider)
+	{
+		AsyncIO::ProviderStats io;
+		GetProviderStats(io);
+		writer.Counter("netmod_io_requests_total", "Async I/O requests submitted", io.mTotalRequests);
+		writer.Counter("netmod_io_completions_total", "Async I/O completions processed",
+		               io.mTotalCompletions);
+		writer.Gauge("netmod_io_pending_requests", "Async I/O requests in flight",
+		             static_cast<double>(io.mPendingRequests));
+		writer.Counter("netmod_io_provider_errors_total", "Async I/O provider errors",
+		               io.mErrorCount);
+		const char *ioHelp = "Async I/O latency (send: submit to completion, recv: completion to dispatch)";
+		writer.Histogram("netmod_io_latency_seconds", ioHelp, io.mSendLatency, {{"op", "send"}});
+		writer.Histogram("netmod_io_latency_seconds", ioHelp, io.mRecvLatency, {{"op", "recv"}});
+	}
+
+	// 패킷 단계별 지연 (PacketTrace)
+	const auto &trace = PacketTrace::Instance();
+	for (size_t i = 0; i < static_cast<size_t>(PacketStage::Count); ++i)
+	{
+		const auto stage = static_cast<PacketStage>(i);
+		writer.Histogram("netmod_packet_stage_latency_seconds", "Per-stage packet latency",
+		                 trace.GetStageHistogram(stage), {{"stage", PacketStageName(stage)}});
+	}
+}
+
 // =============================================================================
 // English: Helper methods for derived classes
 // 한글: 파생 클래스용 헬퍼 메서드
 // =============================================================================
 
+void BaseNetworkEngine::PinIoThread(size_t index) const
+{
+	Utils::PinCurrentThread(mIoCpus, index, "I/O");
+}
+
+void BaseNetworkEngine::GetProviderStats(AsyncIO::ProviderStats &out) const
+{
+	mProvider->GetStats(out);
+}
+
 void BaseNetworkEngine::FireEvent(NetworkEvent eventType,
 									  Utils::ConnectionId connId,
 									  const uint8_t *data, size_t dataSize,
 									  OSError errorCode)
 {
+	Utils::AllocTagScope allocTag(Utils::AllocTag::EventBus);
+
 	NetworkEventCallback callback;
 	{
 		std::lock_guard<std::mutex> lock(mCallbackMutex);
@@ -368,18 +1293,22 @@ void BaseNetworkEngine::ProcessRecvCompletion(SessionRef session,
 		//       (Cancel() 완료) OnDisconnected()가 이미 닫힌 세션에서 실행되지 않도록 보장.
 		const auto connId = session->GetId();
 		auto sessionCopy  = session;
+		const bool silent = DetachOutboundSession(connId) || DetachListenerSession(connId);
 		if (!session->mAsyncScope.Submit(
 				mLogicDispatcher,
 				connId,
-				[this, sessionCopy, connId]()
+				Network::Concurrency::TaskPriority::Control,
+				[this, sessionCopy, connId, silent]()
 				{
 					sessionCopy->OnDisconnected();
-					FireEvent(NetworkEvent::Disconnected, connId);
+					if (!silent)
+					{
+						FireEvent(NetworkEvent::Disconnected, connId);
+					}
 				}))
 		{
 			Utils::Logger::Warn(
-				"LogicDispatcher full or scope cancelled - disconnect event dropped, Session: " +
-				std::to_string(connId));
+				"LogicDispatcher full or scope cancelled - disconnect event dropped, Session: {}", connId);
 		}
 
 		SessionManager::Instance().RemoveSession(session);
@@ -388,34 +1317,80 @@ void BaseNetworkEngine::ProcessRecvCompletion(SessionRef session,
 
 	// English: Update stats (atomic, no lock needed)
 	// 한글: 통계 업데이트 (atomic, 락 불필요)
-	mTotalBytesReceived.fetch_add(bytesReceived, std::memory_order_relaxed);
+	mTotalBytesReceived.Add(static_cast<uint64_t>(bytesReceived));
+
+	Utils::AllocTagScope allocTag(Utils::AllocTag::Recv);
+
+	// English: Run-to-completion — process the chunk in place on this I/O thread. The buffer
+	//          is safe to read until this returns: every backend re-arms the session's recv
+	//          only after ProcessRecvCompletion, so no copy and no dispatcher hop.
+	// 한글: run-to-completion — 이 I/O 스레드에서 청크를 그 자리에서 처리. 모든 백엔드가
+	//       ProcessRecvCompletion 이후에야 세션 recv를 재등록하므로 반환 전까지 버퍼를
+	//       읽어도 안전하다 — 복사도 디스패처 경유도 없다.
+	if (RunsInline(*session))
+	{
+		PacketTrace::RecvChunkScope traceScope(PacketTrace::Now());
+		session->ProcessRawRecv(data, static_cast<uint32_t>(bytesReceived));
+		FireEvent(NetworkEvent::DataReceived, session->GetId(),
+		          reinterpret_cast<const uint8_t *>(data), bytesReceived);
+		return;
+	}
 
 	// English: Dispatch via AsyncScope so that pending tasks are skipped after session Close().
-	//          KeyedDispatcher key = sessionId guarantees FIFO order per session.
+	//          KeyedDispatcher key = sessionId guarantees FIFO order per session within a lane.
+	//          Chunks of whole declared-priority packets (ping/pong, connect) take their own
+	//          lane and skip the reassembly buffer, so bulk work queued on the same worker
+	//          cannot delay them.
 	// 한글: AsyncScope를 통해 디스패치하여 세션 Close() 이후 대기 작업 건너뜀.
-	//       KeyedDispatcher key = sessionId로 세션 단위 FIFO 순서 보장.
+	//       KeyedDispatcher key = sessionId로 레인 안에서 세션 단위 FIFO 순서 보장.
+	//       우선순위를 선언한 완성 패킷만 담긴 청크(핑/퐁, 접속)는 자기 레인으로 가고 재조립
+	//       버퍼를 거치지 않는다 — 같은 워커에 쌓인 대량 작업에 밀리지 않는다.
 	const auto connId = session->GetId();
+	const uint64_t recvNs = PacketTrace::Now();
+	const auto priority = session->ClassifyRecvChunk(data, static_cast<uint32_t>(bytesReceived));
 	auto sessionCopy  = session;
 	auto dataCopy     = std::make_shared<std::vector<char>>(
         static_cast<size_t>(bytesReceived));
 	std::memcpy(dataCopy->data(), data, static_cast<size_t>(bytesReceived));
 
+	// English: Count the chunk as queued until its task starts (see PauseRecvOnOverload).
+	// 한글: 작업이 시작될 때까지 대기 중인 청크로 센다 (PauseRecvOnOverload 참고).
+	session->mRecvBacklog.fetch_add(1, std::memory_order_relaxed);
 	if (!session->mAsyncScope.Submit(
 			mLogicDispatcher,
 			connId,
-			[this, sessionCopy, dataCopy, bytesReceived]()
+			priority,
+			[this, sessionCopy, dataCopy, bytesReceived, recvNs, priority]()
 			{
+				sessionCopy->mRecvBacklog.fetch_sub(1, std::memory_order_relaxed);
+				PacketTrace::RecvChunkScope traceScope(recvNs);
+				Utils::AllocTagScope recvTag(Utils::AllocTag::Recv);
 				const char *recvData = dataCopy->data();
-				sessionCopy->ProcessRawRecv(recvData,
-				                            static_cast<uint32_t>(bytesReceived));
+				if (priority == Network::Concurrency::TaskPriority::Normal)
+				{
+					sessionCopy->ProcessRawRecv(recvData, static_cast<uint32_t>(bytesReceived));
+				}
+				else
+				{
+					sessionCopy->ProcessFramedRecv(recvData, static_cast<uint32_t>(bytesReceived));
+				}
 				FireEvent(NetworkEvent::DataReceived, sessionCopy->GetId(),
 				          reinterpret_cast<const uint8_t *>(recvData), bytesReceived);
 			}))
 	{
-		Utils::Logger::Warn("Logic queue full - recv dropped, disconnecting Session: " +
-		                    std::to_string(connId));
+		static Utils::LogRateLimiter sLogicQueueFullLog(1000);
+		Utils::Logger::Warn(sLogicQueueFullLog, "Logic queue full - recv dropped, disconnecting Session: {}",
+		                    connId);
+		session->mRecvBacklog.fetch_sub(1, std::memory_order_relaxed);
 		SessionManager::Instance().RemoveSession(session);
+		return;
 	}
+
+	// English: Recv chunks are never shed (a lost chunk breaks the stream); under sustained
+	//          overload the session stops reading instead and TCP pushes back on the peer.
+	// 한글: recv 청크는 버리지 않는다 (청크 유실 = 스트림 파손). 상시 과부하에서는 대신
+	//       세션이 읽기를 멈추고 TCP가 상대를 되밀어낸다.
+	PauseRecvOnOverload(session);
 }
 
 void BaseNetworkEngine::ProcessSendCompletion(SessionRef session,
@@ -426,16 +1401,24 @@ void BaseNetworkEngine::ProcessSendCompletion(SessionRef session,
 		return;
 	}
 
+	// English: Close the trace of the request this send answered (no-op if untraced).
+	// 한글: 이 send가 응답한 요청의 추적을 마감 (추적 대상이 아니면 no-op).
+	PacketTrace::Instance().CompleteSend(session->mInFlightTrace, session->GetId());
+
+	if (bytesSent > 0)
+	{
+		mTotalBytesSent.Add(static_cast<uint64_t>(bytesSent));
+	}
+
 	// English: Fire DataSent event
 	// 한글: DataSent 이벤트 발생
 	FireEvent(NetworkEvent::DataSent, session->GetId());
 
-	// English: Continue sending if queue has more data
-	// 한글: 큐에 더 많은 데이터가 있으면 계속 전송
-	if (!session->PostSend())
+	// English: Continue sending if queue has more data (empty queue fires the drained callback)
+	// 한글: 큐에 더 많은 데이터가 있으면 계속 전송 (비어 있으면 드레인 콜백 호출)
+	if (!session->PostSend(true))
 	{
-		Utils::Logger::Debug("Send queue empty for session " +
-							 std::to_string(session->GetId()));
+		Utils::Logger::Debug("Send queue empty for session {}", session->GetId());
 	}
 }
 
@@ -452,11 +1435,11 @@ void BaseNetworkEngine::ProcessErrorCompletion(SessionRef session,
 
 	if (ioType == AsyncIO::AsyncIOType::Send)
 	{
-		mTotalSendErrors.fetch_add(1, std::memory_order_relaxed);
+		mTotalSendErrors.Add();
 	}
 	else
 	{
-		mTotalRecvErrors.fetch_add(1, std::memory_order_relaxed);
+		mTotalRecvErrors.Add();
 	}
 
 #if defined(IS_WINDOWS)
@@ -471,16 +1454,16 @@ void BaseNetworkEngine::ProcessErrorCompletion(SessionRef session,
 	                              osError == 0);
 #endif
 
-	const std::string direction = (ioType == AsyncIO::AsyncIOType::Send) ? "Send" : "Recv";
-	const std::string msg = direction + " error on Session " + std::to_string(connId) +
-	                        " - OS error: " + std::to_string(static_cast<uint32_t>(osError));
+	const char *direction = (ioType == AsyncIO::AsyncIOType::Send) ? "Send" : "Recv";
 	if (isExpectedClose)
 	{
-		Utils::Logger::Warn(msg);
+		Utils::Logger::Warn("{} error on Session {} - OS error: {}",
+		                    direction, connId, static_cast<uint32_t>(osError));
 	}
 	else
 	{
-		Utils::Logger::Error(msg);
+		Utils::Logger::Error("{} error on Session {} - OS error: {}",
+		                     direction, connId, static_cast<uint32_t>(osError));
 	}
 
 	ProcessRecvCompletion(session, 0, nullptr);
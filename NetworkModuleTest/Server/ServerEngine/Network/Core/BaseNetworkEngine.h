@@ -8,6 +8,7 @@
 
 #include "../../Concurrency/KeyedDispatcher.h"
 #include "../../Concurrency/TimerQueue.h"
+#include "../../Utils/Metrics.h"
 #include "../../Utils/NetworkUtils.h"
 #include "AsyncIOProvider.h"
 #include "NetworkEngine.h"
@@ -18,6 +19,7 @@
 #include <mutex>
 #include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Network::Core
@@ -52,8 +54,20 @@ class BaseNetworkEngine : public INetworkEngine
 	std::string
 	GetConnectionInfo(Utils::ConnectionId connectionId) const override final;
 
+	ConnectorId AddConnector(const ConnectorOptions &options) override final;
+	void RemoveConnector(ConnectorId connectorId) override final;
+
+	ListenerId AddListener(const ListenerOptions &options) override final;
+	void RemoveListener(ListenerId listenerId) override final;
+
 	Statistics GetStatistics() const override final;
 
+	/**
+	 * 일시 중지 중 보관됐던 세션 recv를 재등록한다 (Session::ResumeRecv 전용, 어느 스레드에서나).
+	 * 이미 끊긴 세션은 무시하고, 재등록 실패 시 recv 에러로 연결을 정리한다.
+	 */
+	void RearmParkedRecv(const SessionRef &session);
+
   protected:
 	// =====================================================================
 	// 플랫폼별 훅 (파생 클래스에서 구현 필수)
@@ -109,6 +123,137 @@ class BaseNetworkEngine : public INetworkEngine
 	                            AsyncIO::AsyncIOType ioType,
 	                            OSError osError);
 
+	/**
+	 * AsyncIOType::Connect 완료 처리.
+	 * 성공 시 풀에서 세션을 만들어 recv를 등록하고, 실패 시 백오프 재연결을 예약한다.
+	 * 플랫폼 ProcessCompletions()가 세션 조회 전에 호출해야 한다.
+	 */
+	void ProcessConnectCompletion(const AsyncIO::CompletionEntry &entry);
+
+	/**
+	 * 추가 리스너로 수락된 세션을 I/O 백엔드에 연결하고 첫 recv를 등록한다.
+	 * 기본 구현은 AssociateSocket + SetAsyncProvider + RecvAsync (epoll/io_uring/kqueue).
+	 * recv 등록 방식이 다른 백엔드(IOCP/RIO)는 재정의한다. 실패 시 false.
+	 */
+	virtual bool AttachListenerSession(const SessionRef &session);
+
+	/**
+	 * 보관됐던 recv 1건 재등록 (RearmParkedRecv에서 호출 — I/O 스레드가 아닐 수 있다).
+	 * 기본 구현은 세션 공급자의 RecvAsync + FlushRequests, 공급자가 없으면 PostRecv.
+	 * recv 등록 방식이 다른 백엔드(IOCP/RIO)는 재정의한다. 실패 시 false.
+	 */
+	virtual bool RearmRecv(const SessionRef &session);
+
+	/**
+	 * 이 세션의 핸들러를 I/O 스레드에서 인라인으로 실행하는지 여부.
+	 * run-to-completion 모드이고 세션이 블로킹 핸들러로 표시되지 않았을 때 true.
+	 */
+	bool RunsInline(const Session &session) const
+	{
+		return mRunToCompletion && !session.HasBlockingHandler();
+	}
+
+	/**
+	 * 세션 제어 작업(Connected 등)을 세션의 핸들러와 같은 실행 문맥에서 실행한다.
+	 * 인라인 세션은 호출 스레드에서 즉시, 그 외에는 로직 디스패처(key = 세션 ID)의 Control 레인으로 보낸다.
+	 * recv 등록 전에 호출하면 인라인 모드에서도 첫 핸들러보다 먼저 끝난다.
+	 */
+	template <typename Fn> void RunSessionTask(const SessionRef &session, Fn &&task)
+	{
+		if (RunsInline(*session))
+		{
+			task();
+			return;
+		}
+		mLogicDispatcher.Dispatch(session->GetId(), Network::Concurrency::TaskPriority::Control,
+		                          std::forward<Fn>(task));
+	}
+
+	/** I/O 워커 index를 mIoCpus[index % 크기]에 고정 (집합이 비면 아무것도 안 함). 워커 스레드 시작 시 호출 */
+	void PinIoThread(size_t index) const;
+
+	/** 메트릭용 I/O 공급자 통계. 공급자를 여러 개 쓰는 플랫폼(스레드별 샤드)은 합산해 재정의한다. */
+	virtual void GetProviderStats(AsyncIO::ProviderStats &out) const;
+
+  private:
+	// 커넥터 1개의 상태. mConnectorMutex 보호.
+	struct ConnectorState
+	{
+		ConnectorId         mId = 0;
+		ConnectorOptions    mOptions;                 // AddConnector 시 복사, 이후 불변 (락 없이 읽기 허용)
+		sockaddr_storage    mAddress{};               // 해석된 대상 주소 (불변)
+		size_t              mAddressLength = 0;       // mAddress 유효 바이트 수
+		SocketHandle        mPendingSocket;           // connect 진행 중 소켓 (없으면 무효 핸들)
+		uint32_t            mAttempt = 0;             // 시도 세대 — 지난 시도의 늦은 완료 무시
+		uint32_t            mBackoffMs = 0;           // 다음 재연결 대기 (ms)
+		Utils::ConnectionId mSessionId = 0;           // 연결된 세션 (0 = 미연결)
+		Network::Concurrency::TimerQueue::TimerHandle mRetryTimer = 0;  // 예약된 재연결 (0 = 없음)
+		bool                mRemoved = false;         // RemoveConnector/Stop 이후 — 재연결 금지
+	};
+	using ConnectorStateRef = std::shared_ptr<ConnectorState>;
+
+	// connect 요청 컨텍스트 = 태그 | (시도 세대 << 32) | 커넥터 ID.
+	// 세션 ID(KeyGenerator, 1부터 단조 증가)는 최상위 비트에 도달하지 않는다.
+	static constexpr AsyncIO::RequestContext kConnectContextTag = 1ull << 63;
+
+	/** 소켓 생성 후 ConnectAsync 발행. 동기 실패 시 OS 에러 반환 (0 = 발행됨) */
+	OSError StartConnectAttempt(const ConnectorStateRef &state, AsyncIO::AsyncIOError &outError);
+
+	/** 백오프 후 StartConnectAttempt 예약 (ECONNREFUSED는 고정 간격) */
+	void ScheduleReconnect(const ConnectorStateRef &state, OSError lastError);
+
+	/** 아웃바운드 세션이면 커넥터에서 분리 후 콜백 + 재연결 예약하고 true (인바운드는 false) */
+	bool DetachOutboundSession(Utils::ConnectionId connId);
+
+	// 추가 리스너 1개의 상태. 맵 등록/제거는 mListenerMutex 보호, 나머지는 accept 스레드 전용.
+	struct ListenerState
+	{
+		ListenerId        mId = 0;
+		ListenerOptions   mOptions;                 // AddListener 시 복사, 이후 불변
+		SocketHandle      mSocket;                  // listen 소켓 (RemoveListener/Stop에서 닫음)
+		std::atomic<bool> mRunning{false};          // accept 루프 조건
+		std::thread       mThread;                  // 전용 accept 스레드 (poll 100ms 주기로 mRunning 확인)
+	};
+
+	/** 리스너 accept 루프 (리스너별 전용 스레드) */
+	void ListenerAcceptLoop(ListenerState *state);
+
+	/** 리스너로 수락한 소켓을 풀 세션으로 만들어 recv 등록 */
+	void AcceptListenerSession(const ListenerState &state, SocketHandle socket);
+
+	/** accept 스레드 종료 + listen 소켓 닫기 (세션은 호출자가 정리) */
+	void ShutdownListener(ListenerState &state);
+
+	/** 모든 리스너 종료 (Stop / 소멸자). 세션은 CloseAllSessions가 정리 */
+	void RetireListeners();
+
+	/** 리스너 세션이면 추적에서 분리하고 true */
+	bool DetachListenerSession(Utils::ConnectionId connId);
+
+	/**
+	 * 로직 워커가 과부하이고 이 세션의 recv 청크가 쌓여 있으면 recv를 일시 중지하고
+	 * 과부하가 풀릴 때까지 mSojournIntervalMs 주기로 재확인하는 타이머를 건다.
+	 */
+	void PauseRecvOnOverload(const SessionRef &session);
+
+	/** 엔진 통계·디스패처·I/O 공급자·패킷 단계 지연을 메트릭 레지스트리로 내보내는 컬렉터 */
+	void CollectMetrics(Utils::MetricsWriter &writer) const;
+
+	// ─── 아웃바운드 커넥터 ───────────────────────────────────────────────────
+	std::unordered_map<ConnectorId, ConnectorStateRef>   mConnectors;        // 등록된 커넥터
+	std::unordered_map<Utils::ConnectionId, ConnectorId> mOutboundSessions;  // 아웃바운드 세션 → 커넥터
+	std::mutex               mConnectorMutex;       // mConnectors / mOutboundSessions / ConnectorState 보호
+	std::atomic<ConnectorId> mNextConnectorId{1};   // 다음 커넥터 ID (0 = 무효)
+
+	// ─── 추가 리스너 ─────────────────────────────────────────────────────────
+	std::unordered_map<ListenerId, std::unique_ptr<ListenerState>> mListeners;  // 등록된 리스너
+	std::unordered_map<Utils::ConnectionId, ListenerId> mListenerSessions;      // 리스너 세션 → 리스너
+	std::mutex              mListenerMutex;        // mListeners / mListenerSessions 보호
+	std::atomic<ListenerId> mNextListenerId{1};    // 다음 리스너 ID (0 = 무효)
+
+	// ─── 메트릭 ──────────────────────────────────────────────────────────────
+	Utils::MetricsRegistry::CollectorId mMetricsCollectorId = 0;  // Initialize에서 등록, Stop에서 해제
+
   protected:
 	// =====================================================================
 	// 공통 멤버 변수
@@ -122,6 +267,10 @@ class BaseNetworkEngine : public INetworkEngine
 	// ─── 설정 (Initialize()에서 1회 쓰기, 이후 읽기 전용) ───────────────────
 	uint16_t mPort;            // 수신 대기 포트 번호
 	size_t   mMaxConnections;  // 최대 허용 동시 연결 수
+	bool     mRunToCompletion; // NetworkConfig::RunToCompletion — 핸들러를 I/O 스레드에서 인라인 실행
+	uint32_t mIoThreadCount;   // I/O 완료 워커 수 (WorkerThreadCount, 0이면 사용 가능한 CPU 수)
+	std::vector<int> mIoCpus;  // I/O 워커 고정 CPU 집합 (IoCpuSet 해석 결과, 비면 고정 안 함)
+	uint32_t mSojournIntervalMs; // LogicSojournIntervalMs — 과부하 recv 일시 중지 재확인 주기
 
 	// ─── 상태 ────────────────────────────────────────────────────────────────
 	std::atomic<bool> mRunning;      // Start()/Stop() 제어 플래그 — I/O 루프 종료 조건
@@ -140,15 +289,16 @@ class BaseNetworkEngine : public INetworkEngine
 	Network::Concurrency::TimerQueue mTimerQueue;  // 주기 타이머 — Shutdown()에서 명시적으로 내림
 
 	// ─── 통계 ────────────────────────────────────────────────────────────────
-	// 핫 패스 카운터는 atomic (lock-free), 콜드 패스 스냅샷은 mStatsMutex 보호.
+	// 핫 패스 카운터는 스레드별 셀 카운터 (공유 캐시 라인 없음), 콜드 패스 스냅샷은 mStatsMutex 보호.
 	// totalErrors = sendErrors + recvErrors.
 	mutable std::mutex    mStatsMutex;                   // mStats 스냅샷 일관성 보호
 	Statistics            mStats;                        // startTime 등 초기화 시점 데이터
-	std::atomic<uint64_t> mTotalBytesSent{0};            // 누적 송신 바이트 (relaxed 읽기 허용)
-	std::atomic<uint64_t> mTotalBytesReceived{0};        // 누적 수신 바이트 (relaxed 읽기 허용)
-	std::atomic<uint64_t> mTotalConnections{0};          // 누적 연결 수 (현재 미사용 — 확장 예정)
-	std::atomic<uint64_t> mTotalSendErrors{0};           // 송신 방향 에러 카운터
-	std::atomic<uint64_t> mTotalRecvErrors{0};           // 수신 방향 에러 카운터
+	Utils::MetricCounter  mTotalBytesSent;               // 누적 송신 바이트
+	Utils::MetricCounter  mTotalBytesReceived;           // 누적 수신 바이트
+	Utils::MetricCounter  mTotalConnections;             // 누적 연결 수 (accept + 커넥터 + 리스너)
+	Utils::MetricCounter  mTotalSendErrors;              // 송신 방향 에러 카운터
+	Utils::MetricCounter  mTotalRecvErrors;              // 수신 방향 에러 카운터
+	Utils::MetricCounter  mRecvOverloadPauses;           // 로직 과부하로 recv를 일시 중지한 횟수
 };
 
 } // namespace Network::Core
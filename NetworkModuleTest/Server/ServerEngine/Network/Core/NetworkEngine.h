@@ -6,6 +6,7 @@
 #include "AsyncIOProvider.h"
 #include <functional>
 #include <memory>
+#include <string>
 
 namespace Network::Core
 {
@@ -45,6 +46,54 @@ struct NetworkEventData
 
 using NetworkEventCallback = std::function<void(const NetworkEventData &)>;
 
+// =============================================================================
+// 아웃바운드 커넥터 (서버 간 링크)
+// =============================================================================
+
+class Session;
+
+// 커넥터 식별자 (0 = 무효)
+using ConnectorId = uint32_t;
+
+// 아웃바운드 연결 설정.
+// 연결된 세션은 인바운드 세션과 같은 세션 풀·I/O 워커·로직 디스패처를 쓴다.
+// Connected/Disconnected NetworkEvent는 발행하지 않고 아래 콜백으로만 알린다
+// (클라이언트 이벤트 핸들러와 서버 링크를 섞지 않기 위함).
+struct ConnectorOptions
+{
+	std::string mHost;                  // 대상 IPv4 주소 문자열
+	uint16_t    mPort = 0;              // 대상 포트
+	uint32_t    mInitialBackoffMs = 1000;   // 첫 재연결 대기 (연결 성공 시 이 값으로 리셋)
+	uint32_t    mMaxBackoffMs     = 30000;  // 지수 백오프 상한
+	uint32_t    mRefusedRetryMs   = 1000;   // ECONNREFUSED(상대 기동/종료 중) 고정 재시도 간격
+
+	// 세션 생성 직후, 첫 recv 등록 전에 호출 — SetOnRecv 등 세션별 설정용
+	std::function<void(Session *)>    mConfigurator;
+	// 로직 디스패처 워커에서 호출 (세션 키 FIFO 보장)
+	std::function<void(ConnectionId)> mOnConnected;
+	std::function<void(ConnectionId)> mOnDisconnected;
+};
+
+// =============================================================================
+// 추가 리스너 (관리 포트 등)
+// =============================================================================
+
+// 리스너 식별자 (0 = 무효)
+using ListenerId = uint32_t;
+
+// 주 포트 외 추가 수신 대기 설정.
+// 수락된 세션은 주 포트 세션과 같은 세션 풀·I/O 워커·로직 디스패처를 쓴다.
+// 커넥터와 마찬가지로 Connected/Disconnected NetworkEvent는 발행하지 않는다
+// (게임 클라이언트 이벤트 핸들러와 관리 연결을 섞지 않기 위함).
+struct ListenerOptions
+{
+	std::string mBindAddress = "127.0.0.1";  // 바인드할 IPv4 주소 ("0.0.0.0" = 모든 인터페이스)
+	uint16_t    mPort = 0;                   // 수신 대기 포트
+
+	// 세션 생성 직후, 첫 recv 등록 전에 호출 — SetOnRecv / SetOnStreamRecv 등 세션별 설정용
+	std::function<void(Session *)> mConfigurator;
+};
+
 // =============================================================================
 // 핵심 네트워크 인터페이스
 // =============================================================================
@@ -102,6 +151,26 @@ class INetworkEngine
 	/** 연결 정보 조회. 연결이 없으면 빈 문자열 반환. */
 	virtual std::string GetConnectionInfo(ConnectionId connectionId) const = 0;
 
+	/**
+	 * 아웃바운드 커넥터 등록. 즉시 비동기 연결을 시작하며, 실패나 연결 끊김 시
+	 * 지수 백오프로 재연결한다. 엔진 Initialize() 이후 호출.
+	 * @return 커넥터 ID, 백엔드가 비동기 connect를 지원하지 않으면 0
+	 */
+	virtual ConnectorId AddConnector(const ConnectorOptions &options) = 0;
+
+	/** 커넥터 제거 — 진행 중 연결을 중단하고 연결된 세션을 닫는다. 재연결하지 않는다. */
+	virtual void RemoveConnector(ConnectorId connectorId) = 0;
+
+	/**
+	 * 추가 리스너 등록. 바인드/리슨 후 전용 accept 스레드를 시작한다.
+	 * 엔진 Initialize() 이후 호출.
+	 * @return 리스너 ID, 바인드/리슨 실패 시 0
+	 */
+	virtual ListenerId AddListener(const ListenerOptions &options) = 0;
+
+	/** 리스너 제거 — accept를 멈추고 이 리스너로 수락된 세션을 닫는다. */
+	virtual void RemoveListener(ListenerId listenerId) = 0;
+
 	// =====================================================================
 	// 통계
 	// =====================================================================
@@ -2,6 +2,7 @@
 
 // 네트워크 프레이밍용 바이너리 패킷 정의
 
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 
@@ -0,0 +1,309 @@
+#pragma once
+
+// 컴파일 타임 패킷 디스패치 테이블
+//
+// 패킷 구조체마다 PacketTraits<PKT_*> 특수화로 ID와 허용 와이어 크기 [최소, 최대], 디스패치
+// 우선순위를 선언하고 (PacketRegistry.h), 핸들러 목록을 템플릿 인자로 넘기면 constexpr 플랫
+// 테이블이 만들어진다.
+//
+//   using DispatchTable = PacketDispatchTable<ServerPacketHandler, ServerPacketHeader,
+//                                             &ServerPacketHandler::HandleServerPingRequest,
+//                                             &ServerPacketHandler::HandleDBSavePingTimeRequest>;
+//   DispatchTable::Dispatch(this, session, data, size);
+//
+// 핸들러 시그니처 (패킷 타입은 시그니처에서 추론):
+//   void (Owner::*)(Session*, const PKT_X&)               고정 길이 패킷
+//   void (Owner::*)(Session*, const PKT_X&, uint32_t)     가변 길이 — 세 번째 인자는 검증된 header.size
+//   정적/자유 함수 void (*)(Session*, const PKT_X&[, uint32_t])도 같은 규칙 (Owner 무시)
+//
+// 구조:
+//   kIndex[id - kMinId] → kSlots 인덱스 (0 = 미등록). 둘 다 인스턴스화당 1개, 프로세스 전역 읽기 전용.
+//   디스패치 = 범위 비교 1회 + 배열 인덱스 2회 + 직접 호출. 할당·해시·std::function 없음.
+//
+// 검증 (Dispatch가 핸들러 호출 전에 수행 — 핸들러는 크기 검사를 하지 않는다):
+//   - 수신 크기 >= sizeof(Header), sizeof(Header) <= header.size <= 수신 크기
+//   - header.id 등록 여부, PacketTraits의 [kMinSize, kMaxSize] 범위
+//
+// 우선순위: PriorityOf(id)를 Session::SetPacketPriority에 넘기면 I/O 스레드가 recv 청크를
+//   로직 디스패처의 해당 레인으로 보낸다 (Session.h 참고). 미등록 ID는 Normal.
+//
+// 컴파일 타임 보장: 중복 ID, 헤더보다 작은 최소 크기, uint16 header.size로 표현할 수 없는 최대 크기,
+// 너무 넓은 ID 범위(kMaxIdSpan)는 static_assert로 막는다.
+
+#include "../../Concurrency/TaskPriority.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace Network::Core
+{
+
+class Session;
+
+// =============================================================================
+// 패킷 선언
+// =============================================================================
+
+// 미정의 기본형 — 등록되지 않은 패킷으로 핸들러를 만들면 컴파일 에러
+template <typename Packet> struct PacketTraits;
+
+using Concurrency::TaskPriority;
+
+template <auto Id, uint32_t MinSize, uint32_t MaxSize, TaskPriority Priority = TaskPriority::Normal>
+struct PacketSpec
+{
+	static_assert(MinSize <= MaxSize, "PacketSpec: MinSize must be <= MaxSize");
+
+	static constexpr uint16_t     kId       = static_cast<uint16_t>(Id);
+	static constexpr uint32_t     kMinSize  = MinSize;
+	static constexpr uint32_t     kMaxSize  = MaxSize;
+	static constexpr TaskPriority kPriority = Priority;
+};
+
+// 고정 길이 패킷: header.size == sizeof(Packet)
+template <typename Packet, auto Id, TaskPriority Priority = TaskPriority::Normal>
+using FixedPacketSpec = PacketSpec<Id, sizeof(Packet), sizeof(Packet), Priority>;
+
+// 가변 길이 패킷: sizeof(Packet)은 고정부(최소) 크기, 뒤에 최대 MaxSize까지 페이로드
+template <typename Packet, auto Id, uint32_t MaxSize, TaskPriority Priority = TaskPriority::Normal>
+using VariablePacketSpec = PacketSpec<Id, sizeof(Packet), MaxSize, Priority>;
+
+enum class PacketDispatchResult : uint8_t
+{
+	Handled = 0,
+	Malformed,      // 헤더를 읽을 수 없거나 header.size < sizeof(Header)
+	Incomplete,     // header.size > 수신 크기
+	UnknownId,      // 테이블에 없는 ID
+	SizeOutOfRange, // PacketTraits [kMinSize, kMaxSize] 밖
+};
+
+inline const char *PacketDispatchResultName(PacketDispatchResult result)
+{
+	switch (result)
+	{
+	case PacketDispatchResult::Handled:
+		return "handled";
+	case PacketDispatchResult::Malformed:
+		return "malformed";
+	case PacketDispatchResult::Incomplete:
+		return "incomplete";
+	case PacketDispatchResult::UnknownId:
+		return "unknown id";
+	case PacketDispatchResult::SizeOutOfRange:
+		return "size out of range";
+	default:
+		return "?";
+	}
+}
+
+namespace Detail
+{
+// 핸들러 포인터 타입 → (Owner, Packet, 크기 인자 여부)
+template <typename Fn> struct PacketHandlerSignature;
+
+template <typename Packet> struct PacketHandlerSignature<void (*)(Session *, const Packet &)>
+{
+	using Owner                    = void;
+	using PacketType               = Packet;
+	static constexpr bool kWithSize = false;
+};
+
+template <typename Packet> struct PacketHandlerSignature<void (*)(Session *, const Packet &, uint32_t)>
+{
+	using Owner                    = void;
+	using PacketType               = Packet;
+	static constexpr bool kWithSize = true;
+};
+
+template <typename Class, typename Packet>
+struct PacketHandlerSignature<void (Class::*)(Session *, const Packet &)>
+{
+	using Owner                    = Class;
+	using PacketType               = Packet;
+	static constexpr bool kWithSize = false;
+};
+
+template <typename Class, typename Packet>
+struct PacketHandlerSignature<void (Class::*)(Session *, const Packet &, uint32_t)>
+{
+	using Owner                    = Class;
+	using PacketType               = Packet;
+	static constexpr bool kWithSize = true;
+};
+
+// 테이블 슬롯에 들어가는 thunk — 검증을 마친 프레임을 타입 있는 핸들러로 넘긴다
+template <typename Owner, auto Handler>
+void InvokePacketHandler(Owner *owner, Session *session, const char *data, uint32_t packetSize)
+{
+	using Signature = PacketHandlerSignature<decltype(Handler)>;
+	using Packet    = typename Signature::PacketType;
+
+	const Packet &packet = *reinterpret_cast<const Packet *>(data);
+	if constexpr (std::is_void_v<typename Signature::Owner>)
+	{
+		(void)owner;
+		if constexpr (Signature::kWithSize)
+			Handler(session, packet, packetSize);
+		else
+			Handler(session, packet);
+	}
+	else
+	{
+		static_assert(std::is_base_of_v<typename Signature::Owner, Owner>,
+		              "PacketDispatchTable: member handler belongs to a different Owner");
+		if constexpr (Signature::kWithSize)
+			(owner->*Handler)(session, packet, packetSize);
+		else
+			(owner->*Handler)(session, packet);
+	}
+}
+template <auto Handler>
+inline constexpr uint16_t kPacketIdOf =
+	PacketTraits<typename PacketHandlerSignature<decltype(Handler)>::PacketType>::kId;
+
+// 핸들러 목록의 패킷 ID가 모두 다르면 true — 테이블의 중복 ID static_assert가 쓰고,
+// 테이블을 인스턴스화하지 않고도 검사할 수 있도록 분리해 둔다 (중복 등록 테스트).
+template <auto... Handlers> constexpr bool HasUniquePacketIds()
+{
+	constexpr std::array<uint16_t, sizeof...(Handlers)> ids = {kPacketIdOf<Handlers>...};
+	constexpr size_t                                    count = sizeof...(Handlers);
+	for (size_t i = 0; i < count; ++i)
+		for (size_t j = i + 1; j < count; ++j)
+			if (ids[i] == ids[j])
+				return false;
+	return true;
+}
+} // namespace Detail
+
+// =============================================================================
+// PacketDispatchTable
+// =============================================================================
+
+template <typename Owner, typename Header, auto... Handlers> class PacketDispatchTable
+{
+  public:
+	using Invoker = void (*)(Owner *, Session *, const char *, uint32_t);
+
+	struct Slot
+	{
+		Invoker      mInvoke;  // nullptr = 미등록
+		uint32_t     mMinSize;
+		uint32_t     mMaxSize;
+		TaskPriority mPriority;
+	};
+
+	// 테이블이 덮을 수 있는 최대 ID 범위 (kIndex 바이트 수)
+	static constexpr uint32_t kMaxIdSpan = 4096;
+
+  private:
+	template <auto Handler>
+	using TraitsOf = PacketTraits<typename Detail::PacketHandlerSignature<decltype(Handler)>::PacketType>;
+
+	static constexpr size_t kCount = sizeof...(Handlers);
+	static_assert(kCount > 0, "PacketDispatchTable: no handlers");
+	static_assert(kCount < (std::numeric_limits<uint8_t>::max)(), "PacketDispatchTable: too many handlers");
+	static_assert(((TraitsOf<Handlers>::kMinSize >= sizeof(Header)) && ...),
+	              "PacketDispatchTable: packet MinSize smaller than its header");
+	static_assert(((TraitsOf<Handlers>::kMaxSize <= (std::numeric_limits<uint16_t>::max)()) && ...),
+	              "PacketDispatchTable: packet MaxSize exceeds uint16 header.size");
+
+	static constexpr std::array<uint16_t, kCount> kIds = {TraitsOf<Handlers>::kId...};
+
+	static constexpr uint16_t ComputeMinId()
+	{
+		uint16_t minId = kIds[0];
+		for (uint16_t id : kIds)
+			minId = id < minId ? id : minId;
+		return minId;
+	}
+
+	static constexpr uint16_t ComputeMaxId()
+	{
+		uint16_t maxId = kIds[0];
+		for (uint16_t id : kIds)
+			maxId = id > maxId ? id : maxId;
+		return maxId;
+	}
+
+  public:
+	static constexpr uint16_t kMinId = ComputeMinId();
+	static constexpr uint16_t kMaxId = ComputeMaxId();
+	static constexpr uint32_t kSpan  = static_cast<uint32_t>(kMaxId - kMinId) + 1;
+
+	static_assert(Detail::HasUniquePacketIds<Handlers...>(), "PacketDispatchTable: duplicate packet id");
+	static_assert(kSpan <= kMaxIdSpan, "PacketDispatchTable: packet id range too wide for a flat table");
+
+  private:
+	// [0] = 미등록 슬롯 (mInvoke == nullptr)
+	static constexpr std::array<Slot, kCount + 1> kSlots = {
+		Slot{nullptr, 0, 0, TaskPriority::Normal},
+		Slot{&Detail::InvokePacketHandler<Owner, Handlers>, TraitsOf<Handlers>::kMinSize,
+		     TraitsOf<Handlers>::kMaxSize, TraitsOf<Handlers>::kPriority}...};
+
+	static constexpr std::array<uint8_t, kSpan> BuildIndex()
+	{
+		std::array<uint8_t, kSpan> index{};
+		for (size_t i = 0; i < kCount; ++i)
+			index[kIds[i] - kMinId] = static_cast<uint8_t>(i + 1);
+		return index;
+	}
+
+	static constexpr std::array<uint8_t, kSpan> kIndex = BuildIndex();
+
+  public:
+	// 등록되지 않은 ID면 mInvoke == nullptr인 슬롯
+	static constexpr const Slot &Find(uint16_t id)
+	{
+		// id < kMinId는 부호 없는 뺄셈으로 kSpan 이상이 되어 같은 비교에 걸린다
+		const uint32_t offset = static_cast<uint32_t>(id) - kMinId;
+		return kSlots[offset < kSpan ? kIndex[offset] : 0];
+	}
+
+	// 패킷 ID의 선언 우선순위 (미등록이면 Normal). Session::PacketPriorityFn 시그니처와 같다.
+	static TaskPriority PriorityOf(uint16_t id) { return Find(id).mPriority; }
+
+	static PacketDispatchResult Dispatch(Owner *owner, Session *session, const char *data, uint32_t size)
+	{
+		if (data == nullptr || size < sizeof(Header))
+			return PacketDispatchResult::Malformed;
+
+		const Header *header     = reinterpret_cast<const Header *>(data);
+		const uint32_t packetSize = header->size;
+		if (packetSize < sizeof(Header))
+			return PacketDispatchResult::Malformed;
+		if (packetSize > size)
+			return PacketDispatchResult::Incomplete;
+
+		const Slot &slot = Find(header->id);
+		if (slot.mInvoke == nullptr)
+			return PacketDispatchResult::UnknownId;
+		if (packetSize < slot.mMinSize || packetSize > slot.mMaxSize)
+			return PacketDispatchResult::SizeOutOfRange;
+
+		slot.mInvoke(owner, session, data, packetSize);
+		return PacketDispatchResult::Handled;
+	}
+
+	// 거부 사유 로그용 설명 — Dispatch가 Handled가 아닌 결과를 돌려줬을 때만 호출
+	static std::string Describe(PacketDispatchResult result, const char *data, uint32_t size)
+	{
+		std::string text = PacketDispatchResultName(result);
+		text += " - received: " + std::to_string(size);
+		if (data == nullptr || size < sizeof(Header))
+			return text;
+
+		const Header *header = reinterpret_cast<const Header *>(data);
+		text += ", id: " + std::to_string(header->id) + ", header.size: " + std::to_string(header->size);
+		if (result == PacketDispatchResult::SizeOutOfRange)
+		{
+			const Slot &slot = Find(header->id);
+			text += ", allowed: [" + std::to_string(slot.mMinSize) + ", " + std::to_string(slot.mMaxSize) + "]";
+		}
+		return text;
+	}
+};
+
+} // namespace Network::Core
@@ -0,0 +1,105 @@
+#pragma once
+
+// 패킷 레지스트리 — 패킷 구조체별 ID와 허용 와이어 크기 [최소, 최대] 선언
+//
+// PacketDispatchTable은 핸들러 시그니처의 패킷 타입으로 여기 특수화를 찾아 크기 검증 범위를 만든다.
+// 새 패킷을 추가하면 구조체 정의와 함께 이 파일에 한 줄 등록한다 (미등록 패킷은 컴파일 에러).
+//
+//   FixedPacketSpec     header.size == sizeof(PKT_*)
+//   VariablePacketSpec  sizeof(PKT_*) <= header.size <= 지정 최대 (고정부 뒤에 페이로드)
+//
+// 마지막 인자로 디스패치 우선순위 (생략 시 TaskPriority::Normal):
+//   Control  접속·핑/퐁 — 데이터 부하에 밀리면 타임아웃 → 재접속 폭주로 이어지는 패킷.
+//            같은 세션의 앞선 Normal 패킷보다 먼저 처리될 수 있으므로 순서 무관한 패킷만.
+//   Bulk     배치 쿼리처럼 지연에 둔감한 대량 요청
+
+#include "PacketDefine.h"
+#include "PacketDispatchTable.h"
+#include "ServerPacketDefine.h"
+
+namespace Network::Core
+{
+
+// =============================================================================
+// 클라이언트 ↔ 서버 (PacketHeader)
+// =============================================================================
+
+template <>
+struct PacketTraits<PKT_SessionConnectReq>
+	: FixedPacketSpec<PKT_SessionConnectReq, PacketType::SessionConnectReq, TaskPriority::Control>
+{
+};
+
+template <>
+struct PacketTraits<PKT_SessionConnectRes>
+	: FixedPacketSpec<PKT_SessionConnectRes, PacketType::SessionConnectRes, TaskPriority::Control>
+{
+};
+
+// 부하 테스트 클라이언트(TestClient --payload)가 뒤에 패딩을 붙여 보내므로 최대 MAX_PACKET_SIZE
+template <>
+struct PacketTraits<PKT_PingReq>
+	: VariablePacketSpec<PKT_PingReq, PacketType::PingReq, MAX_PACKET_SIZE, TaskPriority::Control>
+{
+};
+
+template <>
+struct PacketTraits<PKT_PongRes> : FixedPacketSpec<PKT_PongRes, PacketType::PongRes, TaskPriority::Control>
+{
+};
+
+// =============================================================================
+// 서버 ↔ 서버 (ServerPacketHeader)
+// =============================================================================
+
+template <>
+struct PacketTraits<PKT_ServerPingReq>
+	: FixedPacketSpec<PKT_ServerPingReq, PKT_ServerPingReq::PacketId, TaskPriority::Control>
+{
+};
+
+template <>
+struct PacketTraits<PKT_ServerPongRes>
+	: FixedPacketSpec<PKT_ServerPongRes, PKT_ServerPongRes::PacketId, TaskPriority::Control>
+{
+};
+
+template <>
+struct PacketTraits<PKT_DBSavePingTimeReq>
+	: FixedPacketSpec<PKT_DBSavePingTimeReq, PKT_DBSavePingTimeReq::PacketId>
+{
+};
+
+template <>
+struct PacketTraits<PKT_DBSavePingTimeRes>
+	: FixedPacketSpec<PKT_DBSavePingTimeRes, PKT_DBSavePingTimeRes::PacketId>
+{
+};
+
+template <>
+struct PacketTraits<PKT_DBQueryReq>
+	: VariablePacketSpec<PKT_DBQueryReq, PKT_DBQueryReq::PacketId, MAX_SERVER_PACKET_SIZE>
+{
+};
+
+template <>
+struct PacketTraits<PKT_DBQueryRes>
+	: VariablePacketSpec<PKT_DBQueryRes, PKT_DBQueryRes::PacketId, MAX_SERVER_PACKET_SIZE>
+{
+};
+
+template <>
+struct PacketTraits<PKT_DBQueryBatchReq>
+	: VariablePacketSpec<PKT_DBQueryBatchReq, PKT_DBQueryBatchReq::PacketId, MAX_SERVER_PACKET_SIZE,
+	                     TaskPriority::Bulk>
+{
+};
+
+template <>
+struct PacketTraits<PKT_DBQueryBatchRes>
+	: VariablePacketSpec<PKT_DBQueryBatchRes, PKT_DBQueryBatchRes::PacketId, MAX_SERVER_PACKET_SIZE,
+	                     TaskPriority::Bulk>
+{
+};
+
+} // namespace Network::Core
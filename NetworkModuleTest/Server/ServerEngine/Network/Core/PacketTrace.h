@@ -0,0 +1,178 @@
+#pragma once
+
+// 패킷 단계별 지연 추적 — 수신 패킷 1개가 응답 송신 완료까지 거치는 구간을 잰다.
+//
+// 단계 (모두 단조 시계 나노초):
+//   LogicQueue     recv 완료 처리 → 로직 워커 실행 시작 (KeyedDispatcher 대기)
+//   Handler        패킷 1개 OnRecv 실행 (ClientPacketHandler 등 애플리케이션 핸들러)
+//   SendQueue      핸들러 안의 Session::Send 큐잉 → SendAsync 제출
+//   SendCompletion SendAsync 제출 → 송신 완료 처리
+//   EndToEnd       recv 완료 처리 → 응답 송신 완료
+//
+// 단계별 히스토그램은 항상 켜져 있다 (패킷당 시계 읽기 약 7회 + 히스토그램 기록 5회, relaxed atomic).
+// 히스토그램은 Utils::MetricHistogram — 스레드별 샤드에 기록하고 조회 시 합친다. 모든 로직/I/O
+// 스레드가 패킷마다 같은 캐시 라인을 두고 경합하지 않도록 한다.
+// 추가로 스레드별 N번째 패킷을 샘플링하여 구간 이벤트를 고정 크기 링에 남기고,
+// Chrome/Perfetto trace JSON(chrome://tracing, ui.perfetto.dev)으로 내보낸다.
+//
+// 단계 간 연결:
+//   - RecvChunkScope / HandlerScope가 로직 워커의 thread_local에 현재 패킷을 둔다.
+//   - 그 안에서 호출된 Session::Send는 CaptureSend()로 스탬프를 송신 큐 항목에 복사한다.
+//   - 핸들러 밖(타이머, 다른 세션 브로드캐스트 등)에서의 Send는 추적하지 않는다.
+//
+// 오버헤드:
+//   - 상시 경로 비용은 초기화 시 보정(calibration)한 기록 1회 비용 × 기록 수로 추정한다.
+//     보정은 단일 스레드(경합 없는 샤드)에서 잰다 — 기록 스레드 수가 샤드 수
+//     (MetricsDetail::kShardCount)를 넘어 샤드를 공유하면 실제 비용은 이보다 크다 (하한값).
+//   - 샘플 경로는 실제로 소요된 시간을 직접 재어 누적한다.
+//   - 샘플 이벤트 링은 kMaxTraceEvents 고정 — 가득 차면 가장 오래된 이벤트를 덮어쓴다.
+//   - BuildReport()가 두 값을 핸들러 총 실행 시간 대비 비율과 함께 보여준다.
+//
+// 환경 변수:
+//   NETMOD_PACKET_TRACE_SAMPLE=N   스레드별 N개 패킷 중 1개 샘플 (기본 1024, 0이면 샘플링 끔)
+//   NETMOD_PACKET_TRACE=<경로>      종료 시 Chrome trace JSON 기록
+//   NETMOD_PACKET_REPORT=<경로>     종료 시 단계별 보고서 기록 ("-"이면 stderr)
+
+#include "../../Utils/LatencyHistogram.h"
+#include "../../Utils/Metrics.h"
+#include "../../Utils/NetworkTypes.h"
+#include "../../Utils/Timer.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Network::Core
+{
+
+enum class PacketStage : uint8_t
+{
+	LogicQueue = 0,
+	Handler,
+	SendQueue,
+	SendCompletion,
+	EndToEnd,
+	Count
+};
+
+const char *PacketStageName(PacketStage stage);
+
+// 응답 송신 큐 항목에 실려 단계 사이를 이동하는 스탬프. mRecvNs == 0이면 추적 대상 아님.
+struct PacketTraceStamp
+{
+	uint64_t mRecvNs    = 0;  // recv 완료 처리 시각
+	uint64_t mEnqueueNs = 0;  // Session::Send 큐잉 시각
+	uint64_t mSubmitNs  = 0;  // SendAsync 제출 시각
+	uint32_t mSampleId  = 0;  // 0 = 샘플 아님
+	uint16_t mPacketId  = 0;  // 요청 패킷 ID
+
+	bool IsTraced() const { return mRecvNs != 0; }
+};
+
+class PacketTrace
+{
+  public:
+	static constexpr size_t   kMaxTraceEvents     = 1u << 14;  // 이벤트 40B — 약 640KB
+	static constexpr uint32_t kDefaultSampleEvery = 1024;
+
+	static PacketTrace &Instance();
+
+	static uint64_t Now() { return Utils::Timer::GetMonotonicNs(); }
+
+	// ─── 로직 워커: recv 청크 1개 처리 구간 ──────────────────────────────
+	// 생성 시 LogicQueue 단계를 기록하고 이후 HandlerScope가 recvNs를 이어받는다.
+	class RecvChunkScope
+	{
+	  public:
+		explicit RecvChunkScope(uint64_t recvNs);
+		~RecvChunkScope();
+
+		RecvChunkScope(const RecvChunkScope &) = delete;
+		RecvChunkScope &operator=(const RecvChunkScope &) = delete;
+	};
+
+	// ─── 로직 워커: 패킷 1개 OnRecv 구간 ────────────────────────────────
+	class HandlerScope
+	{
+	  public:
+		HandlerScope(Utils::ConnectionId sessionId, const char *packet, uint32_t size);
+		~HandlerScope();
+
+		HandlerScope(const HandlerScope &) = delete;
+		HandlerScope &operator=(const HandlerScope &) = delete;
+
+	  private:
+		Utils::ConnectionId mSessionId;
+		uint64_t            mStartNs;
+		PacketTraceStamp    mStamp;
+		PacketTraceStamp   *mPrevious;  // 중첩 호출 시 복원할 바깥 패킷 스탬프
+	};
+
+	// Session::Send — 현재 처리 중인 패킷이 있으면 큐잉 시각을 찍은 스탬프, 없으면 빈 스탬프
+	static PacketTraceStamp CaptureSend();
+
+	// Session::PostSend — SendAsync 직전. SendQueue 단계 기록.
+	void MarkSubmitted(PacketTraceStamp &stamp, Utils::ConnectionId sessionId);
+
+	// 송신 완료 처리 — SendCompletion/EndToEnd 단계 기록 후 stamp를 비운다.
+	void CompleteSend(PacketTraceStamp &stamp, Utils::ConnectionId sessionId);
+
+	// ─── 조회 / 내보내기 ────────────────────────────────────────────────
+	Utils::LatencyHistogram GetStageHistogram(PacketStage stage) const;
+
+	// 단계별 분위 + 오버헤드 요약 (사람이 읽는 표)
+	std::string BuildReport() const;
+
+	// 샘플 이벤트 링을 Chrome trace JSON으로 기록. 파일을 열지 못하면 false.
+	bool WriteChromeTrace(const char *path) const;
+	void WriteChromeTrace(std::FILE *out) const;
+
+	// 히스토그램과 샘플 링을 비운다 (구간 측정용, 동시 기록 중 호출 시 근사치).
+	void Reset();
+
+	uint32_t GetSampleEvery() const { return mSampleEvery; }
+
+	PacketTrace(const PacketTrace &) = delete;
+	PacketTrace &operator=(const PacketTrace &) = delete;
+
+  private:
+	PacketTrace();
+
+	struct TraceEvent
+	{
+		uint64_t            mStartNs;
+		uint64_t            mDurationNs;
+		Utils::ConnectionId mSessionId;
+		uint32_t            mSampleId;
+		uint32_t            mThreadId;
+		uint16_t            mPacketId;
+		PacketStage         mStage;
+	};
+
+	void Record(PacketStage stage, uint64_t ns)
+	{
+		mStages[static_cast<size_t>(stage)].Record(ns);
+	}
+
+	// 샘플 경로 전용 — 이벤트 묶음을 링에 넣고 소요 시간을 오버헤드로 누적한다.
+	void AppendSampled(const TraceEvent *events, size_t count, uint64_t sampleStartNs);
+	uint32_t NextSampleId();
+
+	Utils::MetricHistogram mStages[static_cast<size_t>(PacketStage::Count)];  // 단계별, 스레드 샤드
+
+	uint32_t mSampleEvery;          // 생성 시 1회 결정, 이후 읽기 전용
+	uint64_t mEpochNs;              // trace ts 기준 시각
+	double   mCalibratedRecordNs;   // 시계 읽기 + 히스토그램 기록 1회 비용 (보정값)
+
+	std::atomic<uint32_t> mNextSampleId{1};
+	std::atomic<uint64_t> mSampledPackets{0};
+	std::atomic<uint64_t> mSampledOverheadNs{0};
+
+	mutable std::mutex      mRingMutex;   // 샘플 경로에서만 잠근다
+	std::vector<TraceEvent> mRing;        // 샘플링이 켜져 있으면 생성 시 kMaxTraceEvents로 할당
+	uint64_t                mRingWritten = 0;  // 누적 기록 수 (링 위치 = % 용량)
+};
+
+} // namespace Network::Core
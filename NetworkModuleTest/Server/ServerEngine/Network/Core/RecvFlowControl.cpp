@@ -0,0 +1,151 @@
+// 하류 큐 → 소켓 읽기 크레딧 흐름 제어 구현
+
+#include "RecvFlowControl.h"
+#include "Session.h"
+#include "SessionManager.h"
+#include "../../Utils/Logger.h"
+
+namespace Network::Core
+{
+
+RecvFlowControl::~RecvFlowControl()
+{
+	Shutdown();
+}
+
+bool RecvFlowControl::Initialize(size_t partitionCount, const Options &options)
+{
+	if (options.mHighWater > 0 && options.mLowWater >= options.mHighWater)
+	{
+		Utils::Logger::Error("RecvFlowControl: low water {} must be below high water {}",
+		                     options.mLowWater, options.mHighWater);
+		return false;
+	}
+
+	mOptions = options;
+	mPartitions.clear();
+	mPartitions.reserve(partitionCount);
+	for (size_t i = 0; i < partitionCount; ++i)
+	{
+		mPartitions.push_back(std::make_unique<Partition>());
+	}
+	return true;
+}
+
+void RecvFlowControl::Shutdown()
+{
+	for (auto &partition : mPartitions)
+	{
+		partition->mDepth.store(0);
+		ResumeAll(*partition);
+	}
+}
+
+void RecvFlowControl::OnEnqueue(size_t partition, Utils::ConnectionId sessionId)
+{
+	if (!Enabled())
+	{
+		return;
+	}
+
+	Partition &p = *mPartitions[partition % mPartitions.size()];
+	if (p.mDepth.fetch_add(1) + 1 < mOptions.mHighWater)
+	{
+		return;
+	}
+
+	bool drained = false;
+	{
+		std::lock_guard<std::mutex> lock(p.mMutex);
+		p.mThrottled.store(true);
+		// mThrottled 저장 → 적체 재확인 (OnComplete는 적체 감소 → mThrottled 확인).
+		// 양쪽 seq_cst — 그 사이 하한까지 비었으면 이쪽이 보고 재개를 맡는다.
+		if (p.mDepth.load() <= mOptions.mLowWater)
+		{
+			drained = true;
+		}
+		else
+		{
+			if (p.mPaused.count(sessionId) != 0)
+			{
+				return;
+			}
+			auto session = SessionManager::Instance().GetSession(sessionId);
+			if (!session)
+			{
+				return;
+			}
+			p.mPaused.insert(sessionId);
+			// 락 안에서 멈춘다 — ResumeAll이 mPaused를 가져간 뒤에 멈추면 재개가 누락된다.
+			session->PauseRecv(RecvPauseReason::FlowControl);
+		}
+	}
+	if (drained)
+	{
+		ResumeAll(p);
+		return;
+	}
+	mPauses.Add();
+	Utils::Logger::Debug("RecvFlowControl: partition {} backlog over {} - recv paused, Session: {}",
+	                     partition, mOptions.mHighWater, sessionId);
+}
+
+void RecvFlowControl::OnComplete(size_t partition, size_t count)
+{
+	if (!Enabled() || count == 0)
+	{
+		return;
+	}
+
+	Partition &p = *mPartitions[partition % mPartitions.size()];
+	const size_t depth = p.mDepth.fetch_sub(count) - count;
+	if (depth > mOptions.mLowWater || !p.mThrottled.load())
+	{
+		return;
+	}
+	ResumeAll(p);
+}
+
+void RecvFlowControl::ResumeAll(Partition &partition)
+{
+	std::unordered_set<Utils::ConnectionId> paused;
+	{
+		std::lock_guard<std::mutex> lock(partition.mMutex);
+		if (partition.mDepth.load() > mOptions.mLowWater)
+		{
+			return;
+		}
+		partition.mThrottled.store(false);
+		paused.swap(partition.mPaused);
+	}
+
+	// ResumeRecv가 recv를 재등록할 수 있으므로 (공급자 호출) 락 밖에서
+	for (const auto sessionId : paused)
+	{
+		if (auto session = SessionManager::Instance().GetSession(sessionId))
+		{
+			session->ResumeRecv(RecvPauseReason::FlowControl);
+			mResumes.Add();
+		}
+	}
+}
+
+size_t RecvFlowControl::GetDepth(size_t partition) const
+{
+	if (mPartitions.empty())
+	{
+		return 0;
+	}
+	return mPartitions[partition % mPartitions.size()]->mDepth.load(std::memory_order_relaxed);
+}
+
+bool RecvFlowControl::IsThrottled(size_t partition) const
+{
+	if (mPartitions.empty())
+	{
+		return false;
+	}
+	return mPartitions[partition % mPartitions.size()]->mThrottled.load(std::memory_order_relaxed);
+}
+
+} // namespace Network::Core
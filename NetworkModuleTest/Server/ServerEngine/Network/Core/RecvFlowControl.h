@@ -0,0 +1,86 @@
+#pragma once
+
+// 하류 큐 → 소켓 읽기 크레딧 흐름 제어.
+//
+// 패킷 핸들러가 작업을 넘기는 하류 큐(DB 작업 큐 등)가 밀리면 네트워크 계층이 계속 읽어
+// 큐와 힙이 끝없이 자란다. 파티션(하류 워커)마다 크레딧 mHighWater개를 두고:
+//   - 작업 수락(OnEnqueue)마다 크레딧 1개 소비, 완료(OnComplete)마다 반환.
+//   - 크레딧이 바닥나면(적체 ≥ mHighWater) 그 파티션에 작업을 넣은 세션의 recv를 멈춘다
+//     (Session::PauseRecv(RecvPauseReason::FlowControl)) — 엔진이 recv를 재등록하지 않아
+//     데이터는 커널에 남고 TCP 윈도가 상대를 조절한다.
+//   - 적체가 mLowWater 이하로 내려가면 멈춘 세션을 모두 재개한다 (히스테리시스).
+//   - 중지는 세션의 사유별 보유 횟수라, 여러 하류 큐·파티션이 같은 세션을 멈춰도 각자 자기
+//     중지만 푼다 — 다른 큐가 아직 밀려 있으면 세션은 계속 멈춰 있다.
+//
+// 작업이 이미 읽은 청크에서 나오므로 멈춘 뒤에도 최대 recv 버퍼 1개 분량은 더 들어온다 —
+// 적체 상한은 mHighWater + (멈춘 세션 수 × 청크당 작업 수).
+//
+// OnEnqueue/OnComplete는 어느 스레드에서나 호출 가능. 상한 아래에서는 atomic 1회.
+
+#include "../../Utils/Metrics.h"
+#include "../../Utils/NetworkTypes.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace Network::Core
+{
+
+class RecvFlowControl
+{
+  public:
+	struct Options
+	{
+		size_t mHighWater = 0;  // 파티션 적체가 이 값에 닿으면 공급 세션 recv 중지 (0 = 끔)
+		size_t mLowWater  = 0;  // 적체가 이 값 이하로 내려가면 재개 (mHighWater 미만이어야 함)
+	};
+
+	RecvFlowControl() = default;
+	~RecvFlowControl();
+
+	RecvFlowControl(const RecvFlowControl &) = delete;
+	RecvFlowControl &operator=(const RecvFlowControl &) = delete;
+
+	/** 파티션 수와 수위 설정. 하류 큐 Initialize에서 워커 수로 1회 호출. 잘못된 수위면 false */
+	bool Initialize(size_t partitionCount, const Options &options);
+
+	/** 멈춘 세션을 모두 재개하고 적체를 0으로 (하류 큐 Shutdown 후 호출) */
+	void Shutdown();
+
+	bool Enabled() const { return mOptions.mHighWater > 0 && !mPartitions.empty(); }
+
+	/** 작업 1건 수락 — sessionId가 partition에 작업을 넣었다. 크레딧이 바닥이면 세션 recv 중지 */
+	void OnEnqueue(size_t partition, Utils::ConnectionId sessionId);
+
+	/** 작업 count건 완료(또는 폐기) — 적체가 하한 이하면 이 파티션이 멈춘 세션 재개 */
+	void OnComplete(size_t partition, size_t count = 1);
+
+	// 모니터링
+	size_t GetDepth(size_t partition) const;
+	bool   IsThrottled(size_t partition) const;
+	size_t GetPauseCount() const { return mPauses.Value(); }    // 누적 recv 중지 횟수
+	size_t GetResumeCount() const { return mResumes.Value(); }  // 누적 recv 재개 횟수
+
+  private:
+	struct Partition
+	{
+		std::atomic<size_t> mDepth{0};              // 수락 후 미완료 작업 수
+		std::atomic<bool>   mThrottled{false};      // 상한 도달 후 아직 하한에 닿지 않음
+		std::mutex          mMutex;                 // mPaused / mThrottled 전이 보호
+		std::unordered_set<Utils::ConnectionId> mPaused;  // 이 파티션 때문에 멈춘 세션 (mMutex 보호)
+	};
+
+	/** 파티션이 멈춘 세션을 모두 재개 (락 밖에서 세션 조회) */
+	void ResumeAll(Partition &partition);
+
+	Options mOptions;
+	std::vector<std::unique_ptr<Partition>> mPartitions;  // Initialize에서 1회 생성, 이후 불변
+
+	Utils::MetricCounter mPauses;   // 누적 recv 중지
+	Utils::MetricCounter mResumes;  // 누적 recv 재개
+};
+
+} // namespace Network::Core
@@ -5,6 +5,7 @@
 #if defined(IS_WINDOWS)
 
 #include "SendBufferPool.h"
+#include "Utils/LockProfiling.h"
 #include <cassert>
 #include <stdexcept>
 
@@ -19,7 +20,7 @@ SendBufferPool &SendBufferPool::Instance()
 
 bool SendBufferPool::Initialize(size_t poolSize, size_t slotSize)
 {
-    std::lock_guard<std::mutex> lock(mMutex);
+    NET_LOCK_GUARD(mMutex);
 
     if (poolSize == 0 || slotSize == 0)
         return false;
@@ -45,7 +46,7 @@ bool SendBufferPool::Initialize(size_t poolSize, size_t slotSize)
 
 void SendBufferPool::Shutdown()
 {
-    std::lock_guard<std::mutex> lock(mMutex);
+    NET_LOCK_GUARD(mMutex);
     if (mStorage)
     {
         _aligned_free(mStorage);
@@ -58,7 +59,7 @@ void SendBufferPool::Shutdown()
 
 ::Network::Core::Memory::BufferSlot SendBufferPool::Acquire()
 {
-    std::lock_guard<std::mutex> lock(mMutex);
+    NET_LOCK_GUARD(mMutex);
 
     if (mFreeSlots.empty() || !mStorage)
         return {};
@@ -85,7 +86,7 @@ void SendBufferPool::Release(size_t slotIdx)
         return;
     }
 
-    std::lock_guard<std::mutex> lock(mMutex);
+    NET_LOCK_GUARD(mMutex);
     // English: Guard against Shutdown() racing between the bounds check and here.
     //          If mStorage is null, the pool was destroyed — skip the push_back.
     // 한글: bounds check 이후 Shutdown()이 끼어드는 레이스 방어.
@@ -101,7 +102,7 @@ size_t SendBufferPool::PoolSize() const { return mPoolSize.load(std::memory_orde
 
 size_t SendBufferPool::FreeCount() const
 {
-    std::lock_guard<std::mutex> lock(mMutex);
+    NET_LOCK_GUARD(mMutex);
     return mFreeSlots.size();
 }
 
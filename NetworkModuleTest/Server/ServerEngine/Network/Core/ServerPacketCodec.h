@@ -0,0 +1,203 @@
+#pragma once
+
+// 서버 간 가변 길이 DB 쿼리 프레임 인코더/디코더
+//
+// DBQueryFrameBuilder: 엔트리를 누적하다가 Finish()에서 1개면 단일 패킷(PKT_DBQueryReq/Res),
+//   2개 이상이면 배치 패킷(PKT_DBQueryBatchReq/Res)으로 프레임을 완성한다.
+//   내부 버퍼는 재사용되므로 워커별로 하나씩 두고 Reset()으로 비운다.
+// ForEachDBQueryEntry: 단일/배치 프레임을 모두 받아 엔트리마다 콜백을 호출한다.
+//   네트워크 입력이므로 프레임 전체의 길이 필드를 먼저 검증하고, 어긋나면 콜백 없이 거부한다.
+//   pack(1) 구조체는 정렬되지 않은 주소에 있을 수 있으므로 memcpy로 꺼낸다.
+
+#include "ServerPacketDefine.h"
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace Network::Core
+{
+    // =============================================================================
+    // DBQueryFrameBuilder
+    // =============================================================================
+
+    template <typename Entry, typename SinglePacket, typename BatchPacket>
+    class DBQueryFrameBuilder
+    {
+    public:
+        // 배치 프레임 고정부 (header + count) — 엔트리는 이 오프셋부터 기록
+        static constexpr size_t kBatchHeadSize   = sizeof(BatchPacket);
+        // 단일 패킷은 엔트리 바로 앞에 헤더만 두므로 버퍼 앞 (count 크기)만큼 건너뛴다
+        static constexpr size_t kSingleOffset    = kBatchHeadSize - sizeof(ServerPacketHeader);
+        static constexpr size_t kMaxEntryPayload = MAX_SERVER_PACKET_SIZE - kBatchHeadSize - sizeof(Entry);
+
+        DBQueryFrameBuilder()
+        {
+            mBuffer.reserve(MAX_SERVER_PACKET_SIZE);
+            Reset();
+        }
+
+        void Reset()
+        {
+            mBuffer.resize(kBatchHeadSize);
+            mCount = 0;
+        }
+
+        bool   Empty() const { return mCount == 0; }
+        size_t Count() const { return mCount; }
+
+        // 엔트리 1개 추가. 프레임 상한(MAX_SERVER_PACKET_SIZE)을 넘으면 false —
+        // 호출자는 Finish()로 현재 프레임을 보낸 뒤 Reset() 후 다시 시도한다.
+        bool Append(Entry entry, const char* payload, size_t payloadLength)
+        {
+            if (payloadLength > kMaxEntryPayload)
+            {
+                return false;
+            }
+            const size_t needed = sizeof(Entry) + payloadLength;
+            if (mBuffer.size() + needed > MAX_SERVER_PACKET_SIZE)
+            {
+                return false;
+            }
+
+            entry.SetPayloadLength(static_cast<uint16_t>(payloadLength));
+            const size_t offset = mBuffer.size();
+            mBuffer.resize(offset + needed);
+            std::memcpy(mBuffer.data() + offset, &entry, sizeof(Entry));
+            if (payloadLength > 0)
+            {
+                std::memcpy(mBuffer.data() + offset + sizeof(Entry), payload, payloadLength);
+            }
+            ++mCount;
+            return true;
+        }
+
+        // 프레임 완성 — 엔트리 1개면 단일 패킷, 2개 이상이면 배치 패킷.
+        // 반환 포인터는 다음 Append/Reset 전까지 유효하다.
+        const char* Finish(uint32_t& outSize)
+        {
+            ServerPacketHeader header;
+            if (mCount == 1)
+            {
+                header.id   = static_cast<uint16_t>(SinglePacket::PacketId);
+                header.size = static_cast<uint16_t>(mBuffer.size() - kSingleOffset);
+                std::memcpy(mBuffer.data() + kSingleOffset, &header, sizeof(header));
+                outSize = header.size;
+                return mBuffer.data() + kSingleOffset;
+            }
+
+            header.id   = static_cast<uint16_t>(BatchPacket::PacketId);
+            header.size = static_cast<uint16_t>(mBuffer.size());
+            std::memcpy(mBuffer.data(), &header, sizeof(header));
+            std::memcpy(mBuffer.data() + sizeof(header), &mCount, sizeof(mCount));
+            outSize = header.size;
+            return mBuffer.data();
+        }
+
+    private:
+        std::vector<char> mBuffer;  // [batch head][entry|payload]... — 재사용 버퍼
+        uint16_t          mCount = 0;  // 누적 엔트리 수
+    };
+
+    using DBQueryReqBuilder = DBQueryFrameBuilder<DBQueryReqEntry, PKT_DBQueryReq, PKT_DBQueryBatchReq>;
+    using DBQueryResBuilder = DBQueryFrameBuilder<DBQueryResEntry, PKT_DBQueryRes, PKT_DBQueryBatchRes>;
+
+    // =============================================================================
+    // ForEachDBQueryEntry — 단일/배치 프레임 디코드
+    //   fn(const Entry&, const char* payload, uint16_t payloadLength)
+    //   헤더가 잘렸거나, 엔트리 수가 0이거나, 엔트리 길이가 프레임 끝을 넘거나,
+    //   마지막 엔트리 뒤에 바이트가 남으면 false — 이때 fn은 한 번도 호출되지 않는다.
+    // =============================================================================
+
+    template <typename Entry, typename SinglePacket, typename BatchPacket, typename Fn>
+    bool ForEachDBQueryEntry(const char* frame, uint32_t size, Fn&& fn)
+    {
+        if (!frame || size < sizeof(ServerPacketHeader))
+        {
+            return false;
+        }
+
+        ServerPacketHeader header;
+        std::memcpy(&header, frame, sizeof(header));
+        if (header.size > size || header.size < sizeof(ServerPacketHeader))
+        {
+            return false;
+        }
+
+        const char* cursor = nullptr;
+        const char* end    = frame + header.size;
+        uint16_t    count  = 0;
+
+        if (header.id == static_cast<uint16_t>(SinglePacket::PacketId))
+        {
+            cursor = frame + sizeof(ServerPacketHeader);
+            count  = 1;
+        }
+        else if (header.id == static_cast<uint16_t>(BatchPacket::PacketId))
+        {
+            if (header.size < sizeof(BatchPacket))
+            {
+                return false;
+            }
+            std::memcpy(&count, frame + sizeof(ServerPacketHeader), sizeof(count));
+            cursor = frame + sizeof(BatchPacket);
+        }
+        else
+        {
+            return false;
+        }
+
+        // 1차: 길이 필드만 따라가며 엔트리 경계가 정확히 프레임 끝에서 닫히는지 확인
+        if (count == 0)
+        {
+            return false;
+        }
+        const char* scan = cursor;
+        for (uint16_t i = 0; i < count; ++i)
+        {
+            if (static_cast<size_t>(end - scan) < sizeof(Entry))
+            {
+                return false;
+            }
+            Entry entry;
+            std::memcpy(&entry, scan, sizeof(Entry));
+            scan += sizeof(Entry);
+            if (static_cast<size_t>(end - scan) < entry.PayloadLength())
+            {
+                return false;
+            }
+            scan += entry.PayloadLength();
+        }
+        if (scan != end)
+        {
+            return false;
+        }
+
+        // 2차: 검증된 프레임의 엔트리마다 콜백
+        for (uint16_t i = 0; i < count; ++i)
+        {
+            Entry entry;
+            std::memcpy(&entry, cursor, sizeof(Entry));
+            cursor += sizeof(Entry);
+
+            const uint16_t payloadLength = entry.PayloadLength();
+            fn(entry, cursor, payloadLength);
+            cursor += payloadLength;
+        }
+        return true;
+    }
+
+    template <typename Fn>
+    bool ForEachDBQueryReq(const char* frame, uint32_t size, Fn&& fn)
+    {
+        return ForEachDBQueryEntry<DBQueryReqEntry, PKT_DBQueryReq, PKT_DBQueryBatchReq>(
+            frame, size, std::forward<Fn>(fn));
+    }
+
+    template <typename Fn>
+    bool ForEachDBQueryRes(const char* frame, uint32_t size, Fn&& fn)
+    {
+        return ForEachDBQueryEntry<DBQueryResEntry, PKT_DBQueryRes, PKT_DBQueryBatchRes>(
+            frame, size, std::forward<Fn>(fn));
+    }
+
+} // namespace Network::Core
@@ -32,10 +32,16 @@ namespace Network::Core
         DBSavePingTimeRes = 2001,
         DBQueryReq        = 2002,
         DBQueryRes        = 2003,
+        DBQueryBatchReq   = 2004,   // DBQueryReqEntry N개를 한 프레임에 묶은 배치
+        DBQueryBatchRes   = 2005,   // DBQueryResEntry N개를 한 프레임에 묶은 배치
 
         Max  // 범위 검사용 상한 (이 값 이상은 유효하지 않은 패킷)
     };
 
+    // 서버 패킷 1개의 최대 와이어 크기 (헤더 포함).
+    // 엔진 수신 경로(Session::ProcessRawRecv)의 MAX_PACKET_SIZE와 같아야 한다.
+    constexpr uint16_t MAX_SERVER_PACKET_SIZE = 4096;
+
     // =============================================================================
     // 서버 패킷 헤더
     // =============================================================================
@@ -131,25 +137,49 @@ namespace Network::Core
     };
 
     // =============================================================================
-    // 범용 DB 쿼리 패킷
+    // 범용 DB 쿼리 패킷 — 가변 길이
+    //
+    // 와이어 레이아웃:
+    //   PKT_DBQueryReq      = ServerPacketHeader | DBQueryReqEntry | data[dataLength]
+    //   PKT_DBQueryRes      = ServerPacketHeader | DBQueryResEntry | detail[detailLength]
+    //   PKT_DBQueryBatchReq = ServerPacketHeader | uint16 count | (DBQueryReqEntry | data)×count
+    //   PKT_DBQueryBatchRes = ServerPacketHeader | uint16 count | (DBQueryResEntry | detail)×count
+    //
+    // 페이로드는 null 종료하지 않으며 길이 필드만큼만 유효하다.
+    // header.size는 실제 전송 바이트 수 — sizeof(PKT_*)는 고정부 크기(최소 길이)다.
+    // 인코딩/디코딩은 ServerPacketCodec.h의 DBQueryFrameBuilder / ForEachDBQueryEntry 사용.
     // =============================================================================
 
+    struct DBQueryReqEntry
+    {
+        uint64_t queryId;     // 요청 ID (KeyGenerator::KeyId: tag|slot|seq48 구조)
+        uint8_t  taskType;    // DBServerTaskType (uint8_t로 캐스팅)
+        uint16_t dataLength;  // 뒤따르는 JSON 페이로드 바이트 수
+
+        uint16_t PayloadLength() const { return dataLength; }
+        void SetPayloadLength(uint16_t length) { dataLength = length; }
+    };
+
+    struct DBQueryResEntry
+    {
+        uint64_t queryId;      // 요청 ID 에코 (요청-응답 매칭용)
+        int32_t  result;       // Network::ResultCode (int32_t 캐스팅)
+        uint16_t detailLength; // 뒤따르는 상세 메시지 바이트 수
+
+        uint16_t PayloadLength() const { return detailLength; }
+        void SetPayloadLength(uint16_t length) { detailLength = length; }
+    };
+
     struct PKT_DBQueryReq
     {
         static constexpr ServerPacketType PacketId = ServerPacketType::DBQueryReq;
 
         ServerPacketHeader header;
-        uint64_t queryId;     // 요청 ID (KeyGenerator::KeyId: tag|slot|seq48 구조)
-        uint8_t  taskType;    // DBServerTaskType (uint8_t로 캐스팅)
-        uint16_t dataLength;  // data[] 유효 바이트 수 (null 종료 문자 미포함)
-        char     data[512];   // JSON 페이로드 (null 종료, dataLength 바이트 유효)
-                              // 512 = 범용 쿼리 파라미터 최대 크기; 초과하면 DBQueryRes.result에 에러 반환)
+        DBQueryReqEntry    entry;  // 뒤에 entry.dataLength 바이트의 data가 이어진다
 
-        PKT_DBQueryReq() : queryId(0), taskType(0), dataLength(0)
-        {
-            header.InitPacket<PKT_DBQueryReq>();
-            data[0] = '\0';
-        }
+        // 단일 요청 프레임에 담을 수 있는 최대 페이로드
+        static constexpr uint32_t kMaxPayload =
+            MAX_SERVER_PACKET_SIZE - sizeof(ServerPacketHeader) - sizeof(DBQueryReqEntry);
     };
 
     struct PKT_DBQueryRes
@@ -157,16 +187,26 @@ namespace Network::Core
         static constexpr ServerPacketType PacketId = ServerPacketType::DBQueryRes;
 
         ServerPacketHeader header;
-        uint64_t queryId;      // 요청 ID 에코 (요청-응답 매칭용)
-        int32_t  result;       // Network::ResultCode (int32_t 캐스팅)
-        uint16_t detailLength; // detail[] 유효 바이트 수
-        char     detail[256];  // 상세 메시지 (null 종료, 최대 255자)
+        DBQueryResEntry    entry;  // 뒤에 entry.detailLength 바이트의 detail이 이어진다
 
-        PKT_DBQueryRes() : queryId(0), result(0), detailLength(0)
-        {
-            header.InitPacket<PKT_DBQueryRes>();
-            detail[0] = '\0';
-        }
+        static constexpr uint32_t kMaxPayload =
+            MAX_SERVER_PACKET_SIZE - sizeof(ServerPacketHeader) - sizeof(DBQueryResEntry);
+    };
+
+    struct PKT_DBQueryBatchReq
+    {
+        static constexpr ServerPacketType PacketId = ServerPacketType::DBQueryBatchReq;
+
+        ServerPacketHeader header;
+        uint16_t           count;  // 뒤따르는 (DBQueryReqEntry | data) 레코드 수
+    };
+
+    struct PKT_DBQueryBatchRes
+    {
+        static constexpr ServerPacketType PacketId = ServerPacketType::DBQueryBatchRes;
+
+        ServerPacketHeader header;
+        uint16_t           count;  // 뒤따르는 (DBQueryResEntry | detail) 레코드 수
     };
 
 } // namespace Network::Core
@@ -2,8 +2,11 @@
 // 한글: Session 클래스 구현
 
 #include "Session.h"
+#include "BaseNetworkEngine.h"
 #include "SendBufferPool.h"
 #include "SessionPool.h"
+#include "../../Utils/AllocationTag.h"
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <sstream>
@@ -16,6 +19,8 @@
 namespace Network::Core
 {
 
+thread_local Session::SendCoalesceScope *Session::sCoalesceScope = nullptr;
+
 Session::Session()
     : mId(0), mSocket(
 #if defined(IS_WINDOWS)
@@ -68,9 +73,11 @@ void Session::Initialize(Utils::ConnectionId id, SocketHandle socket)
     mPingSequence.store(0, std::memory_order_relaxed);
     mIsSending = false;
     mSendQueueSize.store(0, std::memory_order_relaxed);
+    mInFlightTrace = PacketTraceStamp{};
     // mAsyncProvider is set separately via SetAsyncProvider()
 #if defined(IS_WINDOWS)
     mCurrentSendSlotIdx = ~size_t(0);
+    mInFlightShared = SharedSendBuffer();
 #endif
     mRecvAccumBuffer.clear();
     mRecvAccumOffset = 0;
@@ -81,8 +88,12 @@ void Session::Initialize(Utils::ConnectionId id, SocketHandle socket)
     {
         mRecvBatchBuf.reserve(MAX_PACKET_SIZE * 4);
     }
+    if (mRecvPackets.capacity() == 0)
+    {
+        mRecvPackets.reserve(64);
+    }
 
-    Utils::Logger::Info("Session initialized - ID: " + std::to_string(mId));
+    Utils::Logger::Info("Session initialized - ID: {}", mId);
 }
 
 void Session::Reset()
@@ -97,6 +108,25 @@ void Session::Reset()
     mIsSending.store(false, std::memory_order_relaxed);
     mSendQueueSize.store(0, std::memory_order_relaxed);
     mOnRecvCb = nullptr;
+    mOnRecvBatchCb = nullptr;
+    mOnStreamRecvCb = nullptr;
+    mOnSendDrainedCb = nullptr;
+    mBlockingHandler = false;
+    mLogicDispatcher = nullptr;
+    mPacketPriorityFn = nullptr;
+    mIoFrameRemaining = 0;
+    mIoHeaderStashSize = 0;
+    mIoFrameLost = false;
+    mRecvEngine = nullptr;
+    mRecvPauseHolds.store(0, std::memory_order_relaxed);
+    mRecvParked.store(false, std::memory_order_relaxed);
+    mRecvBacklog.store(0, std::memory_order_relaxed);
+#if NETWORK_ENABLE_COROUTINES
+    mRecvAsync = false;
+    mRecvPending.clear();
+    mRecvCurrent.clear();
+    mRecvPendingPaused = false;
+#endif
     // English: Reset AsyncScope so reused pool slots accept new tasks.
     //          Safe here: all in-flight lambdas held sessionCopy refs and have
     //          already completed before ReleaseInternal drops the last ref.
@@ -106,12 +136,30 @@ void Session::Reset()
     mAsyncScope.Reset();
 #if defined(IS_WINDOWS)
     mCurrentSendSlotIdx = ~size_t(0);
+    mInFlightShared = SharedSendBuffer();
 #endif
 }
 
 void Session::SetOnRecv(OnRecvCallback cb)
 {
     mOnRecvCb = std::move(cb);
+    mOnRecvBatchCb = nullptr;
+}
+
+void Session::SetOnRecvBatch(OnRecvBatchCallback cb)
+{
+    mOnRecvBatchCb = std::move(cb);
+    mOnRecvCb = nullptr;
+}
+
+void Session::SetOnStreamRecv(OnRecvCallback cb)
+{
+    mOnStreamRecvCb = std::move(cb);
+}
+
+void Session::SetOnSendDrained(OnSendDrainedCallback cb)
+{
+    mOnSendDrainedCb = std::move(cb);
 }
 
 void Session::Close()
@@ -149,11 +197,7 @@ void Session::Close()
     //       closesocket()이 대기 중인 WSASend를 중단시켜 커널이 버퍼를
     //       더 이상 참조하지 않으므로 여기서 슬롯을 안전하게 반납 가능.
 #if defined(IS_WINDOWS)
-    if (mCurrentSendSlotIdx != ~size_t(0))
-    {
-        SendBufferPool::Instance().Release(mCurrentSendSlotIdx);
-        mCurrentSendSlotIdx = ~size_t(0);
-    }
+    ReleaseInFlightSend();
 #endif
 
     // English: Reset async provider and drain send queue under a single lock.
@@ -163,10 +207,15 @@ void Session::Close()
         mAsyncProvider.reset();
 #if defined(IS_WINDOWS)
         // English: Return all queued (unsent) pool slots before draining the queue.
+        //          Shared-buffer entries (slotIdx == ~0) just drop their reference.
         // 한글: 큐 비우기 전 미전송 풀 슬롯 전체 반납.
+        //       공유 버퍼 항목(slotIdx == ~0)은 참조만 해제.
         while (!mSendQueue.empty())
         {
-            SendBufferPool::Instance().Release(mSendQueue.front().slotIdx);
+            if (mSendQueue.front().slotIdx != ~size_t(0))
+            {
+                SendBufferPool::Instance().Release(mSendQueue.front().slotIdx);
+            }
             mSendQueue.pop();
         }
 #else
@@ -193,23 +242,77 @@ void Session::Close()
     //       WaitForDrain()은 AsyncScope RAII 소멸자(Session 소멸 시)로 미룸.
     mAsyncScope.Cancel();
 
-    Utils::Logger::Info("Session closed - ID: " + std::to_string(mId));
+#if NETWORK_ENABLE_COROUTINES
+    // English: Coroutines parked on RecvAsync/SendAsync resume through their executor, which
+    //          sees the cancelled scope and destroys the frame instead.
+    // 한글: RecvAsync/SendAsync에 대기 중인 코루틴은 실행 문맥으로 재개되고, 취소된 스코프를
+    //       확인해 재개 대신 프레임을 파괴한다.
+    WakeAsyncWaiters();
+#endif
+
+    Utils::Logger::Info("Session closed - ID: {}", mId);
 }
 
-Session::SendResult Session::Send(const void *data, uint32_t size)
+Session::SendResult Session::AdmitSend(uint32_t size) const
 {
-    if (!IsConnected() || data == nullptr || size == 0)
+    if (!IsConnected())
     {
         return SendResult::NotConnected;
     }
 
     if (size > MAX_PACKET_TOTAL_SIZE)
     {
-        Utils::Logger::Warn("Send size exceeds MAX_PACKET_TOTAL_SIZE - packet dropped (Session: " +
-                            std::to_string(mId) + ", Size: " + std::to_string(size) + ")");
+        static Utils::LogRateLimiter sOversizeLog(1000);
+        Utils::Logger::Warn(sOversizeLog,
+                            "Send size exceeds MAX_PACKET_TOTAL_SIZE - packet dropped (Session: {}, Size: {})",
+                            mId, size);
+        return SendResult::InvalidArgument;
+    }
+
+    // English: Back-pressure: return QueueFull if send queue exceeds threshold.
+    //          Caller receives explicit feedback instead of a silent drop.
+    //          (The RIO path never queues, so this never fires there.)
+    // 한글: 백프레셔: 송신 큐가 임계값을 초과하면 QueueFull 반환.
+    //       호출자에게 묵시적 드롭 대신 명시적 피드백 제공.
+    //       (RIO 경로는 큐를 쓰지 않으므로 여기서 걸리지 않는다.)
+    if (mSendQueueSize.load(std::memory_order_relaxed) >=
+        Utils::SEND_QUEUE_BACKPRESSURE_THRESHOLD)
+    {
+        static Utils::LogRateLimiter sBackpressureLog(1000);
+        Utils::Logger::Warn(sBackpressureLog, "Send backpressure triggered - Session: {}", mId);
         return SendResult::QueueFull;
     }
 
+    return SendResult::Ok;
+}
+
+Session::SendResult Session::Send(const void *data, uint32_t size)
+{
+    Utils::AllocTagScope allocTag(Utils::AllocTag::Send);
+
+    if (data == nullptr || size == 0)
+    {
+        return SendResult::InvalidArgument;
+    }
+
+    // English: Inside a recv batch of this session — append to the batch's send buffer.
+    // 한글: 이 세션의 recv 배치 안 — 배치 송신 버퍼에 이어 붙인다.
+    if (SendCoalesceScope *scope = ActiveCoalesceScope())
+    {
+        return scope->Append(data, size);
+    }
+
+    return SendCopy(data, size);
+}
+
+Session::SendResult Session::SendCopy(const void *data, uint32_t size)
+{
+    const SendResult admitted = AdmitSend(size);
+    if (admitted != SendResult::Ok)
+    {
+        return admitted;
+    }
+
 #if defined(IS_WINDOWS)
     {
         const SocketHandle socket = mSocket.load(std::memory_order_acquire);
@@ -236,9 +339,8 @@ Session::SendResult Session::Send(const void *data, uint32_t size)
                 socket, data, size, static_cast<AsyncIO::RequestContext>(mId));
             if (error != AsyncIO::AsyncIOError::Success)
             {
-                Utils::Logger::Error(
-                    "RIO send failed - Session: " + std::to_string(mId) +
-                    ", Error: " + std::string(providerSnapshot->GetLastError()));
+                Utils::Logger::Error("RIO send failed - Session: {}, Error: {}",
+                                     mId, providerSnapshot->GetLastError());
                 return SendResult::QueueFull;
             }
             else
@@ -250,18 +352,6 @@ Session::SendResult Session::Send(const void *data, uint32_t size)
     }
 #endif
 
-    // English: Back-pressure: return QueueFull if send queue exceeds threshold.
-    //          Caller receives explicit feedback instead of a silent drop.
-    // 한글: 백프레셔: 송신 큐가 임계값을 초과하면 QueueFull 반환.
-    //       호출자에게 묵시적 드롭 대신 명시적 피드백 제공.
-    if (mSendQueueSize.load(std::memory_order_relaxed) >=
-        Utils::SEND_QUEUE_BACKPRESSURE_THRESHOLD)
-    {
-        Utils::Logger::Warn("Send backpressure triggered - Session: " +
-                            std::to_string(mId));
-        return SendResult::QueueFull;
-    }
-
     // English: Lock contention optimization using atomic queue size counter
     // 한글: Atomic 큐 크기 카운터를 사용한 Lock 경합 최적화
 
@@ -271,26 +361,25 @@ Session::SendResult Session::Send(const void *data, uint32_t size)
     auto slot = SendBufferPool::Instance().Acquire();
     if (!slot.ptr)
     {
-        Utils::Logger::Warn("SendBufferPool exhausted - packet dropped (Session: " +
-                            std::to_string(mId) + ")");
+        static Utils::LogRateLimiter sPoolExhaustedLog(1000);
+        Utils::Logger::Warn(sPoolExhaustedLog, "SendBufferPool exhausted - packet dropped (Session: {})", mId);
         return SendResult::QueueFull;
     }
     std::memcpy(slot.ptr, data, size);
 
     {
         std::lock_guard<std::mutex> lock(mSendMutex);
-        mSendQueue.push({slot.index, size});
+        mSendQueue.push({slot.index, size, PacketTrace::CaptureSend(), SharedSendBuffer()});
         mSendQueueSize.fetch_add(1, std::memory_order_release);
     }
 #else
-    // English: Non-IOCP path — copy into a heap buffer (existing behaviour).
-    // 한글: 비 IOCP 경로 — 힙 버퍼로 복사 (기존 동작).
-    std::vector<char> buffer(size);
-    std::memcpy(buffer.data(), data, size);
+    // English: Non-IOCP path — copy once into a single-owner shared buffer (one allocation).
+    // 한글: 비 IOCP 경로 — 단독 소유 공유 버퍼로 1회 복사 (할당 1회).
+    SendRequest request{SharedSendBuffer::Create(data, size), PacketTrace::CaptureSend()};
 
     {
         std::lock_guard<std::mutex> lock(mSendMutex);
-        mSendQueue.push(std::move(buffer));
+        mSendQueue.push(std::move(request));
         mSendQueueSize.fetch_add(1, std::memory_order_release);
     }
 #endif
@@ -301,6 +390,350 @@ Session::SendResult Session::Send(const void *data, uint32_t size)
     return SendResult::Ok;
 }
 
+Session::SendResult Session::Send(const SharedSendBuffer &packet)
+{
+    Utils::AllocTagScope allocTag(Utils::AllocTag::Send);
+
+    if (packet.Empty())
+    {
+        return SendResult::InvalidArgument;
+    }
+
+    // English: Keep stream order — responses coalesced so far in this batch go first.
+    // 한글: 스트림 순서 유지 — 이 배치에서 지금까지 모은 응답을 먼저 큐잉.
+    if (SendCoalesceScope *scope = ActiveCoalesceScope())
+    {
+        scope->Flush();
+    }
+
+    const SendResult admitted = AdmitSend(packet.Size());
+    if (admitted != SendResult::Ok)
+    {
+        return admitted;
+    }
+
+    return EnqueueShared(packet, PacketTrace::CaptureSend());
+}
+
+Session::SendResult Session::EnqueueShared(const SharedSendBuffer &packet, const PacketTraceStamp &trace)
+{
+#if defined(IS_WINDOWS)
+    // English: RIO copies into its registered buffers anyway — reuse the raw path.
+    // 한글: RIO는 어차피 등록 버퍼로 복사하므로 기존 경로를 그대로 사용.
+    bool hasProvider = false;
+    {
+        std::lock_guard<std::mutex> lock(mSendMutex);
+        hasProvider = (mAsyncProvider != nullptr);
+    }
+    if (hasProvider)
+    {
+        return SendCopy(packet.Data(), packet.Size());
+    }
+#endif
+
+    // English: Enqueue a reference only — no payload copy, no pool slot.
+    // 한글: 참조만 큐잉 — 페이로드 복사·풀 슬롯 없음.
+    {
+        std::lock_guard<std::mutex> lock(mSendMutex);
+#if defined(IS_WINDOWS)
+        mSendQueue.push({~size_t(0), packet.Size(), trace, packet});
+#else
+        mSendQueue.push({packet, trace});
+#endif
+        mSendQueueSize.fetch_add(1, std::memory_order_release);
+    }
+
+    FlushSendQueue();
+    return SendResult::Ok;
+}
+
+// =============================================================================
+// English: SendSpan
+// 한글: SendSpan
+// =============================================================================
+
+Session::SendSpan::~SendSpan()
+{
+    // English: Uncommitted in-place reservation — give the batch its tail back.
+    // 한글: 커밋되지 않은 제자리 예약 — 배치 버퍼 끝을 되돌려 준다.
+    if (mScope != nullptr)
+    {
+        mScope->ReleaseReserved(*this);
+    }
+}
+
+Session::SendSpan::SendSpan(SendSpan &&other) noexcept
+    : mBuffer(std::move(other.mBuffer)), mData(other.mData), mSize(other.mSize),
+      mResult(other.mResult), mScope(other.mScope)
+{
+    if (mScope != nullptr)
+    {
+        mScope->MoveReserved(other, *this);
+    }
+    other.mData  = nullptr;
+    other.mSize  = 0;
+    other.mScope = nullptr;
+}
+
+Session::SendSpan &Session::SendSpan::operator=(SendSpan &&other) noexcept
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+
+    if (mScope != nullptr)
+    {
+        mScope->ReleaseReserved(*this);
+    }
+
+    mBuffer = std::move(other.mBuffer);
+    mData   = other.mData;
+    mSize   = other.mSize;
+    mResult = other.mResult;
+    mScope  = other.mScope;
+    if (mScope != nullptr)
+    {
+        mScope->MoveReserved(other, *this);
+    }
+    other.mData  = nullptr;
+    other.mSize  = 0;
+    other.mScope = nullptr;
+    return *this;
+}
+
+Session::SendSpan Session::ReserveSend(uint32_t size)
+{
+    Utils::AllocTagScope allocTag(Utils::AllocTag::Send);
+
+    SendSpan span;
+    if (size == 0)
+    {
+        span.mResult = SendResult::InvalidArgument;
+        return span;
+    }
+
+    // English: Fail early with the same checks Send() applies, so the caller does not
+    //          build a packet that will be dropped anyway.
+    // 한글: Send()와 같은 검사로 먼저 거른다 — 어차피 버려질 패킷을 만들지 않도록.
+    span.mResult = AdmitSend(size);
+    if (span.mResult != SendResult::Ok)
+    {
+        return span;
+    }
+
+    // English: Inside a recv batch — write straight into the batch buffer's tail.
+    // 한글: recv 배치 안 — 배치 버퍼 끝에 바로 쓴다.
+    if (SendCoalesceScope *scope = ActiveCoalesceScope())
+    {
+        if (scope->Reserve(span, size))
+        {
+            return span;
+        }
+    }
+
+    span.mBuffer = SharedSendBuffer::Allocate(size);
+    span.mData   = span.mBuffer.MutableData();
+    span.mSize   = size;
+    return span;
+}
+
+Session::SendResult Session::CommitSend(SendSpan &span, uint32_t actualSize)
+{
+    if (span.mScope != nullptr)
+    {
+        return span.mScope->CommitReserved(span, actualSize);
+    }
+
+    // English: Reserved in a batch buffer that was flushed before commit — the bytes sit
+    //          at an offset inside that block, so publish them by copy.
+    // 한글: 커밋 전에 플러시된 배치 버퍼에 예약된 경우 — 블록 중간에 있으므로 복사로 게시.
+    if (span.mData != nullptr && span.mData != span.mBuffer.MutableData())
+    {
+        SharedSendBuffer block = std::move(span.mBuffer);
+        const char *data = span.mData;
+        const uint32_t size = span.mSize;
+        span.mData = nullptr;
+        span.mSize = 0;
+        if (actualSize == 0 || actualSize > size)
+        {
+            return SendResult::InvalidArgument;
+        }
+        return Send(data, actualSize);
+    }
+
+    // English: The span is consumed either way — a failed commit drops the buffer.
+    // 한글: 성공/실패와 무관하게 span은 소비된다 — 실패한 커밋은 버퍼를 버린다.
+    SharedSendBuffer packet = std::move(span.mBuffer);
+    span.mData = nullptr;
+    span.mSize = 0;
+
+    if (packet.Empty() || actualSize == 0 || !packet.Truncate(actualSize))
+    {
+        return SendResult::InvalidArgument;
+    }
+
+    // English: Reserved outside the batch buffer (nested reservation) — join the batch
+    //          by copy; the span block goes straight back to the pool.
+    // 한글: 배치 버퍼 밖에 예약된 경우 (중첩 예약) — 복사로 배치에 합치고
+    //       span 블록은 바로 풀로 반납.
+    if (SendCoalesceScope *scope = ActiveCoalesceScope())
+    {
+        Utils::AllocTagScope allocTag(Utils::AllocTag::Send);
+        return scope->Append(packet.Data(), packet.Size());
+    }
+    return Send(packet);
+}
+
+// =============================================================================
+// English: SendCoalesceScope
+// 한글: SendCoalesceScope
+// =============================================================================
+
+Session::SendCoalesceScope::SendCoalesceScope(Session *session)
+    : mSession(session), mPrevious(sCoalesceScope)
+{
+    sCoalesceScope = this;
+}
+
+Session::SendCoalesceScope::~SendCoalesceScope()
+{
+    // English: Deactivate first so the flush below cannot route back into this scope.
+    // 한글: 먼저 비활성화 — 아래 플러시가 이 스코프로 되돌아오지 않도록.
+    sCoalesceScope = mPrevious;
+    Flush();
+}
+
+void Session::SendCoalesceScope::EnsureCapacity(uint32_t size)
+{
+    if (mUsed + size > mBuffer.Capacity())
+    {
+        Flush();
+        mBuffer = SharedSendBuffer::Allocate(MAX_PACKET_TOTAL_SIZE);
+        mTrace  = PacketTrace::CaptureSend();
+    }
+}
+
+void Session::SendCoalesceScope::DetachReserved()
+{
+    if (mReserved == nullptr)
+    {
+        return;
+    }
+
+    // English: The span keeps the current block (its bytes sit past mUsed). Move the
+    //          committed prefix to a fresh block so the block we enqueue is never written again.
+    // 한글: span은 현재 블록을 유지 (mUsed 뒤에 기록). 큐잉할 블록에 다시 쓰지 않도록
+    //       커밋된 앞부분을 새 블록으로 옮긴다.
+    mReserved->mScope = nullptr;
+    mReserved = nullptr;
+
+    if (mUsed == 0)
+    {
+        mBuffer = SharedSendBuffer();
+        return;
+    }
+
+    SharedSendBuffer fresh = SharedSendBuffer::Allocate(MAX_PACKET_TOTAL_SIZE);
+    std::memcpy(fresh.MutableData(), mBuffer.Data(), mUsed);
+    mBuffer = std::move(fresh);
+}
+
+bool Session::SendCoalesceScope::Reserve(SendSpan &span, uint32_t size)
+{
+    // English: One in-place reservation at a time — a nested one takes its own block.
+    // 한글: 제자리 예약은 한 번에 하나 — 중첩 예약은 별도 블록을 받는다.
+    if (mReserved != nullptr)
+    {
+        return false;
+    }
+
+    EnsureCapacity(size);
+
+    span.mBuffer = mBuffer;
+    span.mData   = mBuffer.MutableData() + mUsed;
+    span.mSize   = size;
+    span.mScope  = this;
+    mReserved    = &span;
+    return true;
+}
+
+Session::SendResult Session::SendCoalesceScope::CommitReserved(SendSpan &span, uint32_t actualSize)
+{
+    // English: Admitted on Reserve — committing only extends the batch.
+    // 한글: Reserve에서 이미 수락됨 — 커밋은 배치 길이만 늘린다.
+    const bool valid = (actualSize != 0 && actualSize <= span.mSize);
+    if (valid)
+    {
+        mUsed += actualSize;
+    }
+
+    ReleaseReserved(span);
+    span.mBuffer = SharedSendBuffer();
+    span.mData = nullptr;
+    span.mSize = 0;
+    return valid ? SendResult::Ok : SendResult::InvalidArgument;
+}
+
+void Session::SendCoalesceScope::ReleaseReserved(SendSpan &span)
+{
+    if (mReserved == &span)
+    {
+        mReserved = nullptr;
+    }
+    span.mScope = nullptr;
+}
+
+void Session::SendCoalesceScope::MoveReserved(SendSpan &from, SendSpan &to)
+{
+    if (mReserved == &from)
+    {
+        mReserved = &to;
+    }
+}
+
+Session::SendResult Session::SendCoalesceScope::Append(const void *data, uint32_t size)
+{
+    // English: Same per-response checks as Send — the queue does not grow while coalescing,
+    //          so backpressure reflects what was queued before the batch.
+    // 한글: Send와 같은 응답별 검사 — 합치는 동안 큐는 늘지 않으므로 백프레셔는
+    //       배치 이전에 큐잉된 양을 반영한다.
+    const SendResult admitted = mSession->AdmitSend(size);
+    if (admitted != SendResult::Ok)
+    {
+        return admitted;
+    }
+
+    DetachReserved();
+    EnsureCapacity(size);
+
+    std::memcpy(mBuffer.MutableData() + mUsed, data, size);
+    mUsed += size;
+    return SendResult::Ok;
+}
+
+void Session::SendCoalesceScope::Flush()
+{
+    DetachReserved();
+
+    if (mUsed == 0)
+    {
+        return;
+    }
+
+    SharedSendBuffer packet = std::move(mBuffer);
+    packet.Truncate(mUsed);
+    mUsed = 0;
+
+    // English: Every response was admitted on Append — only drop if the session closed since.
+    // 한글: 응답마다 Append에서 수락됨 — 그 사이 세션이 닫혔을 때만 버린다.
+    if (mSession->IsConnected())
+    {
+        Utils::AllocTagScope allocTag(Utils::AllocTag::Send);
+        (void)mSession->EnqueueShared(packet, mTrace);
+    }
+}
+
 void Session::FlushSendQueue()
 {
     // English: CAS to prevent concurrent sends
@@ -314,8 +747,10 @@ void Session::FlushSendQueue()
     PostSend();
 }
 
-bool Session::PostSend()
+bool Session::PostSend(bool sendCompleted)
 {
+    Utils::AllocTagScope allocTag(Utils::AllocTag::Send);
+
     // English: Fast path - check queue size before acquiring lock
     // 한글: Fast path - 락 획득 전 큐 크기 확인
     if (mSendQueueSize.load(std::memory_order_acquire) == 0)
@@ -326,11 +761,7 @@ bool Session::PostSend()
 #if defined(IS_WINDOWS)
         // English: Release the previous in-flight slot (send just completed).
         // 한글: 이전 전송 중 슬롯 반납 (방금 전송 완료).
-        if (mCurrentSendSlotIdx != ~size_t(0))
-        {
-            SendBufferPool::Instance().Release(mCurrentSendSlotIdx);
-            mCurrentSendSlotIdx = ~size_t(0);
-        }
+        ReleaseInFlightSend();
 #endif
 
         mIsSending.store(false, std::memory_order_release);
@@ -341,13 +772,19 @@ bool Session::PostSend()
         {
             FlushSendQueue();
         }
+        else if (sendCompleted && mOnSendDrainedCb)
+        {
+            // English: Last send completed, nothing queued — let a stream handler queue more or close.
+            // 한글: 마지막 송신 완료, 큐 비어 있음 — 스트림 핸들러가 이어 보내거나 닫도록 알린다.
+            mOnSendDrainedCb(this);
+        }
         return true;
     }
 
 #if defined(IS_WINDOWS)
-    SendRequest req{~size_t(0), 0};
+    SendRequest req{~size_t(0), 0, PacketTraceStamp{}, SharedSendBuffer()};
 #else
-    std::vector<char> dataToSend;
+    SendRequest req;
 #endif
 
     {
@@ -358,52 +795,57 @@ bool Session::PostSend()
         if (mSendQueue.empty())
         {
 #if defined(IS_WINDOWS)
-            if (mCurrentSendSlotIdx != ~size_t(0))
-            {
-                SendBufferPool::Instance().Release(mCurrentSendSlotIdx);
-                mCurrentSendSlotIdx = ~size_t(0);
-            }
+            ReleaseInFlightSend();
 #endif
             mIsSending.store(false, std::memory_order_release);
             return true;
         }
 
-#if defined(IS_WINDOWS)
-        req = mSendQueue.front();
-        mSendQueue.pop();
-#else
-        dataToSend = std::move(mSendQueue.front());
+        req = std::move(mSendQueue.front());
         mSendQueue.pop();
-#endif
 
         // English: Decrement queue size atomically
         // 한글: Atomic으로 큐 크기 감소
         mSendQueueSize.fetch_sub(1, std::memory_order_release);
     }
 
+#if NETWORK_ENABLE_COROUTINES
+    WakeSendWaiter();
+#endif
+
 #if defined(IS_WINDOWS)
     // English: Release the previous in-flight slot before committing the next one.
     // 한글: 다음 슬롯 커밋 전에 이전 전송 중 슬롯 반납.
-    if (mCurrentSendSlotIdx != ~size_t(0))
-    {
-        SendBufferPool::Instance().Release(mCurrentSendSlotIdx);
-        mCurrentSendSlotIdx = ~size_t(0);
-    }
+    ReleaseInFlightSend();
 
     const SocketHandle socket = mSocket.load(std::memory_order_acquire);
     if (socket == GetInvalidSocket())
     {
-        SendBufferPool::Instance().Release(req.slotIdx);
+        if (req.slotIdx != ~size_t(0))
+        {
+            SendBufferPool::Instance().Release(req.slotIdx);
+        }
         mIsSending.store(false, std::memory_order_release);
         return false;
     }
 
-    // English: Zero-copy: point wsaBuf directly at the pool slot (no memcpy into mSendContext.buffer).
-    // 한글: Zero-copy: wsaBuf를 풀 슬롯에 직접 지정 (mSendContext.buffer로의 memcpy 없음).
+    // English: Zero-copy: point wsaBuf directly at the pool slot or shared buffer
+    //          (no memcpy into mSendContext.buffer).
+    // 한글: Zero-copy: wsaBuf를 풀 슬롯 또는 공유 버퍼에 직접 지정 (mSendContext.buffer로의 memcpy 없음).
     mSendContext.Reset();
-    mSendContext.wsaBuf.buf = SendBufferPool::Instance().SlotPtr(req.slotIdx);
+    if (req.slotIdx != ~size_t(0))
+    {
+        mSendContext.wsaBuf.buf = SendBufferPool::Instance().SlotPtr(req.slotIdx);
+        mCurrentSendSlotIdx = req.slotIdx;
+    }
+    else
+    {
+        mSendContext.wsaBuf.buf = const_cast<char *>(req.shared.Data());
+        mInFlightShared = std::move(req.shared);
+    }
     mSendContext.wsaBuf.len = static_cast<ULONG>(req.size);
-    mCurrentSendSlotIdx = req.slotIdx;
+    mInFlightTrace = req.trace;
+    PacketTrace::Instance().MarkSubmitted(mInFlightTrace, mId);
 
     DWORD bytesSent = 0;
     int result = WSASend(socket, &mSendContext.wsaBuf, 1, &bytesSent, 0,
@@ -414,9 +856,8 @@ bool Session::PostSend()
         int error = WSAGetLastError();
         if (error != WSA_IO_PENDING)
         {
-            Utils::Logger::Error("WSASend failed - Error: " + std::to_string(error));
-            SendBufferPool::Instance().Release(req.slotIdx);
-            mCurrentSendSlotIdx = ~size_t(0);
+            Utils::Logger::Error("WSASend failed - Error: {}", error);
+            ReleaseInFlightSend();
             mIsSending.store(false, std::memory_order_release);
             Close();
             return false;
@@ -439,15 +880,21 @@ bool Session::PostSend()
         return false;
     }
 
-    auto sendError = providerSnapshot->SendAsync(
-        mSocket.load(std::memory_order_acquire), dataToSend.data(), dataToSend.size(),
+    // English: Stamp before submitting — the completion may run on another worker first.
+    // 한글: 제출 전에 스탬프 기록 — 완료가 다른 워커에서 먼저 처리될 수 있다.
+    mInFlightTrace = req.trace;
+    PacketTrace::Instance().MarkSubmitted(mInFlightTrace, mId);
+
+    // English: The provider keeps its own reference (or copy) of req.buffer until completion.
+    // 한글: 공급자가 완료까지 req.buffer의 참조(또는 복사본)를 보관한다.
+    auto sendError = providerSnapshot->SendSharedAsync(
+        mSocket.load(std::memory_order_acquire), req.buffer,
         static_cast<AsyncIO::RequestContext>(mId));
 
     if (sendError != AsyncIO::AsyncIOError::Success)
     {
-        Utils::Logger::Error(
-            "SendAsync failed - Session: " + std::to_string(mId) +
-            ", Error: " + std::string(providerSnapshot->GetLastError()));
+        Utils::Logger::Error("SendAsync failed - Session: {}, Error: {}",
+                             mId, providerSnapshot->GetLastError());
         mIsSending.store(false, std::memory_order_release);
         Close();
         return false;
@@ -459,6 +906,18 @@ bool Session::PostSend()
 #endif
 }
 
+#if defined(IS_WINDOWS)
+void Session::ReleaseInFlightSend()
+{
+    if (mCurrentSendSlotIdx != ~size_t(0))
+    {
+        SendBufferPool::Instance().Release(mCurrentSendSlotIdx);
+        mCurrentSendSlotIdx = ~size_t(0);
+    }
+    mInFlightShared = SharedSendBuffer();
+}
+#endif
+
 bool Session::PostRecv()
 {
 #if defined(IS_WINDOWS)
@@ -488,8 +947,7 @@ bool Session::PostRecv()
         int error = WSAGetLastError();
         if (error != WSA_IO_PENDING)
         {
-            Utils::Logger::Error("WSARead failed - Error: " +
-                                 std::to_string(error));
+            Utils::Logger::Error("WSARead failed - Error: {}", error);
             return false;
         }
     }
@@ -506,6 +964,76 @@ bool Session::PostRecv()
 #endif
 }
 
+void Session::PauseRecv(RecvPauseReason reason)
+{
+    // English: Add one hold of this reason. A full 8-bit field saturates instead of carrying
+    //          into the next reason's count; the dropped hold is logged.
+    // 한글: 이 사유의 보유 1개 추가. 8비트 필드가 가득 차면 다음 사유 횟수로 넘치지 않도록
+    //       더하지 않고 버린 보유를 기록한다.
+    const uint32_t unit = PauseUnit(reason);
+    uint32_t prev = mRecvPauseHolds.load();
+    do
+    {
+        if ((prev & PauseField(reason)) == PauseField(reason))
+        {
+            static Utils::LogRateLimiter sPauseOverflowLog(1000);
+            Utils::Logger::Error(sPauseOverflowLog,
+                                 "Recv pause hold count saturated - hold dropped (Session: {}, Reason: {})",
+                                 mId, static_cast<uint32_t>(reason));
+            return;
+        }
+    } while (!mRecvPauseHolds.compare_exchange_weak(prev, prev + unit));
+}
+
+void Session::ResumeRecv(RecvPauseReason reason)
+{
+    // English: Release one hold of this reason; a resume with no hold left is ignored.
+    // 한글: 이 사유의 보유 1개 해제 — 남은 보유가 없으면 무시.
+    const uint32_t unit = PauseUnit(reason);
+    uint32_t prev = mRecvPauseHolds.load();
+    do
+    {
+        if ((prev & PauseField(reason)) == 0)
+        {
+            return;
+        }
+    } while (!mRecvPauseHolds.compare_exchange_weak(prev, prev - unit));
+
+    if (prev != unit)
+    {
+        return;
+    }
+
+    // English: Last hold released. If the I/O thread already parked the recv, re-arm it here;
+    //          otherwise its ParkRecvIfPaused sees the cleared holds and re-arms itself.
+    //          seq_cst on both sides: holds store → parked load vs parked store → holds load.
+    // 한글: 마지막 보유 해제. I/O 스레드가 이미 recv를 보관했으면 여기서 재등록하고,
+    //       아니면 I/O 스레드의 ParkRecvIfPaused가 해제된 보유를 보고 직접 재등록한다.
+    //       양쪽 모두 seq_cst: 보유 저장 → parked 읽기 / parked 저장 → 보유 읽기.
+    if (mRecvParked.exchange(false) && mRecvEngine != nullptr)
+    {
+        mRecvEngine->RearmParkedRecv(shared_from_this());
+    }
+}
+
+bool Session::ParkRecvIfPaused()
+{
+    if (mRecvPauseHolds.load() == 0)
+    {
+        return false;
+    }
+
+    mRecvParked.store(true);
+    if (mRecvPauseHolds.load() != 0)
+    {
+        return true;
+    }
+
+    // English: Resumed in between — take the re-arm back unless ResumeRecv already did it.
+    // 한글: 그 사이 재개됨 — ResumeRecv가 이미 재등록하지 않았다면 재등록을 되가져온다.
+    return !mRecvParked.exchange(false);
+}
+
 char *Session::GetRecvBuffer()
 {
 #if defined(IS_WINDOWS)
@@ -535,9 +1063,13 @@ size_t Session::GetRecvBufferSize() const
 
 void Session::ProcessRawRecv(const char *data, uint32_t size)
 {
-    // English: PacketSpan records offset+size within the flat batch buffer (no per-packet alloc).
-    // 한글: PacketSpan은 평탄 배치 버퍼 내 offset+size만 기록 (패킷별 alloc 없음).
-    struct PacketSpan { uint32_t offset; uint32_t size; };
+    // English: Stream mode — no framing; the callback owns reassembly.
+    // 한글: 스트림 모드 — 프레이밍 없음; 재조립은 콜백이 담당.
+    if (mOnStreamRecvCb)
+    {
+        mOnStreamRecvCb(this, data, size);
+        return;
+    }
 
     // English: Fast-path check — no accumulated data and exactly one complete packet.
     //          No lock needed: KeyedDispatcher guarantees this method is only called
@@ -561,37 +1093,58 @@ void Session::ProcessRawRecv(const char *data, uint32_t size)
     {
         // English: Zero-alloc fast path: deliver raw recv buffer directly.
         // 한글: 할당 없는 패스트패스: 원시 recv 버퍼를 직접 전달.
-        OnRecv(data, size);
+        const RecvPacket packet{data, size};
+        DispatchRecvBatch(&packet, 1);
         return;
     }
 
-    // English: General path — batch complete packets into mRecvBatchBuf (reused across calls),
-    //          swap with a local variable before dispatching.
+    // English: General path — frame every complete packet of this chunk into mRecvPackets
+    //          and deliver them as one batch.
     //          No lock needed: serialization is guaranteed by KeyedDispatcher affinity.
-    // 한글: 일반 경로 — 완성 패킷을 mRecvBatchBuf(호출 간 재사용)에 배치 처리하고,
-    //       디스패치 전 지역 변수와 swap.
+    // 한글: 일반 경로 — 이 청크의 완성 패킷을 모두 mRecvPackets에 프레이밍하고
+    //       배치 1회로 전달.
     //       락 불필요: KeyedDispatcher 친화도로 직렬화 보장.
-    std::vector<char>       localBatch;
-    std::vector<PacketSpan> spans;
+    mRecvPackets.clear();
     bool shouldClose = false;
 
-    {
+    // English: Defensive reset in case of internal regression — the invariant
+    //          (offset <= size) is maintained by the parsing below, but
+    //          resetting here prevents size_t underflow from causing OOB reads.
+    // 한글: 내부 회귀 대비 방어 초기화 — 아래 파싱이 불변식을 유지하지만
+    //       여기서 리셋하면 size_t underflow로 인한 OOB 읽기를 방지한다.
+    if (mRecvAccumOffset > mRecvAccumBuffer.size())
+        mRecvAccumOffset = 0;
 
+    if (mRecvAccumOffset == mRecvAccumBuffer.size())
+    {
+        // English: Nothing pending (pipelined client) — the packets are framed in place inside
+        //          the recv chunk, which outlives the dispatch. Only a trailing partial packet
+        //          is copied into the accumulation buffer.
+        // 한글: 대기 데이터 없음 (파이프라인 클라이언트) — 디스패치보다 오래 사는 recv 청크
+        //       안에서 바로 프레이밍한다. 끝의 미완성 패킷만 누적 버퍼로 복사.
+        mRecvAccumBuffer.clear();
+        mRecvAccumOffset = 0;
+
+        size_t consumed = 0;
+        if (!FrameRecvPackets(data, size, consumed))
+        {
+            shouldClose = true;
+        }
+        else if (consumed < size)
+        {
+            mRecvAccumBuffer.assign(data + consumed, data + size);
+        }
+    }
+    else
+    {
         // English: Overflow guard (slow-loris / flood defense).
         // 한글: 오버플로우 방어 (slow-loris / 플러드 방어).
         constexpr size_t kMaxAccumSize = MAX_PACKET_SIZE * 4;
-        // English: Defensive reset in case of internal regression — the invariant
-        //          (offset <= size) is maintained by the parsing loop below, but
-        //          resetting here prevents size_t underflow from causing OOB reads.
-        // 한글: 내부 회귀 대비 방어 초기화 — 아래 파싱 루프가 불변식을 유지하지만
-        //       여기서 리셋하면 size_t underflow로 인한 OOB 읽기를 방지한다.
-        if (mRecvAccumOffset > mRecvAccumBuffer.size())
-            mRecvAccumOffset = 0;
         const size_t unread = mRecvAccumBuffer.size() - mRecvAccumOffset;
         if (unread + size > kMaxAccumSize)
         {
-            Utils::Logger::Warn("Recv accumulation buffer overflow - Session: " +
-                            std::to_string(mId));
+            static Utils::LogRateLimiter sAccumOverflowLog(1000);
+            Utils::Logger::Warn(sAccumOverflowLog, "Recv accumulation buffer overflow - Session: {}", mId);
             mRecvAccumBuffer.clear();
             mRecvAccumOffset = 0;
             shouldClose = true;
@@ -600,74 +1153,354 @@ void Session::ProcessRawRecv(const char *data, uint32_t size)
         {
             mRecvAccumBuffer.insert(mRecvAccumBuffer.end(), data, data + size);
 
-            mRecvBatchBuf.clear(); // keep capacity
-
-            while (mRecvAccumBuffer.size() - mRecvAccumOffset >= sizeof(PacketHeader))
+            const char *base = mRecvAccumBuffer.data() + mRecvAccumOffset;
+            size_t consumed  = 0;
+            if (!FrameRecvPackets(base, mRecvAccumBuffer.size() - mRecvAccumOffset, consumed))
+            {
+                mRecvAccumBuffer.clear();
+                mRecvAccumOffset = 0;
+                shouldClose = true;
+            }
+            else
             {
-                const auto *hdr = reinterpret_cast<const PacketHeader *>(
-                    mRecvAccumBuffer.data() + mRecvAccumOffset);
+                // English: Copy the complete packets out (one contiguous range) and rebase the
+                //          views, so the accumulation buffer can be compacted before dispatch.
+                // 한글: 완성 패킷(연속 구간 1개)을 복사해 두고 뷰를 옮긴다 — 디스패치 전에
+                //       누적 버퍼를 compact할 수 있도록.
+                mRecvBatchBuf.assign(base, base + consumed); // keeps capacity
+                for (RecvPacket &packet : mRecvPackets)
+                {
+                    packet.data = mRecvBatchBuf.data() + (packet.data - base);
+                }
+                mRecvAccumOffset += consumed;
 
-                if (hdr->size < PACKET_HEADER_SIZE || hdr->size > MAX_PACKET_TOTAL_SIZE)
+                if (mRecvAccumOffset >= mRecvAccumBuffer.size())
                 {
-                    Utils::Logger::Warn("Invalid packet size " + std::to_string(hdr->size) +
-                                ", resetting stream - Session: " + std::to_string(mId));
                     mRecvAccumBuffer.clear();
                     mRecvAccumOffset = 0;
-                    shouldClose = true;
-                    break;
                 }
-
-                if (mRecvAccumBuffer.size() - mRecvAccumOffset < hdr->size)
+                else if (mRecvAccumOffset > mRecvAccumBuffer.size() / 2)
                 {
-                    break;
+                    mRecvAccumBuffer.erase(
+                        mRecvAccumBuffer.begin(),
+                        mRecvAccumBuffer.begin() + static_cast<std::ptrdiff_t>(mRecvAccumOffset));
+                    mRecvAccumOffset = 0;
                 }
-
-                const uint32_t packetSize = hdr->size;
-                // English: Append packet bytes to reusable batch buffer and record its span.
-                // 한글: 패킷 바이트를 재사용 배치 버퍼에 추가하고 span 기록.
-                spans.push_back({static_cast<uint32_t>(mRecvBatchBuf.size()), packetSize});
-                mRecvBatchBuf.insert(mRecvBatchBuf.end(),
-                    mRecvAccumBuffer.begin() + static_cast<std::ptrdiff_t>(mRecvAccumOffset),
-                    mRecvAccumBuffer.begin() + static_cast<std::ptrdiff_t>(mRecvAccumOffset + packetSize));
-                mRecvAccumOffset += packetSize;
             }
+        }
+    }
 
-            if (mRecvAccumOffset >= mRecvAccumBuffer.size())
-            {
-                mRecvAccumBuffer.clear();
-                mRecvAccumOffset = 0;
-            }
-            else if (mRecvAccumOffset > mRecvAccumBuffer.size() / 2)
-            {
-                mRecvAccumBuffer.erase(
-                    mRecvAccumBuffer.begin(),
-                    mRecvAccumBuffer.begin() + static_cast<std::ptrdiff_t>(mRecvAccumOffset));
-                mRecvAccumOffset = 0;
-            }
+    if (shouldClose)
+    {
+        mRecvPackets.clear();
+        Close();
+        return;
+    }
+
+    if (!mRecvPackets.empty())
+    {
+        DispatchRecvBatch(mRecvPackets.data(), mRecvPackets.size());
+    }
+}
+
+Concurrency::TaskPriority Session::ClassifyRecvChunk(const char *data, uint32_t size)
+{
+    if (mPacketPriorityFn == nullptr || mOnStreamRecvCb || mIoFrameLost)
+    {
+        return Concurrency::TaskPriority::Normal;
+    }
 
-            // English: Transfer batch to localBatch, then immediately re-arm mRecvBatchBuf
-            //          with pre-reserved capacity so the next call skips the reserve() call.
-            //          swap() alone resets mRecvBatchBuf.capacity() to 0 (defeats the intent).
-            // 한글: 배치를 localBatch로 이전 후, mRecvBatchBuf를 즉시 재무장.
-            //       swap()만 하면 capacity()가 0이 되어 다음 호출 시 reserve() 재실행.
-            mRecvBatchBuf.swap(localBatch);
-            mRecvBatchBuf.reserve(MAX_PACKET_SIZE * 4);
+    const bool startsAligned = mIoFrameRemaining == 0 && mIoHeaderStashSize == 0;
+    size_t pos = 0;
+
+    // English: Finish a header that straddled the previous chunk, then skip the rest of the
+    //          packet it opened.
+    // 한글: 이전 청크에 걸친 헤더를 마저 채우고, 그 헤더가 연 패킷의 나머지를 건너뛴다.
+    if (mIoHeaderStashSize > 0)
+    {
+        const size_t take = (std::min)(sizeof(PacketHeader) - mIoHeaderStashSize, static_cast<size_t>(size));
+        std::memcpy(mIoHeaderStash + mIoHeaderStashSize, data, take);
+        mIoHeaderStashSize = static_cast<uint8_t>(mIoHeaderStashSize + take);
+        pos = take;
+        if (mIoHeaderStashSize < sizeof(PacketHeader))
+        {
+            return Concurrency::TaskPriority::Normal;
         }
+        mIoHeaderStashSize = 0;
+
+        const auto *hdr = reinterpret_cast<const PacketHeader *>(mIoHeaderStash);
+        if (hdr->size < PACKET_HEADER_SIZE || hdr->size > MAX_PACKET_TOTAL_SIZE)
+        {
+            mIoFrameLost = true;
+            return Concurrency::TaskPriority::Normal;
+        }
+        mIoFrameRemaining = hdr->size - static_cast<uint32_t>(sizeof(PacketHeader));
+    }
+    if (mIoFrameRemaining > 0)
+    {
+        const uint32_t skip = (std::min)(mIoFrameRemaining, static_cast<uint32_t>(size - pos));
+        mIoFrameRemaining -= skip;
+        pos += skip;
     }
 
-    if (shouldClose)
+    bool endsAligned = true;
+    bool uniform     = true;
+    size_t packets   = 0;
+    Concurrency::TaskPriority lane = Concurrency::TaskPriority::Normal;
+    while (pos < size)
+    {
+        const size_t remaining = size - pos;
+        if (remaining < sizeof(PacketHeader))
+        {
+            std::memcpy(mIoHeaderStash, data + pos, remaining);
+            mIoHeaderStashSize = static_cast<uint8_t>(remaining);
+            endsAligned = false;
+            break;
+        }
+
+        const auto *hdr = reinterpret_cast<const PacketHeader *>(data + pos);
+        if (hdr->size < PACKET_HEADER_SIZE || hdr->size > MAX_PACKET_TOTAL_SIZE)
+        {
+            mIoFrameLost = true;
+            return Concurrency::TaskPriority::Normal;
+        }
+        if (hdr->size > remaining)
+        {
+            mIoFrameRemaining = static_cast<uint32_t>(hdr->size - remaining);
+            endsAligned = false;
+            break;
+        }
+
+        const Concurrency::TaskPriority priority = mPacketPriorityFn(hdr->id);
+        uniform = uniform && (packets == 0 || priority == lane);
+        lane = priority;
+        ++packets;
+        pos += hdr->size;
+    }
+
+    if (!startsAligned || !endsAligned || !uniform || packets == 0)
     {
+        return Concurrency::TaskPriority::Normal;
+    }
+    return lane;
+}
+
+void Session::ProcessFramedRecv(const char *data, uint32_t size)
+{
+    mRecvPackets.clear();
+    size_t consumed = 0;
+    if (!FrameRecvPackets(data, size, consumed) || consumed != size)
+    {
+        // English: Cannot happen for a chunk ClassifyRecvChunk accepted — treat as corruption.
+        // 한글: ClassifyRecvChunk가 통과시킨 청크에서는 불가능 — 스트림 손상으로 처리.
+        mRecvPackets.clear();
         Close();
         return;
     }
+    DispatchRecvBatch(mRecvPackets.data(), mRecvPackets.size());
+}
+
+bool Session::FrameRecvPackets(const char *base, size_t size, size_t &consumed)
+{
+    consumed = 0;
+    while (size - consumed >= sizeof(PacketHeader))
+    {
+        const auto *hdr = reinterpret_cast<const PacketHeader *>(base + consumed);
+
+        if (hdr->size < PACKET_HEADER_SIZE || hdr->size > MAX_PACKET_TOTAL_SIZE)
+        {
+            static Utils::LogRateLimiter sInvalidSizeLog(1000);
+            Utils::Logger::Warn(sInvalidSizeLog, "Invalid packet size {}, resetting stream - Session: {}",
+                                hdr->size, mId);
+            return false;
+        }
+
+        if (size - consumed < hdr->size)
+        {
+            break;
+        }
+
+        mRecvPackets.push_back({base + consumed, hdr->size});
+        consumed += hdr->size;
+    }
+    return true;
+}
+
+void Session::DispatchRecvBatch(const RecvPacket *packets, size_t count)
+{
+#if NETWORK_ENABLE_COROUTINES
+    if (mRecvAsync)
+    {
+        DeliverRecvAsync(packets, count);
+        return;
+    }
+#endif
+
+    if (count == 1)
+    {
+        OnRecvBatch(packets, count);
+        return;
+    }
+
+    // English: Several packets in one chunk — coalesce this worker's responses to this
+    //          session into one send buffer, queued once when the scope closes.
+    // 한글: 청크 1개에 패킷 여러 개 — 이 워커가 이 세션에 보내는 응답을 송신 버퍼
+    //       1개로 합쳐 스코프 종료 시 한 번에 큐잉.
+    SendCoalesceScope coalesce(this);
+    OnRecvBatch(packets, count);
+}
+
+void Session::OnRecvBatch(const RecvPacket *packets, size_t count)
+{
+    if (mOnRecvBatchCb)
+    {
+        // English: One handler call per batch — traced as a single Handler stage under
+        //          the first packet's id.
+        // 한글: 배치당 핸들러 호출 1회 — 첫 패킷 id로 Handler 단계 1회로 추적.
+        PacketTrace::HandlerScope traceScope(mId, packets[0].data, packets[0].size);
+        Utils::AllocTagScope allocTag(Utils::AllocTag::Handler);
+        mOnRecvBatchCb(this, packets, count);
+        return;
+    }
 
-    // English: Dispatch all packets from localBatch (mRecvMutex not held).
-    // 한글: localBatch에서 모든 패킷 디스패치 (mRecvMutex 미보유 상태).
-    for (const auto &sp : spans)
+    for (size_t i = 0; i < count; ++i)
     {
-        OnRecv(localBatch.data() + sp.offset, sp.size);
+        PacketTrace::HandlerScope traceScope(mId, packets[i].data, packets[i].size);
+        Utils::AllocTagScope allocTag(Utils::AllocTag::Handler);
+        OnRecv(packets[i].data, packets[i].size);
     }
 }
 
+#if NETWORK_ENABLE_COROUTINES
+bool Session::Spawn(Concurrency::Task<void> task)
+{
+    if (!mLogicDispatcher)
+    {
+        return false;
+    }
+    // English: weak_from_this is empty for sessions not owned by a SessionRef (tests, benchmarks).
+    // 한글: SessionRef가 소유하지 않는 세션(테스트, 벤치마크)이면 weak_from_this가 비어 있다.
+    return Concurrency::Spawn(*mLogicDispatcher, mId, mAsyncScope, std::move(task),
+                              weak_from_this().lock());
+}
+
+bool Session::RecvAwaiter::await_ready()
+{
+    if (!mSession->mRecvPending.empty())
+    {
+        mSession->mRecvCurrent = std::move(mSession->mRecvPending.front());
+        mSession->mRecvPending.pop_front();
+        mPacket = {mSession->mRecvCurrent.data(), static_cast<uint32_t>(mSession->mRecvCurrent.size())};
+
+        // English: Backlog drained to half the cap — release the hold taken in DeliverRecvAsync.
+        // 한글: 보관 패킷이 상한의 절반까지 줄었다 — DeliverRecvAsync가 건 보유를 해제.
+        if (mSession->mRecvPendingPaused &&
+            mSession->mRecvPending.size() <= Utils::RECV_ASYNC_PENDING_LIMIT / 2)
+        {
+            mSession->mRecvPendingPaused = false;
+            mSession->ResumeRecv(RecvPauseReason::RecvAsync);
+        }
+        return true;
+    }
+    // English: Closed — resume at once with an empty packet.
+    // 한글: 닫힘 — 빈 패킷으로 즉시 재개.
+    return !mSession->IsConnected();
+}
+
+bool Session::ParkRecvWaiter(RecvAwaiter *waiter)
+{
+    mRecvWaiter.store(waiter, std::memory_order_release);
+    if (IsConnected())
+    {
+        return true;
+    }
+    // English: Close() ran after await_ready — if it already took the waiter it resumes it.
+    // 한글: await_ready 이후 Close() 실행 — 이미 대기자를 가져갔다면 Close 쪽이 재개한다.
+    return mRecvWaiter.exchange(nullptr, std::memory_order_acq_rel) != waiter;
+}
+
+void Session::DeliverRecvAsync(const RecvPacket *packets, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        RecvAwaiter *waiter = mRecvWaiter.exchange(nullptr, std::memory_order_acq_rel);
+        if (!waiter)
+        {
+            mRecvPending.emplace_back(packets[i].data, packets[i].data + packets[i].size);
+            if (!mRecvPendingPaused && mRecvPending.size() >= Utils::RECV_ASYNC_PENDING_LIMIT)
+            {
+                // English: The coroutine is not keeping up — stop reading until it drains
+                //          (RecvAwaiter::await_ready resumes). One hold at most per session.
+                // 한글: 코루틴이 따라오지 못한다 — 소비할 때까지 읽기 중지
+                //       (RecvAwaiter::await_ready가 재개). 세션당 보유는 최대 1개.
+                mRecvPendingPaused = true;
+                PauseRecv(RecvPauseReason::RecvAsync);
+            }
+            continue;
+        }
+
+        // English: Already on the session key — resume inline; the packet view stays valid
+        //          until the coroutine suspends again (zero copy).
+        // 한글: 이미 세션 키 위 — 인라인 재개; 코루틴이 다시 중단될 때까지 패킷 뷰가 유효 (복사 없음).
+        PacketTrace::HandlerScope traceScope(mId, packets[i].data, packets[i].size);
+        Utils::AllocTagScope allocTag(Utils::AllocTag::Handler);
+        waiter->mPacket = packets[i];
+        waiter->mHandle.resume();
+    }
+}
+
+bool Session::SendAwaiter::await_ready()
+{
+    mResult = mSession->Send(mData, mSize);
+    return mResult != SendResult::QueueFull;
+}
+
+Session::SendResult Session::SendAwaiter::await_resume()
+{
+    if (mResult == SendResult::QueueFull)
+    {
+        mResult = mSession->Send(mData, mSize);
+    }
+    return mResult;
+}
+
+bool Session::ParkSendWaiter(SendAwaiter *waiter)
+{
+    mSendWaiter.store(waiter, std::memory_order_release);
+    if (IsConnected() &&
+        mSendQueueSize.load(std::memory_order_acquire) >= Utils::SEND_QUEUE_BACKPRESSURE_THRESHOLD / 2)
+    {
+        return true;
+    }
+    // English: Drained or closed before we parked — retry now unless a waker already took us.
+    // 한글: 등록 전에 드레인/닫힘 — 깨우는 쪽이 먼저 가져가지 않았다면 지금 재시도.
+    return mSendWaiter.exchange(nullptr, std::memory_order_acq_rel) != waiter;
+}
+
+void Session::WakeSendWaiter()
+{
+    if (mSendWaiter.load(std::memory_order_acquire) == nullptr ||
+        mSendQueueSize.load(std::memory_order_acquire) >= Utils::SEND_QUEUE_BACKPRESSURE_THRESHOLD / 2)
+    {
+        return;
+    }
+    if (SendAwaiter *waiter = mSendWaiter.exchange(nullptr, std::memory_order_acq_rel))
+    {
+        waiter->mExecutor->Resume(waiter->mHandle);
+    }
+}
+
+void Session::WakeAsyncWaiters()
+{
+    if (RecvAwaiter *waiter = mRecvWaiter.exchange(nullptr, std::memory_order_acq_rel))
+    {
+        waiter->mExecutor->Resume(waiter->mHandle);
+    }
+    if (SendAwaiter *waiter = mSendWaiter.exchange(nullptr, std::memory_order_acq_rel))
+    {
+        waiter->mExecutor->Resume(waiter->mHandle);
+    }
+}
+#endif
 
 } // namespace Network::Core
@@ -7,16 +7,40 @@
 #include "../../Utils/NetworkUtils.h"
 #include "PlatformDetect.h"
 #include "PacketDefine.h"
+#include "PacketTrace.h"
+#include "SharedSendBuffer.h"
 #include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <queue>
 #include <vector>
 #include <array>
 
+#if NETWORK_ENABLE_COROUTINES
+#include "../../Concurrency/Coroutine.h"
+#include <deque>
+#endif
+
 namespace Network::Core
 {
+class BaseNetworkEngine;
+
+// =============================================================================
+// English: Why a session's recv is paused. Each reason is a hold count, not a flag — independent
+//          sources sharing a reason (DB task queue, DB server queue, their partitions) each hold
+//          their own pause. Reads resume once every hold of every reason is released.
+// 한글: 세션 recv 일시 중지 사유. 사유마다 플래그가 아닌 보유 횟수 — 같은 사유를 쓰는 독립된
+//       원천(DB 작업 큐, DB 서버 큐, 각 파티션)이 각자 중지를 보유한다. 모든 보유가 풀려야 재개.
+// =============================================================================
+enum class RecvPauseReason : uint8_t
+{
+	Overload    = 0,  // English: logic worker over its sojourn target / 한글: 로직 워커 대기 시간 목표 초과
+	FlowControl = 1,  // English: downstream queue over its high-water mark (RecvFlowControl) / 한글: 하류 큐 상한 초과 (RecvFlowControl)
+	RecvAsync   = 2,  // English: RecvAsync backlog over RECV_ASYNC_PENDING_LIMIT / 한글: RecvAsync 보관 패킷이 RECV_ASYNC_PENDING_LIMIT 초과
+};
+
 // =============================================================================
 // English: Session state
 // 한글: 세션 상태
@@ -105,6 +129,42 @@ class Session : public std::enable_shared_from_this<Session>
 		Ok,           // English: Packet enqueued/sent successfully / 한글: 패킷 큐잉/전송 성공
 		QueueFull,    // English: Send queue above backpressure threshold / 한글: 송신 큐 백프레셔 임계값 초과
 		NotConnected, // English: Session not connected / 한글: 세션 미연결
+		InvalidArgument, // English: Oversized packet, null/empty data, bad commit size / 한글: 크기 초과, null/빈 데이터, 잘못된 커밋 크기
+	};
+
+  private:
+	class SendCoalesceScope;
+
+  public:
+	// English: Writable region reserved inside the session's send buffer (see ReserveSend).
+	//          Owns the buffer until CommitSend — destroying it uncommitted cancels the send.
+	//          Move-only: inside a recv batch the region lives in the batch buffer and the
+	//          batch tracks the span by address.
+	// 한글: 세션 송신 버퍼 안에 예약된 쓰기 영역 (ReserveSend 참고).
+	//       CommitSend 전까지 버퍼를 소유 — 커밋 없이 소멸하면 송신 취소.
+	//       이동 전용: recv 배치 안에서는 영역이 배치 버퍼 안에 있고 배치가 span 주소를 추적한다.
+	class SendSpan
+	{
+	  public:
+		SendSpan() = default;
+		~SendSpan();
+		SendSpan(SendSpan &&other) noexcept;
+		SendSpan &operator=(SendSpan &&other) noexcept;
+		SendSpan(const SendSpan &) = delete;
+		SendSpan &operator=(const SendSpan &) = delete;
+
+		char *Data() const { return mData; }
+		uint32_t Size() const { return mSize; }
+		SendResult Result() const { return mResult; }
+		explicit operator bool() const { return mData != nullptr; }
+
+	  private:
+		friend class Session;
+		SharedSendBuffer   mBuffer;            // English: Block holding mData (kept alive) / 한글: mData를 담은 블록 (수명 유지)
+		char              *mData   = nullptr;
+		uint32_t           mSize   = 0;
+		SendResult         mResult = SendResult::NotConnected;
+		SendCoalesceScope *mScope  = nullptr;  // English: Set while reserved in place in a batch buffer / 한글: 배치 버퍼 안에 예약된 동안 설정
 	};
 
 	// English: Send packet. Returns SendResult for backpressure feedback.
@@ -116,6 +176,41 @@ class Session : public std::enable_shared_from_this<Session>
 		return Send(&packet, sizeof(T));
 	}
 
+	// English: Send an already-serialized shared buffer. The queue keeps a reference
+	//          instead of a copy — used by SessionManager::Broadcast/Multicast.
+	// 한글: 직렬화가 끝난 공유 버퍼 전송. 큐는 복사 대신 참조만 보관한다 —
+	//       SessionManager::Broadcast/Multicast가 사용.
+	SendResult Send(const SharedSendBuffer &packet);
+
+	// English: Build the response directly in the send buffer — no stack packet, no copy.
+	//          ReserveSend(size) returns a writable span (empty span + Result() on failure:
+	//          same checks as Send). Write up to size bytes, then CommitSend(span, actual)
+	//          publishes the first actual bytes. Steady-state cost: 0 allocations, 0 copies
+	//          (buffers come from SharedSendBuffer's block pool). Inside a recv batch the span
+	//          is reserved directly at the end of the batch send buffer, so commit only
+	//          advances the batch length.
+	// 한글: 응답을 송신 버퍼 안에서 바로 작성 — 스택 패킷·복사 없음.
+	//       ReserveSend(size)는 쓰기 가능한 영역을 반환 (실패 시 빈 span + Result(): Send와 같은 검사).
+	//       size 바이트 이내로 쓴 뒤 CommitSend(span, actual)로 앞 actual 바이트를 게시.
+	//       정상 상태 비용: 할당 0회, 복사 0회 (SharedSendBuffer 블록 풀 사용). recv 배치 안에서는
+	//       배치 송신 버퍼 끝에 바로 예약되므로 커밋은 배치 길이만 늘린다.
+	SendSpan ReserveSend(uint32_t size);
+	SendResult CommitSend(SendSpan &span, uint32_t actualSize);
+
+	// English: Fixed-size packet built in place: fill(T&) sets the fields after T's constructor.
+	// 한글: 고정 크기 패킷을 제자리에서 생성: T 생성자 이후 fill(T&)이 필드를 채운다.
+	template <typename T, typename Fill> SendResult SendInPlace(Fill &&fill)
+	{
+		SendSpan span = ReserveSend(static_cast<uint32_t>(sizeof(T)));
+		if (!span)
+		{
+			return span.Result();
+		}
+		T *packet = new (span.Data()) T();
+		fill(*packet);
+		return CommitSend(span, static_cast<uint32_t>(sizeof(T)));
+	}
+
 	// English: Post receive request to IOCP
 	// 한글: IOCP에 수신 요청 등록
 	bool PostRecv();
@@ -175,6 +270,21 @@ class Session : public std::enable_shared_from_this<Session>
 		if (mOnRecvCb) mOnRecvCb(this, data, size);
 	}
 
+	// English: One complete framed packet (header included) parsed out of a recv chunk.
+	//          Valid only for the duration of the batch call.
+	// 한글: recv 청크에서 파싱한 완성 패킷 1개 (헤더 포함). 배치 호출 동안만 유효.
+	struct RecvPacket
+	{
+		const char *data;
+		uint32_t    size;
+	};
+
+	// English: All complete packets of one recv chunk, in stream order. Default: the batch
+	//          callback if set (one call), otherwise OnRecv per packet.
+	// 한글: recv 청크 1개의 완성 패킷 전체 (스트림 순서). 기본 동작: 배치 콜백이 있으면
+	//       1회 호출, 없으면 패킷마다 OnRecv.
+	virtual void OnRecvBatch(const RecvPacket *packets, size_t count);
+
 	// English: Per-session recv callback — set once in SessionManager::CreateSession via
 	//          SetSessionConfigurator, before PostRecv() is issued. Cleared in Reset().
 	//          Signature includes Session* so the handler can call session->Send() without
@@ -185,17 +295,319 @@ class Session : public std::enable_shared_from_this<Session>
 	using OnRecvCallback = std::function<void(Session*, const char*, uint32_t)>;
 	void SetOnRecv(OnRecvCallback cb);
 
+	// English: Batch recv callback — replaces SetOnRecv's per-packet calls with one call per
+	//          recv chunk (packets[0..count)). Same set-once/cleared-in-Reset rules as SetOnRecv;
+	//          setting either one clears the other (a later SetOnRecv replaces a batch handler).
+	//          Whenever a chunk holds more than one packet, every Send/SendInPlace this worker
+	//          makes to this session during the batch is appended to one send buffer and
+	//          queued once when the batch returns (one lock, one send submission per batch).
+	// 한글: 배치 recv 콜백 — SetOnRecv의 패킷별 호출 대신 recv 청크당 1회 호출
+	//       (packets[0..count)). 설정/초기화 규칙은 SetOnRecv와 같고, 둘 중 하나를 설정하면
+	//       다른 하나는 지워진다 (나중의 SetOnRecv가 배치 핸들러를 대체).
+	//       청크에 패킷이 2개 이상이면, 배치 중 이 워커가 이 세션으로 보내는 Send/SendInPlace는
+	//       송신 버퍼 1개에 이어 붙여 배치가 끝날 때 한 번에 큐잉된다 (배치당 락 1회, 송신 제출 1회).
+	using OnRecvBatchCallback = std::function<void(Session*, const RecvPacket*, size_t)>;
+	void SetOnRecvBatch(OnRecvBatchCallback cb);
+
+	// English: Stream mode — when set, ProcessRawRecv hands each recv chunk to this callback
+	//          as-is and skips PacketHeader framing (text protocols on listener ports, e.g. HTTP).
+	//          Same set-once/cleared-in-Reset rules as SetOnRecv.
+	// 한글: 스트림 모드 — 설정되면 ProcessRawRecv가 PacketHeader 프레이밍 없이 recv 청크를
+	//       그대로 이 콜백에 넘긴다 (리스너 포트의 텍스트 프로토콜, 예: HTTP).
+	//       설정/초기화 규칙은 SetOnRecv와 같다.
+	void SetOnStreamRecv(OnRecvCallback cb);
+
+	// English: Send-drained callback — runs on the I/O thread once the send queue is empty and
+	//          no send is in flight (every queued byte was handed to the socket). Stream-mode
+	//          handlers use it to pace responses larger than the send queue and to close after
+	//          the last byte. Never called from inside Send(). Same set-once/cleared-in-Reset
+	//          rules as SetOnRecv.
+	// 한글: 송신 드레인 콜백 — 송신 큐가 비고 진행 중인 송신도 없을 때(큐잉된 바이트가 모두
+	//       소켓에 넘어감) I/O 스레드에서 호출. 스트림 모드 핸들러가 송신 큐보다 큰 응답을
+	//       나눠 보내거나 마지막 바이트 뒤에 닫을 때 사용. Send() 안에서는 호출되지 않는다.
+	//       설정/초기화 규칙은 SetOnRecv와 같다.
+	using OnSendDrainedCallback = std::function<void(Session*)>;
+	void SetOnSendDrained(OnSendDrainedCallback cb);
+
+	// English: Marks this session's handlers as blocking (synchronous DB/file calls, long waits).
+	//          In run-to-completion mode (NetworkConfig::RunToCompletion) handlers normally run
+	//          inline on the session's I/O thread; a marked session keeps using the logic
+	//          dispatcher so it cannot stall the other sessions of that thread.
+	//          Set from the configurator before the first recv is armed. Cleared in Reset().
+	// 한글: 이 세션의 핸들러가 블로킹(동기 DB/파일 호출, 긴 대기)함을 표시.
+	//       run-to-completion 모드(NetworkConfig::RunToCompletion)에서 핸들러는 보통 세션의
+	//       I/O 스레드에서 인라인으로 실행되지만, 표시된 세션은 로직 디스패처를 계속 사용해
+	//       같은 스레드의 다른 세션을 막지 않는다.
+	//       첫 recv 등록 전에 설정자에서 설정. Reset()에서 초기화.
+	void SetBlockingHandler(bool blocking) { mBlockingHandler = blocking; }
+	bool HasBlockingHandler() const { return mBlockingHandler; }
+
+	// English: Per-packet-type dispatch priority, e.g. &DispatchTable::PriorityOf (declared in
+	//          PacketRegistry.h). The I/O thread then sends a recv chunk that holds only whole
+	//          packets of one declared priority to that lane of the logic dispatcher; anything
+	//          else (partial packets, mixed priorities) stays Normal. A Control chunk may run
+	//          before this session's earlier Normal chunks — declare only order-independent
+	//          packets. Set from the configurator. Cleared in Reset().
+	// 한글: 패킷 타입별 디스패치 우선순위, 예: &DispatchTable::PriorityOf (PacketRegistry.h 선언).
+	//       설정하면 I/O 스레드가 선언 우선순위가 같은 완성 패킷만 담긴 recv 청크를 로직
+	//       디스패처의 그 레인으로 보낸다. 나머지(미완성 패킷, 우선순위 혼합)는 Normal.
+	//       Control 청크는 이 세션의 앞선 Normal 청크보다 먼저 실행될 수 있다 — 순서와 무관한
+	//       패킷만 선언할 것. 설정자에서 설정. Reset()에서 초기화.
+	using PacketPriorityFn = Concurrency::TaskPriority (*)(uint16_t packetId);
+	void SetPacketPriority(PacketPriorityFn fn) { mPacketPriorityFn = fn; }
+
+	// English: Logic dispatcher this session's tasks run on (key = session id). Set by the
+	//          engine next to SetAsyncProvider, before the first recv is armed. Cleared in Reset().
+	// 한글: 이 세션의 작업이 실행되는 로직 디스패처 (키 = 세션 ID). 엔진이 SetAsyncProvider와
+	//       함께 첫 recv 등록 전에 설정. Reset()에서 초기화.
+	void SetLogicDispatcher(Concurrency::KeyedDispatcher *dispatcher) { mLogicDispatcher = dispatcher; }
+
+	// English: Engine that re-arms this session's recv after ResumeRecv. Set by the engine next
+	//          to SetLogicDispatcher. Cleared in Reset().
+	// 한글: ResumeRecv 후 이 세션의 recv를 재등록하는 엔진. 엔진이 SetLogicDispatcher와 함께
+	//       설정. Reset()에서 초기화.
+	void SetRecvEngine(BaseNetworkEngine *engine) { mRecvEngine = engine; }
+
+	// English: Stop / restart reading from the socket. While any reason is set the engine does
+	//          not re-arm recv after the current completion, so unread data stays in the kernel
+	//          and the peer's TCP window closes. Safe from any thread; the last ResumeRecv re-arms.
+	//          Calls are counted per reason: every PauseRecv needs its own ResumeRecv, issued after
+	//          the pause returns. At most 255 holds per reason: further PauseRecv calls are dropped
+	//          and logged, so recv may resume early. A ResumeRecv with no hold is ignored.
+	// 한글: 소켓 읽기 중지 / 재개. 사유가 하나라도 남아 있으면 엔진이 현재 완료 이후 recv를
+	//       재등록하지 않는다 — 읽지 않은 데이터는 커널에 남고 상대의 TCP 윈도가 닫힌다.
+	//       어느 스레드에서나 호출 가능. 마지막 ResumeRecv가 재등록한다.
+	//       사유별로 횟수를 센다: PauseRecv마다 그 호출이 끝난 뒤의 ResumeRecv가 하나씩 필요.
+	//       사유당 보유 최대 255 — 넘는 PauseRecv는 버리고 기록하므로 일찍 재개될 수 있다.
+	//       보유가 없는 ResumeRecv는 무시한다.
+	void PauseRecv(RecvPauseReason reason);
+	void ResumeRecv(RecvPauseReason reason);
+	bool IsRecvPaused(RecvPauseReason reason) const
+	{
+		return (mRecvPauseHolds.load(std::memory_order_acquire) & PauseField(reason)) != 0;
+	}
+
+	// English: Engine-side, on the I/O thread in place of re-arming recv. true = paused, the
+	//          recv is parked and the last ResumeRecv re-arms it; false = re-arm now.
+	// 한글: 엔진 전용, recv 재등록 대신 I/O 스레드에서 호출. true = 일시 중지 — recv를 보관하고
+	//       마지막 ResumeRecv가 재등록한다. false = 지금 재등록.
+	bool ParkRecvIfPaused();
+
+	// English: Engine-side — recv chunks queued on the logic dispatcher and not yet processed.
+	// 한글: 엔진 전용 — 로직 디스패처에 넣고 아직 처리되지 않은 recv 청크 수.
+	uint32_t GetRecvBacklog() const { return mRecvBacklog.load(std::memory_order_relaxed); }
+
+#if NETWORK_ENABLE_COROUTINES
+	// English: co_await session->RecvAsync() — next complete packet. data == nullptr once the
+	//          session is closed. The view is valid until the coroutine's next co_await.
+	// 한글: co_await session->RecvAsync() — 다음 완성 패킷. 세션이 닫히면 data == nullptr.
+	//       뷰는 코루틴의 다음 co_await 전까지만 유효.
+	class RecvAwaiter
+	{
+	  public:
+		explicit RecvAwaiter(Session *session) : mSession(session) {}
+
+		bool await_ready();
+
+		template <typename Promise> bool await_suspend(std::coroutine_handle<Promise> handle)
+		{
+			mHandle   = handle;
+			mExecutor = &handle.promise().Executor();
+			return mSession->ParkRecvWaiter(this);
+		}
+
+		RecvPacket await_resume() const { return mPacket; }
+
+	  private:
+		friend class Session;
+		Session                           *mSession;
+		std::coroutine_handle<>            mHandle;
+		const Concurrency::CoExecutor     *mExecutor = nullptr;
+		RecvPacket                         mPacket{nullptr, 0};
+	};
+
+	// English: co_await session->SendAsync(...) — Send() that suspends on QueueFull until the
+	//          send queue drains below half the backpressure threshold, then retries once.
+	//          data must stay valid until the co_await completes.
+	// 한글: co_await session->SendAsync(...) — QueueFull이면 송신 큐가 백프레셔 임계값의 절반
+	//       아래로 빠질 때까지 대기한 뒤 1회 재시도하는 Send(). data는 co_await 완료까지 유효해야 한다.
+	class SendAwaiter
+	{
+	  public:
+		SendAwaiter(Session *session, const void *data, uint32_t size)
+			: mSession(session), mData(data), mSize(size)
+		{
+		}
+
+		bool await_ready();
+
+		template <typename Promise> bool await_suspend(std::coroutine_handle<Promise> handle)
+		{
+			mHandle   = handle;
+			mExecutor = &handle.promise().Executor();
+			return mSession->ParkSendWaiter(this);
+		}
+
+		SendResult await_resume();
+
+	  private:
+		friend class Session;
+		Session                       *mSession;
+		const void                    *mData;
+		uint32_t                       mSize;
+		SendResult                     mResult = SendResult::QueueFull;
+		std::coroutine_handle<>        mHandle;
+		const Concurrency::CoExecutor *mExecutor = nullptr;
+	};
+
+	// English: Start a coroutine on this session's dispatcher key, owned by the session's
+	//          AsyncScope — Close() cancels it at its next resumption (locals are destroyed,
+	//          the frame never runs again). The frame keeps the session alive until it ends.
+	//          false if the session has no dispatcher yet or is already closed.
+	// 한글: 이 세션의 디스패처 키에서 코루틴 시작, 세션 AsyncScope 소속 — Close()하면 다음 재개
+	//       시점에 취소된다 (지역 변수 소멸, 이후 실행 안 함). 프레임이 끝날 때까지 세션을 붙잡는다.
+	//       디스패처가 아직 없거나 이미 닫힌 세션이면 false.
+	bool Spawn(Concurrency::Task<void> task);
+
+	// English: Route this session's packets to RecvAsync() instead of the recv callbacks.
+	//          Set once from the configurator (packets arriving before the coroutine waits are
+	//          queued; past RECV_ASYNC_PENDING_LIMIT recv pauses until it catches up). Also marks the session as a blocking handler so run-to-completion mode
+	//          keeps its packets on the dispatcher key where coroutines resume. Cleared in Reset().
+	// 한글: 이 세션의 패킷을 recv 콜백 대신 RecvAsync()로 전달. 설정자에서 1회 설정
+	//       (코루틴이 기다리기 전에 온 패킷은 큐에 보관, RECV_ASYNC_PENDING_LIMIT를 넘으면
+	//       따라잡을 때까지 recv 일시 중지). run-to-completion 모드에서도 패킷이
+	//       코루틴이 재개되는 디스패처 키에 남도록 블로킹 핸들러로 표시한다. Reset()에서 초기화.
+	void EnableRecvAsync()
+	{
+		mRecvAsync = true;
+		mBlockingHandler = true;
+	}
+
+	RecvAwaiter RecvAsync() { return RecvAwaiter(this); }
+	SendAwaiter SendAsync(const void *data, uint32_t size) { return SendAwaiter(this, data, size); }
+	template <typename T> SendAwaiter SendAsync(const T &packet) { return SendAsync(&packet, sizeof(T)); }
+#endif
+
 	// English: TCP stream reassembly - engine calls this with raw bytes
 	// 한글: TCP 스트림 재조립 - 엔진이 원시 바이트로 이 메서드를 호출
 	void ProcessRawRecv(const char *data, uint32_t size);
 
+	// English: Engine-side, on the I/O thread before dispatch — lane for this recv chunk.
+	//          Tracks packet boundaries across chunks (one recv in flight per session, so calls
+	//          arrive in stream order). Normal unless SetPacketPriority is set and the chunk
+	//          starts and ends on a packet boundary with every packet declaring the same priority.
+	// 한글: 엔진 전용, 디스패치 전 I/O 스레드에서 — 이 recv 청크의 레인.
+	//       청크 사이의 패킷 경계를 추적한다 (세션당 recv 1개 — 스트림 순서로 호출됨).
+	//       SetPacketPriority가 설정되고 청크가 패킷 경계에서 시작·끝나며 모든 패킷의 선언
+	//       우선순위가 같을 때만 그 레인, 아니면 Normal.
+	Concurrency::TaskPriority ClassifyRecvChunk(const char *data, uint32_t size);
+
+	// English: Deliver a chunk classified outside Normal. It holds whole packets only, so it is
+	//          framed in place without touching the reassembly buffer (which may still hold a
+	//          partial packet of an earlier Normal chunk).
+	// 한글: Normal 밖으로 분류된 청크 전달. 완성 패킷만 있으므로 재조립 버퍼(앞선 Normal
+	//       청크의 미완성 패킷이 남아 있을 수 있음)를 건드리지 않고 그 자리에서 프레이밍한다.
+	void ProcessFramedRecv(const char *data, uint32_t size);
+
   private:
 	// English: Internal send processing
 	// 한글: 내부 전송 처리
 	void FlushSendQueue();
-	bool PostSend();
+	// English: sendCompleted = called from ProcessSendCompletion; only then may an empty queue
+	//          fire the send-drained callback (so it never runs inside a caller's Send()).
+	// 한글: sendCompleted = ProcessSendCompletion에서 호출됨. 이때만 빈 큐에서 송신 드레인
+	//       콜백을 호출한다 (호출자의 Send() 안에서 재진입하지 않도록).
+	bool PostSend(bool sendCompleted = false);
+
+	// English: Admission checks shared by both Send() overloads — connection, size, backpressure.
+	// 한글: 두 Send() 오버로드 공용 수락 검사 — 연결 상태, 크기, 백프레셔.
+	SendResult AdmitSend(uint32_t size) const;
+
+	// English: Send(data, size) without coalescing — copy into the queue (or RIO) directly.
+	// 한글: 합치기 없는 Send(data, size) — 큐(또는 RIO)로 바로 복사.
+	SendResult SendCopy(const void *data, uint32_t size);
+
+	// English: Queue an admitted shared buffer with an explicit trace stamp.
+	// 한글: 수락된 공유 버퍼를 지정한 추적 스탬프와 함께 큐잉.
+	SendResult EnqueueShared(const SharedSendBuffer &packet, const PacketTraceStamp &trace);
+
+	// English: Recv batching — frame complete packets of [base, base + size) into mRecvPackets.
+	//          consumed = bytes of complete packets. false = invalid header (stream must close).
+	// 한글: recv 배치 — [base, base + size)의 완성 패킷을 mRecvPackets에 기록.
+	//       consumed = 완성 패킷 바이트 수. false = 잘못된 헤더 (스트림 종료 필요).
+	bool FrameRecvPackets(const char *base, size_t size, size_t &consumed);
+	void DispatchRecvBatch(const RecvPacket *packets, size_t count);
+
+	// English: Send coalescing for one recv batch (stack object on the logic worker).
+	//          Active only on the thread that created it and only for its own session —
+	//          sends from other threads or to other sessions take the normal path.
+	// 한글: recv 배치 1회 동안의 송신 합치기 (로직 워커 스택 객체).
+	//       만든 스레드에서, 자기 세션으로 보내는 경우에만 동작 — 다른 스레드나
+	//       다른 세션으로의 송신은 일반 경로를 탄다.
+	class SendCoalesceScope
+	{
+	  public:
+		explicit SendCoalesceScope(Session *session);
+		~SendCoalesceScope();
+
+		SendCoalesceScope(const SendCoalesceScope &) = delete;
+		SendCoalesceScope &operator=(const SendCoalesceScope &) = delete;
+
+		SendResult Append(const void *data, uint32_t size);
+		void Flush();
+
+		// English: In-place reservation at the end of the batch buffer (one at a time).
+		//          Any other use of the scope while a span is held first detaches it:
+		//          the committed prefix moves to a fresh buffer and the span commits by copy.
+		// 한글: 배치 버퍼 끝에 제자리 예약 (한 번에 하나). 예약 중 스코프를 다른 용도로 쓰면
+		//       먼저 분리한다: 커밋된 앞부분은 새 버퍼로 옮기고 span은 복사로 커밋한다.
+		bool Reserve(SendSpan &span, uint32_t size);
+		SendResult CommitReserved(SendSpan &span, uint32_t actualSize);
+		void ReleaseReserved(SendSpan &span);
+		void MoveReserved(SendSpan &from, SendSpan &to);
+
+		Session *GetSession() const { return mSession; }
+
+	  private:
+		void EnsureCapacity(uint32_t size);
+		void DetachReserved();
+
+		Session           *mSession;
+		SendCoalesceScope *mPrevious;  // English: restored on exit / 한글: 종료 시 복원
+		SharedSendBuffer   mBuffer;
+		uint32_t           mUsed = 0;
+		PacketTraceStamp   mTrace;     // English: stamp of the first appended response / 한글: 첫 응답의 스탬프
+		SendSpan          *mReserved = nullptr;  // English: span reserved at mUsed / 한글: mUsed 위치에 예약된 span
+	};
+
+	static thread_local SendCoalesceScope *sCoalesceScope;
+
+	SendCoalesceScope *ActiveCoalesceScope()
+	{
+		SendCoalesceScope *scope = sCoalesceScope;
+		return (scope && scope->GetSession() == this) ? scope : nullptr;
+	}
+
+#if defined(IS_WINDOWS)
+	// English: Return the in-flight pool slot / shared buffer (send completed or aborted).
+	// 한글: 전송 중 풀 슬롯·공유 버퍼 반납 (송신 완료 또는 중단).
+	void ReleaseInFlightSend();
+#endif
+
 	SocketHandle GetInvalidSocket() const;
 
+#if NETWORK_ENABLE_COROUTINES
+	// English: Coroutine waiters — park returns false when the awaiter must resume at once
+	//          (Close or a drain won the race). Wake* hand the waiter back to its executor.
+	// 한글: 코루틴 대기자 — park가 false면 즉시 재개해야 한다 (Close나 드레인이 먼저 일어남).
+	//       Wake*는 대기자를 실행 문맥으로 돌려보낸다.
+	bool ParkRecvWaiter(RecvAwaiter *waiter);
+	bool ParkSendWaiter(SendAwaiter *waiter);
+	void DeliverRecvAsync(const RecvPacket *packets, size_t count);
+	void WakeSendWaiter();
+	void WakeAsyncWaiters();
+#endif
+
   private:
 	Utils::ConnectionId mId;
 	std::atomic<SocketHandle> mSocket;
@@ -219,22 +631,40 @@ class Session : public std::enable_shared_from_this<Session>
 #endif
 
     // English: Send queue with lock contention optimization.
-    //          IOCP path (Windows): uses SendRequest referencing a pool slot (0 alloc).
-    //          Other platforms: uses vector<char> (unchanged).
+    //          IOCP path (Windows): uses SendRequest referencing a pool slot (0 alloc),
+    //          or a shared buffer reference for Send(const SharedSendBuffer&).
+    //          Other platforms: every entry is a SharedSendBuffer — Send(data, size)
+    //          copies once into a new buffer, broadcast entries share one buffer.
     // 한글: Lock 경합 최적화가 적용된 전송 큐.
-    //       IOCP 경로(Windows): 풀 슬롯을 참조하는 SendRequest 사용 (0 alloc).
-    //       다른 플랫폼: vector<char> 사용 (기존과 동일).
+    //       IOCP 경로(Windows): 풀 슬롯을 참조하는 SendRequest 사용 (0 alloc),
+    //       Send(const SharedSendBuffer&)는 공유 버퍼 참조.
+    //       다른 플랫폼: 모든 항목이 SharedSendBuffer — Send(data, size)는 새 버퍼로
+    //       1회 복사, 브로드캐스트 항목은 하나의 버퍼를 공유.
 #if defined(IS_WINDOWS)
     struct SendRequest
     {
-        size_t   slotIdx; // English: index into SendBufferPool / 한글: SendBufferPool 슬롯 인덱스
-        uint32_t size;    // English: payload byte count / 한글: 페이로드 바이트 수
+        size_t           slotIdx; // English: index into SendBufferPool (~0 = shared) / 한글: SendBufferPool 슬롯 인덱스 (~0 = 공유 버퍼)
+        uint32_t         size;    // English: payload byte count / 한글: 페이로드 바이트 수
+        PacketTraceStamp trace;   // English: stage timestamps of the request that produced it / 한글: 이 응답을 만든 요청의 단계 스탬프
+        SharedSendBuffer shared;  // English: payload when slotIdx == ~0 / 한글: slotIdx == ~0일 때 페이로드
     };
     std::queue<SendRequest> mSendQueue;
     size_t   mCurrentSendSlotIdx; // English: in-flight slot index (~0 = none) / 한글: 전송 중 슬롯 인덱스 (~0 = 없음)
+    SharedSendBuffer mInFlightShared; // English: in-flight shared buffer (WSASend target) / 한글: 전송 중 공유 버퍼 (WSASend 대상)
 #else
-    std::queue<std::vector<char>> mSendQueue;
+    struct SendRequest
+    {
+        SharedSendBuffer buffer; // English: payload (owned or shared) / 한글: 페이로드 (단독 또는 공유)
+        PacketTraceStamp trace;  // English: stage timestamps of the request that produced it / 한글: 이 응답을 만든 요청의 단계 스탬프
+    };
+    std::queue<SendRequest> mSendQueue;
 #endif
+
+	// English: Trace stamp of the in-flight send. Written by PostSend before SendAsync and
+	//          consumed by ProcessSendCompletion — mIsSending makes both single-owner.
+	// 한글: 전송 중인 send의 추적 스탬프. PostSend가 SendAsync 전에 쓰고
+	//       ProcessSendCompletion이 소비한다 — mIsSending으로 단일 소유가 보장된다.
+	PacketTraceStamp mInFlightTrace;
 	std::mutex mSendMutex;
 	std::atomic<bool> mIsSending;
 
@@ -278,16 +708,20 @@ class Session : public std::enable_shared_from_this<Session>
 	std::vector<char> mRecvAccumBuffer;
 	size_t            mRecvAccumOffset{0};
 
-	// English: Reusable batch buffer for ProcessRawRecv general path.
+	// English: Reusable batch buffer for ProcessRawRecv accumulation path — complete packets
+	//          are copied out of mRecvAccumBuffer so it can be compacted before dispatch.
 	//          Reserved in Initialize() to amortise allocations across calls.
-	//          Protected by mRecvMutex. Swapped with a local variable before
-	//          dispatching so OnRecv is called without holding mRecvMutex.
-	// 한글: ProcessRawRecv 일반 경로용 재사용 배치 버퍼.
+	// 한글: ProcessRawRecv 누적 경로용 재사용 배치 버퍼 — 디스패치 전에 mRecvAccumBuffer를
+	//       compact할 수 있도록 완성 패킷을 복사해 둔다.
 	//       Initialize()에서 예약하여 호출 간 할당 비용을 상각.
-	//       mRecvMutex 보호. 디스패치 전 지역 변수와 swap하여
-	//       OnRecv 호출 시 mRecvMutex를 보유하지 않도록 한다.
 	std::vector<char> mRecvBatchBuf;
 
+	// English: Packet views of the current recv batch (into the recv chunk or mRecvBatchBuf).
+	//          Reused across calls; same worker-affinity serialization as the buffers above.
+	// 한글: 현재 recv 배치의 패킷 뷰 (recv 청크 또는 mRecvBatchBuf를 가리킴).
+	//       호출 간 재사용; 위 버퍼들과 같은 워커 친화도 직렬화.
+	std::vector<RecvPacket> mRecvPackets;
+
 	// English: Application-level recv callback. Set once before PostRecv() in
 	//          SessionManager::CreateSession (happens-before first recv completion).
 	//          Cleared in Reset() so the slot can be reused without stale captures.
@@ -296,6 +730,68 @@ class Session : public std::enable_shared_from_this<Session>
 	//       Reset()에서 초기화하여 스테일 캡처 없이 슬롯 재사용 가능.
 	OnRecvCallback mOnRecvCb;
 
+	// English: Batch recv callback (see SetOnRecvBatch). Same lifetime rules as mOnRecvCb.
+	// 한글: 배치 recv 콜백 (SetOnRecvBatch 참고). mOnRecvCb와 같은 수명 규칙.
+	OnRecvBatchCallback mOnRecvBatchCb;
+
+	// English: Raw stream callback (stream mode). Empty for packet-framed sessions.
+	// 한글: 원시 스트림 콜백 (스트림 모드). 패킷 프레이밍 세션은 비어 있음.
+	OnRecvCallback mOnStreamRecvCb;
+
+	// English: Send-drained callback (see SetOnSendDrained). Same lifetime rules as mOnRecvCb.
+	// 한글: 송신 드레인 콜백 (SetOnSendDrained 참고). mOnRecvCb와 같은 수명 규칙.
+	OnSendDrainedCallback mOnSendDrainedCb;
+
+	// English: Blocking-handler marker (see SetBlockingHandler). Same lifetime rules as mOnRecvCb.
+	// 한글: 블로킹 핸들러 표시 (SetBlockingHandler 참고). mOnRecvCb와 같은 수명 규칙.
+	bool mBlockingHandler = false;
+
+	// English: Logic dispatcher (see SetLogicDispatcher). Same lifetime rules as mOnRecvCb.
+	// 한글: 로직 디스패처 (SetLogicDispatcher 참고). mOnRecvCb와 같은 수명 규칙.
+	Concurrency::KeyedDispatcher *mLogicDispatcher = nullptr;
+
+	// English: Recv pause state (see PauseRecv). mRecvPauseHolds = one 8-bit hold count per
+	//          RecvPauseReason (0 = reading). mRecvParked = the I/O thread skipped a re-arm;
+	//          whoever clears it (ParkRecvIfPaused or the last ResumeRecv) re-arms. Cleared in Reset().
+	// 한글: recv 일시 중지 상태 (PauseRecv 참고). mRecvPauseHolds = RecvPauseReason마다 8비트 보유
+	//       횟수 (0 = 읽는 중). mRecvParked = I/O 스레드가 재등록을 건너뜀;
+	//       이를 되돌린 쪽(ParkRecvIfPaused 또는 마지막 ResumeRecv)이 재등록한다. Reset()에서 초기화.
+	static constexpr uint32_t PauseUnit(RecvPauseReason reason) { return 1u << (8u * static_cast<uint32_t>(reason)); }
+	static constexpr uint32_t PauseField(RecvPauseReason reason) { return 0xFFu * PauseUnit(reason); }
+
+	BaseNetworkEngine    *mRecvEngine = nullptr;
+	std::atomic<uint32_t> mRecvPauseHolds{0};
+	std::atomic<bool>     mRecvParked{false};
+	std::atomic<uint32_t> mRecvBacklog{0};  // English: see GetRecvBacklog / 한글: GetRecvBacklog 참고
+
+	// English: Packet priority resolver (see SetPacketPriority). Same lifetime rules as mOnRecvCb.
+	// 한글: 패킷 우선순위 조회 함수 (SetPacketPriority 참고). mOnRecvCb와 같은 수명 규칙.
+	PacketPriorityFn mPacketPriorityFn = nullptr;
+
+	// English: I/O-side framing cursor of ClassifyRecvChunk — touched only by the thread that
+	//          completes this session's recv. Cleared in Reset().
+	// 한글: ClassifyRecvChunk의 I/O 측 프레이밍 커서 — 이 세션의 recv를 완료하는 스레드만
+	//       접근. Reset()에서 초기화.
+	uint32_t mIoFrameRemaining = 0;   // English: bytes of the current packet still to come / 한글: 다음 청크로 이어지는 현재 패킷의 남은 바이트
+	alignas(PacketHeader) char mIoHeaderStash[sizeof(PacketHeader)] = {};  // English: header split across chunks / 한글: 청크 경계에 걸린 헤더
+	uint8_t  mIoHeaderStashSize = 0;
+	bool     mIoFrameLost = false;    // English: invalid header seen — stop classifying / 한글: 잘못된 헤더 — 분류 중단 (워커가 스트림을 닫는다)
+
+#if NETWORK_ENABLE_COROUTINES
+	// English: Coroutine recv/send state. mRecvPending / mRecvCurrent are touched only on the
+	//          session key (same serialization as the recv buffers); the waiter slots are atomic
+	//          because Close() and send completions take them from other threads.
+	// 한글: 코루틴 recv/send 상태. mRecvPending / mRecvCurrent는 세션 키에서만 접근
+	//       (recv 버퍼와 같은 직렬화); 대기자 슬롯은 Close()와 송신 완료가 다른 스레드에서
+	//       가져가므로 atomic.
+	bool                          mRecvAsync = false;
+	std::atomic<RecvAwaiter *>    mRecvWaiter{nullptr};
+	std::atomic<SendAwaiter *>    mSendWaiter{nullptr};
+	std::deque<std::vector<char>> mRecvPending;   // English: packets nobody awaited yet / 한글: 아직 기다리는 코루틴이 없던 패킷
+	std::vector<char>             mRecvCurrent;   // English: storage of the last queued packet handed out / 한글: 마지막으로 꺼내 준 큐 패킷 저장소
+	bool                          mRecvPendingPaused = false;  // English: holds RecvPauseReason::RecvAsync / 한글: RecvPauseReason::RecvAsync 보유 중
+#endif
+
 	// English: Async scope for cooperative cancellation of queued logic tasks.
 	//          BaseNetworkEngine calls mAsyncScope.Submit(...) instead of Dispatch() directly,
 	//          so that tasks queued after Close() are silently skipped.
@@ -2,6 +2,7 @@
 
 #include "SessionManager.h"
 #include "SessionPool.h"
+#include "Concurrency/KeyedDispatcher.h"
 #include "Utils/KeyGenerator.h"
 #include "Utils/LockProfiling.h"
 #include <sstream>
@@ -191,6 +192,115 @@ void SessionManager::CloseAllSessions()
 	}
 }
 
+void SessionManager::SetFanoutDispatcher(Concurrency::KeyedDispatcher *dispatcher)
+{
+	std::lock_guard<std::mutex> lock(mFanoutMutex);
+	mFanoutDispatcher = dispatcher;
+}
+
+void SessionManager::ClearFanoutDispatcher(Concurrency::KeyedDispatcher *dispatcher)
+{
+	// 다른 엔진이 나중에 등록한 디스패처는 건드리지 않는다
+	std::lock_guard<std::mutex> lock(mFanoutMutex);
+	if (mFanoutDispatcher == dispatcher)
+	{
+		mFanoutDispatcher = nullptr;
+	}
+}
+
+size_t SessionManager::Broadcast(const SharedSendBuffer &packet)
+{
+	if (packet.Empty())
+	{
+		return 0;
+	}
+	return Fanout(GetAllSessions(), packet);
+}
+
+size_t SessionManager::Multicast(const std::vector<Utils::ConnectionId> &ids, const SharedSendBuffer &packet)
+{
+	if (packet.Empty() || ids.empty())
+	{
+		return 0;
+	}
+
+	std::vector<SessionRef> targets;
+	targets.reserve(ids.size());
+	{
+		NET_LOCK_GUARD(mMutex);
+		for (Utils::ConnectionId id : ids)
+		{
+			auto it = mSessions.find(id);
+			if (it != mSessions.end())
+			{
+				targets.push_back(it->second);
+			}
+		}
+	}
+	return Fanout(std::move(targets), packet);
+}
+
+size_t SessionManager::Fanout(std::vector<SessionRef> &&targets, const SharedSendBuffer &packet)
+{
+	const size_t targetCount = targets.size();
+	if (targetCount == 0)
+	{
+		return 0;
+	}
+
+	if (targetCount >= kFanoutInlineThreshold)
+	{
+		// 등록/해제와 직렬화 — 엔진 종료 중 해제된 디스패처에 Dispatch하지 않도록 보유한 채 분산
+		std::lock_guard<std::mutex> lock(mFanoutMutex);
+		const size_t workerCount = mFanoutDispatcher ? mFanoutDispatcher->GetWorkerCount() : 0;
+		if (workerCount > 1)
+		{
+			// 세션 id % workerCount = 그 세션의 친화도 워커. 버킷 인덱스를 키로 쓰면 같은 워커로 간다.
+			std::vector<std::vector<SessionRef>> buckets(workerCount);
+			for (auto &bucket : buckets)
+			{
+				bucket.reserve(targetCount / workerCount + 1);
+			}
+			for (auto &session : targets)
+			{
+				buckets[session->GetId() % workerCount].push_back(std::move(session));
+			}
+			targets.clear();
+
+			for (size_t i = 0; i < workerCount; ++i)
+			{
+				if (buckets[i].empty())
+				{
+					continue;
+				}
+				// 거부 시 호출 스레드에서 같은 버킷을 처리할 수 있도록 shared_ptr로 보관
+				auto bucket = std::make_shared<std::vector<SessionRef>>(std::move(buckets[i]));
+				const bool queued = mFanoutDispatcher->Dispatch(i, [bucket, packet]() {
+					for (const auto &session : *bucket)
+					{
+						session->Send(packet);
+					}
+				});
+				if (!queued)
+				{
+					// 디스패처 큐 거부/종료 — 호출 스레드에서 처리
+					for (const auto &session : *bucket)
+					{
+						session->Send(packet);
+					}
+				}
+			}
+			return targetCount;
+		}
+	}
+
+	for (const auto &session : targets)
+	{
+		session->Send(packet);
+	}
+	return targetCount;
+}
+
 Utils::ConnectionId SessionManager::GenerateSessionId()
 {
 	// KeyGenerator::NextGlobalId() — monotonic uint64_t, lock-free, starts at 1.
@@ -3,8 +3,15 @@
 // 세션 생성/추적/제거를 위한 세션 관리자
 
 #include "Session.h"
+#include "SharedSendBuffer.h"
 #include <functional>
 #include <unordered_map>
+#include <vector>
+
+namespace Network::Concurrency
+{
+class KeyedDispatcher;
+}
 
 namespace Network::Core
 {
@@ -46,6 +53,29 @@ class SessionManager
 	//       등록하기 위해 사용. 제거된 SessionFactory 패턴을 대체.
 	void SetSessionConfigurator(std::function<void(Session *)> configurator);
 
+	// 브로드캐스트/멀티캐스트 — 패킷을 한 번 직렬화한 SharedSendBuffer를 수신자 송신 큐에
+	// 참조로만 넣는다 (수신자당 페이로드 복사 0회, 참조 카운트 +1).
+	//
+	// 수신자가 kFanoutInlineThreshold 이상이고 팬아웃 디스패처가 등록돼 있으면 세션을
+	// 디스패처 워커별(id % workerCount)로 나눠 각 워커에서 Send한다 — 세션 친화도 워커와
+	// 같은 스레드라 세션별 송신 순서가 유지된다. 그 외에는 호출 스레드에서 바로 Send.
+	//
+	// 반환값: 송신 경로에 넘긴 세션 수 (분산 실행분은 큐잉 시점 기준, QueueFull 드롭은 미반영)
+	size_t Broadcast(const SharedSendBuffer &packet);
+	size_t Multicast(const std::vector<Utils::ConnectionId> &ids, const SharedSendBuffer &packet);
+
+	template <typename T> size_t Broadcast(const T &packet)
+	{
+		return Broadcast(SharedSendBuffer::Create(packet));
+	}
+
+	// 팬아웃에 쓸 디스패처 (BaseNetworkEngine이 로직 디스패처를 등록/해제).
+	// Clear는 현재 등록된 디스패처가 같을 때만 해제하고, 진행 중인 팬아웃이 끝날 때까지 기다린다.
+	void SetFanoutDispatcher(Concurrency::KeyedDispatcher *dispatcher);
+	void ClearFanoutDispatcher(Concurrency::KeyedDispatcher *dispatcher);
+
+	static constexpr size_t kFanoutInlineThreshold = 256;
+
   private:
 	SessionManager() = default;
 	~SessionManager() = default;
@@ -55,10 +85,15 @@ class SessionManager
 
 	Utils::ConnectionId GenerateSessionId();
 
+	// 스냅샷을 송신 — 인라인 또는 디스패처 워커별 분산
+	size_t Fanout(std::vector<SessionRef> &&targets, const SharedSendBuffer &packet);
+
   private:
 	std::unordered_map<Utils::ConnectionId, SessionRef> mSessions;          // 활성 세션 맵 (mMutex 보호)
 	mutable std::mutex                                  mMutex;             // mSessions 읽기·쓰기 보호
 	std::function<void(Session *)>                      mSessionConfigurator;  // CreateSession 시 1회 호출 설정 콜백
+	Concurrency::KeyedDispatcher                       *mFanoutDispatcher = nullptr; // 브로드캐스트 분산용 (mFanoutMutex 보호)
+	std::mutex                                          mFanoutMutex;       // mFanoutDispatcher 등록/해제와 분산 Dispatch 직렬화
 };
 
 } // namespace Network::Core
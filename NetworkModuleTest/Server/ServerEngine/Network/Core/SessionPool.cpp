@@ -2,6 +2,7 @@
 // 한글: SessionPool 구현
 
 #include "SessionPool.h"
+#include "../../Utils/LockProfiling.h"
 #include "../../Utils/Logger.h"
 
 namespace Network::Core
@@ -57,7 +58,7 @@ void SessionPool::Shutdown()
 
     mInitialized = false;
 
-    std::lock_guard<std::mutex> lock(mFreeListMutex);
+    NET_LOCK_GUARD(mFreeListMutex);
     mFreeList.clear();
     mSlots.reset();
     mCapacity = 0;
@@ -74,7 +75,7 @@ SessionRef SessionPool::Acquire()
 {
     size_t slotIdx = ~size_t(0);
     {
-        std::lock_guard<std::mutex> lock(mFreeListMutex);
+        NET_LOCK_GUARD(mFreeListMutex);
         if (mFreeList.empty())
             return nullptr;
 
@@ -107,7 +108,7 @@ void SessionPool::ReleaseInternal(size_t slotIdx)
     mActiveCount.fetch_sub(1, std::memory_order_relaxed);
 
     {
-        std::lock_guard<std::mutex> lock(mFreeListMutex);
+        NET_LOCK_GUARD(mFreeListMutex);
         mFreeList.push_back(slotIdx);
     }
 }
@@ -0,0 +1,175 @@
+// SharedSendBuffer 블록 풀 구현
+
+#include "SharedSendBuffer.h"
+#include "../../Utils/CpuTopology.h"
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace Network::Core
+{
+
+namespace
+{
+// 스레드 캐시 등급별 상한 — 넘치면 kTransferBatch개를 전역 풀로 보낸다
+constexpr size_t kThreadCacheMax = 64;
+// 스레드 캐시 ↔ 전역 풀 이동 단위
+constexpr size_t kTransferBatch = 32;
+// 전역 풀 등급별 보관 상한 — 넘치는 블록은 해제 (버스트 후 메모리 회수)
+constexpr size_t kGlobalPoolMax = 4096;
+// 전역 풀 개수 상한 — 더 많은 NUMA 노드는 나머지 연산으로 접는다
+constexpr size_t kMaxPoolNodes = 8;
+
+struct GlobalBlockPool
+{
+	std::mutex         mMutex;
+	std::vector<void *> mFree[SharedSendBuffer::kSizeClassCount];
+};
+
+// 의도적 누수 — 정적 소멸 이후에 풀리는 버퍼(정적 수명 핸들, 늦게 끝나는 스레드)도 안전하게 반납
+GlobalBlockPool &GlobalPool(uint8_t node)
+{
+	static GlobalBlockPool *sPools = new GlobalBlockPool[kMaxPoolNodes];
+	return sPools[node];
+}
+
+// list 끝의 count개를 node 전역 풀로 넘긴다 (락 1회, 상한 초과분은 해제)
+void ReturnToGlobal(uint8_t node, size_t sizeClass, std::vector<void *> &list, size_t count)
+{
+	GlobalBlockPool &pool = GlobalPool(node);
+	std::lock_guard<std::mutex> lock(pool.mMutex);
+	std::vector<void *> &global = pool.mFree[sizeClass];
+	for (size_t i = 0; i < count; ++i)
+	{
+		void *memory = list.back();
+		list.pop_back();
+		if (global.size() < kGlobalPoolMax)
+			global.push_back(memory);
+		else
+			::operator delete(memory);
+	}
+}
+
+// 캐시 소멸 후(스레드 종료 중 다른 thread_local 소멸자 등)에는 풀을 거치지 않는다.
+// 자명한 타입이라 소멸 순서와 무관하게 항상 읽을 수 있다.
+thread_local bool tBlockCacheDestroyed = false;
+
+// 스레드 종료 시 남은 블록을 전역 풀로 넘긴다 (상한 초과분은 해제)
+struct ThreadBlockCache
+{
+	std::vector<void *> mFree[SharedSendBuffer::kSizeClassCount];  // 모두 mNode 블록
+	// 다른 노드 블록 — 노드별로 모았다가 kTransferBatch개씩 그 노드 풀로 보낸다 (재사용하지 않음)
+	std::vector<void *> mRemote[kMaxPoolNodes][SharedSendBuffer::kSizeClassCount];
+	uint8_t mNode;  // 이 스레드의 NUMA 노드 (캐시 생성 시점 = 보통 CPU 고정 이후)
+
+	ThreadBlockCache() : mNode(static_cast<uint8_t>(Utils::CurrentNumaNode() % kMaxPoolNodes))
+	{
+		for (auto &list : mFree)
+			list.reserve(kThreadCacheMax);
+	}
+
+	~ThreadBlockCache()
+	{
+		tBlockCacheDestroyed = true;
+		for (size_t sizeClass = 0; sizeClass < SharedSendBuffer::kSizeClassCount; ++sizeClass)
+		{
+			if (!mFree[sizeClass].empty())
+				ReturnToGlobal(mNode, sizeClass, mFree[sizeClass], mFree[sizeClass].size());
+			for (size_t node = 0; node < kMaxPoolNodes; ++node)
+			{
+				std::vector<void *> &remote = mRemote[node][sizeClass];
+				if (!remote.empty())
+					ReturnToGlobal(static_cast<uint8_t>(node), sizeClass, remote, remote.size());
+			}
+		}
+	}
+};
+
+thread_local ThreadBlockCache tBlockCache;
+
+uint8_t SizeClassOf(uint32_t capacity)
+{
+	for (size_t i = 0; i < SharedSendBuffer::kSizeClassCount; ++i)
+	{
+		if (capacity <= SharedSendBuffer::kSizeClasses[i])
+			return static_cast<uint8_t>(i);
+	}
+	return 0xFF;
+}
+} // namespace
+
+SharedSendBuffer::Block *SharedSendBuffer::AcquireBlock(uint32_t capacity)
+{
+	static_assert(sizeof(Block) == 16, "Block header must keep the payload 16-byte aligned");
+
+	const uint8_t sizeClass = SizeClassOf(capacity);
+	void *memory = nullptr;
+
+	if (sizeClass == kUnpooled || tBlockCacheDestroyed)
+	{
+		memory = ::operator new(sizeof(Block) + capacity);
+		return new (memory) Block{{1}, capacity, capacity, kUnpooled, 0};
+	}
+
+	ThreadBlockCache &threadCache = tBlockCache;
+	std::vector<void *> &cache = threadCache.mFree[sizeClass];
+	if (cache.empty())
+	{
+		// 자기 노드의 전역 풀에서 묶음으로 채운다 (락 1회)
+		GlobalBlockPool &pool = GlobalPool(threadCache.mNode);
+		std::lock_guard<std::mutex> lock(pool.mMutex);
+		std::vector<void *> &global = pool.mFree[sizeClass];
+		const size_t take = global.size() < kTransferBatch ? global.size() : kTransferBatch;
+		cache.insert(cache.end(), global.end() - take, global.end());
+		global.resize(global.size() - take);
+	}
+
+	if (!cache.empty())
+	{
+		memory = cache.back();
+		cache.pop_back();
+	}
+	else
+	{
+		// 새 블록은 이 스레드가 처음 쓰므로(first-touch) 이 스레드의 노드에 놓인다
+		memory = ::operator new(sizeof(Block) + kSizeClasses[sizeClass]);
+	}
+	return new (memory) Block{{1}, capacity, kSizeClasses[sizeClass], sizeClass, threadCache.mNode};
+}
+
+void SharedSendBuffer::ReleaseBlock(Block *block)
+{
+	const uint8_t sizeClass = block->mSizeClass;
+	const uint8_t node      = block->mNode;
+	block->~Block();
+
+	if (sizeClass == kUnpooled || tBlockCacheDestroyed)
+	{
+		::operator delete(block);
+		return;
+	}
+
+	ThreadBlockCache &threadCache = tBlockCache;
+	if (node != threadCache.mNode)
+	{
+		// 다른 노드 메모리 — 스레드 캐시에 섞지 않고, 묶음이 차면 그 노드의 전역 풀로 돌려보낸다
+		// (블록마다 원격 노드 락을 잡지 않도록 할당 쪽 리필과 같은 단위)
+		std::vector<void *> &remote = threadCache.mRemote[node][sizeClass];
+		if (remote.capacity() == 0)
+			remote.reserve(kTransferBatch);
+		remote.push_back(block);
+		if (remote.size() >= kTransferBatch)
+			ReturnToGlobal(node, sizeClass, remote, remote.size());
+		return;
+	}
+
+	std::vector<void *> &cache = threadCache.mFree[sizeClass];
+	if (cache.size() >= kThreadCacheMax)
+	{
+		// 반납만 하는 스레드(I/O 완료)는 계속 넘치므로 묶음으로 전역 풀에 넘긴다
+		ReturnToGlobal(node, sizeClass, cache, kTransferBatch);
+	}
+	cache.push_back(block);
+}
+
+} // namespace Network::Core
@@ -0,0 +1,136 @@
+#pragma once
+
+// 불변 참조 카운트 송신 버퍼 — 한 번 직렬화한 패킷을 여러 세션 송신 큐가 복사 없이 공유한다.
+//
+//   auto packet = SharedSendBuffer::Create(notice);        // 복사 1회 (정상 상태 할당 0회)
+//   SessionManager::Instance().Broadcast(packet);           // 수신자당 참조 카운트 +1만
+//
+// 구조: [Block 헤더(refcount, size, capacity, class) | 페이로드] 단일 블록. 핸들 복사 = atomic 증가 1회.
+// 생성 후 내용은 바뀌지 않는다 — 여러 I/O 스레드가 동시에 같은 바이트를 송신해도 안전하다.
+// 마지막 핸들(세션 송신 큐, 송신 중인 공급자 작업 포함)이 사라질 때 해제된다.
+//
+// 블록 재사용: kSizeClasses 이하 크기는 크기 등급별 프리리스트(스레드 캐시 + 전역 풀)로 돌아간다.
+// 송신 완료 스레드(I/O)에서 반납되고 로직 스레드에서 다시 꺼내지므로, 스레드 캐시가 넘치거나
+// 비면 전역 풀과 묶음 단위로 주고받는다. 최대 등급보다 큰 버퍼는 매번 할당/해제.
+// 전역 풀은 NUMA 노드별로 나뉜다 — 블록은 할당한 스레드의 노드를 기억하고 그 노드의 풀로만
+// 돌아가므로, CPU에 고정된 스레드는 자기 노드 메모리만 다시 꺼내 쓴다 (단일 노드면 풀 1개).
+//
+// 직접 작성 (Session::ReserveSend): Allocate(capacity)로 쓰기 가능한 블록을 받아 MutableData()에
+// 쓰고 Truncate(실제 크기) 후 공유한다. MutableData/Truncate는 복사본을 만들기 전에만 호출한다.
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace Network::Core
+{
+
+class SharedSendBuffer
+{
+  public:
+	// 재사용 블록 페이로드 용량 등급 (바이트). 마지막 등급 = MAX_PACKET_TOTAL_SIZE
+	static constexpr uint32_t kSizeClasses[] = {128, 1024, 4096};
+	static constexpr size_t   kSizeClassCount = sizeof(kSizeClasses) / sizeof(kSizeClasses[0]);
+
+	SharedSendBuffer() = default;
+
+	// 페이로드를 복사해 새 버퍼를 만든다. size == 0이면 빈 핸들.
+	static SharedSendBuffer Create(const void *data, uint32_t size)
+	{
+		if (data == nullptr || size == 0)
+			return SharedSendBuffer();
+
+		SharedSendBuffer buffer = Allocate(size);
+		std::memcpy(buffer.mBlock->Payload(), data, size);
+		return buffer;
+	}
+
+	template <typename T> static SharedSendBuffer Create(const T &packet)
+	{
+		return Create(&packet, static_cast<uint32_t>(sizeof(T)));
+	}
+
+	// 초기화되지 않은 capacity 바이트 버퍼 (Size() == capacity). capacity == 0이면 빈 핸들.
+	static SharedSendBuffer Allocate(uint32_t capacity)
+	{
+		SharedSendBuffer buffer;
+		if (capacity > 0)
+			buffer.mBlock = AcquireBlock(capacity);
+		return buffer;
+	}
+
+	SharedSendBuffer(const SharedSendBuffer &other) noexcept : mBlock(other.mBlock)
+	{
+		if (mBlock)
+			mBlock->mRefCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	SharedSendBuffer(SharedSendBuffer &&other) noexcept : mBlock(std::exchange(other.mBlock, nullptr)) {}
+
+	SharedSendBuffer &operator=(const SharedSendBuffer &other) noexcept
+	{
+		SharedSendBuffer(other).Swap(*this);
+		return *this;
+	}
+
+	SharedSendBuffer &operator=(SharedSendBuffer &&other) noexcept
+	{
+		SharedSendBuffer(std::move(other)).Swap(*this);
+		return *this;
+	}
+
+	~SharedSendBuffer()
+	{
+		if (mBlock && mBlock->mRefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			ReleaseBlock(mBlock);
+	}
+
+	void Swap(SharedSendBuffer &other) noexcept { std::swap(mBlock, other.mBlock); }
+
+	const char *Data() const { return mBlock ? mBlock->Payload() : nullptr; }
+	uint32_t Size() const { return mBlock ? mBlock->mSize : 0; }
+	uint32_t Capacity() const { return mBlock ? mBlock->mCapacity : 0; }
+	bool Empty() const { return mBlock == nullptr; }
+	explicit operator bool() const { return mBlock != nullptr; }
+
+	// 작성 단계 전용 — 공유(복사) 전, 단독 소유일 때만 호출
+	// (예외: Session 배치 버퍼 — 큐잉 전까지 배치와 예약 span이 겹치지 않는 구간에만 쓴다)
+	char *MutableData() { return mBlock ? mBlock->Payload() : nullptr; }
+
+	// 작성 단계 전용 — 실제 기록한 크기로 줄인다. size > Capacity()면 false (변경 없음)
+	bool Truncate(uint32_t size)
+	{
+		if (!mBlock || size > mBlock->mCapacity)
+			return false;
+		mBlock->mSize = size;
+		return true;
+	}
+
+	// 진단/테스트용 — 동시 변경 중이면 근사값
+	uint32_t UseCount() const { return mBlock ? mBlock->mRefCount.load(std::memory_order_relaxed) : 0; }
+
+  private:
+	struct Block
+	{
+		std::atomic<uint32_t> mRefCount;
+		uint32_t              mSize;
+		uint32_t              mCapacity;
+		uint8_t               mSizeClass;  // kSizeClasses 인덱스, kUnpooled = 풀 밖 할당
+		uint8_t               mNode;       // 할당한 스레드의 NUMA 노드 (풀 노드 수로 접음)
+
+		// 페이로드는 헤더 바로 뒤 (operator new 정렬 → 헤더 16바이트 뒤도 16바이트 정렬)
+		char *Payload() { return reinterpret_cast<char *>(this + 1); }
+		const char *Payload() const { return reinterpret_cast<const char *>(this + 1); }
+	};
+
+	static constexpr uint8_t kUnpooled = 0xFF;
+
+	// SharedSendBuffer.cpp — 크기 등급 프리리스트
+	static Block *AcquireBlock(uint32_t capacity);
+	static void ReleaseBlock(Block *block);
+
+	Block *mBlock = nullptr;
+};
+
+} // namespace Network::Core
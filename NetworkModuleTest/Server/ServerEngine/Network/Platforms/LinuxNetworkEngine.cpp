@@ -3,6 +3,7 @@
 #ifdef __linux__
 
 #include "LinuxNetworkEngine.h"
+#include "../../Utils/AllocationTag.h"
 #include "../../Utils/Logger.h"
 #include "../../Platforms/Linux/EpollAsyncIOProvider.h"
 #if defined(HAVE_IO_URING) || defined(HAVE_LIBURING)
@@ -18,7 +19,7 @@ namespace Network::Platforms
 {
 
 LinuxNetworkEngine::LinuxNetworkEngine(Mode mode)
-	: mMode(mode), mListenSocket(-1), mAcceptBackoffMs(10)
+	: mMode(mode), mListenSocket(-1), mAcceptBackoffMs(10), mNextShard(0)
 {
 	Utils::Logger::Info("LinuxNetworkEngine created with mode: " +
 						std::string(mode == Mode::Epoll ? "epoll" : "io_uring"));
@@ -35,52 +36,45 @@ LinuxNetworkEngine::~LinuxNetworkEngine()
 
 bool LinuxNetworkEngine::InitializePlatform()
 {
-	// 모드에 따라 AsyncIOProvider를 생성한다.
-	// IOUring 선택 시: 빌드 시스템(CMake)이 HAVE_IO_URING 또는 HAVE_LIBURING를 정의한
-	// 경우에만 사용 가능하며, 정의되지 않았거나 런타임 초기화 실패 시 epoll로 폴백.
-	if (mMode == Mode::Epoll)
-	{
-		mProvider = std::make_shared<AsyncIO::Linux::EpollAsyncIOProvider>();
-		Utils::Logger::Info("Using epoll backend");
-	}
-	else // IOUring
+	mProvider = CreateProvider();
+	if (!mProvider)
 	{
-#if defined(HAVE_IO_URING) || defined(HAVE_LIBURING)
-		mProvider = std::make_shared<AsyncIO::Linux::IOUringAsyncIOProvider>();
-		Utils::Logger::Info("Using io_uring backend");
-#else
-		// 컴파일 타임에 io_uring 미지원 (HAVE_LIBURING 미정의) — epoll로 폴백.
-		Utils::Logger::Warn("io_uring not available (HAVE_LIBURING not defined), falling back to epoll");
-		mMode     = Mode::Epoll;
-		mProvider = std::make_shared<AsyncIO::Linux::EpollAsyncIOProvider>();
-		Utils::Logger::Info("Using epoll backend");
-#endif
+		return false;
 	}
+	Utils::Logger::Info(std::string("Using ") + (mMode == Mode::Epoll ? "epoll" : "io_uring") + " backend");
 
-	// AsyncIOProvider 초기화
-	auto error = mProvider->Initialize(
-		1024,                         // Queue depth
-		mMaxConnections > 0 ? static_cast<size_t>(mMaxConnections) : 128 // Max concurrent
-	);
-
-	if (error != AsyncIO::AsyncIOError::Success)
+	// run-to-completion: 워커 스레드마다 공급자 하나. 세션은 배정된 샤드의 스레드에서만 처리된다.
+	if (mRunToCompletion)
 	{
-		if (mMode == Mode::IOUring)
+		const uint32_t shardCount = mIoThreadCount;
+		mShards.push_back(mProvider);
+		while (mShards.size() < shardCount)
 		{
-			Utils::Logger::Warn("io_uring init failed (" +
-								std::string(mProvider->GetLastError()) +
-								"), falling back to epoll");
-			mProvider = std::make_shared<AsyncIO::Linux::EpollAsyncIOProvider>();
-			mMode     = Mode::Epoll;
-			error     = mProvider->Initialize(
-				1024,
-				mMaxConnections > 0 ? static_cast<size_t>(mMaxConnections) : 128);
+			auto shard = CreateProvider();
+			if (!shard)
+			{
+				mShards.clear();
+				return false;
+			}
+			mShards.push_back(std::move(shard));
 		}
-		if (error != AsyncIO::AsyncIOError::Success)
+		Utils::Logger::Info("Run-to-completion: " + std::to_string(shardCount) + " I/O shards");
+
+		// 고정된 샤드는 CPU → 샤드 표를 만들어 accept 시 SO_INCOMING_CPU로 찾는다
+		if (!mIoCpus.empty())
 		{
-			Utils::Logger::Error("Failed to initialize AsyncIOProvider: " +
-								 std::string(mProvider->GetLastError()));
-			return false;
+			for (size_t shard = 0; shard < mShards.size(); ++shard)
+			{
+				const int cpu = mIoCpus[shard % mIoCpus.size()];
+				if (cpu >= static_cast<int>(mCpuShard.size()))
+				{
+					mCpuShard.resize(static_cast<size_t>(cpu) + 1, -1);
+				}
+				if (mCpuShard[cpu] < 0)
+				{
+					mCpuShard[cpu] = static_cast<int>(shard);
+				}
+			}
 		}
 	}
 
@@ -102,7 +96,18 @@ void LinuxNetworkEngine::ShutdownPlatform()
 		mListenSocket = -1;
 	}
 
-	// AsyncIOProvider 종료
+	// AsyncIOProvider 종료 (샤드 0 = mProvider는 아래에서)
+	for (auto &shard : mShards)
+	{
+		if (shard != mProvider)
+		{
+			shard->Shutdown();
+		}
+	}
+	mShards.clear();
+	mCpuShard.clear();
+	mNextShard = 0;
+
 	if (mProvider)
 	{
 		mProvider->Shutdown();
@@ -113,16 +118,12 @@ void LinuxNetworkEngine::ShutdownPlatform()
 
 bool LinuxNetworkEngine::StartPlatformIO()
 {
-	// 완료 처리 워커 스레드 시작 (hardware_concurrency개)
-	uint32_t workerCount = std::thread::hardware_concurrency();
-	if (workerCount == 0)
-	{
-		workerCount = 4;
-	}
+	// 완료 처리 워커 스레드 시작 (mIoThreadCount개, 샤드 모드에선 샤드당 1개)
+	const uint32_t workerCount = mShards.empty() ? mIoThreadCount : static_cast<uint32_t>(mShards.size());
 
 	for (uint32_t i = 0; i < workerCount; ++i)
 	{
-		mWorkerThreads.emplace_back([this]() { this->WorkerThread(); });
+		mWorkerThreads.emplace_back([this, i]() { this->WorkerThread(i); });
 	}
 
 	// accept 전담 스레드 시작
@@ -227,8 +228,11 @@ void LinuxNetworkEngine::AcceptLoop()
 			continue;
 		}
 
+		// 세션을 처리할 공급자 — run-to-completion 모드는 샤드 배정
+		const auto &provider = mShards.empty() ? mProvider : mShards[SelectShard(clientSocket)];
+
 		// 클라이언트 소켓을 비동기 I/O 프로바이더(epoll/io_uring)에 등록
-		auto assocResult = mProvider->AssociateSocket(
+		auto assocResult = provider->AssociateSocket(
 			clientSocket,
 			static_cast<AsyncIO::RequestContext>(session->GetId()));
 		if (assocResult != AsyncIO::AsyncIOError::Success)
@@ -236,7 +240,7 @@ void LinuxNetworkEngine::AcceptLoop()
 			Utils::Logger::Error(
 				"Failed to associate socket with async I/O - Session " +
 				std::to_string(session->GetId()) + ": " +
-				std::string(mProvider->GetLastError()));
+				std::string(provider->GetLastError()));
 			Core::SessionManager::Instance().RemoveSession(session);
 			// Session이 소켓을 소유하므로 RemoveSession → pool deleter가 Close()를 호출한다.
 			// 여기서 close(clientSocket)를 직접 호출하면 이중 닫기 / fd 재사용 경합이 발생한다.
@@ -244,14 +248,17 @@ void LinuxNetworkEngine::AcceptLoop()
 		}
 
 		// 세션에 async 프로바이더를 연결하여 EPOLLOUT 경유 송신 큐잉을 활성화
-		session->SetAsyncProvider(mProvider);
+		session->SetAsyncProvider(provider);
+		session->SetLogicDispatcher(&mLogicDispatcher);
+		session->SetRecvEngine(this);
 
 		// 연결 수 통계 업데이트 (memory_order_relaxed)
-		mTotalConnections.fetch_add(1, std::memory_order_relaxed);
+		mTotalConnections.Add();
 
-		// KeyedDispatcher를 통해 Connected 이벤트를 로직 스레드에 비동기 디스패치
+		// Connected 이벤트 — KeyedDispatcher로 로직 스레드에 비동기 디스패치
+		// (run-to-completion 세션은 recv 등록 전에 여기서 바로 실행)
 		auto sessionCopy = session;
-		mLogicDispatcher.Dispatch(sessionCopy->GetId(),
+		RunSessionTask(session,
 			[this, sessionCopy]()
 			{
 				sessionCopy->OnConnected();
@@ -259,14 +266,14 @@ void LinuxNetworkEngine::AcceptLoop()
 			});
 
 	// 세션의 recv 작업 등록 시작
-	if (!QueueRecv(session))
+	if (!QueueRecv(*provider, session))
 	{
 		Utils::Logger::Error("Failed to queue recv - Session " +
 							 std::to_string(session->GetId()));
 
 		// Connected가 이미 dispatch됐으므로 세션 제거 전에 Disconnected를 dispatch하여 쌍을 맞춘다.
 		auto disconnSession = session;
-		mLogicDispatcher.Dispatch(disconnSession->GetId(),
+		mLogicDispatcher.Dispatch(disconnSession->GetId(), Network::Concurrency::TaskPriority::Control,
 			[this, disconnSession]()
 			{
 				FireEvent(Core::NetworkEvent::Disconnected, disconnSession->GetId());
@@ -289,16 +296,45 @@ void LinuxNetworkEngine::AcceptLoop()
 }
 
 void LinuxNetworkEngine::ProcessCompletions()
+{
+	ProcessCompletions(*mProvider);
+}
+
+void LinuxNetworkEngine::GetProviderStats(AsyncIO::ProviderStats &out) const
+{
+	if (mShards.empty())
+	{
+		mProvider->GetStats(out);
+		return;
+	}
+
+	// 샤드 합산 (요약 필드는 합친 분포로 다시 계산). 샤드 버퍼 1개를 재사용한다.
+	mShards[0]->GetStats(out);
+	AsyncIO::ProviderStats stats;
+	for (size_t i = 1; i < mShards.size(); ++i)
+	{
+		mShards[i]->GetStats(stats);
+		out.mTotalRequests    += stats.mTotalRequests;
+		out.mTotalCompletions += stats.mTotalCompletions;
+		out.mPendingRequests  += stats.mPendingRequests;
+		out.mErrorCount       += stats.mErrorCount;
+		out.mSendLatency.Merge(stats.mSendLatency);
+		out.mRecvLatency.Merge(stats.mRecvLatency);
+	}
+	AsyncIO::FillLatencySummary(out);
+}
+
+void LinuxNetworkEngine::ProcessCompletions(AsyncIO::AsyncIOProvider &provider)
 {
 	// AsyncIOProvider로부터 I/O 완료 이벤트를 수집하여 처리
 	AsyncIO::CompletionEntry entries[64];
-	int count = mProvider->ProcessCompletions(entries, 64, 100);
+	int count = provider.ProcessCompletions(entries, 64, 100);
 
 	if (count < 0)
 	{
 		// ProcessCompletions 자체 에러
 		Utils::Logger::Error("ProcessCompletions failed: " +
-							 std::string(mProvider->GetLastError()));
+							 std::string(provider.GetLastError()));
 		return;
 	}
 
@@ -312,6 +348,13 @@ void LinuxNetworkEngine::ProcessCompletions()
 	{
 		auto &entry = entries[i];
 
+		// 아웃바운드 connect 완료 — context가 세션 ID가 아닌 커넥터 태그이므로 세션 조회 전에 분기
+		if (entry.mType == AsyncIO::AsyncIOType::Connect)
+		{
+			ProcessConnectCompletion(entry);
+			continue;
+		}
+
 		// 완료 엔트리의 context(= ConnectionId)로 세션을 조회
 		Utils::ConnectionId connId = static_cast<Utils::ConnectionId>(entry.mContext);
 		auto session = Core::SessionManager::Instance().GetSession(connId);
@@ -338,14 +381,16 @@ void LinuxNetworkEngine::ProcessCompletions()
 		{
 		case AsyncIO::AsyncIOType::Recv:
 		{
-			// 세션의 recv 버퍼에서 수신 데이터를 가져온다
+			// 세션의 recv 버퍼에서 수신 데이터를 가져온다 (완료→디스패치 지연은 넘기기 직전에 기록)
 			const char *recvBuffer = session->GetRecvBuffer();
+			provider.RecordRecvDispatch(entry.mCompletionTime);
 			ProcessRecvCompletion(session, entry.mResult, recvBuffer);
 
 			// 가드: 세션이 여전히 연결 상태일 때만 recv 재등록.
+			// 일시 중지된 세션(PauseRecv)은 보관만 하고 마지막 ResumeRecv가 재등록한다.
 			// 다른 워커의 송신 에러가 이미 Close()를 호출하여 소켓이 닫혔을 수 있으며,
 			// 닫힌 fd에 QueueRecv를 호출하면 재사용된 fd에 epoll/io_uring이 등록될 위험이 있다.
-			if (session->IsConnected() && !QueueRecv(session))
+			if (session->IsConnected() && !session->ParkRecvIfPaused() && !QueueRecv(provider, session))
 			{
 				ProcessErrorCompletion(session, AsyncIO::AsyncIOType::Recv, 0);
 			}
@@ -364,27 +409,33 @@ void LinuxNetworkEngine::ProcessCompletions()
 	}
 }
 
-void LinuxNetworkEngine::WorkerThread()
+void LinuxNetworkEngine::WorkerThread(size_t shardIndex)
 {
+	// 이 스레드에서 태그 없이 일어나는 할당(완료 수집, recv 재등록)은 Io로 집계
+	Utils::AllocTagScope allocTag(Utils::AllocTag::Io);
 	Utils::Logger::Debug("Worker thread started");
+	PinIoThread(shardIndex);
+
+	// 일반 모드는 모든 워커가 공유 공급자를, 샤드 모드는 자기 샤드만 폴링한다
+	AsyncIO::AsyncIOProvider &provider = mShards.empty() ? *mProvider : *mShards[shardIndex];
 
 	while (mRunning)
 	{
 		// 완료 처리 루프
-		ProcessCompletions();
+		ProcessCompletions(provider);
 	}
 
 	Utils::Logger::Debug("Worker thread stopped");
 }
 
-bool LinuxNetworkEngine::QueueRecv(const Core::SessionRef &session)
+bool LinuxNetworkEngine::QueueRecv(AsyncIO::AsyncIOProvider &provider, const Core::SessionRef &session)
 {
-	if (!session || !mProvider)
+	if (!session)
 	{
 		return false;
 	}
 
-	auto error = mProvider->RecvAsync(
+	auto error = provider.RecvAsync(
 		session->GetSocket(),
 		session->GetRecvBuffer(),
 		session->GetRecvBufferSize(),
@@ -392,7 +443,7 @@ bool LinuxNetworkEngine::QueueRecv(const Core::SessionRef &session)
 
 	if (error != AsyncIO::AsyncIOError::Success)
 	{
-		Utils::Logger::Error("RecvAsync failed: " + std::string(mProvider->GetLastError()));
+		Utils::Logger::Error("RecvAsync failed: " + std::string(provider.GetLastError()));
 		return false;
 	}
 
@@ -403,6 +454,79 @@ bool LinuxNetworkEngine::QueueRecv(const Core::SessionRef &session)
 // Private 헬퍼 메서드
 // =============================================================================
 
+size_t LinuxNetworkEngine::SelectShard(int clientSocket)
+{
+	// 연결의 RX 큐를 처리한 CPU(SO_INCOMING_CPU)에 고정된 샤드가 있으면 그 샤드로 —
+	// 소프트IRQ, 완료 처리, 핸들러가 같은 코어(캐시)에 머문다. 없으면 라운드로빈.
+#ifdef SO_INCOMING_CPU
+	if (!mCpuShard.empty())
+	{
+		int cpu = -1;
+		socklen_t length = sizeof(cpu);
+		if (getsockopt(clientSocket, SOL_SOCKET, SO_INCOMING_CPU, &cpu, &length) == 0 &&
+			cpu >= 0 && cpu < static_cast<int>(mCpuShard.size()) && mCpuShard[cpu] >= 0)
+		{
+			return static_cast<size_t>(mCpuShard[cpu]);
+		}
+	}
+#else
+	(void)clientSocket;
+#endif
+	return mNextShard++ % mShards.size();
+}
+
+std::shared_ptr<AsyncIO::AsyncIOProvider> LinuxNetworkEngine::CreateProvider()
+{
+	// 모드에 따라 AsyncIOProvider를 생성한다.
+	// IOUring 선택 시: 빌드 시스템(CMake)이 HAVE_IO_URING 또는 HAVE_LIBURING를 정의한
+	// 경우에만 사용 가능하며, 정의되지 않았거나 런타임 초기화 실패 시 epoll로 폴백.
+	std::shared_ptr<AsyncIO::AsyncIOProvider> provider;
+	if (mMode == Mode::Epoll)
+	{
+		provider = std::make_shared<AsyncIO::Linux::EpollAsyncIOProvider>();
+	}
+	else // IOUring
+	{
+#if defined(HAVE_IO_URING) || defined(HAVE_LIBURING)
+		provider = std::make_shared<AsyncIO::Linux::IOUringAsyncIOProvider>();
+#else
+		// 컴파일 타임에 io_uring 미지원 (HAVE_LIBURING 미정의) — epoll로 폴백.
+		Utils::Logger::Warn("io_uring not available (HAVE_LIBURING not defined), falling back to epoll");
+		mMode    = Mode::Epoll;
+		provider = std::make_shared<AsyncIO::Linux::EpollAsyncIOProvider>();
+#endif
+	}
+
+	// AsyncIOProvider 초기화
+	auto error = provider->Initialize(
+		1024,                         // Queue depth
+		mMaxConnections > 0 ? static_cast<size_t>(mMaxConnections) : 128 // Max concurrent
+	);
+
+	if (error != AsyncIO::AsyncIOError::Success)
+	{
+		if (mMode == Mode::IOUring)
+		{
+			Utils::Logger::Warn("io_uring init failed (" +
+								std::string(provider->GetLastError()) +
+								"), falling back to epoll");
+			provider = std::make_shared<AsyncIO::Linux::EpollAsyncIOProvider>();
+			mMode    = Mode::Epoll;
+			error    = provider->Initialize(
+				1024,
+				mMaxConnections > 0 ? static_cast<size_t>(mMaxConnections) : 128);
+		}
+		if (error != AsyncIO::AsyncIOError::Success)
+		{
+			Utils::Logger::Error("Failed to initialize AsyncIOProvider: " +
+								 std::string(provider->GetLastError()));
+			return nullptr;
+		}
+	}
+
+	return provider;
+}
+
 bool LinuxNetworkEngine::CreateListenSocket()
 {
 	// 논블로킹 TCP 소켓 생성 (SOCK_NONBLOCK 플래그로 한 번에 논블로킹 설정)
@@ -13,10 +13,17 @@
 // 선택 기준:
 //   - 커널 5.1 미만이거나 liburing 미설치 환경  → Epoll
 //   - 커널 5.1 이상 + liburing 설치 + 고처리량 요구 → IOUring
+//
+// run-to-completion 모드 (NetworkConfig::RunToCompletion):
+//   워커 스레드마다 공급자(epoll fd / io_uring 링)를 하나씩 만들고, accept한 세션을
+//   한 샤드에 배정한다 — I/O 스레드가 CPU에 고정돼 있으면 SO_INCOMING_CPU가 가리키는
+//   CPU의 샤드, 아니면 라운드로빈. 세션의 recv/send 완료와 인라인 핸들러는 모두
+//   그 샤드의 워커 스레드 하나에서만 실행된다. 샤드 0은 mProvider (커넥터/리스너 세션).
 
 #ifdef __linux__
 
 #include "../Core/BaseNetworkEngine.h"
+#include <memory>
 #include <thread>
 #include <vector>
 
@@ -46,16 +53,26 @@ class LinuxNetworkEngine : public Core::BaseNetworkEngine
 	void StopPlatformIO() override;
 	void AcceptLoop() override;
 	void ProcessCompletions() override;
+	void GetProviderStats(AsyncIO::ProviderStats &out) const override;
 
   private:
+	// mMode의 공급자를 생성해 초기화 (IOUring 실패 시 Epoll로 폴백). 실패 시 nullptr.
+	std::shared_ptr<AsyncIO::AsyncIOProvider> CreateProvider();
+
 	// listen 소켓 생성 및 바인드
 	bool CreateListenSocket();
 
-	// 세션에 recv 작업 등록 (epoll EPOLLIN 또는 io_uring RecvAsync)
-	bool QueueRecv(const Core::SessionRef &session);
+	// accept한 소켓을 배정할 샤드 (run-to-completion 모드 전용, accept 스레드에서 호출)
+	size_t SelectShard(int clientSocket);
+
+	// 세션에 recv 작업 등록 (epoll EPOLLIN 또는 io_uring RecvAsync) — 세션이 배정된 공급자로
+	bool QueueRecv(AsyncIO::AsyncIOProvider &provider, const Core::SessionRef &session);
 
-	// 완료 처리 루프 (WorkerThread 내부에서 반복 호출)
-	void WorkerThread();
+	// 공급자 하나의 완료를 수집해 처리 (WorkerThread 내부에서 반복 호출)
+	void ProcessCompletions(AsyncIO::AsyncIOProvider &provider);
+
+	// 완료 처리 루프. shardIndex = run-to-completion 모드에서 이 스레드가 맡는 샤드
+	void WorkerThread(size_t shardIndex);
 
   private:
 	// ─────────────────────────────────────────────
@@ -68,11 +85,17 @@ class LinuxNetworkEngine : public Core::BaseNetworkEngine
 	// static 변수 대신 멤버 변수로 유지하여 재진입/복수 인스턴스 버그를 방지한다.
 	int mAcceptBackoffMs; // 초기값 10ms, 오류 지속 시 최대 1000ms까지 2배씩 증가
 
+	// run-to-completion 모드의 워커별 공급자. mShards[0] == mProvider. 일반 모드에서는 비어 있다.
+	// InitializePlatform에서 만들고 ShutdownPlatform에서 비운다 (그 사이 읽기 전용).
+	std::vector<std::shared_ptr<AsyncIO::AsyncIOProvider>> mShards;
+	std::vector<int> mCpuShard; // CPU 번호 → 그 CPU에 고정된 샤드 (-1 = 없음). I/O 스레드 고정 시에만
+	size_t mNextShard; // 다음 accept 세션을 배정할 샤드 (accept 스레드 전용)
+
 	// ─────────────────────────────────────────────
 	// 스레드
 	// ─────────────────────────────────────────────
 	std::thread              mAcceptThread;  // 단일 accept 전담 스레드
-	std::vector<std::thread> mWorkerThreads; // 완료 처리 워커 (hardware_concurrency개)
+	std::vector<std::thread> mWorkerThreads; // 완료 처리 워커 (hardware_concurrency개, 샤드 모드에선 샤드당 1개)
 };
 
 } // namespace Network::Platforms
@@ -7,6 +7,7 @@
 #include "WindowsNetworkEngine.h"
 #include "../../Platforms/Windows/IocpAsyncIOProvider.h"
 #include "../../Platforms/Windows/RIOAsyncIOProvider.h"
+#include "../../Utils/AllocationTag.h"
 #include "../../Utils/Logger.h"
 #include "../Core/SendBufferPool.h"
 #include <algorithm>
@@ -98,15 +99,16 @@ void WindowsNetworkEngine::ShutdownPlatform()
 
 bool WindowsNetworkEngine::StartPlatformIO()
 {
-	uint32_t workerCount = std::thread::hardware_concurrency();
-	if (workerCount == 0)
-	{
-		workerCount = 4;
-	}
+	// 완료 처리 워커 스레드 시작 (WorkerThreadCount개, 0이면 CPU 수 - 로직 워커 수). IoCpuSet이 있으면 고정
+	const uint32_t workerCount = mIoThreadCount;
 
 	for (uint32_t i = 0; i < workerCount; ++i)
 	{
-		mWorkerThreads.emplace_back([this]() { this->WorkerThread(); });
+		mWorkerThreads.emplace_back([this, i]()
+		{
+			PinIoThread(i);
+			this->WorkerThread();
+		});
 	}
 
 	mAcceptThread = std::thread([this]() { this->AcceptLoop(); });
@@ -196,46 +198,31 @@ void WindowsNetworkEngine::AcceptLoop()
 		{
 			session->SetAsyncProvider(mProvider);
 		}
+		session->SetLogicDispatcher(&mLogicDispatcher);
+		session->SetRecvEngine(this);
 
-		mTotalConnections.fetch_add(1, std::memory_order_relaxed);
+		mTotalConnections.Add();
 
+		// run-to-completion 세션은 recv 등록 전에 바로 실행
 		auto sessionCopy = session;
-		mLogicDispatcher.Dispatch(sessionCopy->GetId(),
+		RunSessionTask(session,
 			[this, sessionCopy]()
 			{
 				sessionCopy->OnConnected();
 				FireEvent(Core::NetworkEvent::Connected, sessionCopy->GetId());
 			});
 
-		bool recvQueued = false;
-		if (mMode == Mode::RIO)
-		{
-			auto recvResult = mProvider->RecvAsync(
-				clientSocket, session->GetRecvBuffer(),
-				session->GetRecvBufferSize(),
-				static_cast<AsyncIO::RequestContext>(session->GetId()));
-			recvQueued = (recvResult == AsyncIO::AsyncIOError::Success);
-			if (recvQueued)
-			{
-				mProvider->FlushRequests();
-			}
-		}
-		else
-		{
-			recvQueued = session->PostRecv();
-		}
-
-		if (!recvQueued)
+		if (!RearmRecv(session))
 		{
 			Utils::Logger::Error("Failed to queue recv - Session " +
 				std::to_string(session->GetId()) + ": " +
 				std::string(mProvider->GetLastError()));
 
 			// 이미 로직 디스패처 큐에 있는 Connected 이벤트에 대응하는 Disconnected 디스패치.
-			// 동일 키(sessionId)를 사용하므로 KeyedDispatcher의 FIFO 보장에 의해
+			// 동일 키(sessionId)·동일 레인(Control)을 사용하므로 KeyedDispatcher의 FIFO 보장에 의해
 			// Connected가 먼저 실행된다. 세션 shared_ptr이 람다 완료까지 객체를 유지한다.
 			auto disconnSession = session;
-			mLogicDispatcher.Dispatch(disconnSession->GetId(),
+			mLogicDispatcher.Dispatch(disconnSession->GetId(), Network::Concurrency::TaskPriority::Control,
 				[this, disconnSession]()
 				{
 					FireEvent(Core::NetworkEvent::Disconnected, disconnSession->GetId());
@@ -256,6 +243,53 @@ void WindowsNetworkEngine::AcceptLoop()
 	Utils::Logger::Info("Accept thread stopped");
 }
 
+bool WindowsNetworkEngine::AttachListenerSession(const Core::SessionRef &session)
+{
+	const auto context = static_cast<AsyncIO::RequestContext>(session->GetId());
+	if (mProvider->AssociateSocket(session->GetSocket(), context) !=
+		AsyncIO::AsyncIOError::Success)
+	{
+		Utils::Logger::Error("Listener - AssociateSocket failed, Session {}: {}",
+		                     session->GetId(), mProvider->GetLastError());
+		return false;
+	}
+
+	if (mMode == Mode::IOCP)
+	{
+		return session->PostRecv();
+	}
+
+	session->SetAsyncProvider(mProvider);
+	if (mProvider->RecvAsync(session->GetSocket(), session->GetRecvBuffer(),
+	                         session->GetRecvBufferSize(), context) !=
+		AsyncIO::AsyncIOError::Success)
+	{
+		Utils::Logger::Error("Listener - RecvAsync failed, Session {}: {}",
+		                     session->GetId(), mProvider->GetLastError());
+		return false;
+	}
+	mProvider->FlushRequests();
+	return true;
+}
+
+bool WindowsNetworkEngine::RearmRecv(const Core::SessionRef &session)
+{
+	if (mMode == Mode::IOCP)
+	{
+		return session->PostRecv();
+	}
+
+	if (mProvider->RecvAsync(session->GetSocket(), session->GetRecvBuffer(),
+	                         session->GetRecvBufferSize(),
+	                         static_cast<AsyncIO::RequestContext>(session->GetId())) !=
+		AsyncIO::AsyncIOError::Success)
+	{
+		return false;
+	}
+	mProvider->FlushRequests();
+	return true;
+}
+
 void WindowsNetworkEngine::ProcessCompletions()
 {
 	AsyncIO::CompletionEntry entries[64];
@@ -302,25 +336,13 @@ void WindowsNetworkEngine::ProcessCompletions()
 				: session->GetRecvContext().buffer;
 			ProcessRecvCompletion(session, entry.mResult, recvBuffer);
 
-			bool recvQueued = false;
-			if (mMode == Mode::RIO)
+			// 일시 중지된 세션은 재등록하지 않는다 — 마지막 ResumeRecv가 RearmRecv로 재등록
+			if (session->ParkRecvIfPaused())
 			{
-				auto recvResult = mProvider->RecvAsync(
-					session->GetSocket(), session->GetRecvBuffer(),
-					session->GetRecvBufferSize(),
-					static_cast<AsyncIO::RequestContext>(session->GetId()));
-				recvQueued = (recvResult == AsyncIO::AsyncIOError::Success);
-				if (recvQueued)
-				{
-					mProvider->FlushRequests();
-				}
-			}
-			else
-			{
-				recvQueued = session->PostRecv();
+				break;
 			}
 
-			if (!recvQueued)
+			if (!RearmRecv(session))
 			{
 				Utils::Logger::Error(
 					"Failed to queue next recv - Session " +
@@ -356,6 +378,8 @@ void WindowsNetworkEngine::ProcessCompletions()
 
 void WindowsNetworkEngine::WorkerThread()
 {
+	// 이 스레드에서 태그 없이 일어나는 할당(완료 수집, recv 재등록)은 Io로 집계
+	Utils::AllocTagScope allocTag(Utils::AllocTag::Io);
 	Utils::Logger::Debug("Worker thread started");
 	while (mRunning)
 	{
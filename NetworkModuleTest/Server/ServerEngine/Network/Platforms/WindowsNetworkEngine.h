@@ -48,6 +48,10 @@ class WindowsNetworkEngine : public Core::BaseNetworkEngine
 	void StopPlatformIO() override;
 	void AcceptLoop() override;
 	void ProcessCompletions() override;
+	// 리스너 세션 등록 — IOCP 모드는 PostRecv, RIO 모드는 공급자 RecvAsync + Flush
+	bool AttachListenerSession(const Core::SessionRef &session) override;
+	// recv 재등록 (수락 직후·완료 후·ResumeRecv) — IOCP 모드는 PostRecv, RIO 모드는 공급자 RecvAsync + Flush
+	bool RearmRecv(const Core::SessionRef &session) override;
 
   private:
 	// WSAStartup(2.2) 호출 및 Winsock 초기화
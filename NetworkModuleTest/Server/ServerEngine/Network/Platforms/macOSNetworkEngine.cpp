@@ -3,6 +3,7 @@
 #ifdef __APPLE__
 
 #include "macOSNetworkEngine.h"
+#include "../../Utils/AllocationTag.h"
 #include "../../Utils/Logger.h"
 #include "../../Platforms/macOS/KqueueAsyncIOProvider.h"
 #include <sys/socket.h>
@@ -77,16 +78,17 @@ void macOSNetworkEngine::ShutdownPlatform()
 
 bool macOSNetworkEngine::StartPlatformIO()
 {
-	// 완료 처리 워커 스레드 시작 (hardware_concurrency개)
-	uint32_t workerCount = std::thread::hardware_concurrency();
-	if (workerCount == 0)
-	{
-		workerCount = 4;
-	}
+	// 완료 처리 워커 스레드 시작 (WorkerThreadCount개, 0이면 CPU 수 - 로직 워커 수).
+	// macOS는 스레드 고정 API가 없어 IoCpuSet을 지정하면 경고만 남는다.
+	const uint32_t workerCount = mIoThreadCount;
 
 	for (uint32_t i = 0; i < workerCount; ++i)
 	{
-		mWorkerThreads.emplace_back([this]() { this->WorkerThread(); });
+		mWorkerThreads.emplace_back([this, i]()
+		{
+			PinIoThread(i);
+			this->WorkerThread();
+		});
 	}
 
 	// accept 전담 스레드 시작
@@ -225,15 +227,17 @@ void macOSNetworkEngine::AcceptLoop()
 
 		// 세션에 async 프로바이더를 연결하여 EVFILT_WRITE 경유 송신 큐잉을 활성화
 		session->SetAsyncProvider(mProvider);
+		session->SetLogicDispatcher(&mLogicDispatcher);
+		session->SetRecvEngine(this);
 
 		// 연결 수 통계 업데이트 (memory_order_relaxed)
-		mTotalConnections.fetch_add(1, std::memory_order_relaxed);
+		mTotalConnections.Add();
 
 		// KeyedDispatcher를 통해 Connected 이벤트를 로직 스레드에 비동기 디스패치.
 		// sessionId를 키로 사용하면 Connected 및 이후 모든 이벤트가 동일 워커로 라우팅된다
-		// (LinuxNetworkEngine과 동일한 패턴).
+		// (LinuxNetworkEngine과 동일한 패턴). run-to-completion 세션은 recv 등록 전에 바로 실행.
 		auto sessionCopy = session;
-		mLogicDispatcher.Dispatch(sessionCopy->GetId(),
+		RunSessionTask(session,
 			[this, sessionCopy]()
 			{
 				sessionCopy->OnConnected();
@@ -248,7 +252,7 @@ void macOSNetworkEngine::AcceptLoop()
 
 			// Connected가 이미 dispatch됐으므로 세션 제거 전에 Disconnected를 dispatch하여 쌍을 맞춘다.
 			auto disconnSession = session;
-			mLogicDispatcher.Dispatch(disconnSession->GetId(),
+			mLogicDispatcher.Dispatch(disconnSession->GetId(), Network::Concurrency::TaskPriority::Control,
 				[this, disconnSession]()
 				{
 					FireEvent(Core::NetworkEvent::Disconnected, disconnSession->GetId());
@@ -325,9 +329,10 @@ void macOSNetworkEngine::ProcessCompletions()
 			ProcessRecvCompletion(session, entry.mResult, recvBuffer);
 
 			// 가드: 세션이 여전히 연결 상태일 때만 recv 재등록.
+			// 일시 중지된 세션(PauseRecv)은 보관만 하고 마지막 ResumeRecv가 재등록한다.
 			// 다른 워커의 송신 에러가 이미 Close()를 호출하여 소켓이 닫혔을 수 있으며,
 			// 닫힌 fd에 QueueRecv를 호출하면 재사용된 fd에 kqueue가 등록될 위험이 있다.
-			if (session->IsConnected() && !QueueRecv(session))
+			if (session->IsConnected() && !session->ParkRecvIfPaused() && !QueueRecv(session))
 			{
 				ProcessErrorCompletion(session, AsyncIO::AsyncIOType::Recv, 0);
 			}
@@ -348,6 +353,8 @@ void macOSNetworkEngine::ProcessCompletions()
 
 void macOSNetworkEngine::WorkerThread()
 {
+	// 이 스레드에서 태그 없이 일어나는 할당(완료 수집, recv 재등록)은 Io로 집계
+	Utils::AllocTagScope allocTag(Utils::AllocTag::Io);
 	Utils::Logger::Debug("Worker thread started");
 
 	while (mRunning)
@@ -4,7 +4,9 @@
 #ifdef __linux__
 
 #include "EpollAsyncIOProvider.h"
+#include "Utils/LockProfiling.h"
 #include "Utils/Logger.h"
+#include "Utils/Timer.h"
 #include "Network/Core/PlatformDetect.h"
 #include <cstdlib>
 #include <cstring>
@@ -12,6 +14,7 @@
 #include <limits>
 #include <unistd.h>
 #include <errno.h>
+#include <sys/socket.h>
 
 namespace Network
 {
@@ -95,7 +98,7 @@ void EpollAsyncIOProvider::Shutdown()
 	        std::memory_order_acq_rel, std::memory_order_acquire))
 		return;
 
-	std::lock_guard<std::mutex> lock(mMutex);
+	NET_LOCK_GUARD(mMutex);
 
 	// English: Close epoll file descriptor
 	// 한글: epoll 파일 디스크립터 닫기
@@ -107,6 +110,8 @@ void EpollAsyncIOProvider::Shutdown()
 
 	mPendingRecvOps.clear();
 	mPendingSendOps.clear();
+	mPendingConnectOps.clear();
+	mPendingConnectCount.store(0, std::memory_order_release);
 }
 
 bool EpollAsyncIOProvider::IsInitialized() const
@@ -119,6 +124,14 @@ bool EpollAsyncIOProvider::IsInitialized() const
 // 한글: 소켓 연결
 // =============================================================================
 
+void EpollAsyncIOProvider::DropStaleOpsLocked(SocketHandle socket)
+{
+	if (mPendingRecvOps.erase(socket) > 0)
+		mStats.mPendingRequests--;
+	if (mPendingSendOps.erase(socket) > 0)
+		mStats.mPendingRequests--;
+}
+
 AsyncIOError EpollAsyncIOProvider::AssociateSocket(SocketHandle socket,
 												   RequestContext context)
 {
@@ -136,6 +149,16 @@ AsyncIOError EpollAsyncIOProvider::AssociateSocket(SocketHandle socket,
 	ev.events = EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLRDHUP | EPOLLONESHOT;
 	ev.data.fd = socket;
 
+	// English: A new socket can reuse the fd number of a socket that was closed with a recv
+	//          still pending (server-side close). Drop those stale ops first, or the first
+	//          EPOLLIN would be read into the old session's buffer and lost.
+	// 한글: 새 소켓은 recv가 대기 중인 채 닫힌 소켓(서버 측 종료)의 fd 번호를 재사용할 수 있다.
+	//       남은 작업을 먼저 버리지 않으면 첫 EPOLLIN이 이전 세션 버퍼로 읽혀 유실된다.
+	{
+		NET_LOCK_GUARD(mMutex);
+		DropStaleOpsLocked(socket);
+	}
+
 	if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, socket, &ev) < 0)
 	{
 		mLastError = "epoll_ctl EPOLL_CTL_ADD failed";
@@ -146,6 +169,65 @@ AsyncIOError EpollAsyncIOProvider::AssociateSocket(SocketHandle socket,
 	return AsyncIOError::Success;
 }
 
+AsyncIOError EpollAsyncIOProvider::ConnectAsync(SocketHandle socket,
+												const struct sockaddr *address,
+												size_t addressLength,
+												RequestContext context)
+{
+	if (!mInitialized.load(std::memory_order_acquire))
+		return AsyncIOError::NotInitialized;
+	if (socket < 0 || !address || addressLength == 0 ||
+		addressLength > sizeof(sockaddr_storage))
+		return AsyncIOError::InvalidParameter;
+
+	// English: Non-blocking connect. EINPROGRESS is the normal path; an immediate 0
+	//          (loopback) is handled the same way since EPOLLOUT fires right away.
+	//          Any other errno is returned synchronously — errno is left intact
+	//          for the caller (e.g. ECONNREFUSED backoff decisions).
+	// 한글: 논블로킹 connect. EINPROGRESS가 정상 경로이며, 즉시 0(루프백)이어도
+	//       EPOLLOUT이 곧바로 발화하므로 동일하게 처리한다.
+	//       그 외 errno는 동기 실패로 반환 — 호출자가 errno를 그대로 참조할 수 있다.
+	if (::connect(socket, address, static_cast<socklen_t>(addressLength)) < 0 &&
+		errno != EINPROGRESS)
+	{
+		const int savedErrno = errno;
+		mLastError = "connect failed: " + std::string(strerror(savedErrno));
+		errno = savedErrno;
+		return AsyncIOError::OperationFailed;
+	}
+
+	NET_LOCK_GUARD(mMutex);
+	DropStaleOpsLocked(socket);  // English: fd reuse — see AssociateSocket / 한글: fd 재사용 — AssociateSocket 참고
+
+	// English: Insert before arming (same ordering rule as RecvAsync).
+	// 한글: 등록 전에 맵에 먼저 삽입 (RecvAsync와 동일한 순서 규칙).
+	mPendingConnectOps[socket] = context;
+	mPendingConnectCount.fetch_add(1, std::memory_order_release);
+	mStats.mTotalRequests++;
+	mStats.mPendingRequests++;
+
+	// English: Writable (or error/hangup) = connect finished. ONESHOT so the next
+	//          RecvAsync re-arms with its own interest set via EPOLL_CTL_MOD.
+	// 한글: 쓰기 가능(또는 에러/끊김) = connect 종료. ONESHOT이므로 이후
+	//       RecvAsync가 EPOLL_CTL_MOD로 자신의 관심 이벤트를 재등록한다.
+	struct epoll_event ev;
+	ev.events  = EPOLLOUT | EPOLLERR | EPOLLHUP | EPOLLRDHUP | EPOLLONESHOT;
+	ev.data.fd = socket;
+	if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, socket, &ev) < 0)
+	{
+		const int savedErrno = errno;
+		mLastError = "epoll_ctl EPOLL_CTL_ADD (connect) failed: " + std::string(strerror(savedErrno));
+		mPendingConnectOps.erase(socket);
+		mPendingConnectCount.fetch_sub(1, std::memory_order_release);
+		mStats.mTotalRequests--;
+		mStats.mPendingRequests--;
+		errno = savedErrno;
+		return AsyncIOError::OperationFailed;
+	}
+
+	return AsyncIOError::Success;
+}
+
 // =============================================================================
 // English: Buffer Management
 // 한글: 버퍼 관리
@@ -193,7 +275,45 @@ AsyncIOError EpollAsyncIOProvider::SendAsync(SocketHandle socket,
 		return AsyncIOError::InvalidParameter;
 	}
 
-	std::lock_guard<std::mutex> lock(mMutex);
+	// English: Copy outside the lock — the caller's buffer is only valid for this call.
+	// 한글: 락 밖에서 복사 — 호출자 버퍼는 이 호출 동안만 유효하다.
+	PendingOperation pending;
+	pending.mContext = context;
+	pending.mType = AsyncIOType::Send;
+	pending.mSocket = socket;
+	pending.mOwnedBuffer = std::make_unique<uint8_t[]>(size);
+	std::memcpy(pending.mOwnedBuffer.get(), buffer, size);
+	pending.mBuffer = pending.mOwnedBuffer.get();
+	pending.mBufferSize = static_cast<uint32_t>(size);
+
+	return SubmitSend(socket, std::move(pending));
+}
+
+AsyncIOError EpollAsyncIOProvider::SendSharedAsync(SocketHandle socket,
+												   const Core::SharedSendBuffer &buffer,
+												   RequestContext context)
+{
+	if (!mInitialized.load(std::memory_order_acquire))
+		return AsyncIOError::NotInitialized;
+	if (socket < 0 || buffer.Empty())
+		return AsyncIOError::InvalidParameter;
+
+	// English: No copy — the op holds a reference until the send completes or is dropped.
+	// 한글: 복사 없음 — 송신 완료 또는 작업 폐기까지 작업이 참조를 보관한다.
+	PendingOperation pending;
+	pending.mContext = context;
+	pending.mType = AsyncIOType::Send;
+	pending.mSocket = socket;
+	pending.mSharedBuffer = buffer;
+	pending.mBuffer = reinterpret_cast<uint8_t *>(const_cast<char *>(buffer.Data()));
+	pending.mBufferSize = buffer.Size();
+
+	return SubmitSend(socket, std::move(pending));
+}
+
+AsyncIOError EpollAsyncIOProvider::SubmitSend(SocketHandle socket, PendingOperation &&pending)
+{
+	NET_LOCK_GUARD(mMutex);
 
 	// English: Reject if a send is already in-flight for this socket. Overwriting
 	//          a pending partial-send would silently drop the unfinished data.
@@ -205,17 +325,7 @@ AsyncIOError EpollAsyncIOProvider::SendAsync(SocketHandle socket,
 		return AsyncIOError::OperationFailed;
 	}
 
-	// English: Store pending operation with buffer copy
-	// 한글: 버퍼 복사와 함께 대기 작업 저장
-	PendingOperation pending;
-	pending.mContext = context;
-	pending.mType = AsyncIOType::Send;
-	pending.mSocket = socket;
-	pending.mOwnedBuffer = std::make_unique<uint8_t[]>(size);
-	std::memcpy(pending.mOwnedBuffer.get(), buffer, size);
-	pending.mBuffer = pending.mOwnedBuffer.get();
-	pending.mBufferSize = static_cast<uint32_t>(size);
-
+	pending.mSubmitTimeNs = Utils::Timer::GetMonotonicNs();
 	mPendingSendOps[socket] = std::move(pending);
 	mStats.mTotalRequests++;
 	mStats.mPendingRequests++;
@@ -246,7 +356,7 @@ AsyncIOError EpollAsyncIOProvider::RecvAsync(SocketHandle socket, void *buffer,
 	if (socket < 0 || !buffer || size == 0)
 		return AsyncIOError::InvalidParameter;
 
-	std::lock_guard<std::mutex> lock(mMutex);
+	NET_LOCK_GUARD(mMutex);
 
 	// English: Store pending operation (caller manages buffer)
 	// 한글: 대기 작업 저장 (호출자가 버퍼 관리)
@@ -257,6 +367,7 @@ AsyncIOError EpollAsyncIOProvider::RecvAsync(SocketHandle socket, void *buffer,
 	pending.mOwnedBuffer.reset();
 	pending.mBuffer = static_cast<uint8_t*>(buffer);
 	pending.mBufferSize = static_cast<uint32_t>(size);
+	pending.mSubmitTimeNs = Utils::Timer::GetMonotonicNs();
 
 	mPendingRecvOps[socket] = std::move(pending);
 	mStats.mTotalRequests++;
@@ -267,11 +378,17 @@ AsyncIOError EpollAsyncIOProvider::RecvAsync(SocketHandle socket, void *buffer,
 	//          is always correct: if already armed, this refreshes the interest; if
 	//          disarmed (fired), this re-enables it. If data arrived between AssociateSocket
 	//          and here, the kernel will fire again immediately once re-armed.
+	//          Keep EPOLLOUT if a send is pending: SendAsync on a logic thread may have
+	//          armed IN|OUT first, and overwriting with IN alone would stall that send.
 	// 한글: EPOLLIN을 위해 소켓 재등록 (EPOLLONESHOT이 이벤트 발생 후 소켓을 비활성화함).
 	//       초기 설정 및 recv 완료 후 항상 호출되므로 EPOLL_CTL_MOD가 항상 올바름.
+	//       send가 대기 중이면 EPOLLOUT을 유지해야 한다 — 로직 스레드의 SendAsync가
+	//       먼저 IN|OUT으로 등록한 뒤 여기서 IN만으로 덮어쓰면 send가 영구 정체된다.
 	{
 		struct epoll_event ev;
 		ev.events  = EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLRDHUP | EPOLLONESHOT;
+		if (mPendingSendOps.count(socket))
+			ev.events |= EPOLLOUT;
 		ev.data.fd = socket;
 		if (epoll_ctl(mEpollFd, EPOLL_CTL_MOD, socket, &ev) < 0)
 		{
@@ -357,13 +474,60 @@ int EpollAsyncIOProvider::ProcessCompletions(CompletionEntry *entries,
 			continue;
 		}
 
+		// English: Outbound connect completion. The first event on a connecting socket
+		//          (EPOLLOUT on success, EPOLLERR/EPOLLHUP on failure) ends the connect;
+		//          SO_ERROR carries the actual result. Skipped without locking when no
+		//          connect is in flight — the common case on a pure accept server.
+		// 한글: 아웃바운드 connect 완료. 연결 중인 소켓의 첫 이벤트(성공 시 EPOLLOUT,
+		//       실패 시 EPOLLERR/EPOLLHUP)가 connect 종료이며 실제 결과는 SO_ERROR에 있다.
+		//       진행 중 connect가 없으면 락 없이 건너뛴다 — accept 전용 서버의 일반 경로.
+		if (mPendingConnectCount.load(std::memory_order_acquire) != 0)
+		{
+			RequestContext connectCtx = 0;
+			bool isConnect = false;
+			{
+				NET_LOCK_GUARD(mMutex);
+				auto cit = mPendingConnectOps.find(socket);
+				if (cit != mPendingConnectOps.end())
+				{
+					connectCtx = cit->second;
+					mPendingConnectOps.erase(cit);
+					mPendingConnectCount.fetch_sub(1, std::memory_order_release);
+					mStats.mPendingRequests--;
+					isConnect = true;
+				}
+			}
+
+			if (isConnect)
+			{
+				int soError = 0;
+				socklen_t soErrorLen = sizeof(soError);
+				if (getsockopt(socket, SOL_SOCKET, SO_ERROR, &soError, &soErrorLen) < 0)
+					soError = errno;
+				// English: Hangup without SO_ERROR = connect aborted locally (shutdown()).
+				// 한글: SO_ERROR 없는 끊김 = 로컬에서 connect 중단 (shutdown()).
+				if (soError == 0 && (evFlags & (EPOLLERR | EPOLLHUP)))
+					soError = ECONNABORTED;
+
+				CompletionEntry &entry = entries[processedCount];
+				entry.mContext = connectCtx;
+				entry.mType = AsyncIOType::Connect;
+				entry.mResult = (soError == 0) ? 0 : -1;
+				entry.mOsError = soError;
+				entry.mCompletionTime = 0;
+				mStats.mTotalCompletions++;
+				processedCount++;
+				continue;
+			}
+		}
+
 		// English: Handle error / hangup events
 		// 한글: 에러 / 연결 끊김 이벤트 처리
 		if (evFlags & (EPOLLERR | EPOLLHUP | EPOLLRDHUP))
 		{
 			// English: Find any pending op context for this socket for disconnect reporting
 			// 한글: 연결 해제 보고용 소켓의 대기 중인 작업 컨텍스트 검색
-			std::lock_guard<std::mutex> lock(mMutex);
+			NET_LOCK_GUARD(mMutex);
 			RequestContext ctx = 0;
 			auto rit = mPendingRecvOps.find(socket);
 			if (rit != mPendingRecvOps.end())
@@ -400,7 +564,7 @@ int EpollAsyncIOProvider::ProcessCompletions(CompletionEntry *entries,
 			PendingOperation pending;
 			bool found = false;
 			{
-				std::lock_guard<std::mutex> lock(mMutex);
+				NET_LOCK_GUARD(mMutex);
 				auto it = mPendingRecvOps.find(socket);
 				if (it != mPendingRecvOps.end())
 				{
@@ -434,13 +598,18 @@ int EpollAsyncIOProvider::ProcessCompletions(CompletionEntry *entries,
 						//       epoll_ctl이 먼저 실행되면 다른 워커가 재등록된 이벤트를
 						//       수신했을 때 맵에 op가 없어 recv를 조용히 버리고
 						//       세션이 영구 hang됨. RecvAsync와 동일한 패턴.
+						uint32_t rearmEvents = EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLRDHUP | EPOLLONESHOT;
 						{
-							std::lock_guard<std::mutex> lock(mMutex);
+							NET_LOCK_GUARD(mMutex);
 							mPendingRecvOps[socket] = std::move(pending);
 							mStats.mPendingRequests++;
+							// English: Same rule as RecvAsync — keep a pending send armed.
+							// 한글: RecvAsync와 동일 — 대기 중인 send의 EPOLLOUT 유지.
+							if (mPendingSendOps.count(socket))
+								rearmEvents |= EPOLLOUT;
 						}
 						struct epoll_event rearmEv;
-						rearmEv.events  = EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLRDHUP | EPOLLONESHOT;
+						rearmEv.events  = rearmEvents;
 						rearmEv.data.fd = socket;
 						epoll_ctl(mEpollFd, EPOLL_CTL_MOD, socket, &rearmEv);
 					}
@@ -460,12 +629,16 @@ int EpollAsyncIOProvider::ProcessCompletions(CompletionEntry *entries,
 					continue;
 				}
 
+				// English: Recv latency is measured from here to engine dispatch (RecordRecvDispatch).
+				// 한글: 수신 지연은 이 시각부터 엔진 디스패치까지 잰다 (RecordRecvDispatch).
+				const uint64_t completedNs = Utils::Timer::GetMonotonicNs();
+
 				CompletionEntry &entry = entries[processedCount];
 				entry.mContext = pending.mContext;
 				entry.mType = AsyncIOType::Recv;
 				entry.mResult = result;
 				entry.mOsError = osError;
-				entry.mCompletionTime = 0;
+				entry.mCompletionTime = completedNs;
 				mStats.mTotalCompletions++;
 				processedCount++;
 			}
@@ -516,14 +689,16 @@ int EpollAsyncIOProvider::ProcessCompletions(CompletionEntry *entries,
 			int32_t sendResult = 0;
 			OSError sendError = 0;
 			RequestContext sendCtx = 0;
+			uint64_t sendSubmitNs = 0;
 
 			{
-				std::lock_guard<std::mutex> lock(mMutex);
+				NET_LOCK_GUARD(mMutex);
 				auto it = mPendingSendOps.find(socket);
 				if (it != mPendingSendOps.end())
 				{
 					found = true;
 					sendCtx = it->second.mContext;
+					sendSubmitNs = it->second.mSubmitTimeNs;
 
 					ssize_t sent = ::send(socket, it->second.mBuffer,
 					                      it->second.mBufferSize, MSG_NOSIGNAL);
@@ -531,14 +706,13 @@ int EpollAsyncIOProvider::ProcessCompletions(CompletionEntry *entries,
 					if (sent >= 0 &&
 					    static_cast<uint32_t>(sent) < it->second.mBufferSize)
 					{
-						// English: Partial send -- update in-place, keep in map.
-						// 한글: 부분 전송 -- in-place 갱신, 맵에 유지.
+						// English: Partial send -- update in-place, keep in map. The op still owns
+						//          (or references) the whole buffer, so just advance the pointer.
+						// 한글: 부분 전송 -- in-place 갱신, 맵에 유지. 작업이 버퍼 전체를 소유(또는 참조)하므로
+						//       포인터만 전진 — 잔여분 복사 없음.
 						const uint32_t remaining =
 							it->second.mBufferSize - static_cast<uint32_t>(sent);
-						auto remainBuf = std::make_unique<uint8_t[]>(remaining);
-						std::memcpy(remainBuf.get(), it->second.mBuffer + sent, remaining);
-						it->second.mOwnedBuffer = std::move(remainBuf);
-						it->second.mBuffer      = it->second.mOwnedBuffer.get();
+						it->second.mBuffer     += sent;
 						it->second.mBufferSize  = remaining;
 						partialSend = true;
 					}
@@ -581,12 +755,19 @@ int EpollAsyncIOProvider::ProcessCompletions(CompletionEntry *entries,
 							"epoll_ctl EPOLL_CTL_MOD (send done) failed: " +
 							std::string(strerror(errno)));
 					}
+					// English: Partial sends update the entry in place, so the latency
+					//          spans the whole buffer from SendAsync to the last byte.
+					// 한글: 부분 전송은 맵 항목을 in-place 갱신하므로 SendAsync부터 마지막 바이트까지의 시간이다.
+					const uint64_t completedNs = Utils::Timer::GetMonotonicNs();
+					if (sendResult >= 0)
+						mSendLatency.Record(completedNs - sendSubmitNs);
+
 					CompletionEntry &entry = entries[processedCount];
 					entry.mContext = sendCtx;
 					entry.mType = AsyncIOType::Send;
 					entry.mResult = sendResult;
 					entry.mOsError = sendError;
-					entry.mCompletionTime = 0;
+					entry.mCompletionTime = completedNs;
 					mStats.mTotalCompletions++;
 					processedCount++;
 				}
@@ -612,7 +793,21 @@ int EpollAsyncIOProvider::ProcessCompletions(CompletionEntry *entries,
 
 const ProviderInfo &EpollAsyncIOProvider::GetInfo() const { return mInfo; }
 
-ProviderStats EpollAsyncIOProvider::GetStats() const { return mStats; }
+void EpollAsyncIOProvider::GetStats(ProviderStats &out) const
+{
+	CopyStatCounters(out, mStats);
+	out.mSendLatency.Reset();
+	mSendLatency.MergeInto(out.mSendLatency);
+	out.mRecvLatency.Reset();
+	mRecvLatency.MergeInto(out.mRecvLatency);
+	FillLatencySummary(out);
+}
+
+void EpollAsyncIOProvider::RecordRecvDispatch(uint64_t completionNs)
+{
+	if (completionNs != 0)
+		mRecvLatency.Record(Utils::Timer::GetMonotonicNs() - completionNs);
+}
 
 const char *EpollAsyncIOProvider::GetLastError() const
 {
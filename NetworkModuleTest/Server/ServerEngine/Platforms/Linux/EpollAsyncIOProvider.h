@@ -58,6 +58,11 @@ class EpollAsyncIOProvider : public AsyncIOProvider
 	AsyncIOError AssociateSocket(SocketHandle socket,
 								RequestContext context) override;
 
+	// English: Non-blocking connect; completion reported on first EPOLLOUT/EPOLLERR
+	// 한글: 논블로킹 connect; 첫 EPOLLOUT/EPOLLERR에서 완료 보고
+	AsyncIOError ConnectAsync(SocketHandle socket, const struct sockaddr *address,
+							  size_t addressLength, RequestContext context) override;
+
 	// =====================================================================
 	// English: Buffer Management
 	// 한글: 버퍼 관리
@@ -74,6 +79,11 @@ class EpollAsyncIOProvider : public AsyncIOProvider
 	AsyncIOError SendAsync(SocketHandle socket, const void *buffer, size_t size,
 							   RequestContext context, uint32_t flags = 0) override;
 
+	// English: Holds the shared buffer until completion instead of copying it
+	// 한글: 복사 대신 완료까지 공유 버퍼 핸들을 보관
+	AsyncIOError SendSharedAsync(SocketHandle socket, const Core::SharedSendBuffer &buffer,
+								 RequestContext context) override;
+
 	AsyncIOError RecvAsync(SocketHandle socket, void *buffer, size_t size,
 							   RequestContext context, uint32_t flags = 0) override;
 
@@ -93,7 +103,8 @@ class EpollAsyncIOProvider : public AsyncIOProvider
 	// =====================================================================
 
 	const ProviderInfo &GetInfo() const override;
-	ProviderStats GetStats() const override;
+	void GetStats(ProviderStats &out) const override;
+	void RecordRecvDispatch(uint64_t completionNs) override;
 	const char *GetLastError() const override;
 
   private:
@@ -114,9 +125,21 @@ class EpollAsyncIOProvider : public AsyncIOProvider
 						  // 한글: 버퍼 포인터 (수신 또는 송신 소유 버퍼)
 		std::unique_ptr<uint8_t[]> mOwnedBuffer; // English: Owned buffer for send
 												 // 한글: 송신용 소유 버퍼
+		Core::SharedSendBuffer mSharedBuffer; // English: Shared send buffer (SendSharedAsync)
+											  // 한글: 공유 송신 버퍼 (SendSharedAsync)
 		uint32_t mBufferSize; // English: Buffer size / 한글: 버퍼 크기
+		uint64_t mSubmitTimeNs = 0; // English: Monotonic submit time (ns) / 한글: 제출 시각 (단조 ns)
 	};
 
+	// English: Register a prepared send op and arm EPOLLOUT (shared by SendAsync/SendSharedAsync)
+	// 한글: 준비된 송신 작업 등록 후 EPOLLOUT 등록 (SendAsync/SendSharedAsync 공용)
+	AsyncIOError SubmitSend(SocketHandle socket, PendingOperation &&pending);
+
+	// English: Forget recv/send ops left by a closed socket whose fd number is being reused.
+	//          Caller holds mMutex.
+	// 한글: fd 번호가 재사용되는, 이미 닫힌 소켓이 남긴 recv/send 작업 제거. 호출자가 mMutex 보유.
+	void DropStaleOpsLocked(SocketHandle socket);
+
 	// =====================================================================
 	// English: Member Variables
 	// 한글: 멤버 변수
@@ -128,10 +151,18 @@ class EpollAsyncIOProvider : public AsyncIOProvider
 		mPendingRecvOps; // English: Pending recv operations / 한글: 대기 수신 작업
 	std::map<SocketHandle, PendingOperation>
 		mPendingSendOps; // English: Pending send operations / 한글: 대기 송신 작업
+	std::map<SocketHandle, RequestContext>
+		mPendingConnectOps; // English: In-progress connects / 한글: 진행 중 connect
+	std::atomic<uint32_t>
+		mPendingConnectCount{0}; // English: mPendingConnectOps size — lock-free skip when 0 / 한글: 0이면 락 없이 connect 검사 생략
 	mutable std::mutex
 		mMutex; // English: Thread safety mutex / 한글: 스레드 안전성 뮤텍스
 	ProviderInfo mInfo;   // English: Provider info / 한글: 공급자 정보
 	ProviderStats mStats; // English: Statistics / 한글: 통계
+	Utils::ConcurrentLatencyHistogram
+		mSendLatency; // English: Send submit→completion (ns), recorded outside mMutex / 한글: 송신 제출→완료 (ns), 락 밖에서 기록
+	Utils::ConcurrentLatencyHistogram
+		mRecvLatency; // English: Recv completion→dispatch (ns), recorded by the engine / 한글: 수신 완료→디스패치 (ns), 엔진이 기록
 	std::string
 		mLastError; // English: Last error message / 한글: 마지막 에러 메시지
 	size_t
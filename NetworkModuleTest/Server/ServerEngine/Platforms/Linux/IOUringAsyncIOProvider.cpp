@@ -7,6 +7,7 @@
 
 #include "IOUringAsyncIOProvider.h"
 #include "Network/Core/PlatformDetect.h"
+#include "Utils/Timer.h"
 #include <cstdlib>
 #include <cstring>
 #include <fcntl.h>
@@ -169,6 +170,67 @@ AsyncIOError IOUringAsyncIOProvider::AssociateSocket(SocketHandle socket,
 	return AsyncIOError::Success;
 }
 
+AsyncIOError IOUringAsyncIOProvider::ConnectAsync(SocketHandle socket,
+												  const struct sockaddr *address,
+												  size_t addressLength,
+												  RequestContext context)
+{
+	if (!mInitialized.load(std::memory_order_acquire))
+		return AsyncIOError::NotInitialized;
+	if (socket < 0 || !address || addressLength == 0 ||
+		addressLength > sizeof(sockaddr_storage))
+		return AsyncIOError::InvalidParameter;
+
+	// English: The kernel reads the address asynchronously, so copy it into storage
+	//          owned by the pending op (released when the CQE is consumed).
+	// 한글: 커널이 주소를 비동기로 읽으므로 pending op 소유 저장소에 복사한다
+	//       (CQE 소비 시 해제).
+	auto addressCopy = std::make_unique<sockaddr_storage>();
+	std::memset(addressCopy.get(), 0, sizeof(sockaddr_storage));
+	std::memcpy(addressCopy.get(), address, addressLength);
+	const struct sockaddr *stableAddress =
+		reinterpret_cast<const struct sockaddr *>(addressCopy.get());
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	uint64_t opKey = mNextOpKey++;
+	PendingOperation pending;
+	pending.mContext         = context;
+	pending.mType            = AsyncIOType::Connect;
+	pending.mSocket          = socket;
+	pending.mCallerBuffer    = nullptr;
+	pending.mPoolSlotPtr     = nullptr;
+	pending.mBufferSize      = 0;
+	pending.mPoolSlotIndex   = 0;
+	pending.mConnectAddress  = std::move(addressCopy);
+
+	mPendingOps[opKey] = std::move(pending);
+
+	struct io_uring_sqe *sqe = io_uring_get_sqe(&mRing);
+	if (!sqe)
+	{
+		mLastError = "io_uring SQ full";
+		mPendingOps.erase(opKey);
+		return AsyncIOError::NoResources;
+	}
+
+	io_uring_prep_connect(sqe, socket, stableAddress,
+						  static_cast<socklen_t>(addressLength));
+	sqe->user_data = opKey;
+
+	mStats.mTotalRequests++;
+	mStats.mPendingRequests++;
+
+	if (!SubmitRing())
+	{
+		mPendingOps.erase(opKey);
+		mStats.mTotalRequests--;
+		mStats.mPendingRequests--;
+		return AsyncIOError::OperationFailed;
+	}
+	return AsyncIOError::Success;
+}
+
 // =============================================================================
 // English: Buffer Management
 // 한글: 버퍼 관리
@@ -244,6 +306,7 @@ AsyncIOError IOUringAsyncIOProvider::SendAsync(SocketHandle socket,
 	pending.mPoolSlotPtr    = sendSlot.ptr;
 	pending.mBufferSize     = static_cast<uint32_t>(size);
 	pending.mPoolSlotIndex  = sendSlot.index;
+	pending.mSubmitTimeNs   = Utils::Timer::GetMonotonicNs();
 
 	mPendingOps[opKey] = std::move(pending);
 
@@ -282,6 +345,65 @@ AsyncIOError IOUringAsyncIOProvider::SendAsync(SocketHandle socket,
 	return AsyncIOError::Success;
 }
 
+AsyncIOError IOUringAsyncIOProvider::SendSharedAsync(SocketHandle socket,
+														 const Core::SharedSendBuffer &buffer,
+														 RequestContext context)
+{
+	if (!mInitialized.load(std::memory_order_acquire))
+		return AsyncIOError::NotInitialized;
+	if (socket < 0 || buffer.Empty())
+		return AsyncIOError::InvalidParameter;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	// English: No pool slot and no copy — the SQE points straight at the shared
+	//          payload, and the pending op keeps it alive until the CQE arrives.
+	// 한글: 풀 슬롯·복사 없음 — SQE가 공유 페이로드를 직접 가리키고,
+	//       CQE 도착까지 대기 작업이 참조를 보관해 수명을 유지한다.
+	uint64_t opKey = mNextOpKey++;
+	PendingOperation pending;
+	pending.mContext        = context;
+	pending.mType           = AsyncIOType::Send;
+	pending.mSocket         = socket;
+	pending.mCallerBuffer   = nullptr;
+	pending.mPoolSlotPtr    = nullptr;
+	pending.mBufferSize     = buffer.Size();
+	pending.mPoolSlotIndex  = 0;
+	pending.mSubmitTimeNs   = Utils::Timer::GetMonotonicNs();
+	pending.mSharedBuffer   = buffer;
+
+	mPendingOps[opKey] = std::move(pending);
+
+	struct io_uring_sqe *sqe = io_uring_get_sqe(&mRing);
+	if (!sqe)
+	{
+		mLastError = "io_uring SQ full";
+		mPendingOps.erase(opKey);
+		return AsyncIOError::NoResources;
+	}
+
+	io_uring_prep_send(sqe, socket, buffer.Data(), buffer.Size(), 0);
+	sqe->user_data = opKey;
+
+	mStats.mTotalRequests++;
+	mStats.mPendingRequests++;
+
+	// English: Same rollback as SendAsync, but the prepped SQE can still be submitted by a
+	//          later SubmitRing() and read the payload. Park the reference until its stale
+	//          CQE arrives instead of dropping it here.
+	// 한글: SendAsync와 같은 롤백이지만, prep된 SQE는 이후 SubmitRing()에서 제출되어
+	//       페이로드를 읽을 수 있다. 여기서 참조를 버리지 않고 스테일 CQE 도착까지 보관한다.
+	if (!SubmitRing())
+	{
+		mOrphanedSends[opKey] = std::move(mPendingOps[opKey].mSharedBuffer);
+		mPendingOps.erase(opKey);
+		mStats.mTotalRequests--;
+		mStats.mPendingRequests--;
+		return AsyncIOError::OperationFailed;
+	}
+	return AsyncIOError::Success;
+}
+
 AsyncIOError IOUringAsyncIOProvider::RecvAsync(SocketHandle socket,
 												   void *buffer, size_t size,
 												   RequestContext context,
@@ -311,6 +433,7 @@ AsyncIOError IOUringAsyncIOProvider::RecvAsync(SocketHandle socket,
 	pending.mPoolSlotPtr    = recvSlot.ptr;
 	pending.mBufferSize     = static_cast<uint32_t>(size);
 	pending.mPoolSlotIndex  = recvSlot.index;
+	pending.mSubmitTimeNs   = Utils::Timer::GetMonotonicNs();
 
 	mPendingOps[opKey] = std::move(pending);
 
@@ -415,6 +538,10 @@ int IOUringAsyncIOProvider::ProcessCompletionQueue(CompletionEntry *entries,
 	unsigned head;
 	struct io_uring_cqe *cqe;
 
+	// English: One clock read per batch — every CQE here completed before this point.
+	// 한글: 배치당 한 번만 시계를 읽는다 — 여기 있는 CQE는 모두 이 시점 이전에 완료됐다.
+	const uint64_t completedNs = Utils::Timer::GetMonotonicNs();
+
 	io_uring_for_each_cqe(&mRing, head, cqe)
 	{
 		if (static_cast<size_t>(processedCount) >= maxEntries)
@@ -440,7 +567,7 @@ int IOUringAsyncIOProvider::ProcessCompletionQueue(CompletionEntry *entries,
 			entry.mType           = op.mType;
 			entry.mResult         = static_cast<int32_t>(res);
 			entry.mOsError        = (res < 0) ? static_cast<OSError>(-res) : 0;
-			entry.mCompletionTime = 0;
+			entry.mCompletionTime = completedNs;
 
 			// English: For recv completions copy data from the pool slot to the
 			//          caller's buffer, then release the slot back to the pool.
@@ -456,14 +583,27 @@ int IOUringAsyncIOProvider::ProcessCompletionQueue(CompletionEntry *entries,
 			}
 			else if (op.mType == AsyncIOType::Send)
 			{
-				mSendPool.Release(op.mPoolSlotIndex);
+				// English: SendSharedAsync ops hold no slot (mPoolSlotPtr == nullptr).
+				// 한글: SendSharedAsync 작업은 슬롯이 없다 (mPoolSlotPtr == nullptr).
+				if (op.mPoolSlotPtr)
+					mSendPool.Release(op.mPoolSlotIndex);
+				if (res >= 0)
+					mSendLatency.Record(completedNs - op.mSubmitTimeNs);
 			}
+			// English: Connect holds no pool slot; res is 0 or -errno.
+			// 한글: Connect는 풀 슬롯이 없으며 res는 0 또는 -errno.
 
 			mPendingOps.erase(it);
 			mStats.mPendingRequests--;
 			mStats.mTotalCompletions++;
 			processedCount++;
 		}
+		else
+		{
+			// English: A rolled-back SendSharedAsync parked its buffer until now.
+			// 한글: 롤백된 SendSharedAsync가 지금까지 보관한 버퍼 해제.
+			mOrphanedSends.erase(opKey);
+		}
 		// English: Stale CQE (opKey not in mPendingOps): counted in cqesConsumed but
 		//          not in processedCount. io_uring_cq_advance must use cqesConsumed so
 		//          the stale entry is actually removed from the ring.
@@ -501,7 +641,23 @@ bool IOUringAsyncIOProvider::SubmitRing()
 
 const ProviderInfo &IOUringAsyncIOProvider::GetInfo() const { return mInfo; }
 
-ProviderStats IOUringAsyncIOProvider::GetStats() const { return mStats; }
+void IOUringAsyncIOProvider::GetStats(ProviderStats &out) const
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		CopyStatCounters(out, mStats);
+		out.mSendLatency = mSendLatency;
+	}
+	out.mRecvLatency.Reset();
+	mRecvLatency.MergeInto(out.mRecvLatency);
+	FillLatencySummary(out);
+}
+
+void IOUringAsyncIOProvider::RecordRecvDispatch(uint64_t completionNs)
+{
+	if (completionNs != 0)
+		mRecvLatency.Record(Utils::Timer::GetMonotonicNs() - completionNs);
+}
 
 const char *IOUringAsyncIOProvider::GetLastError() const
 {
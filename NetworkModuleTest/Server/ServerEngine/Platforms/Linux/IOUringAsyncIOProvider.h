@@ -65,6 +65,11 @@ class IOUringAsyncIOProvider : public AsyncIOProvider
 	AsyncIOError AssociateSocket(SocketHandle socket,
 								RequestContext context) override;
 
+	// English: Outbound connect via IORING_OP_CONNECT
+	// 한글: IORING_OP_CONNECT 기반 아웃바운드 연결
+	AsyncIOError ConnectAsync(SocketHandle socket, const struct sockaddr *address,
+							  size_t addressLength, RequestContext context) override;
+
 	// =====================================================================
 	// English: Buffer Management
 	// 한글: 버퍼 관리
@@ -81,6 +86,11 @@ class IOUringAsyncIOProvider : public AsyncIOProvider
 	AsyncIOError SendAsync(SocketHandle socket, const void *buffer, size_t size,
 							   RequestContext context, uint32_t flags = 0) override;
 
+	// English: Holds the shared buffer until completion instead of copying it
+	// 한글: 복사 대신 완료까지 공유 버퍼 핸들을 보관
+	AsyncIOError SendSharedAsync(SocketHandle socket, const Core::SharedSendBuffer &buffer,
+								 RequestContext context) override;
+
 	AsyncIOError RecvAsync(SocketHandle socket, void *buffer, size_t size,
 							   RequestContext context, uint32_t flags = 0) override;
 
@@ -100,7 +110,8 @@ class IOUringAsyncIOProvider : public AsyncIOProvider
 	// =====================================================================
 
 	const ProviderInfo &GetInfo() const override;
-	ProviderStats GetStats() const override;
+	void GetStats(ProviderStats &out) const override;
+	void RecordRecvDispatch(uint64_t completionNs) override;
 	const char *GetLastError() const override;
 
   private:
@@ -120,6 +131,13 @@ class IOUringAsyncIOProvider : public AsyncIOProvider
 		void*          mPoolSlotPtr;  // English: Pool slot pointer (recv fixed buf or send buf) / 한글: 풀 슬롯 포인터
 		uint32_t       mBufferSize;   // English: Buffer size / 한글: 버퍼 크기
 		size_t         mPoolSlotIndex;// English: Pool slot index for Release() / 한글: Release() 용 슬롯 인덱스
+		// English: Shared send buffer (SendSharedAsync) — no pool slot, mPoolSlotPtr is nullptr
+		// 한글: 공유 송신 버퍼 (SendSharedAsync) — 풀 슬롯 없음, mPoolSlotPtr는 nullptr
+		Core::SharedSendBuffer mSharedBuffer;
+		// English: Connect target — heap-held so the address stays put while the SQE is in flight
+		// 한글: connect 대상 주소 — SQE 처리 중 주소가 이동하지 않도록 힙에 보관
+		std::unique_ptr<sockaddr_storage> mConnectAddress;
+		uint64_t       mSubmitTimeNs = 0; // English: Monotonic submit time (ns) / 한글: 제출 시각 (단조 ns)
 	};
 
 	// English: Registered buffer info
@@ -140,12 +158,18 @@ class IOUringAsyncIOProvider : public AsyncIOProvider
 	std::map<uint64_t, PendingOperation>
 		mPendingOps; // English: Pending ops by user_data / 한글: user_data별
 					 // 대기 작업
+	std::map<uint64_t, Core::SharedSendBuffer>
+		mOrphanedSends; // English: Rolled-back shared sends awaiting their stale CQE / 한글: 스테일 CQE 대기 중인 롤백된 공유 송신
 	std::map<int64_t, RegisteredBufferEntry>
 		mRegisteredBuffers; // English: Registered buffers / 한글: 등록된 버퍼
 	mutable std::mutex
 		mMutex; // English: Thread safety mutex / 한글: 스레드 안전성 뮤텍스
 	ProviderInfo mInfo;   // English: Provider info / 한글: 공급자 정보
 	ProviderStats mStats; // English: Statistics / 한글: 통계
+	Utils::LatencyHistogram
+		mSendLatency; // English: Send submit→CQE (ns), guarded by mMutex / 한글: 송신 제출→CQE (ns), mMutex로 보호
+	Utils::ConcurrentLatencyHistogram
+		mRecvLatency; // English: Recv CQE→dispatch (ns), recorded by the engine without mMutex / 한글: 수신 CQE→디스패치 (ns), 엔진이 락 없이 기록
 	std::string
 		mLastError; // English: Last error message / 한글: 마지막 에러 메시지
 	size_t
@@ -464,10 +464,10 @@ const ProviderInfo &IocpAsyncIOProvider::GetInfo() const
 	return mInfo;
 }
 
-ProviderStats IocpAsyncIOProvider::GetStats() const
+void IocpAsyncIOProvider::GetStats(ProviderStats &out) const
 {
 	std::lock_guard<std::mutex> lock(mMutex);
-	return mStats;
+	out = mStats;
 }
 
 const char *IocpAsyncIOProvider::GetLastError() const
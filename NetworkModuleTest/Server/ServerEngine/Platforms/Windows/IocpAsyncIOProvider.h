@@ -99,7 +99,7 @@ class IocpAsyncIOProvider : public AsyncIOProvider
 	// =====================================================================
 
 	const ProviderInfo &GetInfo() const override;
-	ProviderStats GetStats() const override;
+	void GetStats(ProviderStats &out) const override;
 	const char *GetLastError() const override;
 
   private:
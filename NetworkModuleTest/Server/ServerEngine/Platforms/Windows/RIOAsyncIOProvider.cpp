@@ -734,10 +734,10 @@ const ProviderInfo &RIOAsyncIOProvider::GetInfo() const
 	return mInfo;
 }
 
-ProviderStats RIOAsyncIOProvider::GetStats() const
+void RIOAsyncIOProvider::GetStats(ProviderStats &out) const
 {
 	std::lock_guard<std::mutex> lock(mMutex);
-	return mStats;
+	out = mStats;
 }
 
 const char *RIOAsyncIOProvider::GetLastError() const
@@ -66,7 +66,7 @@ class RIOAsyncIOProvider : public AsyncIOProvider
 					   int timeoutMs = 0) override;
 
 	const ProviderInfo &GetInfo() const override;
-	ProviderStats GetStats() const override;
+	void GetStats(ProviderStats &out) const override;
 	const char *GetLastError() const override;
 
   private:
@@ -168,16 +168,6 @@ AsyncIOError KqueueAsyncIOProvider::SendAsync(SocketHandle socket,
 		return AsyncIOError::InvalidParameter;
 	}
 
-	std::lock_guard<std::mutex> lock(mMutex);
-
-	// English: Reject if a send is already in-flight for this socket.
-	// 한글: 동일 소켓에 이미 in-flight send가 있으면 거부.
-	if (mPendingSendOps.count(socket))
-	{
-		mLastError = "SendAsync: duplicate pending send for socket";
-		return AsyncIOError::OperationFailed;
-	}
-
 	// English: Store pending operation with buffer copy
 	// 한글: 버퍼 복사와 함께 대기 작업 저장
 	PendingOperation pending;
@@ -189,6 +179,43 @@ AsyncIOError KqueueAsyncIOProvider::SendAsync(SocketHandle socket,
 	pending.mBuffer = pending.mOwnedBuffer.get();
 	pending.mBufferSize = static_cast<uint32_t>(size);
 
+	return SubmitSend(socket, std::move(pending));
+}
+
+AsyncIOError KqueueAsyncIOProvider::SendSharedAsync(SocketHandle socket,
+													const Core::SharedSendBuffer &buffer,
+													RequestContext context)
+{
+	if (!mInitialized.load(std::memory_order_acquire))
+		return AsyncIOError::NotInitialized;
+	if (socket < 0 || buffer.Empty())
+		return AsyncIOError::InvalidParameter;
+
+	// English: No copy — the op holds a reference until the send completes or is dropped.
+	// 한글: 복사 없음 — 송신 완료 또는 작업 폐기까지 작업이 참조를 보관한다.
+	PendingOperation pending;
+	pending.mContext = context;
+	pending.mType = AsyncIOType::Send;
+	pending.mSocket = socket;
+	pending.mSharedBuffer = buffer;
+	pending.mBuffer = reinterpret_cast<uint8_t *>(const_cast<char *>(buffer.Data()));
+	pending.mBufferSize = buffer.Size();
+
+	return SubmitSend(socket, std::move(pending));
+}
+
+AsyncIOError KqueueAsyncIOProvider::SubmitSend(SocketHandle socket, PendingOperation &&pending)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	// English: Reject if a send is already in-flight for this socket.
+	// 한글: 동일 소켓에 이미 in-flight send가 있으면 거부.
+	if (mPendingSendOps.count(socket))
+	{
+		mLastError = "SendAsync: duplicate pending send for socket";
+		return AsyncIOError::OperationFailed;
+	}
+
 	mPendingSendOps[socket] = std::move(pending);
 	mStats.mTotalRequests++;
 	mStats.mPendingRequests++;
@@ -450,10 +477,8 @@ int KqueueAsyncIOProvider::ProcessCompletions(CompletionEntry *entries,
 						// Partial send -- update in-place, keep in map.
 						const uint32_t remaining =
 							it->second.mBufferSize - static_cast<uint32_t>(sent);
-						auto remainBuf = std::make_unique<uint8_t[]>(remaining);
-						std::memcpy(remainBuf.get(), it->second.mBuffer + sent, remaining);
-						it->second.mOwnedBuffer = std::move(remainBuf);
-						it->second.mBuffer      = it->second.mOwnedBuffer.get();
+						// The op still owns (or references) the whole buffer, so just advance.
+						it->second.mBuffer     += sent;
 						it->second.mBufferSize  = remaining;
 						partialSend = true;
 					}
@@ -548,7 +573,7 @@ bool KqueueAsyncIOProvider::UnregisterSocketEvents(SocketHandle socket)
 
 const ProviderInfo &KqueueAsyncIOProvider::GetInfo() const { return mInfo; }
 
-ProviderStats KqueueAsyncIOProvider::GetStats() const { return mStats; }
+void KqueueAsyncIOProvider::GetStats(ProviderStats &out) const { out = mStats; }
 
 const char *KqueueAsyncIOProvider::GetLastError() const
 {
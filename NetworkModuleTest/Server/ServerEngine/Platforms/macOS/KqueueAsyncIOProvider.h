@@ -73,6 +73,11 @@ class KqueueAsyncIOProvider : public AsyncIOProvider
 	AsyncIOError SendAsync(SocketHandle socket, const void *buffer, size_t size,
 							   RequestContext context, uint32_t flags = 0) override;
 
+	// English: Holds the shared buffer until completion instead of copying it
+	// 한글: 복사 대신 완료까지 공유 버퍼 핸들을 보관
+	AsyncIOError SendSharedAsync(SocketHandle socket, const Core::SharedSendBuffer &buffer,
+								 RequestContext context) override;
+
 	AsyncIOError RecvAsync(SocketHandle socket, void *buffer, size_t size,
 							   RequestContext context, uint32_t flags = 0) override;
 
@@ -92,7 +97,7 @@ class KqueueAsyncIOProvider : public AsyncIOProvider
 	// =====================================================================
 
 	const ProviderInfo &GetInfo() const override;
-	ProviderStats GetStats() const override;
+	void GetStats(ProviderStats &out) const override;
 	const char *GetLastError() const override;
 
   private:
@@ -113,6 +118,8 @@ class KqueueAsyncIOProvider : public AsyncIOProvider
 						  // 한글: 버퍼 포인터 (수신 또는 송신 소유 버퍼)
 		std::unique_ptr<uint8_t[]> mOwnedBuffer; // English: Owned buffer for send
 												 // 한글: 송신용 소유 버퍼
+		Core::SharedSendBuffer mSharedBuffer; // English: Shared send buffer (SendSharedAsync)
+											  // 한글: 공유 송신 버퍼 (SendSharedAsync)
 		uint32_t mBufferSize; // English: Buffer size / 한글: 버퍼 크기
 	};
 
@@ -151,6 +158,10 @@ class KqueueAsyncIOProvider : public AsyncIOProvider
 	// English: Unregister socket events from kqueue
 	// 한글: kqueue에서 소켓 이벤트 등록 해제
 	bool UnregisterSocketEvents(SocketHandle socket);
+
+	// English: Register a prepared send op and arm EVFILT_WRITE (shared by SendAsync/SendSharedAsync)
+	// 한글: 준비된 송신 작업 등록 후 EVFILT_WRITE 등록 (SendAsync/SendSharedAsync 공용)
+	AsyncIOError SubmitSend(SocketHandle socket, PendingOperation &&pending);
 };
 
 } // namespace BSD
@@ -100,7 +100,8 @@ void TestAsyncIOProviderCreation()
 			std::cout << "Batching: " << (info.mSupportsBatching ? "yes" : "no")
 					  << std::endl;
 
-			ProviderStats stats = provider->GetStats();
+			ProviderStats stats;
+			provider->GetStats(stats);
 			std::cout << "Total Requests: " << stats.mTotalRequests
 					  << std::endl;
 
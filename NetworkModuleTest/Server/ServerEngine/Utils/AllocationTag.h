@@ -0,0 +1,96 @@
+#pragma once
+
+// 힙 할당 분류 태그 — 현재 스레드가 어느 하위 시스템 코드를 실행 중인지 thread_local로 표시한다.
+//
+// 엔진은 할당을 직접 세지 않는다. operator new를 교체하는 쪽(AllocationTest, 프로파일러)이
+// GetCurrentAllocTag()를 읽어 할당을 하위 시스템별로 분류한다.
+//
+// 사용:
+//   void Session::PostSend()
+//   {
+//       Utils::AllocTagScope allocTag(Utils::AllocTag::Send);
+//       ...
+//   }
+//
+// 규칙:
+//   - 스코프는 중첩된다. 소멸 시 바깥 태그로 복원한다 (Handler 안의 Send → Send로 집계).
+//   - 호출자가 인자를 만들며 생긴 할당(예: Logger::Info(std::string) 인자)은 호출자 태그로 집계된다.
+//   - 태그가 없는 경로는 Other. I/O 워커 스레드는 루프 전체가 Io로 시작한다.
+//
+// 비용: 스코프당 thread_local 1바이트 읽기/쓰기 2회. 항상 켜져 있다.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Network::Utils
+{
+
+enum class AllocTag : uint8_t
+{
+	Other = 0,  // 태그 없음 (타이머, 배경 스레드, 테스트 코드 등)
+	Io,         // I/O 워커 루프 — AsyncIOProvider 완료 수집, recv 재등록
+	Recv,       // recv 완료 처리 — 수신 데이터 복사
+	Dispatch,   // 로직 워커로 넘기는 태스크 (std::function 클로저, 큐 노드)
+	Handler,    // 애플리케이션 OnRecv 핸들러
+	Send,       // Session::Send / PostSend — 송신 큐, 송신 버퍼
+	EventBus,   // FireEvent — 콜백 이벤트, NetworkEventBus 발행 복사
+	Logger,     // Logger 포맷/백엔드 제출
+	Count
+};
+
+inline const char *AllocTagName(AllocTag tag)
+{
+	switch (tag)
+	{
+	case AllocTag::Other:
+		return "Other";
+	case AllocTag::Io:
+		return "Io";
+	case AllocTag::Recv:
+		return "Recv";
+	case AllocTag::Dispatch:
+		return "Dispatch";
+	case AllocTag::Handler:
+		return "Handler";
+	case AllocTag::Send:
+		return "Send";
+	case AllocTag::EventBus:
+		return "EventBus";
+	case AllocTag::Logger:
+		return "Logger";
+	default:
+		return "?";
+	}
+}
+
+namespace Detail
+{
+inline thread_local AllocTag tCurrentAllocTag = AllocTag::Other;
+}
+
+inline AllocTag GetCurrentAllocTag()
+{
+	return Detail::tCurrentAllocTag;
+}
+
+class AllocTagScope
+{
+  public:
+	explicit AllocTagScope(AllocTag tag) : mPrevious(Detail::tCurrentAllocTag)
+	{
+		Detail::tCurrentAllocTag = tag;
+	}
+
+	~AllocTagScope()
+	{
+		Detail::tCurrentAllocTag = mPrevious;
+	}
+
+	AllocTagScope(const AllocTagScope &) = delete;
+	AllocTagScope &operator=(const AllocTagScope &) = delete;
+
+  private:
+	AllocTag mPrevious;
+};
+
+} // namespace Network::Utils
@@ -7,6 +7,8 @@
 #include <cstdlib>
 #include <sstream>
 #include <algorithm>
+#include <filesystem>
+#include <system_error>
 
 namespace Network::Utils
 {
@@ -39,6 +41,8 @@ void ConfigManager::Initialize()
 	// English: Override with environment variables if present
 	// 한글: 환경 변수가 있으면 덮어쓰기
 	LoadFromEnv();
+
+	ApplyLogConfig();
 }
 
 // =============================================================================
@@ -94,6 +98,18 @@ void ConfigManager::LoadFromEnv()
 		mNetwork.EngineType = engineStr;
 	}
 
+	auto adminPortStr = GetEnv("NETMOD_ADMIN_PORT");
+	if (!adminPortStr.empty())
+	{
+		mNetwork.AdminPort = static_cast<uint16_t>(std::stoi(adminPortStr));
+	}
+
+	auto adminBind = GetEnv("NETMOD_ADMIN_BIND");
+	if (!adminBind.empty())
+	{
+		mNetwork.AdminBindAddress = adminBind;
+	}
+
 	auto maxConnStr = GetEnv("NETMOD_MAX_CONNECTIONS");
 	if (!maxConnStr.empty())
 	{
@@ -106,6 +122,60 @@ void ConfigManager::LoadFromEnv()
 		mNetwork.WorkerThreadCount = static_cast<uint32_t>(std::stoul(workerStr));
 	}
 
+	auto logicStr = GetEnv("NETMOD_LOGIC_THREADS");
+	if (!logicStr.empty())
+	{
+		mNetwork.LogicThreadCount = static_cast<uint32_t>(std::stoul(logicStr));
+	}
+
+	auto laneBurstStr = GetEnv("NETMOD_LOGIC_LANE_BURST");
+	if (!laneBurstStr.empty())
+	{
+		mNetwork.LogicLaneBurstLimit = static_cast<uint32_t>(std::stoul(laneBurstStr));
+	}
+
+	auto sojournTargetStr = GetEnv("NETMOD_LOGIC_SOJOURN_TARGET_MS");
+	if (!sojournTargetStr.empty())
+	{
+		mNetwork.LogicSojournTargetMs = static_cast<uint32_t>(std::stoul(sojournTargetStr));
+	}
+
+	auto sojournIntervalStr = GetEnv("NETMOD_LOGIC_SOJOURN_INTERVAL_MS");
+	if (!sojournIntervalStr.empty())
+	{
+		mNetwork.LogicSojournIntervalMs = static_cast<uint32_t>(std::stoul(sojournIntervalStr));
+	}
+
+	auto dbFlowHighStr = GetEnv("NETMOD_DB_FLOW_HIGH");
+	if (!dbFlowHighStr.empty())
+	{
+		mNetwork.DBFlowHighWater = static_cast<size_t>(std::stoull(dbFlowHighStr));
+	}
+
+	auto dbFlowLowStr = GetEnv("NETMOD_DB_FLOW_LOW");
+	if (!dbFlowLowStr.empty())
+	{
+		mNetwork.DBFlowLowWater = static_cast<size_t>(std::stoull(dbFlowLowStr));
+	}
+
+	auto ioCpuStr = GetEnv("NETMOD_IO_CPUS");
+	if (!ioCpuStr.empty())
+	{
+		mNetwork.IoCpuSet = ioCpuStr;
+	}
+
+	auto logicCpuStr = GetEnv("NETMOD_LOGIC_CPUS");
+	if (!logicCpuStr.empty())
+	{
+		mNetwork.LogicCpuSet = logicCpuStr;
+	}
+
+	auto rtcStr = GetEnv("NETMOD_RUN_TO_COMPLETION");
+	if (!rtcStr.empty())
+	{
+		mNetwork.RunToCompletion = (rtcStr == "1" || StringUtils::ToUpper(rtcStr) == "TRUE");
+	}
+
 	// English: Timeout settings
 	// 한글: 타임아웃 설정
 	auto shutdownStr = GetEnv("NETMOD_GRACEFUL_TIMEOUT");
@@ -140,6 +210,24 @@ void ConfigManager::LoadFromEnv()
 		mLog.EnableFile = true;
 	}
 
+	auto logMaxSizeStr = GetEnv("NETMOD_LOG_MAX_SIZE_MB");
+	if (!logMaxSizeStr.empty())
+	{
+		mLog.MaxFileSizeMB = static_cast<size_t>(std::stoul(logMaxSizeStr));
+	}
+
+	auto logMaxFilesStr = GetEnv("NETMOD_LOG_MAX_FILES");
+	if (!logMaxFilesStr.empty())
+	{
+		mLog.MaxFileCount = static_cast<size_t>(std::stoul(logMaxFilesStr));
+	}
+
+	auto logOverflow = GetEnv("NETMOD_LOG_OVERFLOW");
+	if (!logOverflow.empty())
+	{
+		mLog.OverflowPolicy = StringUtils::ToUpper(logOverflow);
+	}
+
 	// English: Database settings
 	// 한글: 데이터베이스 설정
 	auto dbConnStr = GetEnv("NETMOD_DB_CONNECTION");
@@ -155,6 +243,29 @@ void ConfigManager::LoadFromEnv()
 	}
 }
 
+// =============================================================================
+// English: Apply logging configuration
+// Korean: 로깅 설정 반영
+// =============================================================================
+
+void ConfigManager::ApplyLogConfig() const
+{
+	Logger::SetConsoleOutput(mLog.EnableConsole);
+	Logger::SetOverflowPolicy(mLog.OverflowPolicy == "BLOCK" ? LogOverflowPolicy::Block
+	                                                         : LogOverflowPolicy::Drop);
+	Logger::SetRotation(mLog.MaxFileSizeMB * 1024 * 1024, mLog.MaxFileCount);
+
+	if (mLog.EnableFile)
+	{
+		// English: Create the log directory on demand; the file itself is opened in append mode
+		// 한글: 로그 디렉터리는 필요 시 생성, 파일은 추가 모드로 연다
+		std::error_code ec;
+		std::filesystem::create_directories(mLog.LogDir, ec);
+		const auto path = std::filesystem::path(mLog.LogDir) / (mLog.LogFilePrefix + ".log");
+		Logger::SetLogFile(path.string());
+	}
+}
+
 // =============================================================================
 // English: Helper: get environment variable
 // Korean: 도우미: 환경 변수 가져오기
@@ -187,8 +298,24 @@ void ConfigManager::PrintConfig() const
 	Logger::Info("  DB Host         : " + mNetwork.DBServerHost);
 	Logger::Info("  DB Port         : " + std::to_string(mNetwork.DBServerPort));
 	Logger::Info("  Engine          : " + mNetwork.EngineType);
+	Logger::Info("  Admin Endpoint  : " + (mNetwork.AdminPort > 0
+	                                           ? mNetwork.AdminBindAddress + ":" + std::to_string(mNetwork.AdminPort)
+	                                           : std::string("disabled")));
 	Logger::Info("  Max Connections : " + std::to_string(mNetwork.MaxConnections));
 	Logger::Info("  Worker Threads  : " + (mNetwork.WorkerThreadCount > 0 ? std::to_string(mNetwork.WorkerThreadCount) : "auto"));
+	Logger::Info("  Logic Threads   : " + (mNetwork.LogicThreadCount > 0 ? std::to_string(mNetwork.LogicThreadCount) : "auto"));
+	Logger::Info("  Lane Burst Limit: " + (mNetwork.LogicLaneBurstLimit > 0 ? std::to_string(mNetwork.LogicLaneBurstLimit) : std::string("strict")));
+	Logger::Info("  Sojourn Target  : " + (mNetwork.LogicSojournTargetMs > 0
+	                                           ? std::to_string(mNetwork.LogicSojournTargetMs) + "ms / " +
+	                                                 std::to_string(mNetwork.LogicSojournIntervalMs) + "ms"
+	                                           : std::string("disabled")));
+	Logger::Info("  DB Flow Control : " + (mNetwork.DBFlowHighWater > 0
+	                                           ? std::to_string(mNetwork.DBFlowLowWater) + " / " +
+	                                                 std::to_string(mNetwork.DBFlowHighWater)
+	                                           : std::string("disabled")));
+	Logger::Info("  I/O CPUs        : " + (mNetwork.IoCpuSet.empty() ? std::string("unpinned") : mNetwork.IoCpuSet));
+	Logger::Info("  Logic CPUs      : " + (mNetwork.LogicCpuSet.empty() ? std::string("unpinned") : mNetwork.LogicCpuSet));
+	Logger::Info("  Run-to-completion: " + std::string(mNetwork.RunToCompletion ? "enabled" : "disabled"));
 
 	Logger::Info("Timeouts:");
 	Logger::Info("  Connect         : " + std::to_string(mTimeout.ConnectTimeoutMs) + "ms");
@@ -200,6 +327,12 @@ void ConfigManager::PrintConfig() const
 	Logger::Info("  Level           : " + mLog.Level);
 	Logger::Info("  Dir             : " + mLog.LogDir);
 	Logger::Info("  File            : " + std::string(mLog.EnableFile ? "enabled" : "disabled"));
+	if (mLog.EnableFile)
+	{
+		Logger::Info("  Rotation        : " + std::to_string(mLog.MaxFileSizeMB) + "MB x " +
+		             std::to_string(mLog.MaxFileCount) + " files");
+	}
+	Logger::Info("  Overflow        : " + mLog.OverflowPolicy);
 
 	if (!mDB.ConnectionString.empty())
 	{
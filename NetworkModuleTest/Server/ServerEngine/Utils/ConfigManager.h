@@ -28,14 +28,26 @@ struct NetworkConfig
 	std::string DBServerHost = "127.0.0.1";
 	std::string EngineType = "auto";
 
+	uint16_t AdminPort = 0;                       // 0 = disabled (Prometheus /metrics)
+	std::string AdminBindAddress = "127.0.0.1";
+
 	size_t MaxConnections = 1000;
 	size_t SessionPoolCapacity = 1000;
 	size_t SendBufferSize = 65536;
 	size_t RecvBufferSize = 65536;
-	size_t MaxLogicQueueDepth = 10000;
-
-	uint32_t WorkerThreadCount = 0; // 0 = auto (hardware_concurrency)
+	size_t MaxLogicQueueDepth = 10000;   // per priority lane
+	uint32_t LogicLaneBurstLimit = 8;    // higher-lane pops in a row before a waiting lower lane runs once (0 = strict)
+	uint32_t LogicSojournTargetMs = 5;     // logic queue wait above this for a whole interval = overloaded (0 = off)
+	uint32_t LogicSojournIntervalMs = 100; // overload observation window / recv-pause recheck period
+	size_t DBFlowHighWater = 1024;       // per DB worker backlog that pauses the submitting session's recv (0 = off)
+	size_t DBFlowLowWater = 256;         // backlog at which paused sessions resume reading
+
+	uint32_t WorkerThreadCount = 0; // I/O threads, 0 = auto (available CPUs minus logic workers, at least 1)
+	uint32_t LogicThreadCount = 0;  // logic dispatcher workers, 0 = auto (4)
 	uint32_t AcceptThreadCount = 1;
+	std::string IoCpuSet;           // "" = unpinned, "auto" = from topology, or list "0-3,8"
+	std::string LogicCpuSet;        // same format; "auto" = CPUs left over by the I/O threads
+	bool RunToCompletion = false;   // true = handlers run inline on the session's I/O thread
 
 	bool EnableNagle = false;
 	bool EnableKeepAlive = true;
@@ -82,8 +94,9 @@ struct LogConfig
 	bool EnableConsole = true;
 	bool EnableFile = false;
 	bool EnableTimestamp = true;
-	size_t MaxFileSizeMB = 50;
-	size_t MaxFileCount = 5;
+	size_t MaxFileSizeMB = 50;   // English: rotate when the active file exceeds this / 한글: 초과 시 로테이션 (0 = 끔)
+	size_t MaxFileCount = 5;     // English: files kept, active one included / 한글: 현재 파일 포함 보관 개수
+	std::string OverflowPolicy = "DROP"; // English: DROP | BLOCK when a thread's log ring is full / 한글: 링 가득 참 정책
 };
 
 // =============================================================================
@@ -140,6 +153,10 @@ public:
 	// 한글: Docker 최적화 기본값 적용
 	void ApplyDockerDefaults();
 
+	// English: Push LogConfig into Logger (file sink, rotation, console, overflow policy)
+	// 한글: LogConfig를 Logger에 반영 (파일 싱크, 로테이션, 콘솔, 오버플로 정책)
+	void ApplyLogConfig() const;
+
 	// English: Print current configuration to logger
 	// 한글: 현재 설정을 로거에 출력
 	void PrintConfig() const;
@@ -0,0 +1,262 @@
+// CPU 토폴로지 감지와 스레드 고정 구현
+
+#include "CpuTopology.h"
+#include "Logger.h"
+#include "../Network/Core/PlatformDetect.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#if defined(IS_WINDOWS)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif defined(IS_LINUX)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Network::Utils
+{
+
+namespace
+{
+// 노드 디렉터리 탐색 상한 (sysfs는 연속 번호가 아닐 수 있다)
+constexpr int kMaxNumaNodes = 64;
+
+CpuTopology DetectTopology()
+{
+	CpuTopology topology;
+
+#if defined(IS_LINUX)
+	cpu_set_t mask;
+	CPU_ZERO(&mask);
+	if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
+	{
+		for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+		{
+			if (CPU_ISSET(cpu, &mask))
+				topology.mCpus.push_back(cpu);
+		}
+	}
+
+	int maxNode = 0;
+	for (int node = 0; node < kMaxNumaNodes; ++node)
+	{
+		std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+		std::string line;
+		if (!file || !std::getline(file, line))
+			continue;
+		std::vector<int> cpus;
+		if (!ParseCpuList(line, cpus))
+			continue;
+		for (int cpu : cpus)
+		{
+			if (cpu >= static_cast<int>(topology.mCpuNode.size()))
+				topology.mCpuNode.resize(cpu + 1, 0);
+			topology.mCpuNode[cpu] = node;
+		}
+		maxNode = (std::max)(maxNode, node);
+	}
+	topology.mNodeCount = static_cast<size_t>(maxNode) + 1;
+#elif defined(IS_WINDOWS)
+	DWORD_PTR processMask = 0;
+	DWORD_PTR systemMask  = 0;
+	if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask))
+	{
+		for (int cpu = 0; cpu < static_cast<int>(sizeof(DWORD_PTR) * 8); ++cpu)
+		{
+			if (processMask & (static_cast<DWORD_PTR>(1) << cpu))
+				topology.mCpus.push_back(cpu);
+		}
+	}
+
+	int maxNode = 0;
+	for (int cpu : topology.mCpus)
+	{
+		UCHAR node = 0;
+		if (!GetNumaProcessorNode(static_cast<UCHAR>(cpu), &node) || node == 0xFF)
+			node = 0;
+		if (cpu >= static_cast<int>(topology.mCpuNode.size()))
+			topology.mCpuNode.resize(cpu + 1, 0);
+		topology.mCpuNode[cpu] = node;
+		maxNode = (std::max)(maxNode, static_cast<int>(node));
+	}
+	topology.mNodeCount = static_cast<size_t>(maxNode) + 1;
+#endif
+
+	if (topology.mCpus.empty())
+	{
+		const unsigned count = std::thread::hardware_concurrency();
+		for (unsigned cpu = 0; cpu < (count > 0 ? count : 1); ++cpu)
+			topology.mCpus.push_back(static_cast<int>(cpu));
+	}
+	return topology;
+}
+} // namespace
+
+const CpuTopology &CpuTopology::Get()
+{
+	static const CpuTopology sTopology = DetectTopology();
+	return sTopology;
+}
+
+int CpuTopology::NodeOf(int cpu) const
+{
+	if (cpu < 0 || cpu >= static_cast<int>(mCpuNode.size()))
+		return 0;
+	return mCpuNode[cpu];
+}
+
+std::vector<int> CpuTopology::NodeInterleavedCpus() const
+{
+	std::vector<std::vector<int>> perNode(mNodeCount);
+	for (int cpu : mCpus)
+		perNode[static_cast<size_t>(NodeOf(cpu)) % mNodeCount].push_back(cpu);
+
+	std::vector<int> ordered;
+	ordered.reserve(mCpus.size());
+	for (size_t round = 0; ordered.size() < mCpus.size(); ++round)
+	{
+		for (const auto &cpus : perNode)
+		{
+			if (round < cpus.size())
+				ordered.push_back(cpus[round]);
+		}
+	}
+	return ordered;
+}
+
+bool ParseCpuList(const std::string &text, std::vector<int> &outCpus)
+{
+	std::vector<int> cpus;
+	std::stringstream stream(text);
+	std::string item;
+	while (std::getline(stream, item, ','))
+	{
+		item.erase(std::remove_if(item.begin(), item.end(), [](char c) { return c == ' ' || c == '\n'; }),
+		           item.end());
+		if (item.empty())
+			continue;
+
+		int first = 0;
+		int last  = 0;
+		char tail = 0;
+		// "a-b" 범위 또는 단일 번호 — 뒤에 남는 문자가 있으면 형식 오류
+		const int ranged = std::sscanf(item.c_str(), "%d-%d%c", &first, &last, &tail);
+		if (ranged == 1 && std::sscanf(item.c_str(), "%d%c", &first, &tail) == 1)
+			last = first;
+		else if (ranged != 2)
+			return false;
+		if (first < 0 || last < first)
+			return false;
+		for (int cpu = first; cpu <= last; ++cpu)
+			cpus.push_back(cpu);
+	}
+
+	if (cpus.empty())
+		return false;
+	std::sort(cpus.begin(), cpus.end());
+	cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+	outCpus = std::move(cpus);
+	return true;
+}
+
+std::vector<int> ResolveCpuSet(const std::string &spec, const std::vector<int> &autoCpus, const char *role)
+{
+	if (spec.empty())
+		return {};
+	if (spec == "auto")
+		return autoCpus;
+
+	std::vector<int> requested;
+	if (!ParseCpuList(spec, requested))
+	{
+		Logger::Warn("{} CPU set '{}' is not a CPU list - threads stay unpinned", role, spec);
+		return {};
+	}
+
+	const auto &available = CpuTopology::Get().mCpus;
+	std::vector<int> cpus;
+	for (int cpu : requested)
+	{
+		if (std::binary_search(available.begin(), available.end(), cpu))
+			cpus.push_back(cpu);
+		else
+			Logger::Warn("{} CPU set: CPU {} is not available to this process - skipped", role, cpu);
+	}
+	if (cpus.empty())
+		Logger::Warn("{} CPU set '{}' has no usable CPU - threads stay unpinned", role, spec);
+	return cpus;
+}
+
+std::vector<int> AutoIoCpuSet(size_t ioThreads)
+{
+	std::vector<int> cpus = CpuTopology::Get().NodeInterleavedCpus();
+	if (ioThreads < cpus.size())
+		cpus.resize(ioThreads);
+	return cpus;
+}
+
+std::vector<int> AutoLogicCpuSet(size_t ioThreads)
+{
+	// I/O 스레드가 모든 CPU를 가지면 로직 워커는 고정하지 않는다 — 같은 코어에 겹쳐 고정하면
+	// 스케줄러가 다른 코어로 옮겨 줄 수도 없다.
+	std::vector<int> cpus = CpuTopology::Get().NodeInterleavedCpus();
+	if (ioThreads >= cpus.size())
+		return {};
+	cpus.erase(cpus.begin(), cpus.begin() + static_cast<std::ptrdiff_t>(ioThreads));
+	return cpus;
+}
+
+bool PinCurrentThread(int cpu)
+{
+	if (cpu < 0)
+		return false;
+#if defined(IS_LINUX)
+	if (cpu >= CPU_SETSIZE)
+		return false;
+	cpu_set_t mask;
+	CPU_ZERO(&mask);
+	CPU_SET(cpu, &mask);
+	return pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) == 0;
+#elif defined(IS_WINDOWS)
+	if (cpu >= static_cast<int>(sizeof(DWORD_PTR) * 8))
+		return false;
+	return SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpu) != 0;
+#else
+	return false;
+#endif
+}
+
+void PinCurrentThread(const std::vector<int> &cpus, size_t index, const char *role)
+{
+	if (cpus.empty())
+		return;
+	const int cpu = cpus[index % cpus.size()];
+	if (!PinCurrentThread(cpu))
+		Logger::Warn("{} thread {} could not be pinned to CPU {}", role, index, cpu);
+}
+
+int CurrentCpu()
+{
+#if defined(IS_LINUX)
+	return sched_getcpu();
+#elif defined(IS_WINDOWS)
+	return static_cast<int>(GetCurrentProcessorNumber());
+#else
+	return -1;
+#endif
+}
+
+int CurrentNumaNode()
+{
+	thread_local const int tNode = CpuTopology::Get().NodeOf(CurrentCpu());
+	return tNode;
+}
+
+} // namespace Network::Utils
@@ -0,0 +1,60 @@
+#pragma once
+
+// CPU 토폴로지 감지와 스레드 고정(affinity) 유틸리티.
+//
+// - CpuTopology::Get(): 이 프로세스가 쓸 수 있는 CPU와 CPU별 NUMA 노드 (최초 호출 시 1회 감지)
+//     Linux  : sched_getaffinity + /sys/devices/system/node/node*/cpulist
+//     Windows: 프로세스 affinity 마스크(첫 64개 CPU) + GetNumaProcessorNode
+//     macOS  : hardware_concurrency, 단일 노드 (스레드 고정 API 없음 — PinCurrentThread는 false)
+// - CPU 집합 설정 문자열 (NetworkConfig::IoCpuSet / LogicCpuSet):
+//     ""      고정하지 않음
+//     "auto"  감지한 토폴로지에서 유도 (I/O 스레드 먼저, 로직 워커는 남은 CPU)
+//     "0-3,8" 명시 목록
+//   스레드 i는 집합의 [i % 크기]번째 CPU 하나에 고정된다.
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Network::Utils
+{
+
+struct CpuTopology
+{
+	std::vector<int> mCpus;      // 사용 가능한 CPU 번호 (오름차순)
+	std::vector<int> mCpuNode;   // CPU 번호 → NUMA 노드 (모르면 0)
+	size_t           mNodeCount = 1;
+
+	static const CpuTopology &Get();
+
+	// CPU의 NUMA 노드 (범위 밖이면 0)
+	int NodeOf(int cpu) const;
+
+	// 노드를 번갈아 가며 나열한 CPU 목록 — 앞에서부터 잘라 써도 노드에 고르게 퍼진다
+	std::vector<int> NodeInterleavedCpus() const;
+};
+
+// "0-3,8,10-11" 형식 파싱. 형식 오류나 빈 목록이면 false (outCpus 변경 없음)
+bool ParseCpuList(const std::string &text, std::vector<int> &outCpus);
+
+// 설정 문자열을 CPU 집합으로 해석. autoCpus = "auto"일 때 쓸 집합.
+// 사용할 수 없는 CPU는 빼고, 남는 것이 없으면 경고 후 빈 집합(고정 안 함).
+std::vector<int> ResolveCpuSet(const std::string &spec, const std::vector<int> &autoCpus, const char *role);
+
+// "auto" 집합 — I/O 스레드는 노드 교차 순서의 앞 ioThreads개, 로직 워커는 그 나머지 (없으면 빈 집합 = 고정 안 함)
+std::vector<int> AutoIoCpuSet(size_t ioThreads);
+std::vector<int> AutoLogicCpuSet(size_t ioThreads);
+
+// 호출 스레드를 CPU 하나에 고정. 지원하지 않는 플랫폼이나 실패 시 false
+bool PinCurrentThread(int cpu);
+
+// cpus가 비어 있지 않으면 호출 스레드를 cpus[index % 크기]에 고정 (실패는 경고 로그)
+void PinCurrentThread(const std::vector<int> &cpus, size_t index, const char *role);
+
+// 호출 스레드가 지금 실행 중인 CPU (모르면 -1)
+int CurrentCpu();
+
+// 호출 스레드의 NUMA 노드 — 스레드별 첫 호출 값을 캐시한다 (고정 후 호출 기준)
+int CurrentNumaNode();
+
+} // namespace Network::Utils
@@ -0,0 +1,251 @@
+#pragma once
+
+// HDR 스타일 지연 히스토그램 (log-linear 버킷, 나노초 단위).
+//
+// 버킷 구성: 2의 거듭제곱 구간 [2^k, 2^(k+1))을 kSubBuckets(32)개로 균등 분할한다.
+//   - 0 ~ 31ns는 1ns 단위 정확값
+//   - 그 이상은 상대 오차 최대 1/32 (~3%)
+//   - 2^kMaxBits ns(~18분) 이상은 마지막 버킷으로 모은다
+// 버킷 경계가 고정이므로 두 히스토그램은 버킷별 합으로 정확히 병합된다
+// (스레드/공급자/프로세스 간 집계).
+//
+// LatencyHistogram           — 단일 기록자 또는 외부 동기화. 자명 복사 가능하며
+//                              0으로 채운 상태가 빈 히스토그램이다 (memset 안전).
+// ConcurrentLatencyHistogram — 여러 스레드가 동시에 Record (relaxed atomic).
+//                              Snapshot()으로 LatencyHistogram을 얻어 질의한다.
+//
+// 헤더 전용: TestClient 등 ServerEngine을 링크하지 않는 타깃도 사용한다.
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Network::Utils
+{
+
+namespace LatencyHistogramLayout
+{
+constexpr uint32_t kSubBucketBits = 5;
+constexpr uint32_t kSubBuckets    = 1u << kSubBucketBits;
+constexpr uint32_t kMaxBits       = 40;
+constexpr size_t   kBucketCount   = kSubBuckets + (kMaxBits - kSubBucketBits) * kSubBuckets;
+
+inline uint32_t HighestBit(uint64_t value)
+{
+#if defined(_MSC_VER)
+	unsigned long index = 0;
+	_BitScanReverse64(&index, value);
+	return static_cast<uint32_t>(index);
+#else
+	return 63u - static_cast<uint32_t>(__builtin_clzll(value));
+#endif
+}
+
+inline size_t IndexOf(uint64_t value)
+{
+	if (value < kSubBuckets)
+	{
+		return static_cast<size_t>(value);
+	}
+	const uint32_t msb = HighestBit(value);
+	if (msb >= kMaxBits)
+	{
+		return kBucketCount - 1;
+	}
+	const uint32_t shift = msb - kSubBucketBits;
+	return kSubBuckets + static_cast<size_t>(shift) * kSubBuckets +
+	       static_cast<size_t>((value >> shift) - kSubBuckets);
+}
+
+// 버킷이 나타내는 구간의 최댓값 (HDR의 "highest equivalent value")
+inline uint64_t UpperBoundOf(size_t index)
+{
+	if (index < kSubBuckets)
+	{
+		return index;
+	}
+	const size_t   offset = index - kSubBuckets;
+	const uint32_t shift  = static_cast<uint32_t>(offset / kSubBuckets);
+	const uint64_t sub    = kSubBuckets + offset % kSubBuckets;
+	return ((sub + 1) << shift) - 1;
+}
+} // namespace LatencyHistogramLayout
+
+// =============================================================================
+// LatencyHistogram
+// =============================================================================
+
+class LatencyHistogram
+{
+public:
+	static constexpr size_t kBucketCount = LatencyHistogramLayout::kBucketCount;
+
+	void Record(uint64_t valueNs)
+	{
+		RecordMany(valueNs, 1);
+	}
+
+	void RecordMany(uint64_t valueNs, uint64_t count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+		mBuckets[LatencyHistogramLayout::IndexOf(valueNs)] += count;
+		if (mCount == 0 || valueNs < mMin)
+		{
+			mMin = valueNs;
+		}
+		if (valueNs > mMax)
+		{
+			mMax = valueNs;
+		}
+		mCount += count;
+		mSum += valueNs * count;
+	}
+
+	void Merge(const LatencyHistogram &other)
+	{
+		if (other.mCount == 0)
+		{
+			return;
+		}
+		for (size_t i = 0; i < kBucketCount; ++i)
+		{
+			mBuckets[i] += other.mBuckets[i];
+		}
+		mMin = (mCount == 0) ? other.mMin : (std::min)(mMin, other.mMin);
+		mMax = (std::max)(mMax, other.mMax);
+		mCount += other.mCount;
+		mSum += other.mSum;
+	}
+
+	void Reset() { *this = LatencyHistogram(); }
+
+	uint64_t Count() const { return mCount; }
+	uint64_t Sum() const { return mSum; }
+	uint64_t Min() const { return mMin; }
+	uint64_t Max() const { return mMax; }
+	uint64_t Mean() const { return mCount ? mSum / mCount : 0; }
+
+	// q ∈ [0, 1]. 해당 분위가 속한 버킷의 상한을 관측 최댓값으로 제한하여 반환한다.
+	uint64_t Percentile(double q) const
+	{
+		if (mCount == 0)
+		{
+			return 0;
+		}
+		q = (std::min)((std::max)(q, 0.0), 1.0);
+		uint64_t target = static_cast<uint64_t>(q * static_cast<double>(mCount) + 0.5);
+		target = (std::max)(target, static_cast<uint64_t>(1));
+		uint64_t seen = 0;
+		for (size_t i = 0; i < kBucketCount; ++i)
+		{
+			seen += mBuckets[i];
+			if (seen >= target)
+			{
+				return (std::min)((std::max)(LatencyHistogramLayout::UpperBoundOf(i), mMin), mMax);
+			}
+		}
+		return mMax;
+	}
+
+	uint64_t BucketCount(size_t index) const { return mBuckets[index]; }
+	static uint64_t BucketUpperBound(size_t index) { return LatencyHistogramLayout::UpperBoundOf(index); }
+
+private:
+	friend class ConcurrentLatencyHistogram;
+
+	uint64_t mBuckets[kBucketCount] = {};
+	uint64_t mCount = 0;
+	uint64_t mSum   = 0;
+	uint64_t mMin   = 0;  // mCount > 0일 때만 유효
+	uint64_t mMax   = 0;
+};
+
+// =============================================================================
+// ConcurrentLatencyHistogram
+// =============================================================================
+
+class ConcurrentLatencyHistogram
+{
+public:
+	static constexpr size_t kBucketCount = LatencyHistogramLayout::kBucketCount;
+
+	void Record(uint64_t valueNs)
+	{
+		mBuckets[LatencyHistogramLayout::IndexOf(valueNs)].fetch_add(1, std::memory_order_relaxed);
+		mCount.fetch_add(1, std::memory_order_relaxed);
+		mSum.fetch_add(valueNs, std::memory_order_relaxed);
+
+		uint64_t current = mMin.load(std::memory_order_relaxed);
+		while (valueNs < current &&
+		       !mMin.compare_exchange_weak(current, valueNs, std::memory_order_relaxed))
+		{
+		}
+		current = mMax.load(std::memory_order_relaxed);
+		while (valueNs > current &&
+		       !mMax.compare_exchange_weak(current, valueNs, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	// 기록과 동시에 호출 가능 (각 필드는 개별적으로 일관, 전체는 근사 스냅샷).
+	LatencyHistogram Snapshot() const
+	{
+		LatencyHistogram out;
+		MergeInto(out);
+		return out;
+	}
+
+	void MergeInto(LatencyHistogram &out) const
+	{
+		LatencyHistogram snapshot;
+		for (size_t i = 0; i < kBucketCount; ++i)
+		{
+			snapshot.mBuckets[i] = mBuckets[i].load(std::memory_order_relaxed);
+			snapshot.mCount += snapshot.mBuckets[i];
+		}
+		if (snapshot.mCount == 0)
+		{
+			return;
+		}
+		snapshot.mSum = mSum.load(std::memory_order_relaxed);
+		snapshot.mMin = mMin.load(std::memory_order_relaxed);
+		snapshot.mMax = mMax.load(std::memory_order_relaxed);
+		// 첫 Record와 경합하면 min이 아직 갱신 전일 수 있다.
+		if (snapshot.mMin > snapshot.mMax)
+		{
+			snapshot.mMin = snapshot.mMax;
+		}
+		out.Merge(snapshot);
+	}
+
+	void Reset()
+	{
+		for (auto &bucket : mBuckets)
+		{
+			bucket.store(0, std::memory_order_relaxed);
+		}
+		mCount.store(0, std::memory_order_relaxed);
+		mSum.store(0, std::memory_order_relaxed);
+		mMin.store(UINT64_MAX, std::memory_order_relaxed);
+		mMax.store(0, std::memory_order_relaxed);
+	}
+
+	uint64_t Count() const { return mCount.load(std::memory_order_relaxed); }
+
+private:
+	std::atomic<uint64_t> mBuckets[kBucketCount] = {};
+	std::atomic<uint64_t> mCount{0};
+	std::atomic<uint64_t> mSum{0};
+	std::atomic<uint64_t> mMin{UINT64_MAX};
+	std::atomic<uint64_t> mMax{0};
+};
+
+} // namespace Network::Utils
@@ -3,8 +3,15 @@
 
 #if defined(NET_LOCK_PROFILING)
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <cstring>
+#include <map>
+#include <new>
 #include <mutex>
+#include <tuple>
+#include <vector>
 
 #if defined(IS_WINDOWS)
 #include <TraceLoggingProvider.h>
@@ -14,28 +21,291 @@ TRACELOGGING_DEFINE_PROVIDER(
 	g_NetworkLockProfilingProvider,
 	"NetworkModule.LockProfiling",
 	(0x6f1c2b17, 0x8c9b, 0x4db1, 0x9a, 0x2d, 0x5f, 0x83, 0x2f, 0x1e, 0x2a, 0x91));
+#endif
 
 namespace Network::Utils::LockProfiling
 {
 namespace
 {
-	std::once_flag g_registerOnce;
+	// 버킷 i: [2^i, 2^(i+1)) ns (0은 버킷 0), 마지막 버킷은 ~2.1초 이상 전부.
+	constexpr size_t   kBucketCount       = 32;
+	// 스레드별 락 지점 테이블 크기 (2의 거듭제곱, 선형 탐사).
+	constexpr size_t   kMaxSitesPerThread = 256;
+	// 이 이상 기다린 획득을 "경합"으로 센다.
+	constexpr uint64_t kContendedWaitNs   = 1000;
+	constexpr uint32_t kDefaultTraceSample = 100;
 
-	void RegisterProvider() noexcept
+	// -------------------------------------------------------------------------
+	// 스레드별 통계 — 소유 스레드만 쓰고(load+store, RMW 없음) 보고서는 relaxed로 읽는다.
+	// -------------------------------------------------------------------------
+	using Counter = std::atomic<uint64_t>;
+
+	inline void Add(Counter &counter, uint64_t value) noexcept
 	{
-		TraceLoggingRegister(g_NetworkLockProfilingProvider);
-		std::atexit([]() { TraceLoggingUnregister(g_NetworkLockProfilingProvider); });
+		counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+
+	inline void Max(Counter &counter, uint64_t value) noexcept
+	{
+		if (value > counter.load(std::memory_order_relaxed))
+		{
+			counter.store(value, std::memory_order_relaxed);
+		}
+	}
+
+	inline size_t BucketOf(uint64_t ns) noexcept
+	{
+		size_t bucket = 0;
+		while (ns > 1 && bucket + 1 < kBucketCount)
+		{
+			ns >>= 1;
+			++bucket;
+		}
+		return bucket;
+	}
+
+	struct SiteStats
+	{
+		const char *name = nullptr;
+		const char *file = nullptr;
+		int         line = 0;
+
+		Counter count{0};
+		Counter contended{0};
+		Counter waitTotalNs{0};
+		Counter waitMaxNs{0};
+		Counter holdTotalNs{0};
+		Counter holdMaxNs{0};
+		Counter waitBuckets[kBucketCount] = {};
+		Counter holdBuckets[kBucketCount] = {};
+	};
+
+	struct ThreadStats
+	{
+		uint32_t                threadId = 0;
+		std::atomic<SiteStats *> slots[kMaxSitesPerThread] = {};
+		Counter                 untracked{0};  // 테이블이 가득 차 집계하지 못한 기록 수
+		uint32_t                traceCounter = 0;
+	};
+
+	// -------------------------------------------------------------------------
+	// 전역 레지스트리 — 스레드 등록 시에만 잠근다. 스레드가 끝나도 통계는 남도록
+	// ThreadStats/SiteStats는 해제하지 않는다 (프로파일링 빌드 전용).
+	// -------------------------------------------------------------------------
+	struct Registry
+	{
+		std::mutex                 mutex;
+		std::vector<ThreadStats *> threads;
+
+		// 샘플링 트레이스 (NETMOD_LOCK_TRACE)
+		std::mutex  traceMutex;
+		std::FILE  *traceFile   = nullptr;
+		bool        traceEnabled = false;  // 초기화 시 1회 결정 (핫 경로는 락 없이 확인)
+		uint32_t    traceSample = kDefaultTraceSample;
+		Clock::time_point traceEpoch = Clock::now();
+
+		std::string reportPath;   // 비어 있으면 stderr
+		bool        reportAtExit = true;
+	};
+
+	Registry &GetRegistry()
+	{
+		static Registry *sRegistry = []() {
+			auto *registry = new Registry();
+
+			if (const char *trace = std::getenv("NETMOD_LOCK_TRACE"); trace && *trace)
+			{
+				registry->traceFile = std::fopen(trace, "w");
+				registry->traceEnabled = registry->traceFile != nullptr;
+				if (registry->traceFile)
+				{
+					std::fputs("time_ns,thread,name,file,line,wait_ns,hold_ns\n", registry->traceFile);
+				}
+			}
+			if (const char *sample = std::getenv("NETMOD_LOCK_TRACE_SAMPLE"); sample && *sample)
+			{
+				const long value = std::strtol(sample, nullptr, 10);
+				registry->traceSample = value > 0 ? static_cast<uint32_t>(value) : kDefaultTraceSample;
+			}
+			if (const char *report = std::getenv("NETMOD_LOCK_REPORT"); report && *report)
+			{
+				if (std::strcmp(report, "0") == 0)
+				{
+					registry->reportAtExit = false;
+				}
+				else
+				{
+					registry->reportPath = report;
+				}
+			}
+
+			std::atexit([]() {
+				Registry &r = GetRegistry();
+				if (r.reportAtExit)
+				{
+					std::FILE *out = r.reportPath.empty() ? nullptr : std::fopen(r.reportPath.c_str(), "w");
+					DumpContentionReport(out);
+					if (out)
+					{
+						std::fclose(out);
+					}
+				}
+				std::lock_guard<std::mutex> lock(r.traceMutex);
+				if (r.traceFile)
+				{
+					std::fclose(r.traceFile);
+					r.traceFile = nullptr;
+				}
+			});
+			return registry;
+		}();
+		return *sRegistry;
+	}
+
+	ThreadStats &LocalStats()
+	{
+		// 자명 소멸 포인터 — 스레드/정적 소멸 중에도 안전하게 접근된다.
+		thread_local ThreadStats *sLocal = nullptr;
+		if (!sLocal)
+		{
+			auto *stats     = new ThreadStats();
+			stats->threadId = CurrentThreadId();
+			Registry &registry = GetRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			registry.threads.push_back(stats);
+			sLocal = stats;
+		}
+		return *sLocal;
+	}
+
+	SiteStats *FindOrCreateSite(ThreadStats &stats, const LockRecord &record) noexcept
+	{
+		const uintptr_t key = reinterpret_cast<uintptr_t>(record.file) ^
+		                      (static_cast<uintptr_t>(record.line) * 0x9E3779B97F4A7C15ull);
+		size_t index = static_cast<size_t>(key ^ (key >> 17)) & (kMaxSitesPerThread - 1);
+		for (size_t probe = 0; probe < kMaxSitesPerThread; ++probe)
+		{
+			SiteStats *site = stats.slots[index].load(std::memory_order_relaxed);
+			if (!site)
+			{
+				site       = new (std::nothrow) SiteStats();
+				if (!site)
+				{
+					return nullptr;
+				}
+				site->name = record.name;
+				site->file = record.file;
+				site->line = record.line;
+				// 보고서 스레드가 필드 초기화 이후의 포인터만 보도록 release로 공개한다.
+				stats.slots[index].store(site, std::memory_order_release);
+				return site;
+			}
+			if (site->line == record.line && site->file == record.file && site->name == record.name)
+			{
+				return site;
+			}
+			index = (index + 1) & (kMaxSitesPerThread - 1);
+		}
+		return nullptr;
+	}
+
+	void WriteTrace(Registry &registry, const LockRecord &record)
+	{
+		const uint64_t now = ToNs(Clock::now() - registry.traceEpoch);
+		std::lock_guard<std::mutex> lock(registry.traceMutex);
+		if (registry.traceFile)
+		{
+			std::fprintf(registry.traceFile, "%llu,%u,%s,%s,%d,%llu,%llu\n",
+			             static_cast<unsigned long long>(now), record.threadId,
+			             record.name, record.file, record.line,
+			             static_cast<unsigned long long>(record.waitNs),
+			             static_cast<unsigned long long>(record.holdNs));
+		}
 	}
 
-	void EnsureRegistered() noexcept
+	// 누적 히스토그램에서 q 분위가 속한 버킷의 상한 (ns), 관측 최대값으로 제한
+	uint64_t Percentile(const uint64_t (&buckets)[kBucketCount], uint64_t total, double q,
+	                    uint64_t observedMax)
 	{
-		std::call_once(g_registerOnce, RegisterProvider);
+		if (total == 0)
+		{
+			return 0;
+		}
+		const uint64_t target = static_cast<uint64_t>(static_cast<double>(total) * q + 0.5);
+		uint64_t seen = 0;
+		for (size_t i = 0; i < kBucketCount; ++i)
+		{
+			seen += buckets[i];
+			if (seen >= target && seen > 0)
+			{
+				return (std::min)(uint64_t(1) << (i + 1), observedMax);
+			}
+		}
+		return observedMax;
 	}
+
+	const char *BaseName(const char *path)
+	{
+		const char *base = path;
+		for (const char *p = path; *p; ++p)
+		{
+			if (*p == '/' || *p == '\\')
+			{
+				base = p + 1;
+			}
+		}
+		return base;
+	}
+
+	struct SiteAggregate
+	{
+		uint64_t count       = 0;
+		uint64_t contended   = 0;
+		uint64_t waitTotalNs = 0;
+		uint64_t waitMaxNs   = 0;
+		uint64_t holdTotalNs = 0;
+		uint64_t holdMaxNs   = 0;
+		uint64_t waitBuckets[kBucketCount] = {};
+		uint64_t holdBuckets[kBucketCount] = {};
+		uint32_t threads     = 0;
+	};
 } // namespace
 
 void EmitLockRecord(const LockRecord &record) noexcept
 {
-	EnsureRegistered();
+	ThreadStats &stats = LocalStats();
+	if (SiteStats *site = FindOrCreateSite(stats, record))
+	{
+		Add(site->count, 1);
+		if (record.waitNs >= kContendedWaitNs)
+		{
+			Add(site->contended, 1);
+		}
+		Add(site->waitTotalNs, record.waitNs);
+		Max(site->waitMaxNs, record.waitNs);
+		Add(site->holdTotalNs, record.holdNs);
+		Max(site->holdMaxNs, record.holdNs);
+		Add(site->waitBuckets[BucketOf(record.waitNs)], 1);
+		Add(site->holdBuckets[BucketOf(record.holdNs)], 1);
+	}
+	else
+	{
+		Add(stats.untracked, 1);
+	}
+
+	Registry &registry = GetRegistry();
+	if (registry.traceEnabled && ++stats.traceCounter >= registry.traceSample)
+	{
+		stats.traceCounter = 0;
+		WriteTrace(registry, record);
+	}
+
+#if defined(IS_WINDOWS)
+	static std::once_flag sRegisterOnce;
+	std::call_once(sRegisterOnce, []() {
+		TraceLoggingRegister(g_NetworkLockProfilingProvider);
+		std::atexit([]() { TraceLoggingUnregister(g_NetworkLockProfilingProvider); });
+	});
 	// TraceLogging의 알려진 제한: 내부 버퍼가 가득 찬 경우 레코드가 무음 드롭된다.
 	// 호출자를 블록하지 않는 설계이므로, 락 활동이 매우 많을 때 일부 데이터가 누락될 수 있다.
 	TraceLoggingWrite(g_NetworkLockProfilingProvider,
@@ -46,17 +316,144 @@ void EmitLockRecord(const LockRecord &record) noexcept
 					  TraceLoggingUInt64(record.waitNs, "WaitNs"),
 					  TraceLoggingUInt64(record.holdNs, "HoldNs"),
 					  TraceLoggingUInt32(record.threadId, "ThreadId"));
+#endif
 }
 
-} // namespace Network::Utils::LockProfiling
+std::string BuildContentionReport()
+{
+	Registry &registry = GetRegistry();
 
-#else
+	// 같은 지점이라도 TU마다 __FILE__ 포인터가 다를 수 있으므로 문자열로 합산한다.
+	std::map<std::tuple<std::string, std::string, int>, SiteAggregate> sites;
+	uint64_t untracked   = 0;
+	size_t   threadCount = 0;
+	{
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		threadCount = registry.threads.size();
+		for (ThreadStats *stats : registry.threads)
+		{
+			untracked += stats->untracked.load(std::memory_order_relaxed);
+			for (auto &slot : stats->slots)
+			{
+				const SiteStats *site = slot.load(std::memory_order_acquire);
+				if (!site)
+				{
+					continue;
+				}
+				SiteAggregate &agg = sites[std::make_tuple(std::string(site->name),
+				                                           std::string(BaseName(site->file)),
+				                                           site->line)];
+				agg.count       += site->count.load(std::memory_order_relaxed);
+				agg.contended   += site->contended.load(std::memory_order_relaxed);
+				agg.waitTotalNs += site->waitTotalNs.load(std::memory_order_relaxed);
+				agg.waitMaxNs    = (std::max)(agg.waitMaxNs, site->waitMaxNs.load(std::memory_order_relaxed));
+				agg.holdTotalNs += site->holdTotalNs.load(std::memory_order_relaxed);
+				agg.holdMaxNs    = (std::max)(agg.holdMaxNs, site->holdMaxNs.load(std::memory_order_relaxed));
+				for (size_t i = 0; i < kBucketCount; ++i)
+				{
+					agg.waitBuckets[i] += site->waitBuckets[i].load(std::memory_order_relaxed);
+					agg.holdBuckets[i] += site->holdBuckets[i].load(std::memory_order_relaxed);
+				}
+				++agg.threads;
+			}
+		}
+	}
 
-namespace Network::Utils::LockProfiling
+	using Entry = std::pair<const std::tuple<std::string, std::string, int> *, const SiteAggregate *>;
+	std::vector<Entry> sorted;
+	sorted.reserve(sites.size());
+	for (const auto &kv : sites)
+	{
+		sorted.emplace_back(&kv.first, &kv.second);
+	}
+	std::sort(sorted.begin(), sorted.end(), [](const Entry &a, const Entry &b) {
+		return a.second->waitTotalNs > b.second->waitTotalNs;
+	});
+
+	std::string report;
+	char line[512];
+	std::snprintf(line, sizeof(line),
+	              "=== Lock contention report: %zu sites, %zu threads (sorted by total wait) ===\n",
+	              sorted.size(), threadCount);
+	report += line;
+	std::snprintf(line, sizeof(line),
+	              "%10s %12s %7s %9s %9s %9s %9s %9s %9s %4s  %s\n",
+	              "waitTotal", "count", "contd%", "waitP50", "waitP99", "waitMax",
+	              "holdAvg", "holdP99", "holdMax", "thr", "site");
+	report += line;
+
+	for (const auto &entry : sorted)
+	{
+		const SiteAggregate &agg = *entry.second;
+		const double contendedPct = agg.count ? 100.0 * static_cast<double>(agg.contended) /
+		                                            static_cast<double>(agg.count)
+		                                      : 0.0;
+		const std::string site = std::get<0>(*entry.first) + " @ " + std::get<1>(*entry.first) +
+		                         ":" + std::to_string(std::get<2>(*entry.first));
+		std::snprintf(line, sizeof(line),
+		              "%10s %12llu %6.2f%% %9s %9s %9s %9s %9s %9s %4u  %s\n",
+		              FormatDurationNs(agg.waitTotalNs).c_str(),
+		              static_cast<unsigned long long>(agg.count),
+		              contendedPct,
+		              FormatDurationNs(Percentile(agg.waitBuckets, agg.count, 0.50, agg.waitMaxNs)).c_str(),
+		              FormatDurationNs(Percentile(agg.waitBuckets, agg.count, 0.99, agg.waitMaxNs)).c_str(),
+		              FormatDurationNs(agg.waitMaxNs).c_str(),
+		              FormatDurationNs(agg.count ? agg.holdTotalNs / agg.count : 0).c_str(),
+		              FormatDurationNs(Percentile(agg.holdBuckets, agg.count, 0.99, agg.holdMaxNs)).c_str(),
+		              FormatDurationNs(agg.holdMaxNs).c_str(),
+		              agg.threads,
+		              site.c_str());
+		report += line;
+	}
+
+	if (untracked > 0)
+	{
+		std::snprintf(line, sizeof(line),
+		              "(%llu records not tracked: per-thread site table full)\n",
+		              static_cast<unsigned long long>(untracked));
+		report += line;
+	}
+	report += "(percentiles are log2 bucket upper bounds; contended = wait >= 1us)\n";
+	return report;
+}
+
+void DumpContentionReport(std::FILE *out)
 {
-void EmitLockRecord(const LockRecord &record) noexcept { (void)record; }
-} // namespace Network::Utils::LockProfiling
+	const std::string report = BuildContentionReport();
+	std::FILE *target = out ? out : stderr;
+	std::fwrite(report.data(), 1, report.size(), target);
+	std::fflush(target);
+}
 
-#endif // defined(IS_WINDOWS)
+void ResetContentionStats() noexcept
+{
+	Registry &registry = GetRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	for (ThreadStats *stats : registry.threads)
+	{
+		stats->untracked.store(0, std::memory_order_relaxed);
+		for (auto &slot : stats->slots)
+		{
+			SiteStats *site = slot.load(std::memory_order_acquire);
+			if (!site)
+			{
+				continue;
+			}
+			site->count.store(0, std::memory_order_relaxed);
+			site->contended.store(0, std::memory_order_relaxed);
+			site->waitTotalNs.store(0, std::memory_order_relaxed);
+			site->waitMaxNs.store(0, std::memory_order_relaxed);
+			site->holdTotalNs.store(0, std::memory_order_relaxed);
+			site->holdMaxNs.store(0, std::memory_order_relaxed);
+			for (size_t i = 0; i < kBucketCount; ++i)
+			{
+				site->waitBuckets[i].store(0, std::memory_order_relaxed);
+				site->holdBuckets[i].store(0, std::memory_order_relaxed);
+			}
+		}
+	}
+}
+
+} // namespace Network::Utils::LockProfiling
 
 #endif // NET_LOCK_PROFILING
@@ -9,8 +9,14 @@
 // 측정 방식:
 //   - steady_clock으로 lock() 호출 직전(waitStart)과 직후(acquired)를 기록한다.
 //   - 스코프 소멸 시 acquired~소멸 시점을 holdNs로 산출한다.
-//   - 측정값은 EmitLockRecord()를 통해 Windows TraceLogging 이벤트로 내보낸다.
-//   - TraceLogging 수신기(WPR, PerfView 등)로 분석하거나 CSV로 내보낼 수 있다.
+//   - 측정값은 EmitLockRecord()로 전달되어 락 지점(이름+파일+라인)별·스레드별
+//     히스토그램에 누적된다. 각 스레드는 자기 테이블만 갱신하므로 집계 자체는 경합이 없다.
+//   - DumpContentionReport()가 전 스레드를 합산하여 총 대기 시간 내림차순 보고서를
+//     출력한다 (요청 시 또는 프로세스 종료 시 자동).
+//   - Windows: 추가로 TraceLogging 이벤트를 내보낸다 (WPR, PerfView 등으로 분석).
+//   - 샘플링 이벤트 트레이스 (선택): NETMOD_LOCK_TRACE=<csv 경로>,
+//     NETMOD_LOCK_TRACE_SAMPLE=N (스레드별 N회 중 1회, 기본 100).
+//   - 종료 시 보고서 출력 위치: NETMOD_LOCK_REPORT=<경로> (기본 stderr, "0"이면 끔).
 //
 // 오버헤드 트레이드오프:
 //   - steady_clock 호출 2회(wait 시작, 획득 완료) + 1회(해제) 추가 = ~수십 ns/락
@@ -30,13 +36,9 @@
 
 #if defined(NET_LOCK_PROFILING)
 
-#include <thread>
-#if defined(IS_WINDOWS)
-#ifndef WIN32_LEAN_AND_MEAN
-#define WIN32_LEAN_AND_MEAN
-#endif
-#include <windows.h>
-#endif
+#include <cstdio>
+#include <string>
+#include "ProfilingUtil.h"
 
 namespace Network::Utils::LockProfiling
 {
@@ -56,22 +58,21 @@ struct LockRecord
 
 void EmitLockRecord(const LockRecord &record) noexcept;
 
+// 전 스레드 누적 통계를 락 지점별로 합산한 보고서 (총 대기 시간 내림차순).
+std::string BuildContentionReport();
+
+// 보고서를 out에 기록한다. nullptr이면 stderr.
+void DumpContentionReport(std::FILE *out = nullptr);
+
+// 누적 통계를 0으로 되돌린다 (구간 측정용, 동시 기록 중 호출 시 근사치).
+void ResetContentionStats() noexcept;
+
 inline uint64_t ToNs(Clock::duration duration) noexcept
 {
 	return static_cast<uint64_t>(
 		std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
 }
 
-inline uint32_t GetThreadId() noexcept
-{
-#if defined(IS_WINDOWS)
-	return static_cast<uint32_t>(::GetCurrentThreadId());
-#else
-	return static_cast<uint32_t>(
-		std::hash<std::thread::id>{}(std::this_thread::get_id()));
-#endif
-}
-
 struct LockTiming
 {
 	const char       *name;      // 락 변수 이름 (LockRecord와 동일한 문자열 리터럴)
@@ -106,7 +107,7 @@ class LockHoldScope
 							mTiming.line,
 							ToNs(mTiming.acquired - mTiming.waitStart),
 							ToNs(end - mTiming.acquired),
-							GetThreadId()};
+							CurrentThreadId()};
 		EmitLockRecord(record);
 	}
 
@@ -136,7 +137,7 @@ class LockGuard
 							mTiming.line,
 							ToNs(mTiming.acquired - mTiming.waitStart),
 							ToNs(end - mTiming.acquired),
-							GetThreadId()};
+							CurrentThreadId()};
 		EmitLockRecord(record);
 		mMutex.unlock();
 	}
@@ -174,6 +175,17 @@ class LockGuard
 
 #else
 
+#include <cstdio>
+#include <string>
+
+// 비활성 빌드에서도 보고서 호출 지점을 조건부 컴파일 없이 둘 수 있도록 빈 구현 제공
+namespace Network::Utils::LockProfiling
+{
+inline std::string BuildContentionReport() { return std::string(); }
+inline void DumpContentionReport(std::FILE * = nullptr) {}
+inline void ResetContentionStats() noexcept {}
+} // namespace Network::Utils::LockProfiling
+
 // 프로파일링 비활성화 시 — 표준 락으로 무비용 교체
 #define NET_LOCK_GUARD_NAMED(mutex, name) \
 	std::lock_guard<std::remove_reference_t<decltype(mutex)>> name((mutex))
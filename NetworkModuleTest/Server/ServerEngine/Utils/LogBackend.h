@@ -0,0 +1,640 @@
+#pragma once
+
+// 비동기 로그 백엔드 — 스레드별 링 + 단일 라이터 스레드 + 크기 기반 파일 로테이션.
+//
+// 생산자(로그 호출 스레드)는 자기 스레드 전용 SPSC 링에 레코드를 넣기만 한다.
+// 공유 락·포맷·syscall이 없으므로 로그 호출이 다른 스레드를 직렬화하지 않는다.
+// 라이터 스레드가 모든 링을 모아 시간순 정렬 → 포맷 → 배치 단위 fwrite/fflush 한다.
+//
+// 링이 가득 찼을 때 정책 (LogOverflowPolicy):
+//   Drop  — 레코드를 버리고 카운트만 올린다. 라이터가 "N records dropped" 경고를 남긴다.
+//   Block — 라이터가 공간을 비울 때까지 생산자가 양보하며 대기한다.
+//   어느 정책이든 Err 레벨은 버리지 않는다 (Block처럼 대기).
+//
+// 포맷 인자는 LogArgBuffer로 값 캡처되어 링을 건너오고, 문자열화는 라이터에서만 일어난다
+// (LogFormat.h 참조).
+//
+// 헤더 전용: TestClient 등 ServerEngine 라이브러리를 링크하지 않는 타깃도 Logger.h를 쓴다.
+
+#include "../Network/Core/PlatformDetect.h"
+#include "LogFormat.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Network::Utils
+{
+
+enum class LogLevel : int
+{
+	Debug = 0,
+	Info = 1,
+	Warn = 2,
+	Err = 3
+};
+
+enum class LogOverflowPolicy : int
+{
+	Drop = 0,
+	Block = 1
+};
+
+// =============================================================================
+// LogRecord — 생산자가 캡처하는 원본. 포맷은 라이터 스레드에서 수행한다.
+//   mFormat != nullptr: 정적 포맷 문자열 + mArgs (지연 포맷)
+//   mFormat == nullptr: 호출자가 완성한 mMessage
+//                       (mArgs가 있으면 mMessage는 복사해 둔 포맷 문자열 — 비-const 버퍼 호출)
+// =============================================================================
+
+struct LogRecord
+{
+	LogLevel                              mLevel = LogLevel::Info;
+	std::chrono::system_clock::time_point mTime;
+	const char                           *mFormat = nullptr;  // 문자열 리터럴만 (수명 보장)
+	LogArgBuffer                          mArgs;
+	std::string                           mMessage;
+	uint32_t                              mSuppressed = 0;     // 직전 허용 이후 레이트 리밋으로 생략된 수
+};
+
+// =============================================================================
+// LogRing — 스레드 1개(생산자) : 라이터 1개(소비자) 고정 크기 링
+// =============================================================================
+
+class LogRing
+{
+public:
+	explicit LogRing(size_t capacity)
+	{
+		size_t cap = 16;
+		while (cap < capacity)
+		{
+			cap <<= 1;
+		}
+		mSlots.resize(cap);
+		mMask = cap - 1;
+	}
+
+	// 생산자 전용. 가득 차면 false (record는 변경되지 않음).
+	bool TryPush(LogRecord &record)
+	{
+		const size_t tail = mTail.load(std::memory_order_relaxed);
+		if (tail - mHead.load(std::memory_order_acquire) > mMask)
+		{
+			return false;
+		}
+		mSlots[tail & mMask] = std::move(record);
+		mTail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	// 소비자 전용. 최대 maxCount개를 out 뒤에 이동한다.
+	size_t Drain(std::vector<LogRecord> &out, size_t maxCount)
+	{
+		size_t head = mHead.load(std::memory_order_relaxed);
+		const size_t tail = mTail.load(std::memory_order_acquire);
+		size_t count = 0;
+		while (head != tail && count < maxCount)
+		{
+			out.push_back(std::move(mSlots[head & mMask]));
+			++head;
+			++count;
+		}
+		mHead.store(head, std::memory_order_release);
+		return count;
+	}
+
+	bool Empty() const
+	{
+		return mHead.load(std::memory_order_acquire) ==
+		       mTail.load(std::memory_order_acquire);
+	}
+
+	std::atomic<uint64_t> mDropped{0};     // Drop 정책으로 버려진 수 (생산자 증가, 라이터가 회수)
+	std::atomic<bool>     mRetired{false}; // 소유 스레드 종료 — 비워지면 라이터가 제거
+
+private:
+	std::vector<LogRecord> mSlots;
+	size_t                 mMask = 0;
+	alignas(64) std::atomic<size_t> mHead{0};  // 소비자 위치
+	alignas(64) std::atomic<size_t> mTail{0};  // 생산자 위치
+};
+
+// =============================================================================
+// LogFileSink — 크기 기반 로테이션 (path → path.1 → ... → path.(maxFiles-1))
+//   maxFiles는 현재 파일을 포함한 전체 개수. maxBytes == 0이면 로테이션 없음.
+// =============================================================================
+
+class LogFileSink
+{
+public:
+	~LogFileSink() { Close(); }
+
+	bool Open(const std::string &path, size_t maxBytes, size_t maxFiles)
+	{
+		Close();
+		mPath     = path;
+		mMaxBytes = maxBytes;
+		mMaxFiles = (std::max)(maxFiles, static_cast<size_t>(1));
+		mFile     = std::fopen(path.c_str(), "ab");
+		if (!mFile)
+		{
+			return false;
+		}
+		std::fseek(mFile, 0, SEEK_END);
+		const long size = std::ftell(mFile);
+		mWritten = size > 0 ? static_cast<size_t>(size) : 0;
+		return true;
+	}
+
+	void SetRotation(size_t maxBytes, size_t maxFiles)
+	{
+		mMaxBytes = maxBytes;
+		mMaxFiles = (std::max)(maxFiles, static_cast<size_t>(1));
+	}
+
+	bool IsOpen() const { return mFile != nullptr; }
+
+	void Write(const char *data, size_t size)
+	{
+		if (!mFile)
+		{
+			return;
+		}
+		if (mMaxBytes > 0 && mWritten > 0 && mWritten + size > mMaxBytes)
+		{
+			Rotate();
+			if (!mFile)
+			{
+				return;
+			}
+		}
+		std::fwrite(data, 1, size, mFile);
+		mWritten += size;
+	}
+
+	void Flush()
+	{
+		if (mFile)
+		{
+			std::fflush(mFile);
+		}
+	}
+
+	void Close()
+	{
+		if (mFile)
+		{
+			std::fclose(mFile);
+			mFile = nullptr;
+		}
+		mWritten = 0;
+	}
+
+private:
+	void Rotate()
+	{
+		std::fclose(mFile);
+		mFile = nullptr;
+
+		if (mMaxFiles > 1)
+		{
+			// 가장 오래된 파일 제거 후 한 칸씩 민다.
+			std::remove((mPath + "." + std::to_string(mMaxFiles - 1)).c_str());
+			for (size_t i = mMaxFiles - 1; i > 1; --i)
+			{
+				std::rename((mPath + "." + std::to_string(i - 1)).c_str(),
+				            (mPath + "." + std::to_string(i)).c_str());
+			}
+			std::rename(mPath.c_str(), (mPath + ".1").c_str());
+		}
+
+		// maxFiles == 1이면 "wb"로 현재 파일을 잘라낸다.
+		mFile    = std::fopen(mPath.c_str(), "wb");
+		mWritten = 0;
+	}
+
+	std::string mPath;
+	std::FILE  *mFile     = nullptr;
+	size_t      mWritten  = 0;
+	size_t      mMaxBytes = 0;
+	size_t      mMaxFiles = 1;
+};
+
+// =============================================================================
+// LogBackend — 프로세스 단일 인스턴스 (의도적 누수: 정적 소멸 중 로그도 안전)
+// =============================================================================
+
+class LogBackend
+{
+public:
+	static constexpr size_t   kDefaultRingCapacity = 1024;
+	static constexpr size_t   kMaxDrainPerRing     = 256;  // 라운드당 링별 상한 (공정성)
+	static constexpr uint32_t kIdleWaitMs          = 20;   // 유휴 시 최대 대기
+
+	static LogBackend &Instance()
+	{
+		static LogBackend *sInstance = new LogBackend();
+		return *sInstance;
+	}
+
+	// 완성된 메시지 경로 (기존 호출 호환)
+	void Submit(LogLevel level, std::string message)
+	{
+		LogRecord record;
+		record.mLevel   = level;
+		record.mMessage = std::move(message);
+		Submit(record);
+	}
+
+	// 생산자 경로. 캡처 시각을 찍어 링에 넣는다.
+	// 라이터 종료 후(atexit 이후)에는 동기 기록으로 전환된다.
+	void Submit(LogRecord &record)
+	{
+		const LogLevel level = record.mLevel;
+		record.mTime = std::chrono::system_clock::now();
+
+		if (mStopped.load(std::memory_order_acquire))
+		{
+			WriteDirect(record);
+			return;
+		}
+
+		LogRing *localRing = LocalRing();
+		if (!localRing)
+		{
+			// 이 스레드의 thread_local이 이미 소멸됨 (정적 소멸자 등) — 링 잔여분을
+			// 먼저 기록한 뒤 동기 기록하여 순서를 유지한다.
+			WriteBatch();
+			WriteDirect(record);
+			return;
+		}
+
+		LogRing &ring = *localRing;
+		if (!ring.TryPush(record))
+		{
+			const bool mustKeep = level == LogLevel::Err ||
+				mPolicy.load(std::memory_order_relaxed) == LogOverflowPolicy::Block;
+			if (!mustKeep)
+			{
+				ring.mDropped.fetch_add(1, std::memory_order_relaxed);
+				WakeWriter();
+				return;
+			}
+			while (!ring.TryPush(record))
+			{
+				if (mStopped.load(std::memory_order_acquire))
+				{
+					WriteDirect(record);
+					return;
+				}
+				WakeWriter();
+				std::this_thread::yield();
+			}
+		}
+		WakeWriter();
+	}
+
+	// 호출 시점까지 모든 스레드가 넣은 레코드가 기록될 때까지 대기한다.
+	void Flush()
+	{
+		if (mStopped.load(std::memory_order_acquire))
+		{
+			std::fflush(stdout);
+			return;
+		}
+		std::unique_lock<std::mutex> lock(mWakeMutex);
+		const uint64_t target = ++mFlushRequested;
+		mWakeCV.notify_one();
+		mFlushedCV.wait(lock, [this, target] {
+			return mFlushCompleted >= target || mStopped.load(std::memory_order_acquire);
+		});
+	}
+
+	// 라이터를 정지하고 남은 레코드를 모두 기록한다. 이후 로그는 동기 기록.
+	void Shutdown()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mWakeMutex);
+			if (!mRunning)
+			{
+				return;
+			}
+			mRunning = false;
+		}
+		mWakeCV.notify_one();
+		if (mWriter.joinable())
+		{
+			mWriter.join();
+		}
+		mStopped.store(true, std::memory_order_release);
+		mFlushedCV.notify_all();
+
+		// join 직후 경합으로 링에 들어간 잔여분 회수
+		WriteBatch();
+	}
+
+	bool SetLogFile(const std::string &path)
+	{
+		std::lock_guard<std::mutex> lock(mSinkMutex);
+		if (path.empty())
+		{
+			mFileSink.Close();
+			return true;
+		}
+		return mFileSink.Open(path, mMaxFileBytes, mMaxFileCount);
+	}
+
+	void SetRotation(size_t maxBytes, size_t maxFiles)
+	{
+		std::lock_guard<std::mutex> lock(mSinkMutex);
+		mMaxFileBytes = maxBytes;
+		mMaxFileCount = maxFiles;
+		mFileSink.SetRotation(maxBytes, maxFiles);
+	}
+
+	void SetConsoleEnabled(bool enabled) { mConsoleEnabled.store(enabled, std::memory_order_relaxed); }
+	void SetOverflowPolicy(LogOverflowPolicy policy) { mPolicy.store(policy, std::memory_order_relaxed); }
+
+	// 이후 처음 로그를 남기는 스레드의 링 크기 (기존 링은 유지)
+	void SetRingCapacity(size_t capacity) { mRingCapacity.store((std::max)(capacity, static_cast<size_t>(16)), std::memory_order_relaxed); }
+
+	uint64_t GetDroppedCount() const { return mTotalDropped.load(std::memory_order_relaxed); }
+
+private:
+	// 스레드 종료 시 링을 retired로 표시 — 라이터가 비운 뒤 제거한다.
+	struct RingHandle
+	{
+		std::shared_ptr<LogRing> mRing;
+		~RingHandle()
+		{
+			if (mRing)
+			{
+				mRing->mRetired.store(true, std::memory_order_release);
+			}
+			sRingReleased = true;
+		}
+	};
+
+	// RingHandle 소멸 이후에도 접근 가능한 자명 소멸 플래그.
+	// 메인 스레드는 thread_local이 정적 객체보다 먼저 소멸하므로, 정적 소멸자의
+	// 로그가 소멸된 handle에 접근하지 않도록 막는다.
+	static inline thread_local bool sRingReleased = false;
+
+	LogBackend()
+	{
+		mWriter = std::thread(&LogBackend::WriterLoop, this);
+		std::atexit([] { LogBackend::Instance().Shutdown(); });
+	}
+
+	// 이 스레드의 링. thread_local 소멸 이후면 nullptr.
+	LogRing *LocalRing()
+	{
+		if (sRingReleased)
+		{
+			return nullptr;
+		}
+		thread_local RingHandle handle;
+		if (!handle.mRing)
+		{
+			handle.mRing = std::make_shared<LogRing>(mRingCapacity.load(std::memory_order_relaxed));
+			std::lock_guard<std::mutex> lock(mRingsMutex);
+			mRings.push_back(handle.mRing);
+		}
+		return handle.mRing.get();
+	}
+
+	// 라이터가 유휴 대기 중일 때만 notify — 바쁜 동안 생산자는 syscall 없이 반환한다.
+	void WakeWriter()
+	{
+		if (mWriterIdle.load(std::memory_order_relaxed) &&
+		    mWriterIdle.exchange(false, std::memory_order_acq_rel))
+		{
+			mWakeCV.notify_one();
+		}
+	}
+
+	void WriterLoop()
+	{
+		for (;;)
+		{
+			uint64_t flushTarget = 0;
+			bool running = true;
+			{
+				std::lock_guard<std::mutex> lock(mWakeMutex);
+				flushTarget = mFlushRequested;
+				running     = mRunning;
+			}
+
+			// flushTarget을 읽은 뒤 링이 빌 때까지 비우면, Flush() 호출 이전에
+			// 들어간 레코드는 모두 기록된 상태가 된다.
+			size_t written = 0;
+			size_t round   = 0;
+			do
+			{
+				round = WriteBatch();
+				written += round;
+			} while (round > 0);
+
+			{
+				std::unique_lock<std::mutex> lock(mWakeMutex);
+				if (mFlushCompleted < flushTarget)
+				{
+					mFlushCompleted = flushTarget;
+					mFlushedCV.notify_all();
+				}
+				if (!running)
+				{
+					return;
+				}
+				if (written == 0 && mFlushRequested == mFlushCompleted && mRunning)
+				{
+					mWriterIdle.store(true, std::memory_order_release);
+					mWakeCV.wait_for(lock, std::chrono::milliseconds(kIdleWaitMs), [this] {
+						return !mRunning || mFlushRequested != mFlushCompleted ||
+						       !mWriterIdle.load(std::memory_order_acquire);
+					});
+					mWriterIdle.store(false, std::memory_order_release);
+				}
+			}
+		}
+	}
+
+	// 모든 링에서 한 라운드 회수 → 시간순 정렬 → 포맷 → 한 번에 기록. 회수한 레코드 수 반환.
+	// 링의 소비자 측은 mWriteMutex로 직렬화되므로 라이터 외 스레드가 호출해도 안전하다.
+	size_t WriteBatch()
+	{
+		std::lock_guard<std::mutex> writeLock(mWriteMutex);
+
+		mBatch.clear();
+		uint64_t dropped = 0;
+		{
+			std::lock_guard<std::mutex> lock(mRingsMutex);
+			for (auto it = mRings.begin(); it != mRings.end();)
+			{
+				LogRing &ring = **it;
+				ring.Drain(mBatch, kMaxDrainPerRing);
+				dropped += ring.mDropped.exchange(0, std::memory_order_relaxed);
+				if (ring.mRetired.load(std::memory_order_acquire) && ring.Empty())
+				{
+					it = mRings.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+		}
+
+		if (mBatch.empty() && dropped == 0)
+		{
+			return 0;
+		}
+
+		// 스레드 간 순서는 캡처 시각으로 맞춘다 (같은 시각이면 링 순서 유지).
+		std::stable_sort(mBatch.begin(), mBatch.end(),
+			[](const LogRecord &a, const LogRecord &b) { return a.mTime < b.mTime; });
+
+		mOut.clear();
+		for (const auto &record : mBatch)
+		{
+			AppendFormatted(mOut, record);
+		}
+		if (dropped > 0)
+		{
+			mTotalDropped.fetch_add(dropped, std::memory_order_relaxed);
+			AppendPrefix(mOut, LogLevel::Warn, std::chrono::system_clock::now());
+			mOut.append("[Logger] ").append(std::to_string(dropped))
+			    .append(" records dropped (ring full)\n");
+		}
+		WriteOut(mOut);
+
+		const size_t count = mBatch.size();
+		mBatch.clear();
+		return count > 0 ? count : 1;
+	}
+
+	// 라이터 정지 후 경로 — 호출 스레드에서 즉시 기록
+	void WriteDirect(const LogRecord &record)
+	{
+		std::lock_guard<std::mutex> writeLock(mWriteMutex);
+		mOut.clear();
+		AppendFormatted(mOut, record);
+		WriteOut(mOut);
+	}
+
+	// 호출자가 mWriteMutex를 보유해야 한다.
+	void WriteOut(const std::string &text)
+	{
+		if (text.empty())
+		{
+			return;
+		}
+		if (mConsoleEnabled.load(std::memory_order_relaxed))
+		{
+			std::fwrite(text.data(), 1, text.size(), stdout);
+			std::fflush(stdout);
+		}
+		std::lock_guard<std::mutex> lock(mSinkMutex);
+		if (mFileSink.IsOpen())
+		{
+			mFileSink.Write(text.data(), text.size());
+			mFileSink.Flush();
+		}
+	}
+
+	// "[HH:MM:SS] [LEVEL] message\n" — 호출자가 mWriteMutex를 보유해야 한다.
+	void AppendFormatted(std::string &out, const LogRecord &record)
+	{
+		AppendPrefix(out, record.mLevel, record.mTime);
+		if (record.mFormat)
+		{
+			AppendLogFormat(out, record.mFormat, record.mArgs);
+		}
+		else if (!record.mArgs.Empty())
+		{
+			AppendLogFormat(out, record.mMessage.c_str(), record.mArgs);
+		}
+		else
+		{
+			out.append(record.mMessage);
+		}
+		if (record.mSuppressed > 0)
+		{
+			out.append(" (").append(std::to_string(record.mSuppressed)).append(" similar suppressed)");
+		}
+		out.push_back('\n');
+	}
+
+	// "[HH:MM:SS] [LEVEL] " — strftime은 초가 바뀔 때만 호출한다.
+	void AppendPrefix(std::string &out, LogLevel level,
+	                  std::chrono::system_clock::time_point time)
+	{
+		const std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+		if (seconds != mCachedSecond)
+		{
+			std::tm localTime{};
+#if defined(IS_WINDOWS)
+			localtime_s(&localTime, &seconds);
+#else
+			localtime_r(&seconds, &localTime);
+#endif
+			std::strftime(mCachedTime, sizeof(mCachedTime), "%H:%M:%S", &localTime);
+			mCachedSecond = seconds;
+		}
+
+		const char *levelStr = "???";
+		switch (level)
+		{
+		case LogLevel::Debug: levelStr = "DEBUG"; break;
+		case LogLevel::Info:  levelStr = "INFO";  break;
+		case LogLevel::Warn:  levelStr = "WARN";  break;
+		case LogLevel::Err:   levelStr = "ERROR"; break;
+		}
+
+		out.append("[").append(mCachedTime).append("] [").append(levelStr).append("] ");
+	}
+
+	// 링 레지스트리 (등록은 스레드당 1회, 라이터는 라운드당 1회 잠금)
+	std::mutex                            mRingsMutex;
+	std::vector<std::shared_ptr<LogRing>> mRings;
+	std::atomic<size_t>                   mRingCapacity{kDefaultRingCapacity};
+
+	// 라이터 수명/깨우기/Flush 동기화
+	std::thread             mWriter;
+	std::mutex              mWakeMutex;
+	std::condition_variable mWakeCV;
+	std::condition_variable mFlushedCV;
+	bool                    mRunning        = true;
+	uint64_t                mFlushRequested = 0;
+	uint64_t                mFlushCompleted = 0;
+	std::atomic<bool>       mWriterIdle{false};
+	std::atomic<bool>       mStopped{false};
+
+	// 출력 (mWriteMutex: 라이터 ↔ 정지 후 동기 기록 직렬화)
+	std::mutex             mWriteMutex;
+	std::vector<LogRecord> mBatch;
+	std::string            mOut;
+	std::time_t            mCachedSecond = -1;
+	char                   mCachedTime[16] = {0};
+
+	std::mutex  mSinkMutex;
+	LogFileSink mFileSink;
+	size_t      mMaxFileBytes = 0;
+	size_t      mMaxFileCount = 1;
+
+	std::atomic<bool>              mConsoleEnabled{true};
+	std::atomic<LogOverflowPolicy> mPolicy{LogOverflowPolicy::Drop};
+	std::atomic<uint64_t>          mTotalDropped{0};
+};
+
+} // namespace Network::Utils
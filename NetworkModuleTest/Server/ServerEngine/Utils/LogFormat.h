@@ -0,0 +1,295 @@
+#pragma once
+
+// 지연 포맷 로그 인자 — 생산자는 인자를 값으로 캡처만 하고, 문자열 변환은 라이터 스레드가 한다.
+//
+// 포맷 문법 (인자가 1개 이상일 때만 해석):
+//   {}      다음 인자를 기본 형식으로 출력
+//   {:.Nf}  실수 인자를 소수점 N자리(0~99)로 출력 (정수 인자에는 무시)
+//   {{ }}   중괄호 문자 그대로
+//   그 외 '{...}' 형태는 자리표시자가 아니며 글자 그대로 출력한다.
+//   인자가 모자라면 "{}"를 그대로 남기고, 남는 인자는 버린다.
+//   인자가 없으면 포맷 문자열을 그대로 출력한다 (기존 메시지 호환).
+//
+// 지원 타입: 정수/bool/char/enum, float/double, 포인터, const char*/std::string/std::string_view.
+// 그 외 타입은 static_assert로 컴파일 단계에서 거부한다 (암묵적 to_string 없음).
+// 문자열 인자는 값으로 복사된다 — 호출 후 원본이 사라져도 안전하다.
+//
+// 직렬화 버퍼는 kInlineBytes까지 레코드 안에 두고, 넘치면 그때만 힙으로 옮긴다.
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Network::Utils
+{
+
+enum class LogArgType : uint8_t
+{
+	Int = 0,
+	UInt,
+	Double,
+	Bool,
+	Char,
+	Pointer,
+	String
+};
+
+// =============================================================================
+// LogArgBuffer — [type][payload] 나열. String은 [type][uint32 len][bytes].
+// =============================================================================
+
+class LogArgBuffer
+{
+public:
+	static constexpr size_t kInlineBytes = 96;
+
+	uint32_t Count() const { return mCount; }
+	bool Empty() const { return mCount == 0; }
+
+	const char *Data() const { return mSpill.empty() ? mInline : mSpill.data(); }
+	size_t Size() const { return mSpill.empty() ? mSize : mSpill.size(); }
+
+	template <typename... Args>
+	void Capture(const Args &...args)
+	{
+		(Add(args), ...);
+	}
+
+private:
+	template <typename T>
+	void Add(const T &value)
+	{
+		using U = std::decay_t<T>;
+		if constexpr (std::is_same_v<U, bool>)
+		{
+			AddScalar(LogArgType::Bool, static_cast<uint8_t>(value ? 1 : 0));
+		}
+		else if constexpr (std::is_same_v<U, char>)
+		{
+			AddScalar(LogArgType::Char, value);
+		}
+		else if constexpr (std::is_enum_v<U>)
+		{
+			Add(static_cast<std::underlying_type_t<U>>(value));
+		}
+		else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)
+		{
+			AddScalar(LogArgType::Int, static_cast<int64_t>(value));
+		}
+		else if constexpr (std::is_integral_v<U>)
+		{
+			AddScalar(LogArgType::UInt, static_cast<uint64_t>(value));
+		}
+		else if constexpr (std::is_floating_point_v<U>)
+		{
+			AddScalar(LogArgType::Double, static_cast<double>(value));
+		}
+		else if constexpr (std::is_same_v<U, const char *> || std::is_same_v<U, char *>)
+		{
+			const char *text = value;
+			AddString(text ? std::string_view(text) : std::string_view("(null)"));
+		}
+		else if constexpr (std::is_same_v<U, std::string> || std::is_same_v<U, std::string_view>)
+		{
+			AddString(std::string_view(value));
+		}
+		else if constexpr (std::is_pointer_v<U>)
+		{
+			AddScalar(LogArgType::Pointer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(static_cast<const void *>(value))));
+		}
+		else
+		{
+			static_assert(sizeof(U) == 0, "Unsupported log argument type - convert explicitly");
+		}
+	}
+
+	template <typename T>
+	void AddScalar(LogArgType type, T value)
+	{
+		const uint8_t tag = static_cast<uint8_t>(type);
+		Append(&tag, 1);
+		Append(&value, sizeof(value));
+		++mCount;
+	}
+
+	void AddString(std::string_view text)
+	{
+		const uint8_t  tag = static_cast<uint8_t>(LogArgType::String);
+		const uint32_t len = static_cast<uint32_t>(text.size());
+		Append(&tag, 1);
+		Append(&len, sizeof(len));
+		Append(text.data(), text.size());
+		++mCount;
+	}
+
+	void Append(const void *data, size_t size)
+	{
+		if (mSpill.empty() && mSize + size <= kInlineBytes)
+		{
+			std::memcpy(mInline + mSize, data, size);
+			mSize += size;
+			return;
+		}
+		if (mSpill.empty())
+		{
+			mSpill.assign(mInline, mSize);
+		}
+		mSpill.append(static_cast<const char *>(data), size);
+	}
+
+	uint32_t    mCount = 0;
+	uint32_t    mSize  = 0;
+	char        mInline[kInlineBytes];
+	std::string mSpill;
+};
+
+// =============================================================================
+// 라이터 측 포맷
+// =============================================================================
+
+namespace LogFormatDetail
+{
+
+template <typename T>
+inline T ReadScalar(const char *&cursor)
+{
+	T value;
+	std::memcpy(&value, cursor, sizeof(T));
+	cursor += sizeof(T);
+	return value;
+}
+
+template <typename T>
+inline void AppendInteger(std::string &out, T value, int base = 10)
+{
+	char buffer[24];
+	const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value, base);
+	out.append(buffer, result.ptr);
+}
+
+// precision < 0이면 기본 형식(%g)
+inline void AppendArg(std::string &out, const char *&cursor, int precision)
+{
+	const auto type = static_cast<LogArgType>(ReadScalar<uint8_t>(cursor));
+	switch (type)
+	{
+	case LogArgType::Int:
+		AppendInteger(out, ReadScalar<int64_t>(cursor));
+		break;
+	case LogArgType::UInt:
+		AppendInteger(out, ReadScalar<uint64_t>(cursor));
+		break;
+	case LogArgType::Double:
+	{
+		char buffer[64];
+		const double value = ReadScalar<double>(cursor);
+		const int written = precision >= 0
+			? std::snprintf(buffer, sizeof(buffer), "%.*f", precision, value)
+			: std::snprintf(buffer, sizeof(buffer), "%g", value);
+		if (written > 0)
+		{
+			out.append(buffer, static_cast<size_t>(written) < sizeof(buffer)
+				? static_cast<size_t>(written) : sizeof(buffer) - 1);
+		}
+		break;
+	}
+	case LogArgType::Bool:
+		out.append(ReadScalar<uint8_t>(cursor) ? "true" : "false");
+		break;
+	case LogArgType::Char:
+		out.push_back(ReadScalar<char>(cursor));
+		break;
+	case LogArgType::Pointer:
+		out.append("0x");
+		AppendInteger(out, ReadScalar<uint64_t>(cursor), 16);
+		break;
+	case LogArgType::String:
+	{
+		const uint32_t len = ReadScalar<uint32_t>(cursor);
+		out.append(cursor, len);
+		cursor += len;
+		break;
+	}
+	}
+}
+
+} // namespace LogFormatDetail
+
+// format에 args를 치환하여 out 뒤에 붙인다.
+// 자리표시자는 "{}"와 "{:.Nf}"만 인정한다. 그 밖의 '{'/'}'는 글자 그대로 출력한다
+// (예: "{id}", JSON 조각). 중괄호 자체는 "{{" / "}}"로 쓴다.
+inline void AppendLogFormat(std::string &out, const char *format, const LogArgBuffer &args)
+{
+	if (args.Empty())
+	{
+		out.append(format);
+		return;
+	}
+
+	const char *cursor    = args.Data();
+	uint32_t    remaining = args.Count();
+	const char *p         = format;
+	while (*p)
+	{
+		if (p[0] == '}')
+		{
+			out.push_back('}');
+			p += (p[1] == '}') ? 2 : 1;
+			continue;
+		}
+		if (p[0] != '{')
+		{
+			out.push_back(*p++);
+			continue;
+		}
+		if (p[1] == '{')
+		{
+			out.push_back('{');
+			p += 2;
+			continue;
+		}
+
+		// "{}" 또는 "{:.Nf}" (N은 1~2자리)
+		const char *end       = nullptr;
+		int         precision = -1;
+		if (p[1] == '}')
+		{
+			end = p + 2;
+		}
+		else if (p[1] == ':' && p[2] == '.' && p[3] >= '0' && p[3] <= '9')
+		{
+			const char *d = p + 3;
+			precision = 0;
+			for (int digits = 0; digits < 2 && *d >= '0' && *d <= '9'; ++digits, ++d)
+			{
+				precision = precision * 10 + (*d - '0');
+			}
+			if (d[0] == 'f' && d[1] == '}')
+			{
+				end = d + 2;
+			}
+		}
+		if (!end)
+		{
+			out.push_back(*p++);
+			continue;
+		}
+
+		if (remaining > 0)
+		{
+			LogFormatDetail::AppendArg(out, cursor, precision);
+			--remaining;
+		}
+		else
+		{
+			out.append(p, static_cast<size_t>(end - p));
+		}
+		p = end;
+	}
+}
+
+} // namespace Network::Utils
@@ -12,25 +12,62 @@
 #include <ctime>
 #include <cstring>
 #include <memory>
+#include <type_traits>
+#include "AllocationTag.h"
+#include "LogBackend.h"
 #include "../Network/Core/PlatformDetect.h"
 
 #if defined(IS_WINDOWS)
 #include <windows.h>
 #endif
 
+// English: Compile-time minimum level (0=Debug, 1=Info, 2=Warn, 3=Err).
+//          Calls below it compile to nothing, e.g. -DNET_LOG_MIN_LEVEL=1 strips Debug.
+// 한글: 컴파일 타임 최소 레벨 (0=Debug, 1=Info, 2=Warn, 3=Err).
+//       이보다 낮은 호출은 빈 함수가 된다. 예: -DNET_LOG_MIN_LEVEL=1 이면 Debug 제거.
+#ifndef NET_LOG_MIN_LEVEL
+#define NET_LOG_MIN_LEVEL 0
+#endif
+
 namespace Network::Utils
 {
 // =============================================================================
-// English: Log levels
-// 한글: 로그 레벨
+// English: LogRateLimiter - at most one record per interval for one call site
+// 한글: LogRateLimiter - 호출 지점 하나에 대해 주기당 최대 1건만 통과
 // =============================================================================
 
-enum class LogLevel : int
+// English: Declare as a function-local static next to a hot warning:
+//            static Utils::LogRateLimiter sLimit(1000);
+//            Utils::Logger::Warn(sLimit, "Send queue full - Session: {}", id);
+//          The next record that passes reports how many were suppressed.
+// 한글: 고빈도 경고 옆에 함수 지역 static으로 선언한다 (위 예시).
+//       다음에 통과하는 레코드에 생략된 개수가 함께 기록된다.
+class LogRateLimiter
 {
-	Debug = 0,
-	Info = 1,
-	Warn = 2,
-	Err = 3
+public:
+	explicit LogRateLimiter(uint32_t intervalMs) : mIntervalMs(intervalMs) {}
+
+	// English: true if this call may log; outSuppressed = calls dropped since the last pass
+	// 한글: 이번 호출이 기록 가능하면 true, outSuppressed = 직전 통과 이후 생략 수
+	bool TryAcquire(uint32_t &outSuppressed)
+	{
+		const int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+		int64_t next = mNextAllowedMs.load(std::memory_order_relaxed);
+		if (now < next ||
+			!mNextAllowedMs.compare_exchange_strong(next, now + mIntervalMs, std::memory_order_relaxed))
+		{
+			mSuppressed.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		outSuppressed = mSuppressed.exchange(0, std::memory_order_relaxed);
+		return true;
+	}
+
+private:
+	const uint32_t        mIntervalMs;
+	std::atomic<int64_t>  mNextAllowedMs{0};
+	std::atomic<uint32_t> mSuppressed{0};
 };
 
 // =============================================================================
@@ -38,6 +75,22 @@ enum class LogLevel : int
 // 한글: Logger - 레벨별 로깅 기능 제공
 // =============================================================================
 
+// English: Log calls only enqueue into a per-thread ring; a background writer
+//          formats and writes in batches (see LogBackend.h).
+//          Preferred form: Logger::Info("Session closed - ID: {}", id);
+//          the format must be a string literal, arguments are captured by value
+//          and formatted on the writer thread (see LogFormat.h). A filtered call
+//          costs one compare; nothing is built or allocated.
+//          A non-const char buffer is accepted too, but its format is copied
+//          into the record because the buffer may change before the writer runs.
+//          Logger::Info(std::string) is kept for messages built elsewhere.
+// 한글: 로그 호출은 스레드별 링에 넣기만 하고, 백그라운드 라이터가 포맷·배치 기록한다
+//       (LogBackend.h 참조).
+//       권장 형태: Logger::Info("Session closed - ID: {}", id);
+//       포맷은 문자열 리터럴이어야 하며 인자는 값으로 캡처되어 라이터 스레드에서
+//       포맷된다 (LogFormat.h). 걸러진 호출은 비교 1회뿐이며 문자열 생성·할당이 없다.
+//       const가 아닌 char 버퍼도 받지만, 라이터가 읽기 전에 바뀔 수 있으므로 포맷을 복사한다.
+//       Logger::Info(std::string)은 이미 만들어진 메시지용으로 유지한다.
 class Logger
 {
 public:
@@ -45,78 +98,145 @@ public:
 	// 한글: 최소 로그 레벨 설정
 	static void SetLevel(LogLevel level) { sCurrentLevel.store(level); }
 
-	// English: Set log file path and open file for writing
-	// 한글: 로그 파일 경로 설정 및 쓰기용 파일 열기
+	// English: Set log file path (append mode; empty path closes the file)
+	// 한글: 로그 파일 경로 설정 (추가 모드, 빈 경로면 파일 닫기)
 	static void SetLogFile(const std::string &filename)
 	{
-		std::lock_guard<std::mutex> lock(sMutex);
-		sLogFile = filename;
-		
-		// English: Open log file in append mode
-		// 한글: 추가 모드로 로그 파일 열기
-		if (!filename.empty())
+		if (!LogBackend::Instance().SetLogFile(filename))
 		{
-			sLogFileStream = std::make_unique<std::ofstream>(filename, std::ios::app);
-			if (!sLogFileStream->is_open())
-			{
-				sLogFileStream.reset();
-				std::cerr << "[Logger] Failed to open log file: " << filename << std::endl;
-			}
-		}
-		else
-		{
-			sLogFileStream.reset();
+			std::cerr << "[Logger] Failed to open log file: " << filename << std::endl;
 		}
 	}
 
+	// English: Size-based rotation (maxFiles includes the active file; 0 bytes = off)
+	// 한글: 크기 기반 로테이션 (maxFiles는 현재 파일 포함 개수, 0바이트 = 끔)
+	static void SetRotation(size_t maxFileBytes, size_t maxFiles)
+	{
+		LogBackend::Instance().SetRotation(maxFileBytes, maxFiles);
+	}
+
+	// English: Enable/disable console output
+	// 한글: 콘솔 출력 사용 여부
+	static void SetConsoleOutput(bool enabled) { LogBackend::Instance().SetConsoleEnabled(enabled); }
+
+	// English: What to do when a thread's ring is full (Err is never dropped)
+	// 한글: 스레드 링이 가득 찼을 때 정책 (Err는 항상 보존)
+	static void SetOverflowPolicy(LogOverflowPolicy policy) { LogBackend::Instance().SetOverflowPolicy(policy); }
+
 	// English: Log debug message
 	// 한글: 디버그 메시지 로깅
-	template <typename... Args>
-	static void Debug(const std::string &format, Args... /*args*/)
+	template <typename Char, size_t N, typename... Args>
+	static void Debug(Char (&format)[N], const Args &...args)
 	{
-		WriteLog(LogLevel::Debug, format);
+		Log<LogLevel::Debug, std::is_const_v<Char>>(nullptr, format, args...);
+	}
+
+	template <typename Char, size_t N, typename... Args>
+	static void Debug(LogRateLimiter &limiter, Char (&format)[N], const Args &...args)
+	{
+		Log<LogLevel::Debug, std::is_const_v<Char>>(&limiter, format, args...);
+	}
+
+	static void Debug(std::string message)
+	{
+		if (IsEnabled(LogLevel::Debug))
+		{
+			WriteLog(LogLevel::Debug, std::move(message));
+		}
 	}
 
 	// English: Log info message
 	// 한글: 정보 메시지 로깅
-	template <typename... Args>
-	static void Info(const std::string &format, Args... /*args*/)
+	template <typename Char, size_t N, typename... Args>
+	static void Info(Char (&format)[N], const Args &...args)
+	{
+		Log<LogLevel::Info, std::is_const_v<Char>>(nullptr, format, args...);
+	}
+
+	template <typename Char, size_t N, typename... Args>
+	static void Info(LogRateLimiter &limiter, Char (&format)[N], const Args &...args)
 	{
-		WriteLog(LogLevel::Info, format);
+		Log<LogLevel::Info, std::is_const_v<Char>>(&limiter, format, args...);
+	}
+
+	static void Info(std::string message)
+	{
+		if (IsEnabled(LogLevel::Info))
+		{
+			WriteLog(LogLevel::Info, std::move(message));
+		}
 	}
 
 	// English: Log warning message
 	// 한글: 경고 메시지 로깅
-	template <typename... Args>
-	static void Warn(const std::string &format, Args... /*args*/)
+	template <typename Char, size_t N, typename... Args>
+	static void Warn(Char (&format)[N], const Args &...args)
+	{
+		Log<LogLevel::Warn, std::is_const_v<Char>>(nullptr, format, args...);
+	}
+
+	template <typename Char, size_t N, typename... Args>
+	static void Warn(LogRateLimiter &limiter, Char (&format)[N], const Args &...args)
+	{
+		Log<LogLevel::Warn, std::is_const_v<Char>>(&limiter, format, args...);
+	}
+
+	static void Warn(std::string message)
 	{
-		WriteLog(LogLevel::Warn, format);
+		if (IsEnabled(LogLevel::Warn))
+		{
+			WriteLog(LogLevel::Warn, std::move(message));
+		}
 	}
 
 	// English: Log error message
 	// 한글: 오류 메시지 로깅
-	template <typename... Args>
-	static void Error(const std::string &format, Args... /*args*/)
+	template <typename Char, size_t N, typename... Args>
+	static void Error(Char (&format)[N], const Args &...args)
+	{
+		Log<LogLevel::Err, std::is_const_v<Char>>(nullptr, format, args...);
+	}
+
+	template <typename Char, size_t N, typename... Args>
+	static void Error(LogRateLimiter &limiter, Char (&format)[N], const Args &...args)
+	{
+		Log<LogLevel::Err, std::is_const_v<Char>>(&limiter, format, args...);
+	}
+
+	static void Error(std::string message)
 	{
-		WriteLog(LogLevel::Err, format);
+		if (IsEnabled(LogLevel::Err))
+		{
+			WriteLog(LogLevel::Err, std::move(message));
+		}
+	}
+
+	// English: Block until everything logged so far has been written
+	// 한글: 지금까지 남긴 로그가 모두 기록될 때까지 대기
+	static void Flush() { LogBackend::Instance().Flush(); }
+
+	// English: Compile-time floor + runtime level (one relaxed load)
+	// 한글: 컴파일 타임 하한 + 런타임 레벨 (relaxed load 1회)
+	static bool IsEnabled(LogLevel level)
+	{
+		return static_cast<int>(level) >= NET_LOG_MIN_LEVEL &&
+			   static_cast<int>(level) >= static_cast<int>(sCurrentLevel.load(std::memory_order_relaxed));
 	}
 
-	// English: Flush output buffer
-	// 한글: 출력 버퍼 플러시
-	static void Flush() { std::cout.flush(); }
+	// English: Stop the writer thread and drain (also runs at exit)
+	// 한글: 라이터 스레드 정지 및 잔여 기록 (종료 시 자동 호출)
+	static void Shutdown() { LogBackend::Instance().Shutdown(); }
 
 private:
 	static inline std::atomic<LogLevel> sCurrentLevel{LogLevel::Info};
-	static inline std::string sLogFile;
-	static inline std::unique_ptr<std::ofstream> sLogFileStream;
-	static inline std::mutex sMutex;
 	static inline std::atomic<bool> sConsoleInitialized{false};
 
 	// English: Initialize console for UTF-8 output (Korean support)
 	// 한글: 콘솔 UTF-8 출력 초기화 (한글 지원)
 	static void InitConsoleUTF8()
 	{
-		if (sConsoleInitialized.exchange(true))
+		if (sConsoleInitialized.load(std::memory_order_relaxed) ||
+			sConsoleInitialized.exchange(true))
 		{
 			return; // English: Already initialized / 한글: 이미 초기화됨
 		}
@@ -129,75 +249,58 @@ private:
 #endif
 	}
 
-	// English: Write log message with level check to console and file
-	// 한글: 레벨 확인 후 콘솔과 파일에 로그 메시지 작성
-	static void WriteLog(LogLevel level, const std::string &message)
+	// English: Deferred-format path: level check first, then capture args by value.
+	//          StaticFormat=false (non-const buffer): the format text is copied too.
+	// 한글: 지연 포맷 경로 — 레벨 확인이 먼저, 통과 시에만 인자를 값으로 캡처.
+	//       StaticFormat=false(비-const 버퍼)면 포맷 문자열도 복사한다.
+	template <LogLevel Level, bool StaticFormat, typename... Args>
+	static void Log(LogRateLimiter *limiter, const char *format, const Args &...args)
 	{
-		// English: Ensure console is initialized for UTF-8 on first use
-		// 한글: 최초 사용 시 콘솔 UTF-8 초기화 보장
-		InitConsoleUTF8();
-
-		if (static_cast<int>(level) < static_cast<int>(sCurrentLevel.load()))
+		if constexpr (static_cast<int>(Level) < NET_LOG_MIN_LEVEL)
 		{
 			return;
 		}
-
-		std::string formatted = FormatMessage(level, message);
-
-		std::lock_guard<std::mutex> lock(sMutex);
-		
-		// English: Write to console
-		// 한글: 콘솔에 작성
-		std::cout << formatted << std::endl;
-		
-		// English: Write to file if available
-		// 한글: 파일이 있으면 파일에도 작성
-		if (sLogFileStream && sLogFileStream->is_open())
+		else
 		{
-			*sLogFileStream << formatted << std::endl;
-			sLogFileStream->flush();
+			if (static_cast<int>(Level) < static_cast<int>(sCurrentLevel.load(std::memory_order_relaxed)))
+			{
+				return;
+			}
+
+			AllocTagScope allocTag(AllocTag::Logger);
+			LogRecord record;
+			if (limiter && !limiter->TryAcquire(record.mSuppressed))
+			{
+				return;
+			}
+
+			InitConsoleUTF8();
+
+			record.mLevel = Level;
+			if constexpr (StaticFormat)
+			{
+				record.mFormat = format;
+			}
+			else
+			{
+				record.mMessage.assign(format);
+			}
+			record.mArgs.Capture(args...);
+			LogBackend::Instance().Submit(record);
 		}
 	}
 
-	// English: Format log message with timestamp and level (optimized)
-	// 한글: 타임스탬프와 레벨로 로그 메시지 포맷 (최적화)
-	static std::string FormatMessage(LogLevel level, const std::string &message)
+	// English: Hand an already-built message to this thread's ring
+	// 한글: 완성된 메시지를 현재 스레드 링에 전달
+	static void WriteLog(LogLevel level, std::string message)
 	{
-		const char *levelStr = "???";
-		switch (level)
-		{
-		case LogLevel::Debug:
-			levelStr = "DEBUG";
-			break;
-		case LogLevel::Info:
-			levelStr = "INFO";
-			break;
-		case LogLevel::Warn:
-			levelStr = "WARN";
-			break;
-		case LogLevel::Err:
-			levelStr = "ERROR";
-			break;
-		}
+		AllocTagScope allocTag(AllocTag::Logger);
 
-		auto now = std::chrono::system_clock::now();
-		auto time = std::chrono::system_clock::to_time_t(now);
+		// English: Ensure console is initialized for UTF-8 on first use
+		// 한글: 최초 사용 시 콘솔 UTF-8 초기화 보장
+		InitConsoleUTF8();
 
-		char timeStr[32];
-		std::tm localTime;
-#if defined(IS_WINDOWS)
-		localtime_s(&localTime, &time);
-#else
-		localtime_r(&time, &localTime);
-#endif
-		std::strftime(timeStr, sizeof(timeStr), "%H:%M:%S", &localTime);
-
-		// English: Use string reserve and append to avoid multiple allocations
-		// 한글: 여러 할당을 피하기 위해 string reserve 및 append 사용
-		std::string result;
-		result.reserve(64 + message.size());
-		result.append("[").append(timeStr).append("] [").append(levelStr).append("] ").append(message);
-		return result;
+		LogBackend::Instance().Submit(level, std::move(message));
 	}
 };
 
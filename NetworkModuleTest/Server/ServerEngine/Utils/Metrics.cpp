@@ -0,0 +1,397 @@
+// 메트릭 레지스트리 구현 — 등록/컬렉터 관리와 Prometheus 텍스트 직렬화
+
+#include "Metrics.h"
+#include "Logger.h"
+#include <cmath>
+#include <cstdio>
+
+namespace Network::Utils
+{
+
+namespace
+{
+void AppendEscaped(std::string &out, const std::string &value, bool escapeQuote)
+{
+	for (char c : value)
+	{
+		if (c == '\\')
+		{
+			out += "\\\\";
+		}
+		else if (c == '\n')
+		{
+			out += "\\n";
+		}
+		else if (escapeQuote && c == '"')
+		{
+			out += "\\\"";
+		}
+		else
+		{
+			out += c;
+		}
+	}
+}
+
+// `{k="v",...,extraKey="extraValue"}` — 레이블이 없으면 빈 문자열
+void AppendLabels(std::string &out, const MetricLabels &labels,
+                  const char *extraKey = nullptr, const std::string &extraValue = {})
+{
+	if (labels.empty() && extraKey == nullptr)
+	{
+		return;
+	}
+	out += '{';
+	bool first = true;
+	for (const auto &label : labels)
+	{
+		if (!first)
+		{
+			out += ',';
+		}
+		first = false;
+		out += label.first;
+		out += "=\"";
+		AppendEscaped(out, label.second, true);
+		out += '"';
+	}
+	if (extraKey != nullptr)
+	{
+		if (!first)
+		{
+			out += ',';
+		}
+		out += extraKey;
+		out += "=\"";
+		out += extraValue;
+		out += '"';
+	}
+	out += '}';
+}
+
+void AppendDouble(std::string &out, double value)
+{
+	if (std::isnan(value))
+	{
+		out += "NaN";
+		return;
+	}
+	if (std::isinf(value))
+	{
+		out += value > 0 ? "+Inf" : "-Inf";
+		return;
+	}
+	char buffer[32];
+	std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+	out += buffer;
+}
+
+std::string SecondsLabel(uint64_t ns)
+{
+	std::string out;
+	AppendDouble(out, static_cast<double>(ns) / 1e9);
+	return out;
+}
+} // namespace
+
+// =============================================================================
+// MetricsWriter
+// =============================================================================
+
+MetricsWriter::Family *MetricsWriter::GetFamily(const std::string &name, const std::string &help,
+                                                const char *type)
+{
+	auto it = mFamilies.find(name);
+	if (it == mFamilies.end())
+	{
+		Family family;
+		family.mHelp = help;
+		family.mType = type;
+		return &mFamilies.emplace(name, std::move(family)).first->second;
+	}
+	if (std::string(it->second.mType) != type)
+	{
+		return nullptr;
+	}
+	return &it->second;
+}
+
+void MetricsWriter::Counter(const std::string &name, const std::string &help, uint64_t value,
+                            const MetricLabels &labels)
+{
+	Family *family = GetFamily(name, help, "counter");
+	if (family == nullptr)
+	{
+		return;
+	}
+	family->mSamples += name;
+	AppendLabels(family->mSamples, labels);
+	family->mSamples += ' ';
+	family->mSamples += std::to_string(value);
+	family->mSamples += '\n';
+}
+
+void MetricsWriter::Gauge(const std::string &name, const std::string &help, double value,
+                          const MetricLabels &labels)
+{
+	Family *family = GetFamily(name, help, "gauge");
+	if (family == nullptr)
+	{
+		return;
+	}
+	family->mSamples += name;
+	AppendLabels(family->mSamples, labels);
+	family->mSamples += ' ';
+	AppendDouble(family->mSamples, value);
+	family->mSamples += '\n';
+}
+
+void MetricsWriter::Histogram(const std::string &name, const std::string &help,
+                              const LatencyHistogram &histogram, const MetricLabels &labels)
+{
+	Family *family = GetFamily(name, help, "histogram");
+	if (family == nullptr)
+	{
+		return;
+	}
+
+	// HDR 버킷 상한이 들어가는 첫 `le` 경계에 누적 (경계 초과분은 +Inf)
+	constexpr size_t kBoundCount = sizeof(kHistogramBoundsNs) / sizeof(kHistogramBoundsNs[0]);
+	uint64_t counts[kBoundCount] = {};
+	if (histogram.Count() > 0)
+	{
+		size_t bound = 0;
+		for (size_t i = 0; i < LatencyHistogram::kBucketCount; ++i)
+		{
+			const uint64_t n = histogram.BucketCount(i);
+			if (n == 0)
+			{
+				continue;
+			}
+			const uint64_t upper = LatencyHistogram::BucketUpperBound(i);
+			while (bound < kBoundCount && kHistogramBoundsNs[bound] < upper)
+			{
+				++bound;
+			}
+			if (bound == kBoundCount)
+			{
+				break;
+			}
+			counts[bound] += n;
+		}
+	}
+
+	std::string &out = family->mSamples;
+	uint64_t cumulative = 0;
+	for (size_t b = 0; b < kBoundCount; ++b)
+	{
+		cumulative += counts[b];
+		out += name;
+		out += "_bucket";
+		AppendLabels(out, labels, "le", SecondsLabel(kHistogramBoundsNs[b]));
+		out += ' ';
+		out += std::to_string(cumulative);
+		out += '\n';
+	}
+	out += name;
+	out += "_bucket";
+	AppendLabels(out, labels, "le", "+Inf");
+	out += ' ';
+	out += std::to_string(histogram.Count());
+	out += '\n';
+
+	out += name;
+	out += "_sum";
+	AppendLabels(out, labels);
+	out += ' ';
+	AppendDouble(out, static_cast<double>(histogram.Sum()) / 1e9);
+	out += '\n';
+
+	out += name;
+	out += "_count";
+	AppendLabels(out, labels);
+	out += ' ';
+	out += std::to_string(histogram.Count());
+	out += '\n';
+}
+
+std::string MetricsWriter::Render() const
+{
+	std::string out;
+	for (const auto &entry : mFamilies)
+	{
+		const Family &family = entry.second;
+		if (family.mSamples.empty())
+		{
+			continue;
+		}
+		out += "# HELP ";
+		out += entry.first;
+		out += ' ';
+		AppendEscaped(out, family.mHelp, false);
+		out += "\n# TYPE ";
+		out += entry.first;
+		out += ' ';
+		out += family.mType;
+		out += '\n';
+		out += family.mSamples;
+	}
+	return out;
+}
+
+// =============================================================================
+// MetricsRegistry
+// =============================================================================
+
+MetricsRegistry &MetricsRegistry::Instance()
+{
+	// 누수 싱글턴: 정적 소멸 이후 다른 정적 객체 소멸자가 카운터를 갱신해도 안전하다.
+	static MetricsRegistry *sInstance = new MetricsRegistry();
+	return *sInstance;
+}
+
+MetricsRegistry::Entry *MetricsRegistry::FindOrCreate(Kind kind, const std::string &name,
+                                                      const std::string &help,
+                                                      const MetricLabels &labels)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	bool exported = true;
+	auto kindIt = mKinds.find(name);
+	if (kindIt == mKinds.end())
+	{
+		mKinds.emplace(name, kind);
+	}
+	else if (kindIt->second != kind)
+	{
+		Logger::Error("MetricsRegistry: '{}' already registered with a different type - not exported", name);
+		exported = false;
+	}
+
+	if (exported)
+	{
+		for (auto &entry : mEntries)
+		{
+			if (entry->mExported && entry->mName == name && entry->mLabels == labels)
+			{
+				return entry.get();
+			}
+		}
+	}
+
+	auto entry = std::make_unique<Entry>();
+	entry->mKind     = kind;
+	entry->mName     = name;
+	entry->mHelp     = help;
+	entry->mLabels   = labels;
+	entry->mExported = exported;
+	switch (kind)
+	{
+	case Kind::Counter:
+		entry->mCounter = std::make_unique<MetricCounter>();
+		break;
+	case Kind::Gauge:
+		entry->mGauge = std::make_unique<MetricGauge>();
+		break;
+	case Kind::Histogram:
+		entry->mHistogram = std::make_unique<MetricHistogram>();
+		break;
+	}
+	mEntries.push_back(std::move(entry));
+	return mEntries.back().get();
+}
+
+MetricCounter &MetricsRegistry::Counter(const std::string &name, const std::string &help,
+                                        const MetricLabels &labels)
+{
+	return *FindOrCreate(Kind::Counter, name, help, labels)->mCounter;
+}
+
+MetricGauge &MetricsRegistry::Gauge(const std::string &name, const std::string &help,
+                                    const MetricLabels &labels)
+{
+	return *FindOrCreate(Kind::Gauge, name, help, labels)->mGauge;
+}
+
+MetricHistogram &MetricsRegistry::Histogram(const std::string &name, const std::string &help,
+                                            const MetricLabels &labels)
+{
+	return *FindOrCreate(Kind::Histogram, name, help, labels)->mHistogram;
+}
+
+MetricsRegistry::CollectorId MetricsRegistry::AddCollector(Collector collector)
+{
+	if (!collector)
+	{
+		return 0;
+	}
+	std::lock_guard<std::mutex> lock(mMutex);
+	const CollectorId id = mNextCollectorId++;
+	mCollectors.emplace_back(id, std::move(collector));
+	return id;
+}
+
+void MetricsRegistry::RemoveCollector(CollectorId id)
+{
+	if (id == 0)
+	{
+		return;
+	}
+	// 진행 중인 스크레이프가 끝난 뒤 제거 — 반환 후 컬렉터가 캡처한 객체를 해제해도 안전
+	std::lock_guard<std::mutex> collectLock(mCollectMutex);
+	std::lock_guard<std::mutex> lock(mMutex);
+	for (auto it = mCollectors.begin(); it != mCollectors.end(); ++it)
+	{
+		if (it->first == id)
+		{
+			mCollectors.erase(it);
+			return;
+		}
+	}
+}
+
+std::string MetricsRegistry::RenderPrometheus()
+{
+	std::lock_guard<std::mutex> collectLock(mCollectMutex);
+
+	MetricsWriter writer;
+	std::vector<Collector> collectors;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		for (const auto &entry : mEntries)
+		{
+			if (!entry->mExported)
+			{
+				continue;
+			}
+			switch (entry->mKind)
+			{
+			case Kind::Counter:
+				writer.Counter(entry->mName, entry->mHelp, entry->mCounter->Value(), entry->mLabels);
+				break;
+			case Kind::Gauge:
+				writer.Gauge(entry->mName, entry->mHelp,
+				             static_cast<double>(entry->mGauge->Value()), entry->mLabels);
+				break;
+			case Kind::Histogram:
+				writer.Histogram(entry->mName, entry->mHelp, entry->mHistogram->Snapshot(),
+				                 entry->mLabels);
+				break;
+			}
+		}
+		collectors.reserve(mCollectors.size());
+		for (const auto &collector : mCollectors)
+		{
+			collectors.push_back(collector.second);
+		}
+	}
+
+	// 컬렉터는 mMutex 밖에서 실행 — 컬렉터가 Counter() 등을 호출해도 교착하지 않는다.
+	for (const auto &collector : collectors)
+	{
+		collector(writer);
+	}
+	return writer.Render();
+}
+
+} // namespace Network::Utils
@@ -0,0 +1,253 @@
+#pragma once
+
+// 프로세스 내 메트릭 레지스트리 (카운터 / 게이지 / 히스토그램) + Prometheus 텍스트 출력.
+//
+// 핫 패스 설계:
+//   - MetricCounter / MetricHistogram은 kShardCount개의 캐시 라인 정렬 셀로 나뉜다.
+//     각 스레드는 처음 기록할 때 셀 하나를 배정받아(라운드로빈) 그 셀만 갱신하므로,
+//     스레드 수가 kShardCount 이하이면 셀 간 캐시 라인 공유가 없다.
+//   - 합산은 스크레이프 시점에만 한다 (Value() / Snapshot()).
+//   - MetricGauge는 단일 atomic — 상태 값(큐 깊이, 풀 크기 등) 전용이며 핫 패스에 두지 않는다.
+//     자주 바뀌는 상태는 컬렉터(AddCollector)로 스크레이프 시점에 읽는 편이 낫다.
+//
+// 레지스트리:
+//   - Counter()/Gauge()/Histogram()은 이름+레이블로 가져오거나 생성한다. 반환 참조는
+//     프로세스 종료까지 유효하다 (등록 해제 없음 — 지점별 static 참조로 캐시해 쓴다).
+//   - 기존 컴포넌트 통계(엔진, 디스패처, 작업 큐 등)는 AddCollector()로 등록한 함수가
+//     스크레이프 시점에 MetricsWriter에 기록한다. 컴포넌트 종료 시 RemoveCollector().
+//   - RenderPrometheus()가 text exposition format 0.0.4로 직렬화한다.
+//     히스토그램은 초 단위 `le` 버킷(kHistogramBoundsNs)으로 변환된다. 내부 HDR 버킷
+//     (상대 오차 ~3%)이 경계에 걸치면 다음 `le` 버킷에 집계된다.
+//
+// 헤더의 Add()/Record()는 인라인, 레지스트리/직렬화는 Metrics.cpp.
+
+#include "LatencyHistogram.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Network::Utils
+{
+
+namespace MetricsDetail
+{
+constexpr size_t kShardCount = 16;
+
+inline std::atomic<size_t> sNextShard{0};
+
+// 호출 스레드의 셀 인덱스 (첫 호출 시 라운드로빈 배정, 이후 고정)
+inline size_t ThreadShard()
+{
+	thread_local const size_t sShard =
+		sNextShard.fetch_add(1, std::memory_order_relaxed) % kShardCount;
+	return sShard;
+}
+
+struct alignas(64) CounterCell
+{
+	std::atomic<uint64_t> mValue{0};
+};
+} // namespace MetricsDetail
+
+// 레이블 (키, 값) 목록 — 출력 시 주어진 순서를 유지한다.
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+// =============================================================================
+// MetricCounter — 단조 증가 카운터 (스레드별 셀)
+// =============================================================================
+
+class MetricCounter
+{
+public:
+	void Add(uint64_t delta = 1)
+	{
+		mCells[MetricsDetail::ThreadShard()].mValue.fetch_add(delta, std::memory_order_relaxed);
+	}
+
+	uint64_t Value() const
+	{
+		uint64_t sum = 0;
+		for (const auto &cell : mCells)
+		{
+			sum += cell.mValue.load(std::memory_order_relaxed);
+		}
+		return sum;
+	}
+
+	void Reset()
+	{
+		for (auto &cell : mCells)
+		{
+			cell.mValue.store(0, std::memory_order_relaxed);
+		}
+	}
+
+private:
+	MetricsDetail::CounterCell mCells[MetricsDetail::kShardCount];
+};
+
+// =============================================================================
+// MetricGauge — 현재 값 (단일 atomic, 콜드 패스 전용)
+// =============================================================================
+
+class MetricGauge
+{
+public:
+	void Set(int64_t value) { mValue.store(value, std::memory_order_relaxed); }
+	void Add(int64_t delta) { mValue.fetch_add(delta, std::memory_order_relaxed); }
+	int64_t Value() const { return mValue.load(std::memory_order_relaxed); }
+
+private:
+	std::atomic<int64_t> mValue{0};
+};
+
+// =============================================================================
+// MetricHistogram — 나노초 지연 분포 (스레드별 ConcurrentLatencyHistogram 셀)
+// =============================================================================
+
+class MetricHistogram
+{
+public:
+	void Record(uint64_t valueNs)
+	{
+		mShards[MetricsDetail::ThreadShard()].Record(valueNs);
+	}
+
+	LatencyHistogram Snapshot() const
+	{
+		LatencyHistogram merged;
+		for (const auto &shard : mShards)
+		{
+			shard.MergeInto(merged);
+		}
+		return merged;
+	}
+
+	void Reset()
+	{
+		for (auto &shard : mShards)
+		{
+			shard.Reset();
+		}
+	}
+
+private:
+	ConcurrentLatencyHistogram mShards[MetricsDetail::kShardCount];
+};
+
+// =============================================================================
+// MetricsWriter — 스크레이프 1회의 샘플 수집기 (Prometheus family 단위로 묶는다)
+// =============================================================================
+
+class MetricsWriter
+{
+public:
+	// Prometheus 히스토그램 `le` 경계 (나노초). 1us ~ 10s, 1-2.5-5 단계.
+	static constexpr uint64_t kHistogramBoundsNs[] = {
+		1000ull,       2500ull,       5000ull,
+		10000ull,      25000ull,      50000ull,
+		100000ull,     250000ull,     500000ull,
+		1000000ull,    2500000ull,    5000000ull,
+		10000000ull,   25000000ull,   50000000ull,
+		100000000ull,  250000000ull,  500000000ull,
+		1000000000ull, 2500000000ull, 5000000000ull,
+		10000000000ull};
+
+	void Counter(const std::string &name, const std::string &help, uint64_t value,
+	             const MetricLabels &labels = {});
+	void Gauge(const std::string &name, const std::string &help, double value,
+	           const MetricLabels &labels = {});
+	// 나노초 히스토그램을 초 단위 Prometheus 히스토그램으로 기록 (name은 _seconds로 끝나야 한다)
+	void Histogram(const std::string &name, const std::string &help,
+	               const LatencyHistogram &histogram, const MetricLabels &labels = {});
+
+	// family 이름 순으로 HELP/TYPE + 샘플을 직렬화한다.
+	std::string Render() const;
+
+private:
+	struct Family
+	{
+		std::string mHelp;
+		const char *mType = "";
+		std::string mSamples;
+	};
+
+	// 같은 이름의 family가 다른 타입으로 이미 있으면 nullptr (샘플 무시)
+	Family *GetFamily(const std::string &name, const std::string &help, const char *type);
+
+	std::map<std::string, Family> mFamilies;
+};
+
+// =============================================================================
+// MetricsRegistry — 프로세스 전역 레지스트리 (누수 싱글턴, 종료 순서 무관)
+// =============================================================================
+
+class MetricsRegistry
+{
+public:
+	using CollectorId = uint32_t;  // 0 = 무효
+	using Collector   = std::function<void(MetricsWriter &)>;
+
+	static MetricsRegistry &Instance();
+
+	// 이름+레이블로 조회, 없으면 생성. 다른 타입으로 등록된 이름이면 Error 로그 후
+	// 내보내지 않는 별도 인스턴스를 반환한다 (호출자 코드는 그대로 동작).
+	MetricCounter   &Counter(const std::string &name, const std::string &help,
+	                         const MetricLabels &labels = {});
+	MetricGauge     &Gauge(const std::string &name, const std::string &help,
+	                       const MetricLabels &labels = {});
+	MetricHistogram &Histogram(const std::string &name, const std::string &help,
+	                           const MetricLabels &labels = {});
+
+	// 스크레이프마다 호출되는 컬렉터. 호출은 mMutex 밖, 등록 순서대로.
+	CollectorId AddCollector(Collector collector);
+	// 반환 후에는 해당 컬렉터가 실행 중이지 않음을 보장한다 (컬렉터 안에서 호출 금지).
+	void RemoveCollector(CollectorId id);
+
+	// 등록 메트릭 + 컬렉터 출력을 Prometheus text format으로 직렬화
+	std::string RenderPrometheus();
+
+	MetricsRegistry(const MetricsRegistry &) = delete;
+	MetricsRegistry &operator=(const MetricsRegistry &) = delete;
+
+private:
+	MetricsRegistry() = default;
+
+	enum class Kind : uint8_t
+	{
+		Counter,
+		Gauge,
+		Histogram
+	};
+
+	struct Entry
+	{
+		Kind         mKind;
+		std::string  mName;
+		std::string  mHelp;
+		MetricLabels mLabels;
+		std::unique_ptr<MetricCounter>   mCounter;
+		std::unique_ptr<MetricGauge>     mGauge;
+		std::unique_ptr<MetricHistogram> mHistogram;
+		bool         mExported = true;  // 타입 충돌로 만든 인스턴스는 false
+	};
+
+	Entry *FindOrCreate(Kind kind, const std::string &name, const std::string &help,
+	                    const MetricLabels &labels);
+
+	std::mutex                             mMutex;          // mEntries / mKinds / mCollectors 보호
+	std::vector<std::unique_ptr<Entry>>    mEntries;        // 등록 순서 유지, 제거 없음
+	std::map<std::string, Kind>            mKinds;          // family 이름 → 타입 (충돌 검사)
+	std::vector<std::pair<CollectorId, Collector>> mCollectors;
+	CollectorId                            mNextCollectorId = 1;
+	std::mutex                             mCollectMutex;   // 스크레이프 직렬화 — RemoveCollector와 동기화
+};
+
+} // namespace Network::Utils
@@ -50,6 +50,14 @@ constexpr Timestamp INVALID_TIMESTAMP = 0;
 //       하드 한도 (MAX_SEND_QUEUE_DEPTH = 1000)는 PacketDefine.h에 정의.
 constexpr size_t SEND_QUEUE_BACKPRESSURE_THRESHOLD = 64;
 
+// English: Packets Session::RecvAsync() may hold for a coroutine that is not awaiting yet.
+//          At this depth the session pauses recv (RecvPauseReason::RecvAsync) until the
+//          coroutine drains the backlog to half of it. Soft cap: chunks already read still land.
+// 한글: 아직 기다리지 않는 코루틴을 위해 Session::RecvAsync()가 보관하는 패킷 수 상한.
+//       이 깊이에 도달하면 세션 recv를 일시 중지(RecvPauseReason::RecvAsync)하고, 코루틴이
+//       절반까지 소비하면 재개한다. 소프트 상한 — 이미 읽은 청크는 그대로 쌓인다.
+constexpr size_t RECV_ASYNC_PENDING_LIMIT = 256;
+
 constexpr size_t DEFAULT_DB_WORKER_COUNT         = 4; // OrderedTaskQueue (DBServer)
 constexpr size_t DEFAULT_TASK_QUEUE_WORKER_COUNT = 3; // DBTaskQueue (TestServer)
 
@@ -0,0 +1,64 @@
+#pragma once
+
+// 프로파일링/트레이스 공용 헬퍼 (LockProfiling, PacketTrace).
+//   - CurrentThreadId(): 보고서·트레이스에 찍는 OS 스레드 ID
+//   - FormatDurationNs(): ns 값을 사람이 읽기 쉬운 단위 문자열로
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+#include "../Network/Core/PlatformDetect.h"
+
+#if defined(IS_WINDOWS)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif defined(IS_LINUX)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Network::Utils
+{
+
+// 현재 스레드의 OS 스레드 ID. Linux는 top/perf와 대조할 수 있도록 커널 TID를 쓴다.
+inline uint32_t CurrentThreadId() noexcept
+{
+#if defined(IS_WINDOWS)
+	return static_cast<uint32_t>(::GetCurrentThreadId());
+#elif defined(IS_LINUX)
+	thread_local const uint32_t sTid = static_cast<uint32_t>(::syscall(SYS_gettid));
+	return sTid;
+#else
+	return static_cast<uint32_t>(
+		std::hash<std::thread::id>{}(std::this_thread::get_id()));
+#endif
+}
+
+// ns → "850ns" / "12.3us" / "4.5ms" / "1.25s"
+inline std::string FormatDurationNs(uint64_t ns)
+{
+	char buffer[32];
+	if (ns < 10000)
+	{
+		std::snprintf(buffer, sizeof(buffer), "%lluns", static_cast<unsigned long long>(ns));
+	}
+	else if (ns < 10000000)
+	{
+		std::snprintf(buffer, sizeof(buffer), "%.1fus", static_cast<double>(ns) / 1e3);
+	}
+	else if (ns < 10000000000ull)
+	{
+		std::snprintf(buffer, sizeof(buffer), "%.1fms", static_cast<double>(ns) / 1e6);
+	}
+	else
+	{
+		std::snprintf(buffer, sizeof(buffer), "%.2fs", static_cast<double>(ns) / 1e9);
+	}
+	return buffer;
+}
+
+} // namespace Network::Utils
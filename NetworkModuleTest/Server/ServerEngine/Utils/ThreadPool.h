@@ -69,7 +69,8 @@ public:
 
 		if (!mTasks.Push([task]() { (*task)(); }))
 		{
-			Logger::Warn("[ThreadPool] Task queue full - task dropped");
+			static LogRateLimiter sQueueFullLog(1000);
+			Logger::Warn(sQueueFullLog, "[ThreadPool] Task queue full - task dropped");
 			return false;
 		}
 
@@ -4,6 +4,7 @@
 
 #include "NetworkTypes.h"
 #include <chrono>
+#include <cstdint>
 
 namespace Network::Utils
 {
@@ -38,6 +39,13 @@ public:
 			.count();
 	}
 
+	// 단조 시계 나노초 — I/O 제출/완료 등 구간 지연 측정용 (Linux vDSO, 수십 ns).
+	static uint64_t GetMonotonicNs()
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
 private:
 	Timestamp mStartTime;  // 마지막 Reset() 또는 생성 시점의 steady_clock 밀리초 값
 };
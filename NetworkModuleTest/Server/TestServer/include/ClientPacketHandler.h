@@ -3,10 +3,8 @@
 // TestServer용 클라이언트 패킷 핸들러
 
 #include "Network/Core/Session.h"
-#include "Network/Core/PacketDefine.h"
+#include "Network/Core/PacketRegistry.h"
 #include "Utils/NetworkUtils.h"
-#include <functional>
-#include <unordered_map>
 
 namespace Network::TestServer
 {
@@ -15,31 +13,40 @@ namespace Network::TestServer
     using Core::PacketType;
 
     // =============================================================================
-    // ClientPacketHandler - 펑터 맵을 사용하여 게임 클라이언트 패킷 처리
+    // ClientPacketHandler - 컴파일 타임 디스패치 테이블로 게임 클라이언트 패킷 처리.
+    //
+    //   상태가 없으므로 인스턴스를 만들지 않는다 — 모든 세션이 정적 ProcessPacket과
+    //   프로세스 전역 constexpr 테이블(DispatchTable)을 공유한다.
+    //   크기 검증은 PacketRegistry.h의 PacketTraits 선언을 따라 테이블이 수행한다.
     // =============================================================================
 
     class ClientPacketHandler
     {
     public:
-        // 패킷 핸들러 펑터 타입
-        using PacketHandlerFunc = std::function<void(Core::Session*, const char*, uint32_t)>;
+        ClientPacketHandler() = delete;
 
-        ClientPacketHandler();
-        virtual ~ClientPacketHandler();
+        // 클라이언트로부터 받은 패킷 처리 (헤더/크기 검증 → 테이블 인덱스 → 직접 호출)
+        static void ProcessPacket(Core::Session* session, const char* data, uint32_t size);
 
-        // 클라이언트로부터 받은 패킷 처리 (펑터 맵 디스패치)
-        void ProcessPacket(Core::Session* session, const char* data, uint32_t size);
+        // recv 청크 1개에서 나온 패킷 묶음 처리 (Session::SetOnRecvBatch).
+        //   세션 콜백 호출은 청크당 1회, 묶음 안의 응답은 엔진이 송신 버퍼 1개로 합쳐 한 번에 보낸다.
+        static void ProcessPacketBatch(Core::Session* session, const Core::Session::RecvPacket* packets,
+                                       size_t count);
 
-    private:
-        // 패킷 핸들러 펑터 맵 (PacketType → Handler)
-        std::unordered_map<uint16_t, PacketHandlerFunc> mHandlers;  // 생성자에서 1회 구성 후 read-only (stateless)
+        // 패킷 ID → 로직 디스패처 레인 (Session::SetPacketPriority). 핑/연결은 Control.
+        static Concurrency::TaskPriority PacketPriority(uint16_t packetId)
+        {
+            return DispatchTable::PriorityOf(packetId);
+        }
 
-        // 생성자에서 모든 패킷 핸들러를 등록
-        void RegisterHandlers();
+    private:
+        // 개별 패킷 핸들러 — 테이블이 크기 검증을 마친 뒤 타입 있는 참조로 호출
+        static void HandleConnectRequest(Core::Session* session, const Core::PKT_SessionConnectReq& packet);
+        static void HandlePingRequest(Core::Session* session, const Core::PKT_PingReq& packet);
 
-        // 개별 패킷 핸들러
-        void HandleConnectRequest(Core::Session* session, const Core::PKT_SessionConnectReq* packet);
-        void HandlePingRequest(Core::Session* session, const Core::PKT_PingReq* packet);
+        using DispatchTable = Core::PacketDispatchTable<void, PacketHeader,
+                                                        &ClientPacketHandler::HandleConnectRequest,
+                                                        &ClientPacketHandler::HandlePingRequest>;
     };
 
 } // namespace Network::TestServer
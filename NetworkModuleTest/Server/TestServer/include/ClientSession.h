@@ -52,7 +52,6 @@ namespace Network::TestServer
 
     private:
         bool mConnectionRecorded;                        // 접속 시간 DB 기록 완료 여부 (중복 기록 방지)
-        std::unique_ptr<ClientPacketHandler> mPacketHandler;  // 수신 패킷 디스패처 — 세션 전용 소유
 
         // DB 작업 큐 — weak_ptr로 세션이 큐의 수명을 연장하지 않도록 한다.
         // 매 접근 전 lock(); nullptr이면 큐가 이미 종료된 상태.
@@ -6,11 +6,9 @@
 namespace Network::TestServer { class DBServerTaskQueue; }
 
 #include "Network/Core/Session.h"
-#include "Network/Core/ServerPacketDefine.h"
+#include "Network/Core/PacketRegistry.h"
 #include "Utils/NetworkUtils.h"
 #include <atomic>
-#include <functional>
-#include <unordered_map>
 #include <memory>
 
 namespace Network::TestServer
@@ -18,19 +16,17 @@ namespace Network::TestServer
     using Utils::ConnectionId;
 
     // =============================================================================
-    // DBServerPacketHandler - 펑터 맵을 사용하여 DB 서버 패킷 처리
+    // DBServerPacketHandler - 컴파일 타임 디스패치 테이블로 DB 서버 패킷 처리.
+    //   테이블(DispatchTable)은 프로세스 전역 constexpr — 인스턴스는 핑 시퀀스와 큐 포인터만 가진다.
     // =============================================================================
 
     class DBServerPacketHandler
     {
     public:
-        // 패킷 핸들러 펑터 타입
-        using PacketHandlerFunc = std::function<void(Core::Session*, const char*, uint32_t)>;
-
         DBServerPacketHandler();
         virtual ~DBServerPacketHandler();
 
-        // DB 서버로부터 받은 패킷 처리 (펑터 맵 디스패치)
+        // DB 서버로부터 받은 패킷 처리 (헤더/크기 검증 → 테이블 인덱스 → 직접 호출)
         void ProcessPacket(Core::Session* session, const char* data, uint32_t size);
 
         // DB 서버로 Ping 전송
@@ -42,17 +38,25 @@ namespace Network::TestServer
         // DBQueryRes 응답 라우팅을 위한 DBServerTaskQueue 주입
         void SetTaskQueue(DBServerTaskQueue* queue) { mTaskQueue = queue; }
 
-    private:
-        // 패킷 핸들러 펑터 맵 (ServerPacketType → Handler)
-        std::unordered_map<uint16_t, PacketHandlerFunc> mHandlers;  // 생성자에서 1회 구성 후 read-only (stateless)
-
-        // 생성자에서 모든 패킷 핸들러를 등록
-        void RegisterHandlers();
+        // 패킷 ID → 로직 디스패처 레인 (Session::SetPacketPriority). 퐁은 Control, 배치 응답은 Bulk.
+        static Concurrency::TaskPriority PacketPriority(uint16_t packetId)
+        {
+            return DispatchTable::PriorityOf(packetId);
+        }
 
-        // 개별 패킷 핸들러
-        void HandleServerPongResponse(Core::Session* session, const Core::PKT_ServerPongRes* packet);
-        void HandleDBSavePingTimeResponse(Core::Session* session, const Core::PKT_DBSavePingTimeRes* packet);
-        void HandleDBQueryResponse(Core::Session* session, const Core::PKT_DBQueryRes* packet);
+    private:
+        // 개별 패킷 핸들러 — 테이블이 크기 검증을 마친 뒤 타입 있는 참조로 호출
+        void HandleServerPongResponse(Core::Session* session, const Core::PKT_ServerPongRes& packet);
+        void HandleDBSavePingTimeResponse(Core::Session* session, const Core::PKT_DBSavePingTimeRes& packet);
+        // 단일(PKT_DBQueryRes)/배치(PKT_DBQueryBatchRes) 응답 프레임 모두 처리 — size는 검증된 header.size
+        template <typename Packet>
+        void HandleDBQueryResponse(Core::Session* session, const Packet& packet, uint32_t size);
+
+        using DispatchTable = Core::PacketDispatchTable<DBServerPacketHandler, Core::ServerPacketHeader,
+            &DBServerPacketHandler::HandleServerPongResponse,
+            &DBServerPacketHandler::HandleDBSavePingTimeResponse,
+            &DBServerPacketHandler::HandleDBQueryResponse<Core::PKT_DBQueryRes>,
+            &DBServerPacketHandler::HandleDBQueryResponse<Core::PKT_DBQueryBatchRes>>;
 
     private:
         // 핑 시퀀스 카운터.
@@ -11,15 +11,42 @@
 // Routing:
 //   task   → worker[sessionId % workerCount]  (key-affinity, per-session FIFO)
 //   response → worker[KeyGenerator::GetSlot(requestId)] (slot field in 64-bit KeyId)
+//
+// Pipelining:
+//   Up to inflightWindow requests per session are outstanding at once. Responses may
+//   arrive in any order; they are parked on their in-flight entry and callbacks fire
+//   strictly in submission order once every earlier request has completed.
+//   A per-worker cap (maxOutstanding / workerCount) bounds the total number of
+//   requests on the wire; sessions blocked by the cap wait in a FIFO credit queue.
+// 한글: 세션당 최대 inflightWindow개 요청을 동시에 전송한다. 응답은 순서와 무관하게
+//       도착할 수 있으며, 해당 in-flight 항목에 보관했다가 앞선 요청이 모두 완료되면
+//       제출 순서대로 콜백을 호출한다. 워커별 상한(maxOutstanding / workerCount)으로
+//       전체 미응답 요청 수를 제한하고, 상한에 막힌 세션은 FIFO 대기열에서 기다린다.
+//
+// Batching:
+//   Requests issued during one worker pass are packed into a single variable-length
+//   frame (PKT_DBQueryBatchReq, or PKT_DBQueryReq when only one) and flushed once
+//   at the end of the pass, or earlier when the frame is full.
+// 한글: 워커 한 바퀴 동안 발행된 요청을 가변 길이 프레임 하나로 묶어 패스 끝에
+//       한 번 전송한다 (프레임이 가득 차면 즉시 전송).
+//
+// Flow control:
+//   Tasks accepted but not yet answered count against a per-worker high-water mark.
+//   At the mark the submitting session stops reading its socket; it resumes when the
+//   worker drains to the low-water mark (Core::RecvFlowControl).
+// 한글: 수락 후 콜백 전인 작업 수가 워커별 상한에 닿으면 작업을 넣은 세션이 소켓 읽기를
+//       멈추고, 하한까지 비면 재개한다 (Core::RecvFlowControl).
 
 #include "Utils/KeyGenerator.h"
 #include "Interfaces/ResultCode.h"
-#include "Network/Core/ServerPacketDefine.h"
+#include "Network/Core/RecvFlowControl.h"
+#include "Network/Core/ServerPacketCodec.h"
 #include "Utils/NetworkUtils.h"
 
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -78,10 +105,16 @@ namespace Network::TestServer
         // Lifecycle
         // 한글: 생명주기
         //
-        // workerCount : number of worker threads (max 255 — enforced by if-guard in Initialize)
-        // sendFunc    : injected send function (TestServer::SendDBPacket)
+        // workerCount    : number of worker threads (max 255 — enforced by if-guard in Initialize)
+        // sendFunc       : injected send function (TestServer::SendDBPacket)
+        // inflightWindow : max outstanding requests per session (1 = strict request/response)
+        // maxOutstanding : total outstanding request cap across all workers
+        // flowControl    : per-worker backlog watermarks for pausing submitting sessions (default off)
         bool Initialize(size_t workerCount,
-                        std::function<bool(const void*, uint32_t)> sendFunc);
+                        std::function<bool(const void*, uint32_t)> sendFunc,
+                        size_t inflightWindow = kDefaultInflightWindow,
+                        size_t maxOutstanding = kDefaultMaxOutstanding,
+                        const Core::RecvFlowControl::Options& flowControl = {});
         void Shutdown();
         bool IsRunning() const;
 
@@ -102,6 +135,30 @@ namespace Network::TestServer
 
         size_t GetPendingCount() const;
 
+        // Requests currently sent and awaiting a response (all workers).
+        // 한글: 전송 후 응답 대기 중인 요청 수 (전체 워커 합계).
+        size_t GetInflightCount() const;
+
+        // Deadline heap entries including lazily cancelled ones (all workers,
+        // refreshed once per worker pass).
+        // 한글: 지연 취소 항목을 포함한 마감 heap 크기 (전체 워커 합계, 워커 패스마다 갱신).
+        size_t GetDeadlineCount() const;
+
+        // Per-request response timeout. Call before Initialize().
+        // 한글: 요청별 응답 대기 시간. Initialize() 전에 호출.
+        void SetRequestTimeout(std::chrono::milliseconds timeout) { mRequestTimeout = timeout; }
+
+        // Backlog-driven recv pause state (pause/resume counters, per-worker depth).
+        // 한글: 적체 기반 recv 중지 상태 (중지/재개 횟수, 워커별 적체).
+        const Core::RecvFlowControl& GetFlowControl() const { return mFlowControl; }
+
+        static constexpr size_t kDefaultInflightWindow = 8;
+        static constexpr size_t kDefaultMaxOutstanding = 1024;
+        // Default wait for a DB server response before the request completes with
+        // DBServerTimeout (expected round trip + margin).
+        // 한글: 요청이 DBServerTimeout으로 끝나기 전 기본 응답 대기 시간 (예상 왕복 + 여유).
+        static constexpr std::chrono::milliseconds kDefaultRequestTimeout{5000};
+
     private:
         // =====================================================================
         // Internal response event — DBRecvThread → worker queue
@@ -115,24 +172,52 @@ namespace Network::TestServer
         };
 
         // =====================================================================
-        // Per-session in-flight state
-        // 한글: 세션별 in-flight 상태 (requestId != 0 이면 in-flight)
+        // In-flight request entry — kept in submission order per session
+        // 한글: 세션별 제출 순서대로 유지되는 in-flight 요청 항목
+        // =====================================================================
+        struct InflightRequest
+        {
+            uint64_t    requestId = 0;     // 0 = 전송되지 않은 항목 (검증/전송 실패 결과를 순서대로 전달하기 위해 보관)
+            std::function<void(ResultCode, const std::string&)> callback;  // 완료 순서가 head에 도달하면 호출
+            bool        completed = false; // 응답(또는 실패) 도착 여부 — head가 아니면 여기서 대기 (out-of-order 버퍼)
+            ResultCode  result    = ResultCode::Unknown;  // completed일 때 전달할 결과
+            std::string detail;            // completed일 때 전달할 상세 메시지
+        };
+
+        // =====================================================================
+        // Per-session pipeline state
+        // 한글: 세션별 파이프라인 상태 (inflight가 비어 있고 pending도 비면 항목 제거)
         // =====================================================================
         struct SessionState
         {
-            uint64_t  requestId = 0;   // 0 = idle; != 0 이면 in-flight (KeyGenerator::kInvalid = 0; was uint32_t)
-            std::function<void(ResultCode, const std::string&)> callback;  // in-flight 완료 시 호출; idle 시 null
-            std::queue<DBServerTask> pending;  // in-flight 중 도착한 동일 세션 작업 (순서 보장 대기열)
+            std::deque<InflightRequest> inflight;  // 전송 순서 = 콜백 순서; 최대 mInflightWindow개
+            std::queue<DBServerTask>    pending;   // 윈도우/전체 상한에 막혀 아직 전송하지 못한 작업 (FIFO)
+            size_t                      sentCount = 0;  // inflight 중 실제 전송되어 응답 대기 중인 수 (requestId != 0 && !completed)
+            bool                        waitingCredit = false;  // creditWaiters에 등록됨 (중복 등록 방지)
+        };
 
-            // 현재 in-flight 요청의 마감 시각. requestId != 0일 때만 유효.
-            // ProcessTask에서 요청 전송 시 설정.
-            std::chrono::steady_clock::time_point inflightDeadline;  // kRequestTimeoutMs 초과 시 Timeout 콜백 발동
+        // =====================================================================
+        // Deadline heap entry — min-heap by deadline (lazy cancellation:
+        // entries whose requestId is no longer in requestIndex are skipped)
+        // 한글: 마감 시각 min-heap 항목 (지연 취소: requestIndex에 없으면 무시)
+        // =====================================================================
+        struct DeadlineEntry
+        {
+            std::chrono::steady_clock::time_point deadline;  // 요청 마감 시각 (전송 시각 + mRequestTimeout)
+            uint64_t                              requestId = 0;  // 대상 요청
+
+            bool operator>(const DeadlineEntry& other) const { return deadline > other.deadline; }
         };
 
+        using DeadlineHeap = std::priority_queue<DeadlineEntry,
+                                                 std::vector<DeadlineEntry>,
+                                                 std::greater<DeadlineEntry>>;
+
         // =====================================================================
         // Per-worker data
         //   Shared (mutex):  taskQueue, responseQueue
-        //   Worker-exclusive (no mutex): sessions, seqCounter, index
+        //   Worker-exclusive (no mutex): sessions, requestIndex, creditWaiters,
+        //                                 deadlines, outstanding, keyGen, index
         // =====================================================================
         struct WorkerData
         {
@@ -150,6 +235,13 @@ namespace Network::TestServer
 
             // Worker-exclusive — only touched by this worker's thread
             std::unordered_map<ConnectionId, SessionState> sessions;  // 세션별 in-flight 및 pending 상태 (워커 전용)
+            std::unordered_map<uint64_t, ConnectionId> requestIndex;  // requestId → 세션 (응답 매칭 O(1))
+            std::deque<ConnectionId>    creditWaiters;  // 워커 상한에 막혀 전송 대기 중인 세션 (FIFO 공정성)
+            size_t                      outstanding = 0;  // 이 워커가 전송 후 응답 대기 중인 요청 수
+            DeadlineHeap                deadlines;        // in-flight 마감 시각 min-heap — 워커는 top까지만 sleep
+            std::atomic<size_t>         deadlineCount{0}; // deadlines.size() 관측용 사본 (워커 패스 끝에 relaxed store)
+            Core::DBQueryReqBuilder     batch;            // 이번 패스에 발행된 요청 프레임 (FlushBatch에서 전송)
+            std::vector<std::pair<ConnectionId, uint64_t>> batchRequests;  // batch에 담긴 (세션, requestId) — 전송 실패 시 완료 처리용
             Utils::KeyGenerator         keyGen;  // 충돌 없는 requestId 발급 (tag=DBQuery, slot=index); was seqCounter
             size_t                      index;   // 워커 인덱스 (로그 식별용)
         };
@@ -157,14 +249,40 @@ namespace Network::TestServer
         // Worker thread entry point
         void WorkerThreadFunc(size_t workerIndex);
 
-        // Process a task (check → send or defer).
-        // 한글: 태스크 처리: 검증 → send 또는 pending 보관.
+        // Process a task (append to session pending → fill window).
+        // 한글: 태스크 처리: 세션 pending에 추가 → 윈도우 채우기.
         void ProcessTask(size_t workerIndex, DBServerTask task);
 
-        // Handle a response event (callback → inline next pending).
-        // 한글: 응답 처리: callback 호출 → 다음 pending 1개 inline 처리.
+        // Handle a response event (park result → deliver in-order completions → refill).
+        // 한글: 응답 처리: 결과 보관 → 순서대로 완료 콜백 → 윈도우 재충전.
         void HandleResponse(size_t workerIndex, const DBResponseEvent& resp);
 
+        // Issue pending tasks while the session window and worker cap allow.
+        // 한글: 세션 윈도우와 워커 상한이 허용하는 만큼 pending 작업 전송.
+        void FillWindow(size_t workerIndex, ConnectionId sessionId, SessionState& ss);
+
+        // Check + send one task, appending its in-flight entry.
+        // 한글: 작업 1개 검증 후 전송, in-flight 항목 추가.
+        void IssueTask(size_t workerIndex, SessionState& ss, DBServerTask task);
+
+        // Send the accumulated request frame; on failure complete its entries.
+        // 한글: 누적된 요청 프레임 전송; 실패 시 해당 항목들을 오류로 완료 처리.
+        void FlushBatch(size_t workerIndex);
+
+        // Mark an in-flight entry completed and release its worker credit.
+        // 한글: in-flight 항목을 완료 처리하고 워커 상한 크레딧 반환.
+        void CompleteRequest(WorkerData& worker, SessionState& ss, InflightRequest& req,
+                             ResultCode result, const std::string& detail);
+
+        // Fire callbacks for completed entries at the head of the session, then
+        // refill the window and erase the session if idle.
+        // 한글: 세션 head의 완료 항목 콜백 호출 후 윈도우 재충전, idle이면 세션 제거.
+        void DeliverAndRefill(size_t workerIndex, ConnectionId sessionId);
+
+        // Hand freed worker credits to sessions waiting on the cap.
+        // 한글: 반환된 크레딧을 상한 대기 세션에 분배.
+        void ServeCreditWaiters(size_t workerIndex);
+
         // Drain remaining sessions/queues on shutdown (called after thread join).
         // 한글: 종료 시 남은 세션/큐 드레인 (스레드 join 후 호출).
         void ShutdownDrain(size_t workerIndex);
@@ -173,24 +291,29 @@ namespace Network::TestServer
         // 한글: 타입별 내부 검증 (B 방식; task.checkFunc으로 확장 가능).
         bool CheckTask(const DBServerTask& task);
 
-        // Scan worker sessions for timed-out in-flight requests and fire Timeout callbacks.
-        // Called from the worker thread — sessions map is worker-exclusive (no mutex needed).
-        // 한글: 워커 세션을 순회하여 타임아웃된 in-flight 요청을 찾아 Timeout 콜백 호출.
-        //       워커 스레드에서만 호출 — sessions 맵은 워커 전용 (mutex 불필요).
+        // Pop expired entries from the deadline heap and fire Timeout callbacks.
+        // Entries for already-answered requests are discarded (lazy cancellation).
+        // Called from the worker thread — heap and sessions are worker-exclusive.
+        // 한글: 마감 heap에서 만료 항목을 꺼내 Timeout 콜백 호출. 이미 응답된 요청의
+        //       항목은 버린다 (지연 취소). 워커 스레드 전용 — heap/세션 모두 워커 소유.
         void CheckTimeouts(size_t workerIndex);
 
-    private:
-        // DB 서버 응답 대기 최대 시간 (Timeout 콜백 발동 기준).
-        // 예상 DB 왕복 지연 + 여유를 고려하여 조정.
-        static constexpr int kRequestTimeoutMs = 5000;
+        // Rebuild the heap without cancelled entries once they dominate it.
+        // 한글: 취소된 항목이 대부분을 차지하면 heap 재구성 (메모리 상한 유지).
+        void CompactDeadlines(WorkerData& worker);
 
-        // 타임아웃 확인을 위한 워커 깨움 주기 (밀리초).
-        // 타임아웃을 적시에 감지하려면 kRequestTimeoutMs 이하여야 함.
-        static constexpr int kTimeoutCheckIntervalMs = 1000;
+    private:
+        // 지연 취소 항목이 살아있는 요청 수의 이 배수를 넘으면 heap 재구성.
+        static constexpr size_t kDeadlineCompactFactor = 4;
 
         std::vector<std::unique_ptr<WorkerData>> mWorkers;    // 워커별 데이터 (인덱스 = sessionId % workerCount)
         std::atomic<bool>   mIsRunning{false};               // Initialize 후 true, Shutdown 시 false
         std::atomic<size_t> mPendingCount{0};                // 전체 미처리 작업 수 (relaxed; GetPendingCount lock-free)
+        std::atomic<size_t> mInflightCount{0};               // 전송 후 응답 대기 중인 요청 수 (relaxed; 관측용)
+        size_t              mInflightWindow = kDefaultInflightWindow;  // 세션당 동시 전송 상한 (Initialize 시 설정)
+        size_t              mWorkerOutstandingCap = kDefaultMaxOutstanding;  // 워커당 전송 상한 = maxOutstanding / workerCount
+        std::chrono::milliseconds mRequestTimeout = kDefaultRequestTimeout;  // 요청별 응답 대기 시간 (Initialize 전 설정)
+        Core::RecvFlowControl mFlowControl;  // 워커별 미완료 작업(수락 → 콜백) 적체 → 공급 세션 recv 중지/재개
 
         // Injected send function — TestServer::SendDBPacket
         // 한글: 주입된 send 함수 — TestServer::SendDBPacket
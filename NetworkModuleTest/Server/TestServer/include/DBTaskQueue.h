@@ -7,6 +7,8 @@
 // ServerEngine 헤더 전이 방지를 위한 IDatabase 전방 선언
 namespace Network { namespace Database { class IDatabase; } }
 
+#include "Network/Core/RecvFlowControl.h"
+#include "Utils/Metrics.h"
 #include "Utils/NetworkUtils.h"
 #include <atomic>
 #include <condition_variable>
@@ -17,6 +19,10 @@ namespace Network { namespace Database { class IDatabase; } }
 #include <string>
 #include <thread>
 
+#if NETWORK_ENABLE_COROUTINES
+#include "Concurrency/Coroutine.h"
+#endif
+
 #ifdef _WIN32
 #include <windows.h>
 #else
@@ -93,9 +99,12 @@ namespace Network::TestServer
         ~DBTaskQueue();
 
         // 생명주기
+        //   flowControl: 워커별 적체 수위 — 상한에 닿으면 작업을 넣은 세션의 recv를 멈추고
+        //   하한에서 재개한다 (기본 끔, Core::RecvFlowControl 참고).
         bool Initialize(size_t workerThreadCount = 1,
                         const std::string& walPath = "db_tasks.wal",
-                        Network::Database::IDatabase* db = nullptr);
+                        Network::Database::IDatabase* db = nullptr,
+                        const Core::RecvFlowControl::Options& flowControl = {});
         void Shutdown();
         bool IsRunning() const;
 
@@ -110,10 +119,60 @@ namespace Network::TestServer
         void UpdatePlayerData(ConnectionId sessionId, const std::string& jsonData,
                               std::function<void(bool, const std::string&)> callback = nullptr);
 
-        // 통계 — mQueueSize/mProcessedCount/mFailedCount는 atomic이므로 lock-free 조회
+#if NETWORK_ENABLE_COROUTINES
+        // co_await 버전 EnqueueTask — 콜백 대신 결과를 돌려받는다.
+        //   DB 워커에서 완료되면 코루틴의 디스패처 키(세션 코루틴이면 그 세션)에서 재개된다.
+        //   task.callback은 awaiter가 채우므로 비워서 넘긴다.
+        struct DBTaskResult
+        {
+            bool        success = false;
+            std::string result;
+        };
+
+        class ExecuteAwaiter
+        {
+        public:
+            ExecuteAwaiter(DBTaskQueue& queue, DBTask&& task)
+                : mQueue(queue), mTask(std::move(task))
+            {
+            }
+
+            bool await_ready() const noexcept { return false; }
+
+            template <typename Promise>
+            void await_suspend(std::coroutine_handle<Promise> handle)
+            {
+                mHandle   = handle;
+                mExecutor = &handle.promise().Executor();
+                // this 캡처 8바이트 — std::function 내부 버퍼에 들어간다.
+                // 이 awaiter는 재개 전까지 코루틴 프레임 안에 살아 있다.
+                mTask.callback = [this](bool success, const std::string& result)
+                {
+                    mResult.success = success;
+                    mResult.result  = result;
+                    mExecutor->Resume(mHandle);
+                };
+                mQueue.EnqueueTask(std::move(mTask));
+            }
+
+            DBTaskResult await_resume() { return std::move(mResult); }
+
+        private:
+            DBTaskQueue&                                mQueue;
+            DBTask                                      mTask;
+            DBTaskResult                                mResult;
+            std::coroutine_handle<>                     mHandle;
+            const Network::Concurrency::CoExecutor*     mExecutor = nullptr;
+        };
+
+        ExecuteAwaiter Execute(DBTask task) { return ExecuteAwaiter(*this, std::move(task)); }
+#endif
+
+        // 통계 — mQueueSize/mProcessedCount/mFailedCount 모두 lock-free 조회
         size_t GetQueueSize() const;
         size_t GetProcessedCount() const;
         size_t GetFailedCount() const;
+        const Core::RecvFlowControl& GetFlowControl() const { return mFlowControl; }
 
     private:
         // 워커 스레드 메인 루프 — 자신의 WorkerData::cv에서 대기, 작업 도착 시 pop → ProcessTask
@@ -170,9 +229,12 @@ namespace Network::TestServer
 
         std::atomic<bool>               mIsRunning;      // Initialize 후 true, Shutdown 시 false
 
+        // 워커별 적체 → 공급 세션 recv 중지/재개 (워커 인덱스 = 파티션)
+        Core::RecvFlowControl           mFlowControl;
+
         // 통계
-        std::atomic<size_t>             mProcessedCount;  // 성공 처리된 작업 수 (relaxed, lock-free 조회)
-        std::atomic<size_t>             mFailedCount;     // 실패한 작업 수 (relaxed, lock-free 조회)
+        Utils::MetricCounter            mProcessedCount;  // 성공 처리된 작업 수 (워커별 셀, lock-free 조회)
+        Utils::MetricCounter            mFailedCount;     // 실패한 작업 수 (워커별 셀, lock-free 조회)
 
         // WAL 크래시 복구 멤버
         std::string                     mWalPath;       // WAL 파일 경로
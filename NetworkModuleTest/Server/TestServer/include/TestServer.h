@@ -10,8 +10,10 @@ namespace Network { namespace Database { class IDatabase; } }
 #include "DBServerTaskQueue.h"
 #include "DBTaskQueue.h"
 #include "Concurrency/TimerQueue.h"
+#include "Network/Core/AdminHttpServer.h"
 #include "Network/Core/NetworkEngine.h"
 #include "Network/Core/SessionManager.h"
+#include "Utils/Metrics.h"
 #include "Utils/NetworkUtils.h"
 #include <atomic>
 #include <condition_variable>
@@ -46,6 +48,9 @@ namespace Network::TestServer
         // DB 서버 연결
         bool ConnectToDBServer(const std::string& host, uint16_t port);
 
+        // 관리 포트 Prometheus 엔드포인트 (GET /metrics). Start() 이후 호출.
+        bool StartAdminEndpoint(uint16_t port, const std::string& bindAddress = "127.0.0.1");
+
         // DBServerTaskQueue 셀프 테스트 (check-failure 경로, 네트워크 불필요).
         // 모든 assertion이 통과하면 true 반환.
         bool RunSelfTest();
@@ -66,11 +71,10 @@ namespace Network::TestServer
         void SendDBPing();   // DB 핑 1회 전송 (타이머 콜백)
         void DBReconnectLoop();
 
-    private:
-        // 모든 클라이언트 세션에서 공유하는 패킷 핸들러 (생성 후 stateless).
-        // TestServer 생성자에서 1회 할당, 세션별 OnRecv 콜백에 주입.
-        std::unique_ptr<ClientPacketHandler>        mPacketHandler;       // 클라이언트 패킷 디스패처 (stateless, 공유)
+        // DB 작업 큐 통계를 메트릭 레지스트리로 내보내는 컬렉터
+        void CollectMetrics(Utils::MetricsWriter& writer) const;
 
+    private:
         // 클라이언트 연결 엔진 (멀티플랫폼 지원)
         std::unique_ptr<Core::INetworkEngine>       mClientEngine;        // IOCP/io_uring 등 자동 선택; Stop 시 해제
 
@@ -91,23 +95,31 @@ namespace Network::TestServer
         // 클라이언트 요청을 TestDBServer로 중계하는 비동기 작업 큐
         std::shared_ptr<DBServerTaskQueue>          mDBServerTaskQueue;   // DB 서버 중계 큐; 세션은 weak_ptr로 참조
 
+        // 관리 엔드포인트 — mClientEngine의 추가 리스너, 엔진 Stop 전에 먼저 정지
+        Core::AdminHttpServer                       mAdminServer;         // GET /metrics (AdminPort 0이면 미시작)
+        Utils::MetricsRegistry::CollectorId         mMetricsCollectorId = 0;  // Start에서 등록, Stop에서 해제
+
         // 서버 상태
         std::atomic<bool>                           mIsRunning;          // Start 후 true, Stop 시 false
         uint16_t                                    mPort;               // 클라이언트 리슨 포트 (Initialize 시 설정)
         std::string                                 mDbConnectionString; // 로컬 DB 연결 문자열 (비면 MockDatabase)
         std::string                                 mEngineType;         // 네트워크 엔진 타입 ("auto", "iocp" 등)
 
+        // ─────────────────────────────────────────────
+        // DB 핑 (모든 플랫폼)
+        // ─────────────────────────────────────────────
+        std::atomic<uint32_t>                       mDBPingSequence{0};   // 핑 시퀀스 번호 — 타이머 콜백에서 단조 증가 (relaxed)
+        // 이전의 mDBPingThread를 TimerQueue로 교체 — mDBPingTimer가 핸들 보유.
+        Network::Concurrency::TimerQueue            mTimerQueue;          // 주기적 DB 핑 타이머 스케줄러 (소유)
+        Network::Concurrency::TimerQueue::TimerHandle mDBPingTimer{0};    // 반복 핑 타이머 핸들 (0 = 미등록)
+
 #ifdef _WIN32
         // ─────────────────────────────────────────────
-        // DB 서버 연결 상태 (현재 Windows 전용)
+        // DB 서버 연결 상태 (Windows — 블로킹 소켓 + 전용 recv 스레드)
         // ─────────────────────────────────────────────
         SocketHandle                                mDBServerSocket;      // DB 서버 TCP 소켓 (INVALID_SOCKET = 미연결)
         std::atomic<bool>                           mDBRunning;           // DB 연결 활성 여부; DBRecvLoop 루프 조건
-        std::atomic<uint32_t>                       mDBPingSequence;      // 핑 시퀀스 번호 — 타이머 콜백에서 단조 증가 (relaxed)
         std::thread                                 mDBRecvThread;        // DB 수신 루프 스레드 — DisconnectFromDBServer 시 join
-        // 이전의 mDBPingThread를 TimerQueue로 교체 — mDBPingTimer가 핸들 보유.
-        Network::Concurrency::TimerQueue            mTimerQueue;          // 주기적 DB 핑 타이머 스케줄러 (소유)
-        Network::Concurrency::TimerQueue::TimerHandle mDBPingTimer{0};    // 반복 핑 타이머 핸들 (0 = 미등록)
         std::mutex                                  mDBSendMutex;         // SendDBPacket 직렬화 (다중 스레드 send 방지)
         // 종료 시 재연결 루프 backoff sleep을 즉시 깨우기 위한 조건 변수.
         // Stop()이 notify_all()로 DBReconnectLoop를 중단시킨다.
@@ -125,6 +137,15 @@ namespace Network::TestServer
         // WSAECONNREFUSED(10061, 서버 종료/기동 중)와 기타 오류를 구분하여
         // DBReconnectLoop에서 백오프 전략을 결정한다.
         std::atomic<int>                            mLastDBConnectError{0};  // ConnectToDBServer 실패 시 WSAGetLastError() 결과
+#else
+        // ─────────────────────────────────────────────
+        // DB 서버 연결 상태 (엔진 커넥터 — 클라이언트와 같은 I/O 워커·디스패처 공유)
+        //   재연결 백오프는 엔진 커넥터가 담당하므로 전용 스레드가 없다.
+        // ─────────────────────────────────────────────
+        Core::ConnectorId                           mDBConnectorId = 0;   // mClientEngine에 등록된 커넥터 (0 = 미등록)
+        std::atomic<ConnectionId>                   mDBConnectionId{0};   // 현재 DB 링크 세션 ID (0 = 미연결)
+        // 아웃바운드 세션의 OnRecv 콜백이 참조 — 엔진 Stop() 이후까지 유지한다.
+        std::unique_ptr<DBServerPacketHandler>      mDBPacketHandler;     // DB 서버 수신 패킷 디스패처
 #endif
     };
 
@@ -1,13 +1,18 @@
 // English: TestServer entry point - initializes and runs the game server
 // 한글: TestServer 진입점 - 게임 서버 초기화 및 실행
 
+#include "Network/Core/PacketTrace.h"
 #include "Utils/ConfigManager.h"
 #include "Utils/CrashDump.h"
+#include "Utils/LockProfiling.h"
 #include "Utils/NetworkUtils.h"
 #include "include/TestServer.h"
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <csignal>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <string>
 #include <thread>
@@ -24,6 +29,8 @@
 static Network::TestServer::TestServer *g_pServer = nullptr;
 static std::atomic<bool> g_Running{true};
 static std::atomic<bool> g_ShutdownComplete{false};
+static std::atomic<bool> g_LockReportRequested{false};
+static std::atomic<bool> g_PacketReportRequested{false};
 
 // English: Signal handler for graceful shutdown (SIGINT/SIGTERM)
 // 한글: 정상 종료를 위한 시그널 핸들러 (SIGINT/SIGTERM)
@@ -33,6 +40,24 @@ void SignalHandler(int signum)
 	g_Running = false;
 }
 
+#if defined(NET_LOCK_PROFILING) && !defined(_WIN32)
+// English: SIGUSR1 - request a lock contention report (written by the main loop)
+// 한글: SIGUSR1 - 락 경합 보고서 요청 (메인 루프에서 출력)
+void LockReportSignalHandler(int)
+{
+	g_LockReportRequested = true;
+}
+#endif
+
+#ifndef _WIN32
+// English: SIGUSR2 - request a packet stage latency report (+ Chrome trace if NETMOD_PACKET_TRACE is set)
+// 한글: SIGUSR2 - 패킷 단계별 지연 보고서 요청 (NETMOD_PACKET_TRACE가 있으면 Chrome trace도 기록)
+void PacketReportSignalHandler(int)
+{
+	g_PacketReportRequested = true;
+}
+#endif
+
 #ifdef _WIN32
 // English: Console ctrl handler - catches CTRL_CLOSE_EVENT from taskkill/window close
 //          so that server.Stop() (DisconnectFromDBServer) runs before process exits,
@@ -74,6 +99,9 @@ void PrintUsage(const char *programName)
 	std::cout << "  --db-host <h>   DB server host" << std::endl;
 	std::cout << "  --db-port <p>   DB server port" << std::endl;
 	std::cout << "  --engine <name> Network engine (default: auto)" << std::endl;
+	std::cout << "  -w <n>          DB task queue workers (default: " << Network::Utils::DEFAULT_TASK_QUEUE_WORKER_COUNT << ")" << std::endl;
+	std::cout << "  --admin-port <p> Prometheus /metrics port (default: 0 = disabled)" << std::endl;
+	std::cout << "  --run-to-completion  Run packet handlers inline on I/O threads" << std::endl;
 	std::cout << "  -l <level>      Log level: DEBUG, INFO, WARN, ERROR "
 				 "(default: INFO)"
 				  << std::endl;
@@ -84,9 +112,23 @@ void PrintUsage(const char *programName)
 	std::cout << "  NETMOD_DB_HOST           DB server host" << std::endl;
 	std::cout << "  NETMOD_DB_PORT           DB server port" << std::endl;
 	std::cout << "  NETMOD_ENGINE            Network engine (auto/rio/iocp/epoll/kqueue)" << std::endl;
-	std::cout << "  NETMOD_WORKER_THREADS    Worker thread count (0=auto)" << std::endl;
+	std::cout << "  NETMOD_WORKER_THREADS    I/O thread count (0=CPU count)" << std::endl;
+	std::cout << "  NETMOD_LOGIC_THREADS     Logic worker count (0=4)" << std::endl;
+	std::cout << "  NETMOD_LOGIC_LANE_BURST  Control/normal tasks in a row before a waiting lower lane runs (0=strict)" << std::endl;
+	std::cout << "  NETMOD_LOGIC_SOJOURN_TARGET_MS    Logic queue wait target before overload control (0=off)" << std::endl;
+	std::cout << "  NETMOD_LOGIC_SOJOURN_INTERVAL_MS  Overload observation window in ms" << std::endl;
+	std::cout << "  NETMOD_DB_FLOW_HIGH      DB worker backlog that pauses client reads (0=off)" << std::endl;
+	std::cout << "  NETMOD_DB_FLOW_LOW       DB worker backlog that resumes client reads" << std::endl;
+	std::cout << "  NETMOD_IO_CPUS           Pin I/O threads (auto or CPU list, e.g. 0-3)" << std::endl;
+	std::cout << "  NETMOD_LOGIC_CPUS        Pin logic workers (auto or CPU list)" << std::endl;
+	std::cout << "  NETMOD_RUN_TO_COMPLETION Handlers inline on I/O threads (1/true)" << std::endl;
+	std::cout << "  NETMOD_ADMIN_PORT        Prometheus /metrics port (0=disabled)" << std::endl;
+	std::cout << "  NETMOD_ADMIN_BIND        Admin endpoint bind address (default: 127.0.0.1)" << std::endl;
 	std::cout << "  NETMOD_LOG_LEVEL         Log level (DEBUG/INFO/WARN/ERROR)" << std::endl;
 	std::cout << "  NETMOD_GRACEFUL_TIMEOUT  Shutdown timeout in seconds" << std::endl;
+	std::cout << "  NETMOD_PACKET_TRACE_SAMPLE  Sample 1 of N packets per thread into the trace (0=off)" << std::endl;
+	std::cout << "  NETMOD_PACKET_TRACE      Chrome trace JSON path (written on exit / SIGUSR2)" << std::endl;
+	std::cout << "  NETMOD_PACKET_REPORT     Packet stage report path on exit (- = stderr)" << std::endl;
 }
 
 // English: Parse log level string
@@ -133,6 +175,8 @@ int main(int argc, char *argv[])
 	std::string dbHost = Network::Utils::ConfigManager::Instance().GetNetwork().DBServerHost;
 	uint16_t dbPort = Network::Utils::ConfigManager::Instance().GetNetwork().DBServerPort;
 	std::string engineType = Network::Utils::ConfigManager::Instance().GetNetwork().EngineType;
+	uint16_t adminPort = Network::Utils::ConfigManager::Instance().GetNetwork().AdminPort;
+	size_t dbWorkerCount = Network::Utils::DEFAULT_TASK_QUEUE_WORKER_COUNT;
 
 	// English: Parse command line arguments (override ConfigManager settings)
 	// 한글: 커맨드라인 인자 파싱 (ConfigManager 설정 덮어쓰기)
@@ -175,6 +219,18 @@ int main(int argc, char *argv[])
 		{
 			engineType = argv[++i];
 		}
+		else if (arg == "--admin-port" && i + 1 < argc)
+		{
+			adminPort = static_cast<uint16_t>(std::stoi(argv[++i]));
+		}
+		else if (arg == "--run-to-completion")
+		{
+			Network::Utils::ConfigManager::Instance().Network().RunToCompletion = true;
+		}
+		else if (arg == "-w" && i + 1 < argc)
+		{
+			dbWorkerCount = (std::max)(static_cast<size_t>(1), static_cast<size_t>(std::stoul(argv[++i])));
+		}
 		else
 		{
 			std::cerr << "Unknown option: " << arg << std::endl;
@@ -187,6 +243,11 @@ int main(int argc, char *argv[])
 	// 한글: 로깅 설정
 	Network::Utils::Logger::SetLevel(logLevel);
 
+	// English: Reflect CLI overrides so the dump shows the values actually used
+	// 한글: 설정 출력이 실제 사용 값과 같도록 CLI 덮어쓰기를 반영
+	Network::Utils::ConfigManager::Instance().Network().ListenPort = port;
+	Network::Utils::ConfigManager::Instance().Network().AdminPort = adminPort;
+
 	// English: Print current configuration
 	// 한글: 현재 설정 출력
 	Network::Utils::ConfigManager::Instance().PrintConfig();
@@ -195,6 +256,12 @@ int main(int argc, char *argv[])
 	// 한글: 시그널 핸들러 등록
 	std::signal(SIGINT, SignalHandler);
 	std::signal(SIGTERM, SignalHandler);
+#if defined(NET_LOCK_PROFILING) && !defined(_WIN32)
+	std::signal(SIGUSR1, LockReportSignalHandler);
+#endif
+#ifndef _WIN32
+	std::signal(SIGUSR2, PacketReportSignalHandler);
+#endif
 #ifdef _WIN32
 	// English: SIGBREAK is Windows-specific, defined in <signal.h>
 	// 한글: SIGBREAK는 Windows 전용, <signal.h>에 정의
@@ -214,7 +281,7 @@ int main(int argc, char *argv[])
 	Network::Utils::Logger::Info("Initializing server on port " +
 								 std::to_string(port));
 
-	if (!server.Initialize(port, dbConnectionString, engineType))
+	if (!server.Initialize(port, dbConnectionString, engineType, dbWorkerCount))
 	{
 		Network::Utils::Logger::Error("Failed to initialize server");
 		return 1;
@@ -236,6 +303,12 @@ int main(int argc, char *argv[])
 		}
 	}
 
+	if (adminPort != 0 &&
+		!server.StartAdminEndpoint(adminPort, Network::Utils::ConfigManager::Instance().GetNetwork().AdminBindAddress))
+	{
+		Network::Utils::Logger::Warn("Admin endpoint unavailable - continuing without /metrics");
+	}
+
 	Network::Utils::Logger::Info("Server is running. Press Ctrl+C to stop.");
 
 	// English: Get graceful shutdown timeout from ConfigManager
@@ -263,6 +336,20 @@ int main(int argc, char *argv[])
 	while (g_Running && server.IsRunning())
 	{
 		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		if (g_LockReportRequested.exchange(false))
+		{
+			Network::Utils::LockProfiling::DumpContentionReport();
+		}
+		if (g_PacketReportRequested.exchange(false))
+		{
+			auto &trace = Network::Core::PacketTrace::Instance();
+			const std::string report = trace.BuildReport();
+			std::fwrite(report.data(), 1, report.size(), stderr);
+			if (const char *tracePath = std::getenv("NETMOD_PACKET_TRACE"); tracePath && *tracePath)
+			{
+				trace.WriteChromeTrace(tracePath);
+			}
+		}
 	}
 #endif
 
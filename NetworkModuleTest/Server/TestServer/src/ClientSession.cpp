@@ -17,7 +17,6 @@ namespace Network::TestServer
 
     ClientSession::ClientSession(std::weak_ptr<DBTaskQueue> dbTaskQueue)
         : mConnectionRecorded(false)
-        , mPacketHandler(std::make_unique<ClientPacketHandler>())
         , mDBTaskQueue(std::move(dbTaskQueue))
     {
     }
@@ -48,10 +47,8 @@ namespace Network::TestServer
 
     void ClientSession::OnRecv(const char* data, uint32_t size)
     {
-        if (mPacketHandler)
-        {
-            mPacketHandler->ProcessPacket(this, data, size);
-        }
+        // 디스패치 테이블은 프로세스 전역 — 세션마다 핸들러를 만들지 않는다
+        ClientPacketHandler::ProcessPacket(this, data, size);
     }
 
     std::vector<char> ClientSession::Encrypt(const char* data, uint32_t size)
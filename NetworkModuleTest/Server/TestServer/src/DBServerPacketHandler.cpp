@@ -5,6 +5,7 @@
 #include "Utils/StringUtil.h"
 #include "../include/DBServerTaskQueue.h"
 #include "Interfaces/ResultCode.h"
+#include "Network/Core/ServerPacketCodec.h"
 #include <chrono>
 
 namespace Network::TestServer
@@ -15,94 +16,25 @@ namespace Network::TestServer
     DBServerPacketHandler::DBServerPacketHandler()
         : mPingSequence(0)
     {
-        // 생성 시 모든 패킷 핸들러 등록
-        RegisterHandlers();
     }
 
     DBServerPacketHandler::~DBServerPacketHandler()
     {
     }
 
-    void DBServerPacketHandler::RegisterHandlers()
-    {
-        // 각 패킷 타입에 대한 핸들러 펑터 등록
-        mHandlers[static_cast<uint16_t>(ServerPacketType::ServerPongRes)] =
-            [this](Core::Session* session, const char* data, uint32_t size)
-            {
-                HandleServerPongResponse(session, reinterpret_cast<const PKT_ServerPongRes*>(data));
-            };
-
-        mHandlers[static_cast<uint16_t>(ServerPacketType::DBSavePingTimeRes)] =
-            [this](Core::Session* session, const char* data, uint32_t size)
-            {
-                HandleDBSavePingTimeResponse(session, reinterpret_cast<const PKT_DBSavePingTimeRes*>(data));
-            };
-
-        mHandlers[static_cast<uint16_t>(ServerPacketType::DBQueryRes)] =
-            [this](Core::Session* session, const char* data, uint32_t size)
-            {
-                HandleDBQueryResponse(session,
-                    reinterpret_cast<const PKT_DBQueryRes*>(data));
-            };
-    }
-
     void DBServerPacketHandler::ProcessPacket(Core::Session* session, const char* data, uint32_t size)
     {
-        if (!session || !data || size < sizeof(ServerPacketHeader))
+        if (!session)
         {
             Logger::Warn("Invalid DB server packet data");
             return;
         }
 
-        const ServerPacketHeader* header = reinterpret_cast<const ServerPacketHeader*>(data);
-
-        if (header->size < sizeof(ServerPacketHeader) || header->size > 4096)
-        {
-            Logger::Warn("DB server packet size out of range: " + std::to_string(header->size));
-            return;
-        }
-
-        if (header->size > size)
-        {
-            Logger::Warn("Incomplete DB server packet - expected: " + std::to_string(header->size) +
-                ", received: " + std::to_string(size));
-            return;
-        }
-
-        // 서버 패킷 ID별 최소 길이 검증
-        uint32_t requiredSize = sizeof(ServerPacketHeader);
-        switch (static_cast<ServerPacketType>(header->id))
-        {
-        case ServerPacketType::ServerPongRes:
-            requiredSize = sizeof(PKT_ServerPongRes);
-            break;
-        case ServerPacketType::DBSavePingTimeRes:
-            requiredSize = sizeof(PKT_DBSavePingTimeRes);
-            break;
-        case ServerPacketType::DBQueryRes:
-            requiredSize = sizeof(PKT_DBQueryRes);
-            break;
-        default:
-            break;
-        }
-
-        if (header->size < requiredSize)
-        {
-            Logger::Warn("DB server packet too small for id " + std::to_string(header->id) +
-                " - expected at least: " + std::to_string(requiredSize) +
-                ", actual: " + std::to_string(header->size));
-            return;
-        }
-
-        // 펑터 맵을 사용하여 패킷 핸들러 디스패치
-        auto it = mHandlers.find(header->id);
-        if (it != mHandlers.end())
-        {
-            it->second(session, data, size);
-        }
-        else
+        // 헤더 범위, 패킷 ID별 [최소, 최대] 크기 검증 후 핸들러 직접 호출
+        const PacketDispatchResult result = DispatchTable::Dispatch(this, session, data, size);
+        if (result != PacketDispatchResult::Handled)
         {
-            Logger::Warn("Unknown packet type from DB server: " + std::to_string(header->id));
+            Logger::Warn("DB server packet rejected: " + DispatchTable::Describe(result, data, size));
         }
     }
 
@@ -153,25 +85,19 @@ namespace Network::TestServer
         Logger::Info("Requested save ping time to DB - ServerId: " + std::to_string(serverId));
     }
 
-    void DBServerPacketHandler::HandleServerPongResponse(Core::Session* session, const PKT_ServerPongRes* packet)
+    void DBServerPacketHandler::HandleServerPongResponse(Core::Session* session, const PKT_ServerPongRes& packet)
     {
-        if (!session || !packet)
-        {
-            Logger::Error("HandleServerPongResponse: null pointer");
-            return;
-        }
-
         uint64_t currentTime = Timer::GetCurrentTimestamp();
-        uint64_t rtt = currentTime - packet->requestTimestamp;
+        uint64_t rtt = currentTime - packet.requestTimestamp;
 
 #ifdef ENABLE_PINGPONG_VERBOSE_LOG
-        Logger::Info("Received pong from DB server - Seq: " + std::to_string(packet->sequence) +
+        Logger::Info("Received pong from DB server - Seq: " + std::to_string(packet.sequence) +
             ", RTT: " + std::to_string(rtt) + "ms");
 #else
-        if (packet->sequence % PINGPONG_LOG_INTERVAL == 0)
+        if (packet.sequence % PINGPONG_LOG_INTERVAL == 0)
         {
             Logger::Info("[GameServer<-DB] Pong received (every " + std::to_string(PINGPONG_LOG_INTERVAL) +
-                "th) - Seq: " + std::to_string(packet->sequence) +
+                "th) - Seq: " + std::to_string(packet.sequence) +
                 ", RTT: " + std::to_string(rtt) + "ms");
         }
 #endif
@@ -179,37 +105,28 @@ namespace Network::TestServer
         // 세션의 마지막 Ping 시간 갱신
         if (session->IsConnected())
         {
-            session->SetLastPingTime(packet->responseTimestamp);
+            session->SetLastPingTime(packet.responseTimestamp);
         }
     }
 
-    void DBServerPacketHandler::HandleDBSavePingTimeResponse(Core::Session* session, const PKT_DBSavePingTimeRes* packet)
+    void DBServerPacketHandler::HandleDBSavePingTimeResponse(Core::Session* session, const PKT_DBSavePingTimeRes& packet)
     {
-        if (!session || !packet)
+        if (packet.result == 0)
         {
-            Logger::Error("HandleDBSavePingTimeResponse: null pointer");
-            return;
-        }
-
-        if (packet->result == 0)
-        {
-            Logger::Info("Ping time saved successfully in DB - ServerId: " + std::to_string(packet->serverId));
+            Logger::Info("Ping time saved successfully in DB - ServerId: " + std::to_string(packet.serverId));
         }
         else
         {
-            Logger::Error("Failed to save ping time in DB - ServerId: " + std::to_string(packet->serverId) +
-                ", Error: " + std::string(packet->message));
+            Logger::Error("Failed to save ping time in DB - ServerId: " + std::to_string(packet.serverId) +
+                ", Error: " + std::string(packet.message));
         }
     }
 
+    template <typename Packet>
     void DBServerPacketHandler::HandleDBQueryResponse(
-        Core::Session* session, const Core::PKT_DBQueryRes* packet)
+        Core::Session* session, const Packet& packet, uint32_t size)
     {
-        if (!packet)
-        {
-            Logger::Error("HandleDBQueryResponse: null packet");
-            return;
-        }
+        const char* data = reinterpret_cast<const char*>(&packet);
 
         if (!mTaskQueue)
         {
@@ -217,16 +134,25 @@ namespace Network::TestServer
             return;
         }
 
-        const ResultCode result = static_cast<ResultCode>(packet->result);
-        const size_t detailLen  = std::min<size_t>(packet->detailLength,
-                                                    sizeof(packet->detail));
-        const std::string detail(packet->detail, detailLen);
+        // 단일(PKT_DBQueryRes) / 배치(PKT_DBQueryBatchRes) 프레임의 엔트리마다 라우팅
+        const bool ok = ForEachDBQueryRes(data, size,
+            [this](const DBQueryResEntry& entry, const char* detail, uint16_t detailLength)
+            {
+                const ResultCode result = static_cast<ResultCode>(entry.result);
+
+                // 엔트리마다 호출되므로 지연 포맷 — Debug가 꺼져 있으면 문자열을 만들지 않는다
+                Logger::Debug("DBQueryRes received - queryId: {}, result: {}",
+                              entry.queryId, Network::ToString(result));
 
-        Logger::Debug("DBQueryRes received - queryId: " +
-                      std::to_string(packet->queryId) +
-                      ", result: " + Network::ToString(result));
+                mTaskQueue->OnDBResponse(entry.queryId, result,
+                                         std::string(detail, detailLength));
+            });
 
-        mTaskQueue->OnDBResponse(packet->queryId, result, detail);
+        if (!ok)
+        {
+            Logger::Warn("HandleDBQueryResponse: malformed DBQueryRes frame (" +
+                         std::to_string(size) + " bytes)");
+        }
     }
 
 } // namespace Network::TestServer
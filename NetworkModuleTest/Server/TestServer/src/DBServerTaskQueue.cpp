@@ -4,7 +4,7 @@
 #include "../include/DBServerTaskQueue.h"
 #include "Utils/Logger.h"
 
-#include <cassert>
+#include <algorithm>
 #include <cstring>
 
 namespace Network::TestServer
@@ -31,7 +31,10 @@ DBServerTaskQueue::~DBServerTaskQueue()
 // =============================================================================
 
 bool DBServerTaskQueue::Initialize(size_t workerCount,
-                                   std::function<bool(const void*, uint32_t)> sendFunc)
+                                   std::function<bool(const void*, uint32_t)> sendFunc,
+                                   size_t inflightWindow,
+                                   size_t maxOutstanding,
+                                   const Core::RecvFlowControl::Options& flowControl)
 {
     if (mIsRunning.load())
     {
@@ -54,7 +57,22 @@ bool DBServerTaskQueue::Initialize(size_t workerCount,
         return false;
     }
 
-    mSendFunc = std::move(sendFunc);
+    if (inflightWindow == 0)
+    {
+        Logger::Error("DBServerTaskQueue: inflightWindow must be >= 1");
+        return false;
+    }
+
+    if (!mFlowControl.Initialize(workerCount, flowControl))
+    {
+        return false;
+    }
+
+    mSendFunc       = std::move(sendFunc);
+    mInflightWindow = inflightWindow;
+    // Split the global cap across workers (each worker owns its counter, no atomics).
+    // 한글: 전체 상한을 워커별로 분할 (각 워커가 카운터 소유 — atomic 불필요).
+    mWorkerOutstandingCap = std::max<size_t>(1, maxOutstanding / workerCount);
     mIsRunning.store(true);
 
     for (size_t i = 0; i < workerCount; ++i)
@@ -68,7 +86,9 @@ bool DBServerTaskQueue::Initialize(size_t workerCount,
     }
 
     Logger::Info("DBServerTaskQueue initialized with " +
-                 std::to_string(workerCount) + " worker(s)");
+                 std::to_string(workerCount) + " worker(s), window " +
+                 std::to_string(mInflightWindow) + ", per-worker cap " +
+                 std::to_string(mWorkerOutstandingCap));
     return true;
 }
 
@@ -83,10 +103,16 @@ void DBServerTaskQueue::Shutdown()
 
     mIsRunning.store(false);
 
-    // Wake all workers so they exit their wait loop.
-    // 한글: 모든 워커의 wait 루프를 깨움.
+    // Wake all workers so they exit their wait loop. Take each worker mutex
+    // first: workers may block in an untimed wait, so the flag change must not
+    // slip between their predicate check and the wait.
+    // 한글: 모든 워커의 wait 루프를 깨움. 워커가 무기한 대기할 수 있으므로
+    //       predicate 검사와 wait 사이에 신호가 유실되지 않도록 mutex를 거친다.
     for (auto& w : mWorkers)
     {
+        {
+            std::lock_guard<std::mutex> lock(w->mutex);
+        }
         w->cv.notify_all();
     }
 
@@ -107,6 +133,10 @@ void DBServerTaskQueue::Shutdown()
         ShutdownDrain(i);
     }
 
+    // Every callback has fired — release sessions still paused on the backlog.
+    // 한글: 모든 콜백 완료 — 적체로 멈춰 있던 세션을 풀어 준다.
+    mFlowControl.Shutdown();
+
     Logger::Info("DBServerTaskQueue shutdown complete");
 }
 
@@ -144,6 +174,7 @@ void DBServerTaskQueue::EnqueueTask(DBServerTask&& task)
 
     const size_t workerIndex =
         static_cast<size_t>(task.sessionId) % mWorkers.size();
+    const ConnectionId sessionId = task.sessionId;
     WorkerData& worker = *mWorkers[workerIndex];
 
     bool accepted = false;
@@ -163,6 +194,9 @@ void DBServerTaskQueue::EnqueueTask(DBServerTask&& task)
     if (accepted)
     {
         worker.cv.notify_one();
+        // Worker backlog at the high-water mark → stop reading from the submitting session.
+        // 한글: 워커 적체가 상한이면 작업을 넣은 세션의 읽기를 멈춘다.
+        mFlowControl.OnEnqueue(workerIndex, sessionId);
     }
     else
     {
@@ -225,6 +259,21 @@ size_t DBServerTaskQueue::GetPendingCount() const
     return mPendingCount.load(std::memory_order_relaxed);
 }
 
+size_t DBServerTaskQueue::GetInflightCount() const
+{
+    return mInflightCount.load(std::memory_order_relaxed);
+}
+
+size_t DBServerTaskQueue::GetDeadlineCount() const
+{
+    size_t total = 0;
+    for (const auto& w : mWorkers)
+    {
+        total += w->deadlineCount.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
 // =============================================================================
 // WorkerThreadFunc
 // =============================================================================
@@ -238,23 +287,31 @@ void DBServerTaskQueue::WorkerThreadFunc(size_t workerIndex)
 
     while (mIsRunning.load())
     {
-        // in-flight 타임아웃 확인을 위해 주기적으로 깨어남.
-        // 작업이 없어도 kTimeoutCheckIntervalMs 후에 깨어나
-        // 타임아웃된 요청을 처리할 수 있음.
+        // Sleep until work arrives or the earliest in-flight deadline passes.
+        // No deadlines → untimed wait (zero idle wakeups).
+        // 한글: 작업 도착 또는 가장 이른 in-flight 마감 시각까지 대기.
+        //       마감이 없으면 무기한 대기 (유휴 시 깨어남 없음).
         {
             std::unique_lock<std::mutex> lock(worker.mutex);
-            worker.cv.wait_for(lock,
-                std::chrono::milliseconds(kTimeoutCheckIntervalMs),
-                [&] {
-                    return !worker.taskQueue.empty() ||
-                           !worker.responseQueue.empty() ||
-                           !mIsRunning.load();
-                });
+            auto hasWork = [&] {
+                return !worker.taskQueue.empty() ||
+                       !worker.responseQueue.empty() ||
+                       !mIsRunning.load();
+            };
+            if (worker.deadlines.empty())
+            {
+                worker.cv.wait(lock, hasWork);
+            }
+            else
+            {
+                worker.cv.wait_until(lock, worker.deadlines.top().deadline, hasWork);
+            }
         }
 
-        // Check for timed-out in-flight requests.
-        // sessions is worker-exclusive — no mutex needed here.
-        // 한글: 타임아웃된 in-flight 요청 확인. sessions는 워커 전용 — mutex 불필요.
+        // Fire expired deadlines (no-op unless the heap top has passed).
+        // sessions/deadlines are worker-exclusive — no mutex needed here.
+        // 한글: 만료된 마감 처리 (heap top이 지나지 않았으면 즉시 반환).
+        //       sessions/deadlines는 워커 전용 — mutex 불필요.
         CheckTimeouts(workerIndex);
 
         // Drain all pending responses first (prioritize responses over new tasks).
@@ -293,6 +350,12 @@ void DBServerTaskQueue::WorkerThreadFunc(size_t workerIndex)
             mPendingCount.fetch_sub(1, std::memory_order_relaxed);
             ProcessTask(workerIndex, std::move(task));
         }
+
+        // One frame per pass: everything issued above (timeouts, responses,
+        // new tasks) goes out together.
+        // 한글: 패스당 프레임 1개: 위에서 발행된 요청(타임아웃/응답/신규)을 한 번에 전송.
+        FlushBatch(workerIndex);
+        worker.deadlineCount.store(worker.deadlines.size(), std::memory_order_relaxed);
     }
 
     Logger::Info("DBServerTaskQueue worker[" + std::to_string(workerIndex) +
@@ -308,17 +371,60 @@ void DBServerTaskQueue::ProcessTask(size_t workerIndex, DBServerTask task)
 {
     WorkerData& worker = *mWorkers[workerIndex];
 
-    // If session is in-flight, defer this task.
-    // 한글: 세션이 in-flight 중이면 pending에 보관.
-    auto it = worker.sessions.find(task.sessionId);
-    if (it != worker.sessions.end() && it->second.requestId != 0)
+    // Always queue behind earlier work of the same session, then fill the window.
+    // 한글: 동일 세션의 앞선 작업 뒤에 보관한 뒤 윈도우를 채운다 (순서 보장).
+    const ConnectionId sessionId = task.sessionId;
+    SessionState& ss = worker.sessions[sessionId];
+    ss.pending.push(std::move(task));
+
+    FillWindow(workerIndex, sessionId, ss);
+    DeliverAndRefill(workerIndex, sessionId);
+}
+
+// =============================================================================
+// FillWindow / IssueTask — worker-thread only
+// 한글: 워커 스레드 전용
+// =============================================================================
+
+void DBServerTaskQueue::FillWindow(size_t workerIndex, ConnectionId sessionId,
+                                   SessionState& ss)
+{
+    WorkerData& worker = *mWorkers[workerIndex];
+
+    while (!ss.pending.empty() && ss.inflight.size() < mInflightWindow)
     {
-        it->second.pending.push(std::move(task));
-        return;
+        if (worker.outstanding >= mWorkerOutstandingCap)
+        {
+            // Worker cap reached — wait for a credit in FIFO order.
+            // 한글: 워커 상한 도달 — FIFO 순서로 크레딧 대기.
+            if (!ss.waitingCredit)
+            {
+                ss.waitingCredit = true;
+                worker.creditWaiters.push_back(sessionId);
+            }
+            return;
+        }
+
+        DBServerTask task = std::move(ss.pending.front());
+        ss.pending.pop();
+        IssueTask(workerIndex, ss, std::move(task));
     }
+}
+
+void DBServerTaskQueue::IssueTask(size_t workerIndex, SessionState& ss,
+                                  DBServerTask task)
+{
+    WorkerData& worker = *mWorkers[workerIndex];
+
+    ss.inflight.emplace_back();
+    InflightRequest& req = ss.inflight.back();
+    req.callback = std::move(task.callback);
 
     // Check logic: internal type-based check first, then optional custom lambda.
-    // 한글: 타입별 내부 검증 후 선택적 커스텀 람다 실행.
+    // A failed check is recorded as a completed entry so its callback still
+    // fires after every earlier request of the session.
+    // 한글: 타입별 내부 검증 후 선택적 커스텀 람다 실행. 실패도 완료 항목으로 기록하여
+    //       앞선 요청 콜백 이후에 순서대로 호출되도록 한다.
     bool checkPassed = CheckTask(task);
     if (checkPassed && task.checkFunc)
     {
@@ -327,18 +433,11 @@ void DBServerTaskQueue::ProcessTask(size_t workerIndex, DBServerTask task)
 
     if (!checkPassed)
     {
-        auto cb = std::move(task.callback);
-        // Clean up idle session entry if no pending tasks remain.
-        // 한글: pending이 없으면 idle 세션 항목 정리.
-        if (it != worker.sessions.end() &&
-            it->second.requestId == 0 &&
-            it->second.pending.empty())
-        {
-            worker.sessions.erase(it);
-        }
         Logger::Warn("DBServerTaskQueue: CheckTask failed for session " +
                      std::to_string(task.sessionId));
-        if (cb) cb(ResultCode::InvalidRequest, "Check failed");
+        req.completed = true;
+        req.result    = ResultCode::InvalidRequest;
+        req.detail    = "Check failed";
         return;
     }
 
@@ -346,106 +445,247 @@ void DBServerTaskQueue::ProcessTask(size_t workerIndex, DBServerTask task)
     // 한글: KeyGenerator로 충돌 없는 requestId 발급 (48-bit seq, wrap ~8,900년 @ 1M/s).
     const uint64_t requestId = worker.keyGen.Next();
 
-    // Ensure session state entry exists.
-    // 한글: 세션 상태 항목 확보.
-    SessionState& ss = worker.sessions[task.sessionId];
-
-    // Invariant: session must be idle here — in-flight case was already handled above.
-    // (KeyGenerator::Next() guarantees no seq reuse within the lifetime of any
-    //  realistic session — 48-bit seq wraps after ~8,900 years at 1M ops/s.)
-    assert(ss.requestId == 0);
-
     // STORE before SEND — response may arrive before Send() returns.
     // 한글: Send 전에 반드시 저장 — Send() 반환 전에 응답이 도착할 수 있음.
-    ss.requestId       = requestId;
-    ss.callback        = std::move(task.callback);
-    ss.inflightDeadline = std::chrono::steady_clock::now() +
-                          std::chrono::milliseconds(kRequestTimeoutMs);
-
-    // Build and send PKT_DBQueryReq.
-    // 한글: PKT_DBQueryReq 패킷 조성 후 전송.
-    Network::Core::PKT_DBQueryReq pkt;
-    pkt.queryId    = requestId;
-    pkt.taskType   = static_cast<uint8_t>(task.type);
-    pkt.dataLength = static_cast<uint16_t>(
-        std::min(task.data.size(), sizeof(pkt.data) - 1));
-    if (pkt.dataLength > 0)
-    {
-        std::memcpy(pkt.data, task.data.c_str(), pkt.dataLength);
-    }
-    pkt.data[pkt.dataLength] = '\0';
-
-    const bool sent = mSendFunc(&pkt, sizeof(pkt));
-    if (!sent)
-    {
-        // Send failed — clean up session state and notify caller.
-        // 한글: 전송 실패 — 세션 상태 정리 후 호출자에 알림.
-        auto cb     = std::move(ss.callback);
-        ss.requestId = 0;
-        ss.callback  = nullptr;
-        if (ss.pending.empty())
+    req.requestId = requestId;
+    worker.requestIndex[requestId] = task.sessionId;
+    worker.deadlines.push({std::chrono::steady_clock::now() + mRequestTimeout, requestId});
+    ++ss.sentCount;
+    ++worker.outstanding;
+    mInflightCount.fetch_add(1, std::memory_order_relaxed);
+
+    // Append to the worker's outgoing frame; flushed at the end of the pass.
+    // A full frame is flushed first so this request starts the next one.
+    // 한글: 워커 송신 프레임에 추가 — 패스 끝에 전송. 프레임이 가득 차면 먼저
+    //       전송하고 이 요청으로 다음 프레임을 시작한다.
+    Network::Core::DBQueryReqEntry entry{};
+    entry.queryId  = requestId;
+    entry.taskType = static_cast<uint8_t>(task.type);
+
+    if (task.data.size() > Network::Core::DBQueryReqBuilder::kMaxEntryPayload)
+    {
+        Logger::Warn("DBServerTaskQueue: payload too large (" +
+                     std::to_string(task.data.size()) + " bytes) for session " +
+                     std::to_string(task.sessionId));
+        CompleteRequest(worker, ss, req, ResultCode::InvalidRequest, "Payload too large");
+        return;
+    }
+
+    if (!worker.batch.Append(entry, task.data.data(), task.data.size()))
+    {
+        FlushBatch(workerIndex);
+        worker.batch.Append(entry, task.data.data(), task.data.size());
+    }
+    worker.batchRequests.emplace_back(task.sessionId, requestId);
+}
+
+// =============================================================================
+// FlushBatch — worker-thread only
+// 한글: 워커 스레드 전용
+// =============================================================================
+
+void DBServerTaskQueue::FlushBatch(size_t workerIndex)
+{
+    WorkerData& worker = *mWorkers[workerIndex];
+
+    // Completing failed entries may refill windows and append new requests,
+    // so loop until the frame stays empty.
+    // 한글: 실패 항목 완료 처리가 윈도우를 재충전해 새 요청을 추가할 수 있으므로
+    //       프레임이 빌 때까지 반복.
+    while (!worker.batch.Empty())
+    {
+        uint32_t frameSize = 0;
+        const char* frame  = worker.batch.Finish(frameSize);
+        const bool  sent   = mSendFunc(frame, frameSize);
+
+        std::vector<std::pair<ConnectionId, uint64_t>> flushed;
+        flushed.swap(worker.batchRequests);
+        worker.batch.Reset();
+
+        if (sent)
         {
-            worker.sessions.erase(task.sessionId);
+            return;
         }
-        Logger::Error("DBServerTaskQueue: SendDBPacket failed for session " +
-                      std::to_string(task.sessionId));
-        if (cb) cb(ResultCode::DBServerNotConnected, "Send failed");
+
+        // Send failed — complete every entry of the frame; delivered in order.
+        // 한글: 전송 실패 — 프레임의 모든 항목을 오류로 완료, 콜백은 순서대로 전달.
+        Logger::Error("DBServerTaskQueue: SendDBPacket failed for batch of " +
+                      std::to_string(flushed.size()) + " request(s)");
+
+        for (const auto& [sessionId, requestId] : flushed)
+        {
+            auto sessIt = worker.sessions.find(sessionId);
+            if (sessIt == worker.sessions.end())
+            {
+                continue;
+            }
+            for (auto& req : sessIt->second.inflight)
+            {
+                if (req.requestId == requestId)
+                {
+                    CompleteRequest(worker, sessIt->second, req,
+                                    ResultCode::DBServerNotConnected, "Send failed");
+                    break;
+                }
+            }
+        }
+        for (const auto& [sessionId, requestId] : flushed)
+        {
+            DeliverAndRefill(workerIndex, sessionId);
+        }
+        ServeCreditWaiters(workerIndex);
     }
 }
 
 // =============================================================================
-// HandleResponse — worker-thread only
+// CompleteRequest / DeliverAndRefill / ServeCreditWaiters — worker-thread only
 // 한글: 워커 스레드 전용
 // =============================================================================
 
-void DBServerTaskQueue::HandleResponse(size_t workerIndex,
-                                       const DBResponseEvent& resp)
+void DBServerTaskQueue::CompleteRequest(WorkerData& worker, SessionState& ss,
+                                        InflightRequest& req, ResultCode result,
+                                        const std::string& detail)
+{
+    if (req.completed)
+    {
+        return;
+    }
+
+    req.completed = true;
+    req.result    = result;
+    req.detail    = detail;
+
+    if (req.requestId != 0)
+    {
+        // Deadline entry stays in the heap; it is skipped when popped (lazy cancel).
+        // 한글: 마감 항목은 heap에 남겨두고 pop 시 무시 (지연 취소).
+        worker.requestIndex.erase(req.requestId);
+        --ss.sentCount;
+        --worker.outstanding;
+        mInflightCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void DBServerTaskQueue::DeliverAndRefill(size_t workerIndex, ConnectionId sessionId)
 {
     WorkerData& worker = *mWorkers[workerIndex];
 
-    // Find session by requestId — O(n) over active sessions per worker.
-    // 한글: requestId로 세션 역방향 탐색 — 워커당 활성 세션 수는 소규모이므로 O(n) 허용.
-    ConnectionId sessionId   = 0;
-    bool         found       = false;
-    for (auto& [sid, ss] : worker.sessions)
+    // Loop: delivering may free window slots, and refilling may produce
+    // immediately-completed entries (check/send failures) to deliver.
+    // 한글: 전달이 윈도우를 비우고, 재충전이 즉시 완료 항목(검증/전송 실패)을
+    //       만들 수 있으므로 더 이상 진행이 없을 때까지 반복.
+    while (true)
     {
-        if (ss.requestId == resp.requestId)
+        auto it = worker.sessions.find(sessionId);
+        if (it == worker.sessions.end())
         {
-            sessionId = sid;
-            found     = true;
-            break;
+            return;
+        }
+        SessionState& ss = it->second;
+
+        bool progressed = false;
+        size_t delivered = 0;
+        while (!ss.inflight.empty() && ss.inflight.front().completed)
+        {
+            InflightRequest done = std::move(ss.inflight.front());
+            ss.inflight.pop_front();
+            progressed = true;
+            ++delivered;
+            if (done.callback) done.callback(done.result, done.detail);
+        }
+        mFlowControl.OnComplete(workerIndex, delivered);
+
+        if (ss.inflight.empty() && ss.pending.empty())
+        {
+            if (!ss.waitingCredit)
+            {
+                worker.sessions.erase(it);
+            }
+            return;
+        }
+
+        if (!progressed)
+        {
+            return;
+        }
+
+        const size_t before = ss.inflight.size();
+        FillWindow(workerIndex, sessionId, ss);
+        if (ss.inflight.size() == before ||
+            !ss.inflight.front().completed)
+        {
+            return;
         }
     }
+}
 
-    if (!found)
+void DBServerTaskQueue::ServeCreditWaiters(size_t workerIndex)
+{
+    WorkerData& worker = *mWorkers[workerIndex];
+
+    while (worker.outstanding < mWorkerOutstandingCap && !worker.creditWaiters.empty())
     {
-        Logger::Warn("DBServerTaskQueue::HandleResponse: unknown requestId " +
-                     std::to_string(resp.requestId));
-        return;
+        const ConnectionId sessionId = worker.creditWaiters.front();
+        worker.creditWaiters.pop_front();
+
+        auto it = worker.sessions.find(sessionId);
+        if (it == worker.sessions.end())
+        {
+            continue;
+        }
+        it->second.waitingCredit = false;
+        FillWindow(workerIndex, sessionId, it->second);
+        DeliverAndRefill(workerIndex, sessionId);
     }
+}
 
-    SessionState& ss = worker.sessions[sessionId];
+// =============================================================================
+// HandleResponse — worker-thread only
+// 한글: 워커 스레드 전용
+// =============================================================================
 
-    // Invoke callback and clear in-flight state.
-    // 한글: 콜백 호출 및 in-flight 상태 해제.
-    auto cb       = std::move(ss.callback);
-    ss.requestId  = 0;
-    ss.callback   = nullptr;
+void DBServerTaskQueue::HandleResponse(size_t workerIndex,
+                                       const DBResponseEvent& resp)
+{
+    WorkerData& worker = *mWorkers[workerIndex];
 
-    if (cb) cb(resp.result, resp.detail);
+    // O(1) requestId → session lookup.
+    // 한글: requestId → 세션 O(1) 조회.
+    auto idxIt = worker.requestIndex.find(resp.requestId);
+    if (idxIt == worker.requestIndex.end())
+    {
+        // Unknown or already timed out.
+        // 한글: 알 수 없는 요청이거나 이미 타임아웃 처리됨.
+        Logger::Warn("DBServerTaskQueue::HandleResponse: unknown requestId " +
+                     std::to_string(resp.requestId));
+        return;
+    }
 
-    // Process exactly one pending task inline (ordering guarantee).
-    // 한글: pending에서 정확히 1개만 inline 처리 (순서 보장).
-    if (!ss.pending.empty())
+    const ConnectionId sessionId = idxIt->second;
+    auto sessIt = worker.sessions.find(sessionId);
+    if (sessIt == worker.sessions.end())
     {
-        DBServerTask nextTask = std::move(ss.pending.front());
-        ss.pending.pop();
-        ProcessTask(workerIndex, std::move(nextTask));
+        worker.requestIndex.erase(idxIt);
+        return;
     }
-    else
+    SessionState& ss = sessIt->second;
+
+    // Park the result on its entry (out-of-order buffer). Window is small,
+    // so a linear scan over ss.inflight is cheaper than another index.
+    // 한글: 결과를 해당 항목에 보관 (out-of-order 버퍼). 윈도우가 작으므로
+    //       ss.inflight 선형 탐색이 별도 인덱스보다 저렴.
+    for (auto& req : ss.inflight)
     {
-        worker.sessions.erase(sessionId);
+        if (req.requestId == resp.requestId)
+        {
+            CompleteRequest(worker, ss, req, resp.result, resp.detail);
+            break;
+        }
     }
+
+    DeliverAndRefill(workerIndex, sessionId);
+    ServeCreditWaiters(workerIndex);
+    CompactDeadlines(worker);
 }
 
 // =============================================================================
@@ -457,14 +697,25 @@ void DBServerTaskQueue::ShutdownDrain(size_t workerIndex)
 {
     WorkerData& worker = *mWorkers[workerIndex];
 
-    // Drain in-flight sessions and their pending queues.
-    // 한글: in-flight 세션과 pending 큐 드레인.
+    // Drain in-flight entries in order (already-completed ones keep their result),
+    // then their pending queues.
+    // 한글: in-flight 항목을 순서대로 드레인 (이미 완료된 항목은 원래 결과 전달), 이후 pending.
     for (auto& [sessionId, ss] : worker.sessions)
     {
-        if (ss.requestId != 0 && ss.callback)
+        for (auto& req : ss.inflight)
         {
-            ss.callback(ResultCode::ShuttingDown, "Server shutting down");
+            if (!req.callback) continue;
+            if (req.completed)
+            {
+                req.callback(req.result, req.detail);
+            }
+            else
+            {
+                req.callback(ResultCode::ShuttingDown, "Server shutting down");
+            }
         }
+        ss.inflight.clear();
+
         while (!ss.pending.empty())
         {
             auto& pendingTask = ss.pending.front();
@@ -477,6 +728,13 @@ void DBServerTaskQueue::ShutdownDrain(size_t workerIndex)
         }
     }
     worker.sessions.clear();
+    worker.requestIndex.clear();
+    worker.creditWaiters.clear();
+    worker.deadlines = DeadlineHeap();
+    worker.deadlineCount.store(0, std::memory_order_relaxed);
+    worker.batch.Reset();
+    worker.batchRequests.clear();
+    worker.outstanding = 0;
 
     // Drain unprocessed tasks from taskQueue.
     // 한글: taskQueue에 남은 처리되지 않은 태스크 드레인.
@@ -498,6 +756,7 @@ void DBServerTaskQueue::ShutdownDrain(size_t workerIndex)
     }
 
     mPendingCount.store(0, std::memory_order_relaxed);
+    mInflightCount.store(0, std::memory_order_relaxed);
 }
 
 // =============================================================================
@@ -510,59 +769,84 @@ void DBServerTaskQueue::CheckTimeouts(size_t workerIndex)
     WorkerData& worker = *mWorkers[workerIndex];
     const auto now = std::chrono::steady_clock::now();
 
-    // 반복 중 맵 수정(ProcessTask에서 항목 삽입 가능)을 피하기 위해
-    // 타임아웃 세션 ID를 먼저 수집.
+    // Pop expired entries, plus cancelled entries sitting at the top so the
+    // next wait_until targets a live deadline — O(k log n), nothing when idle.
+    // 한글: 만료 항목과 top에 있는 취소 항목을 pop — 다음 wait_until이 살아있는
+    //       마감을 기준으로 하도록 한다. O(k log n), 유휴 시 비용 없음.
     std::vector<ConnectionId> timedOut;
-    for (const auto& [sessionId, ss] : worker.sessions)
+    while (!worker.deadlines.empty())
     {
-        if (ss.requestId != 0 && now >= ss.inflightDeadline)
+        const DeadlineEntry top = worker.deadlines.top();
+        auto idxIt = worker.requestIndex.find(top.requestId);
+        if (idxIt == worker.requestIndex.end())
         {
-            timedOut.push_back(sessionId);
+            worker.deadlines.pop(); // Already answered — lazily cancelled.
+            continue;
         }
-    }
-
-    for (ConnectionId sessionId : timedOut)
-    {
-        auto it = worker.sessions.find(sessionId);
-        if (it == worker.sessions.end())
+        if (top.deadline > now)
         {
-            continue; // Already resolved by a response that arrived just now.
+            break;
         }
-        SessionState& ss = it->second;
-        if (ss.requestId == 0)
+        worker.deadlines.pop();
+        const uint64_t requestId = top.requestId;
+
+        const ConnectionId sessionId = idxIt->second;
+        auto sessIt = worker.sessions.find(sessionId);
+        if (sessIt == worker.sessions.end())
         {
-            continue; // Response arrived between collection and processing.
+            worker.requestIndex.erase(idxIt);
+            continue;
         }
+        SessionState& ss = sessIt->second;
 
         Logger::Warn("DBServerTaskQueue worker[" + std::to_string(workerIndex) +
-                     "]: requestId " + std::to_string(ss.requestId) +
+                     "]: requestId " + std::to_string(requestId) +
                      " timed out for session " + std::to_string(sessionId));
 
-        // Invoke callback with Timeout, then clear in-flight state.
-        // 한글: Timeout 콜백 호출 후 in-flight 상태 초기화.
-        auto cb      = std::move(ss.callback);
-        ss.requestId = 0;
-        ss.callback  = nullptr;
-
-        if (cb) cb(ResultCode::DBServerTimeout, "DB request timed out");
-
-        // Process next pending task or clean up idle entry — same as HandleResponse.
-        // 한글: 다음 pending 처리 또는 idle 항목 정리 — HandleResponse와 동일 패턴.
-        if (!ss.pending.empty())
+        for (auto& req : ss.inflight)
         {
-            DBServerTask nextTask = std::move(ss.pending.front());
-            ss.pending.pop();
-            // Note: ProcessTask may modify worker.sessions (erase + insert),
-            // which invalidates 'it'. Do not access 'it' after this call.
-            // 한글: ProcessTask가 worker.sessions를 수정할 수 있어 'it'가 무효화될 수 있음.
-            //       이 호출 후 'it' 접근 금지.
-            ProcessTask(workerIndex, std::move(nextTask));
+            if (req.requestId == requestId)
+            {
+                CompleteRequest(worker, ss, req, ResultCode::DBServerTimeout,
+                                "DB request timed out");
+                break;
+            }
         }
-        else
+        timedOut.push_back(sessionId);
+    }
+
+    // Deliver after popping so DeliverAndRefill may push new deadlines safely.
+    // 한글: pop 완료 후 전달 — DeliverAndRefill이 새 마감을 push해도 안전.
+    for (ConnectionId sessionId : timedOut)
+    {
+        DeliverAndRefill(workerIndex, sessionId);
+    }
+    if (!timedOut.empty())
+    {
+        ServeCreditWaiters(workerIndex);
+    }
+}
+
+void DBServerTaskQueue::CompactDeadlines(WorkerData& worker)
+{
+    const size_t live = worker.requestIndex.size();
+    if (worker.deadlines.size() <= (live + 16) * kDeadlineCompactFactor)
+    {
+        return;
+    }
+
+    std::vector<DeadlineEntry> kept;
+    kept.reserve(live);
+    while (!worker.deadlines.empty())
+    {
+        const DeadlineEntry& top = worker.deadlines.top();
+        if (worker.requestIndex.count(top.requestId) != 0)
         {
-            worker.sessions.erase(it);
+            kept.push_back(top);
         }
+        worker.deadlines.pop();
     }
+    worker.deadlines = DeadlineHeap(std::greater<DeadlineEntry>(), std::move(kept));
 }
 
 // =============================================================================
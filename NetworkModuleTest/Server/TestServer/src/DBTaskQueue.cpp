@@ -3,6 +3,7 @@
 #include "../include/DBTaskQueue.h"
 
 #include "Utils/KeyGenerator.h"
+#include "Utils/LockProfiling.h"
 #include "Utils/Logger.h"
 
 #include <chrono>
@@ -60,8 +61,6 @@ namespace
 DBTaskQueue::DBTaskQueue()
     : mQueueSize(0)
     , mIsRunning(false)
-    , mProcessedCount(0)
-    , mFailedCount(0)
 {
 }
 
@@ -75,7 +74,8 @@ DBTaskQueue::~DBTaskQueue()
 
 bool DBTaskQueue::Initialize(size_t workerThreadCount,
                              const std::string& walPath,
-                             Network::Database::IDatabase* db)
+                             Network::Database::IDatabase* db,
+                             const Core::RecvFlowControl::Options& flowControl)
 {
     if (mIsRunning.load())
     {
@@ -114,6 +114,11 @@ bool DBTaskQueue::Initialize(size_t workerThreadCount,
         }
     }
 
+    if (!mFlowControl.Initialize(workerThreadCount, flowControl))
+    {
+        return false;
+    }
+
     // WAL 복구 전에 워커 시작 — EnqueueTask()가 복구된 태스크를 받을 수 있도록
     mIsRunning.store(true);
 
@@ -207,9 +212,12 @@ void DBTaskQueue::Shutdown()
 
     mQueueSize.store(0, std::memory_order_relaxed);
 
+    // drain까지 끝났다 — 아직 멈춰 있는 세션을 풀어 준다
+    mFlowControl.Shutdown();
+
     // WAL 파일 핸들을 닫아 OS 쓰기 버퍼가 모두 플러시되고 파일 디스크립터를 해제
     {
-        std::lock_guard<std::mutex> walLock(mWalMutex);
+        NET_LOCK_GUARD(mWalMutex);
 #ifdef _WIN32
         if (mWalHandle != INVALID_HANDLE_VALUE)
         {
@@ -226,8 +234,8 @@ void DBTaskQueue::Shutdown()
     }
 
     Logger::Info("DBTaskQueue shutdown complete - Processed: " +
-                 std::to_string(mProcessedCount.load()) +
-                 ", Failed: " + std::to_string(mFailedCount.load()));
+                 std::to_string(mProcessedCount.Value()) +
+                 ", Failed: " + std::to_string(mFailedCount.Value()));
 }
 
 bool DBTaskQueue::IsRunning() const { return mIsRunning.load(); }
@@ -256,6 +264,7 @@ void DBTaskQueue::EnqueueTask(DBTask&& task)
     // 한글: 키 친화도 라우팅: sessionId % workerCount.
     //       동일 세션 → 동일 워커 → FIFO 직렬 처리 보장.
     const size_t workerIndex = static_cast<size_t>(task.sessionId) % mWorkers.size();
+    const ConnectionId sessionId = task.sessionId;
     WorkerData& worker = *mWorkers[workerIndex];
 
     bool     accepted        = false;
@@ -263,7 +272,7 @@ void DBTaskQueue::EnqueueTask(DBTask&& task)
     uint64_t canceledWalSeq  = 0;
 
     {
-        std::lock_guard<std::mutex> lock(worker.mutex);
+        NET_LOCK_GUARD(worker.mutex);
 
         // Shutdown()와 경쟁하는 구간을 차단하기 위해 락 안에서 재검증
         if (mIsRunning.load(std::memory_order_acquire))
@@ -300,6 +309,8 @@ void DBTaskQueue::EnqueueTask(DBTask&& task)
     if (accepted)
     {
         worker.cv.notify_one();
+        // 이 워커 적체가 상한이면 작업을 넣은 세션의 읽기를 멈춘다
+        mFlowControl.OnEnqueue(workerIndex, sessionId);
         return;
     }
 
@@ -351,8 +362,8 @@ size_t DBTaskQueue::GetQueueSize() const
     return mQueueSize.load(std::memory_order_relaxed);
 }
 
-size_t DBTaskQueue::GetProcessedCount() const { return mProcessedCount.load(); }
-size_t DBTaskQueue::GetFailedCount() const { return mFailedCount.load(); }
+size_t DBTaskQueue::GetProcessedCount() const { return mProcessedCount.Value(); }
+size_t DBTaskQueue::GetFailedCount() const { return mFailedCount.Value(); }
 
 void DBTaskQueue::WorkerThreadFunc(size_t workerIndex)
 {
@@ -404,6 +415,8 @@ void DBTaskQueue::WorkerThreadFunc(size_t workerIndex)
             {
                 WalWriteDone(task.walSeq);
             }
+
+            mFlowControl.OnComplete(workerIndex);
         }
     }
 
@@ -439,18 +452,18 @@ bool DBTaskQueue::ProcessTask(const DBTask& task)
 
         if (success)
         {
-            mProcessedCount.fetch_add(1);
+            mProcessedCount.Add();
         }
         else
         {
-            mFailedCount.fetch_add(1);
+            mFailedCount.Add();
         }
     }
     catch (const std::exception& e)
     {
         success = false;
         result  = std::string("Exception: ") + e.what();
-        mFailedCount.fetch_add(1);
+        mFailedCount.Add();
         Logger::Error("DB task exception: " + result);
     }
 
@@ -650,7 +663,7 @@ void DBTaskQueue::WalWritePending(const DBTask& task, uint64_t seq)
 
     // mWalFile lazy-open is protected by mWalMutex to prevent race conditions.
     // 한글: mWalFile의 lazy-open은 mWalMutex로 보호되어 경합 방지.
-    std::lock_guard<std::mutex> lock(mWalMutex);
+    NET_LOCK_GUARD(mWalMutex);
     if (!EnsureWalOpen())
     {
         Logger::Warn("WAL: Failed to open WAL file: " + mWalPath);
@@ -706,7 +719,7 @@ void DBTaskQueue::WalWriteDone(uint64_t seq)
 
     // mWalFile lazy-open is protected by mWalMutex to prevent race conditions.
     // 한글: mWalFile의 lazy-open은 mWalMutex로 보호되어 경합 방지.
-    std::lock_guard<std::mutex> lock(mWalMutex);
+    NET_LOCK_GUARD(mWalMutex);
     if (!EnsureWalOpen())
     {
         return;
@@ -5,6 +5,7 @@
 // 로컬 DB 인스턴스 생성에 필요한 IDatabase / DatabaseFactory 전체 정의
 #include "Interfaces/IDatabase.h"
 #include "Database/DatabaseFactory.h"
+#include "Utils/ConfigManager.h"
 #include <mutex>
 #include <thread>
 #include <chrono>
@@ -27,13 +28,11 @@ namespace Network::TestServer
     // =============================================================================
 
     TestServer::TestServer()
-        : mPacketHandler(std::make_unique<ClientPacketHandler>())
-        , mIsRunning(false)
+        : mIsRunning(false)
         , mPort(0)
 #ifdef _WIN32
         , mDBServerSocket(INVALID_SOCKET)
         , mDBRunning(false)
-        , mDBPingSequence(0)
         , mDBReconnectRunning(false)
 #endif
     {
@@ -49,7 +48,6 @@ namespace Network::TestServer
 
     void TestServer::SendDBPing()
     {
-#ifdef _WIN32
         constexpr uint32_t kSaveInterval = 5;
 
         Core::PKT_ServerPingReq pingPacket;
@@ -65,7 +63,6 @@ namespace Network::TestServer
             Network::Utils::StringUtil::Copy(savePacket.serverName, "TestServer");
             SendDBPacket(&savePacket, sizeof(savePacket));
         }
-#endif
     }
 
     TestServer::~TestServer()
@@ -116,8 +113,15 @@ namespace Network::TestServer
             }
         }
 
+        // DB 큐 적체 → 클라이언트 소켓 읽기 중지 (워커별 상한/하한).
+        //   큐가 차오르면 작업을 넣은 세션이 recv를 멈춰 TCP 윈도가 클라이언트를 조절한다.
+        const auto& netConfig = Utils::ConfigManager::Instance().GetNetwork();
+        Core::RecvFlowControl::Options flowControl;
+        flowControl.mHighWater = netConfig.DBFlowHighWater;
+        flowControl.mLowWater  = netConfig.DBFlowLowWater;
+
         mDBTaskQueue = std::make_shared<DBTaskQueue>();
-        if (!mDBTaskQueue->Initialize(dbWorkerCount, "db_tasks.wal", mLocalDatabase.get()))
+        if (!mDBTaskQueue->Initialize(dbWorkerCount, "db_tasks.wal", mLocalDatabase.get(), flowControl))
         {
             Logger::Error("Failed to initialize DB task queue");
             return false;
@@ -129,37 +133,35 @@ namespace Network::TestServer
                 1,   // 1 worker is sufficient for initial deployment
                 [this](const void* data, uint32_t size) -> bool {
                     return SendDBPacket(data, size);
-                }))
+                },
+                DBServerTaskQueue::kDefaultInflightWindow,
+                DBServerTaskQueue::kDefaultMaxOutstanding,
+                flowControl))
         {
             Logger::Error("Failed to initialize DBServerTaskQueue");
             return false;
         }
 
-#ifdef _WIN32
         // DB 핑 타이머 큐 초기화 (백그라운드 스레드 1개, 여기서 시작).
         if (!mTimerQueue.Initialize())
         {
             Logger::Error("TestServer: TimerQueue initialization failed");
             return false;
         }
-#endif
 
         // SessionConfigurator로 세션별 recv 콜백 등록.
         //   CreateSession 내에서 PostRecv() 이전에 호출되므로 첫 recv 완료가
         //   반드시 콜백을 인식함 (경합 없음).
-        //   ClientPacketHandler는 공유하며 생성 후 stateless — 스레드 안전.
-        {
-            ClientPacketHandler* handlerPtr = mPacketHandler.get();
-            Core::SessionManager::Instance().SetSessionConfigurator(
-                [handlerPtr](Core::Session* session)
-                {
-                    session->SetOnRecv(
-                        [handlerPtr](Core::Session* s, const char* data, uint32_t size)
-                        {
-                            handlerPtr->ProcessPacket(s, data, size);
-                        });
-                });
-        }
+        //   ClientPacketHandler는 정적 함수 + 프로세스 전역 constexpr 테이블 — 스레드 안전.
+        //   함수 포인터를 그대로 넘기므로 세션마다 캡처 클로저를 만들지 않는다.
+        //   배치 콜백 — 파이프라인 클라이언트의 recv 청크당 호출 1회, 퐁 응답은 송신 1회로 합쳐진다.
+        //   패킷 우선순위 — 핑/연결만 담긴 청크는 Control 레인으로 데이터 부하를 앞질러 처리된다.
+        Core::SessionManager::Instance().SetSessionConfigurator(
+            [](Core::Session* session)
+            {
+                session->SetOnRecvBatch(&ClientPacketHandler::ProcessPacketBatch);
+                session->SetPacketPriority(&ClientPacketHandler::PacketPriority);
+            });
 
         // 선택한 백엔드로 클라이언트 네트워크 엔진 생성 및 초기화.
         // "auto"는 플랫폼 기본 자동 선택 동작을 유지.
@@ -260,11 +262,48 @@ namespace Network::TestServer
             return false;
         }
 
+        mMetricsCollectorId = MetricsRegistry::Instance().AddCollector(
+            [this](MetricsWriter& writer) { CollectMetrics(writer); });
+
         mIsRunning.store(true);
         Logger::Info("TestServer started");
         return true;
     }
 
+    bool TestServer::StartAdminEndpoint(uint16_t port, const std::string& bindAddress)
+    {
+        if (!mClientEngine || !mIsRunning.load())
+        {
+            Logger::Error("StartAdminEndpoint: server not running");
+            return false;
+        }
+        return mAdminServer.Start(*mClientEngine, port, bindAddress);
+    }
+
+    void TestServer::CollectMetrics(MetricsWriter& writer) const
+    {
+        if (mDBTaskQueue)
+        {
+            writer.Gauge("testserver_db_task_queue_depth", "Pending local DB tasks",
+                         static_cast<double>(mDBTaskQueue->GetQueueSize()));
+            writer.Counter("testserver_db_tasks_total", "Local DB tasks by result",
+                           mDBTaskQueue->GetProcessedCount(), {{"result", "processed"}});
+            writer.Counter("testserver_db_tasks_total", "Local DB tasks by result",
+                           mDBTaskQueue->GetFailedCount(), {{"result", "failed"}});
+            writer.Counter("testserver_recv_flow_pauses_total", "Client reads paused by DB queue backlog",
+                           mDBTaskQueue->GetFlowControl().GetPauseCount(), {{"queue", "db"}});
+        }
+        if (mDBServerTaskQueue)
+        {
+            writer.Gauge("testserver_dbserver_pending_requests", "Relay requests waiting to be sent",
+                         static_cast<double>(mDBServerTaskQueue->GetPendingCount()));
+            writer.Gauge("testserver_dbserver_inflight_requests", "Relay requests awaiting a response",
+                         static_cast<double>(mDBServerTaskQueue->GetInflightCount()));
+            writer.Counter("testserver_recv_flow_pauses_total", "Client reads paused by DB queue backlog",
+                           mDBServerTaskQueue->GetFlowControl().GetPauseCount(), {{"queue", "dbserver"}});
+        }
+    }
+
     void TestServer::Stop()
     {
         if (!mIsRunning.load())
@@ -274,6 +313,11 @@ namespace Network::TestServer
 
         mIsRunning.store(false);
 
+        // 관리 연결을 먼저 닫고 컬렉터 해제 — 이후 드레인/해제되는 큐를 스크레이프가 읽지 않도록
+        mAdminServer.Stop();
+        MetricsRegistry::Instance().RemoveCollector(mMetricsCollectorId);
+        mMetricsCollectorId = 0;
+
 #ifdef _WIN32
         // 재연결 루프가 백오프 대기 중이면 즉시 깨움
         mDBShutdownCV.notify_all();
@@ -313,6 +357,13 @@ namespace Network::TestServer
                 {
                     continue;
                 }
+#ifndef _WIN32
+                // DB 서버 링크는 같은 세션 풀의 아웃바운드 세션 — 클라이언트 기록 대상 아님
+                if (session->GetId() == mDBConnectionId.load(std::memory_order_acquire))
+                {
+                    continue;
+                }
+#endif
 
                 mDBTaskQueue->RecordDisconnectTime(session->GetId(), shutdownTime);
                 ++queuedDisconnectCount;
@@ -326,14 +377,12 @@ namespace Network::TestServer
         }
 
         // 연결 해제 전 DB 핑 타이머 종료 (마지막 핑이 누락되지 않도록)
-#ifdef _WIN32
         if (mDBPingTimer != 0)
         {
             mTimerQueue.Cancel(mDBPingTimer);
             mDBPingTimer = 0;
         }
         mTimerQueue.Shutdown();
-#endif
 
         // 1단계 — DB 태스크 큐 드레인 (로컬 DB 연결이 살아있는 동안 대기 작업 완료)
         if (mDBTaskQueue)
@@ -477,9 +526,76 @@ namespace Network::TestServer
         Logger::Info("Successfully connected to DB server at " + host + ":" + std::to_string(port));
         return true;
 #else
-        // Windows가 아닌 플랫폼에서는 아직 클라이언트 연결을 지원하지 않음
-        Logger::Error("Client connection not implemented for non-Windows platforms");
-        return false;
+        // 엔진 커넥터 경로 — 비동기 connect(epoll/io_uring) 후 클라이언트 세션과 같은
+        //   I/O 워커·세션 풀·로직 디스패처에서 처리된다. 링크당 전용 스레드가 없고,
+        //   실패/끊김 시 재연결 백오프(1s→30s, CONNREFUSED는 1s 고정)는 엔진이 수행한다.
+        if (!mClientEngine)
+        {
+            Logger::Error("ConnectToDBServer: client engine not initialized");
+            return false;
+        }
+
+        if (mDBConnectorId != 0)
+        {
+            Logger::Warn("DB server connector already registered");
+            return true;
+        }
+
+        if (!mDBPacketHandler)
+        {
+            mDBPacketHandler = std::make_unique<DBServerPacketHandler>();
+            // DBQueryRes 응답 라우팅을 위해 DBServerTaskQueue 주입
+            if (mDBServerTaskQueue)
+            {
+                mDBPacketHandler->SetTaskQueue(mDBServerTaskQueue.get());
+            }
+        }
+
+        Core::ConnectorOptions options;
+        options.mHost = host;
+        options.mPort = port;
+
+        // 세션 설정자(SessionConfigurator)가 붙인 클라이언트 핸들러를 DB 핸들러로 교체.
+        //   첫 recv 등록 전에 호출되므로 경합 없음.
+        DBServerPacketHandler* handlerPtr = mDBPacketHandler.get();
+        options.mConfigurator = [handlerPtr](Core::Session* session)
+        {
+            session->SetOnRecv(
+                [handlerPtr](Core::Session* s, const char* data, uint32_t size)
+                {
+                    handlerPtr->ProcessPacket(s, data, size);
+                });
+            session->SetPacketPriority(&DBServerPacketHandler::PacketPriority);
+        };
+        options.mOnConnected = [this, host, port](ConnectionId connectionId)
+        {
+            mDBConnectionId.store(connectionId, std::memory_order_release);
+            Logger::Info("Successfully connected to DB server at " + host + ":" +
+                         std::to_string(port) + " (Session " + std::to_string(connectionId) + ")");
+        };
+        options.mOnDisconnected = [this](ConnectionId connectionId)
+        {
+            ConnectionId expected = connectionId;
+            mDBConnectionId.compare_exchange_strong(expected, 0, std::memory_order_acq_rel);
+            Logger::Warn("DB server link lost - reconnecting with backoff");
+        };
+
+        mDBConnectorId = mClientEngine->AddConnector(options);
+        if (mDBConnectorId == 0)
+        {
+            Logger::Error("Failed to register DB server connector");
+            return false;
+        }
+
+        // 링크가 끊긴 동안의 핑은 SendDBPacket이 false를 반환하여 조용히 버려진다.
+        mDBPingTimer = mTimerQueue.ScheduleRepeat(
+            [this]() -> bool
+            {
+                SendDBPing();
+                return true;
+            },
+            Core::PING_INTERVAL_MS);
+        return true;
 #endif
     }
 
@@ -574,6 +690,19 @@ namespace Network::TestServer
         mDBServerSocket = INVALID_SOCKET;
         mDBRecvBuffer.clear();
         mDBRecvOffset = 0;
+#else
+        if (mDBPingTimer != 0)
+        {
+            mTimerQueue.Cancel(mDBPingTimer);
+            mDBPingTimer = 0;
+        }
+
+        if (mDBConnectorId != 0 && mClientEngine)
+        {
+            mClientEngine->RemoveConnector(mDBConnectorId);
+            mDBConnectorId = 0;
+        }
+        mDBConnectionId.store(0, std::memory_order_release);
 #endif
     }
 
@@ -603,9 +732,14 @@ namespace Network::TestServer
 
         return true;
 #else
-        (void)data;
-        (void)size;
-        return false;
+        const ConnectionId connectionId = mDBConnectionId.load(std::memory_order_acquire);
+        if (connectionId == 0 || !mClientEngine || !data || size == 0)
+        {
+            return false;
+        }
+
+        // Session::Send가 스레드 안전하므로 별도 송신 뮤텍스가 필요 없다.
+        return mClientEngine->SendData(connectionId, data, size);
 #endif
     }
 
@@ -630,7 +764,8 @@ namespace Network::TestServer
                     const auto* header = reinterpret_cast<const Core::ServerPacketHeader*>(
                         mDBRecvBuffer.data() + mDBRecvOffset);
 
-                    if (header->size < sizeof(Core::ServerPacketHeader) || header->size > 4096)
+                    if (header->size < sizeof(Core::ServerPacketHeader) ||
+                        header->size > Core::MAX_SERVER_PACKET_SIZE)
                     {
                         Logger::Warn("Invalid DB packet size: " + std::to_string(header->size));
                         mDBRecvBuffer.clear();
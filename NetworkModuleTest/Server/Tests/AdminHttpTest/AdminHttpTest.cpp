@@ -0,0 +1,318 @@
+// 관리 포트 HTTP 엔드포인트(AdminHttpServer) 연결 수명·송신 테스트.
+//
+// 실제 엔진을 루프백에 띄우고 원시 TCP 소켓으로 요청한다.
+// - keep-alive: 같은 연결에서 요청 여러 개가 순서대로 응답되고 연결이 유지된다.
+// - Connection: close / HTTP/1.0 / 405: 응답 뒤 서버가 연결을 닫아 클라이언트가 EOF를 본다.
+// - 송신 큐(SEND_QUEUE_BACKPRESSURE_THRESHOLD x MAX_PACKET_TOTAL_SIZE)보다 큰 /metrics 본문이
+//   잘리지 않고 Content-Length만큼 도착한다.
+//
+// 사용법: AdminHttpTest [--port P]
+
+#if defined(__linux__) || defined(__APPLE__)
+
+#include "Network/Core/AdminHttpServer.h"
+#include "Network/Core/NetworkEngine.h"
+#include "Network/Core/PacketDefine.h"
+#include "Utils/Logger.h"
+#include "Utils/Metrics.h"
+#include "Utils/NetworkTypes.h"
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <netinet/in.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace Network;
+using namespace Network::Core;
+
+namespace
+{
+
+int gPassed = 0;
+int gFailed = 0;
+
+void Pass(const char *name)
+{
+	std::cout << "[PASS] " << name << "\n";
+	++gPassed;
+}
+
+void Fail(const char *name, const std::string &reason)
+{
+	std::cout << "[FAIL] " << name << " - " << reason << "\n";
+	++gFailed;
+}
+
+int ConnectLoopback(uint16_t port)
+{
+	for (int attempt = 0; attempt < 50; ++attempt)
+	{
+		const int fd = socket(AF_INET, SOCK_STREAM, 0);
+		sockaddr_in addr{};
+		addr.sin_family = AF_INET;
+		addr.sin_port   = htons(port);
+		inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+		if (connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0)
+		{
+			timeval timeout{5, 0};
+			setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+			return fd;
+		}
+		close(fd);
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}
+	return -1;
+}
+
+bool SendText(int fd, const std::string &text)
+{
+	return send(fd, text.data(), text.size(), 0) == static_cast<ssize_t>(text.size());
+}
+
+struct HttpReply
+{
+	bool        ok = false;      // 헤더 + Content-Length만큼의 본문을 받음
+	std::string head;
+	std::string body;
+};
+
+// 응답 1개를 읽는다. 다음 응답의 바이트는 carry에 남긴다.
+HttpReply ReadReply(int fd, std::string &carry)
+{
+	HttpReply reply;
+	char      buffer[16 * 1024];
+	size_t    headEnd;
+	while ((headEnd = carry.find("\r\n\r\n")) == std::string::npos)
+	{
+		const ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+		if (n <= 0)
+			return reply;
+		carry.append(buffer, static_cast<size_t>(n));
+	}
+	reply.head = carry.substr(0, headEnd);
+	carry.erase(0, headEnd + 4);
+
+	const size_t lengthPos = reply.head.find("Content-Length: ");
+	if (lengthPos == std::string::npos)
+		return reply;
+	const size_t length = std::stoul(reply.head.substr(lengthPos + 16));
+	while (carry.size() < length)
+	{
+		const ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+		if (n <= 0)
+			return reply;
+		carry.append(buffer, static_cast<size_t>(n));
+	}
+	reply.body = carry.substr(0, length);
+	carry.erase(0, length);
+	reply.ok = true;
+	return reply;
+}
+
+// 서버가 닫았으면 true (recv == 0). 타임아웃/추가 데이터면 false.
+bool ServerClosed(int fd)
+{
+	char byte;
+	return recv(fd, &byte, 1, 0) == 0;
+}
+
+// 연결이 아직 열려 있으면 true — 짧게 기다려도 EOF/오류가 없다.
+bool StillOpen(int fd)
+{
+	timeval shortWait{0, 200 * 1000};
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &shortWait, sizeof(shortWait));
+	char byte;
+	const ssize_t n = recv(fd, &byte, 1, 0);
+	const bool open = n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+	timeval timeout{5, 0};
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+	return open;
+}
+
+bool IsStatus(const HttpReply &reply, const char *status)
+{
+	return reply.ok && reply.head.compare(0, 12, std::string("HTTP/1.1 ") + status) == 0;
+}
+
+// =============================================================================
+// 테스트
+// =============================================================================
+
+void TestKeepAlive(uint16_t port)
+{
+	const char *name = "AdminHttp/KeepAlive";
+
+	const int fd = ConnectLoopback(port);
+	if (fd < 0)
+	{
+		Fail(name, "connect failed");
+		return;
+	}
+
+	// 요청 하나씩, 그리고 파이프라인 두 개 — 응답 순서가 요청 순서와 같아야 한다
+	std::string carry;
+	const bool sent1 = SendText(fd, "GET /healthz HTTP/1.1\r\nHost: x\r\n\r\n");
+	const HttpReply first = ReadReply(fd, carry);
+	const bool sent2 = SendText(fd, "GET /nope HTTP/1.1\r\n\r\nGET /healthz HTTP/1.1\r\n\r\n");
+	const HttpReply missing = ReadReply(fd, carry);
+	const HttpReply second  = ReadReply(fd, carry);
+	const bool open = StillOpen(fd);
+	close(fd);
+
+	if (!sent1 || !sent2)
+		Fail(name, "request send failed");
+	else if (!IsStatus(first, "200") || first.body != "ok\n" ||
+	         first.head.find("Connection: keep-alive") == std::string::npos)
+		Fail(name, "first response is not a keep-alive 200: " + first.head);
+	else if (!IsStatus(missing, "404") || !IsStatus(second, "200") || second.body != "ok\n")
+		Fail(name, "pipelined responses out of order or missing");
+	else if (!open)
+		Fail(name, "server closed a keep-alive connection");
+	else
+		Pass(name);
+}
+
+void TestCloseAfterResponse(uint16_t port)
+{
+	struct Case
+	{
+		const char *name;
+		const char *request;
+		const char *status;
+	};
+	const Case cases[] = {
+		{"AdminHttp/Close/Header", "GET /healthz HTTP/1.1\r\nConnection: close\r\n\r\n", "200"},
+		{"AdminHttp/Close/Http10", "GET /healthz HTTP/1.0\r\n\r\n", "200"},
+		{"AdminHttp/Close/MethodNotAllowed", "POST /metrics HTTP/1.1\r\nContent-Length: 3\r\n\r\nabc", "405"},
+	};
+
+	for (const Case &c : cases)
+	{
+		const int fd = ConnectLoopback(port);
+		if (fd < 0)
+		{
+			Fail(c.name, "connect failed");
+			continue;
+		}
+		std::string carry;
+		const bool      sent   = SendText(fd, c.request);
+		const HttpReply reply  = ReadReply(fd, carry);
+		const bool      closed = carry.empty() && ServerClosed(fd);
+		close(fd);
+
+		if (!sent)
+			Fail(c.name, "request send failed");
+		else if (!IsStatus(reply, c.status))
+			Fail(c.name, "unexpected response: " + reply.head);
+		else if (!closed)
+			Fail(c.name, "server did not close the connection after the response");
+		else
+			Pass(c.name);
+	}
+}
+
+void TestLargeBody(uint16_t port)
+{
+	const char *name = "AdminHttp/LargeBody";
+
+	// 송신 큐 전체(임계값 x 조각 한도)보다 큰 /metrics 본문을 만든다
+	const size_t queueBytes = Utils::SEND_QUEUE_BACKPRESSURE_THRESHOLD * MAX_PACKET_TOTAL_SIZE;
+	const std::string padding(120, 'p');
+	for (int i = 0; i < 4000; ++i)
+	{
+		Utils::MetricsRegistry::Instance()
+			.Counter("admin_http_test_padding_total", "padding for the large-body test",
+		             {{"id", std::to_string(i) + padding}})
+			.Add(static_cast<uint64_t>(i));
+	}
+	const size_t expected = Utils::MetricsRegistry::Instance().RenderPrometheus().size();
+
+	const int fd = ConnectLoopback(port);
+	if (fd < 0)
+	{
+		Fail(name, "connect failed");
+		return;
+	}
+
+	// keep-alive로 한 번, 이어서 close로 한 번 — 두 번째는 마지막 바이트 뒤에 닫혀야 한다
+	std::string carry;
+	const bool      sent1  = SendText(fd, "GET /metrics HTTP/1.1\r\n\r\n");
+	const HttpReply first  = ReadReply(fd, carry);
+	const bool      sent2  = SendText(fd, "GET /metrics HTTP/1.1\r\nConnection: close\r\n\r\n");
+	const HttpReply second = ReadReply(fd, carry);
+	const bool      closed = carry.empty() && ServerClosed(fd);
+	close(fd);
+
+	const bool complete = first.body.find("admin_http_test_padding_total{id=\"3999") != std::string::npos &&
+	                      second.body.find("admin_http_test_padding_total{id=\"3999") != std::string::npos;
+
+	if (expected <= queueBytes)
+		Fail(name, "test body (" + std::to_string(expected) + " bytes) is not larger than the send queue");
+	else if (!sent1 || !sent2)
+		Fail(name, "request send failed");
+	else if (!IsStatus(first, "200") || !IsStatus(second, "200"))
+		Fail(name, "large response truncated (got " + std::to_string(first.body.size()) + " / " +
+		               std::to_string(second.body.size()) + " bytes)");
+	else if (!complete)
+		Fail(name, "large response body is incomplete");
+	else if (!closed)
+		Fail(name, "server did not close after the last byte of a large response");
+	else
+		Pass(name);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+	uint16_t port = 29880;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		if (arg == "--port" && i + 1 < argc)
+			port = static_cast<uint16_t>(std::stoi(argv[++i]));
+	}
+
+	std::cout << "=== AdminHttp Tests ===\n\n";
+	Utils::Logger::SetLevel(Utils::LogLevel::Warn);
+
+	auto engine = CreateNetworkEngine("auto");
+	AdminHttpServer admin;
+	const uint16_t adminPort = static_cast<uint16_t>(port + 1);
+	if (!engine || !engine->Initialize(16, port) || !engine->Start() || !admin.Start(*engine, adminPort))
+	{
+		Fail("AdminHttp/Start", "engine or admin listener start failed (port " + std::to_string(port) +
+		                            " / " + std::to_string(adminPort) + " in use?)");
+	}
+	else
+	{
+		TestKeepAlive(adminPort);
+		TestCloseAfterResponse(adminPort);
+		TestLargeBody(adminPort);
+	}
+
+	admin.Stop();
+	if (engine)
+		engine->Stop();
+
+	std::cout << "\nResult: " << gPassed << " passed, " << gFailed << " failed\n";
+	return gFailed > 0 ? 1 : 0;
+}
+
+#else
+
+#include <iostream>
+
+int main()
+{
+	std::cout << "[SKIP] AdminHttpTest: Linux/macOS only\n";
+	return 0;
+}
+
+#endif
@@ -0,0 +1,558 @@
+// 정상 상태 ping/pong 왕복의 힙 할당 예산 테스트.
+//
+// 전역 operator new를 교체해 할당을 세고, Utils::AllocTag(엔진이 thread_local로 표시한
+// 하위 시스템)별로 나눈다. 실제 엔진을 루프백에 띄우고 워밍업 후 N회 왕복 동안의
+// 메시지당 할당 수를 kBudgets와 비교한다. 목표는 전 항목 0 — 할당을 없앤 경로를 고치면
+// 해당 예산을 함께 내려서 회귀를 막는다.
+//
+// 로직 디스패처 경유(기본)와 run-to-completion 모드(NetworkConfig::RunToCompletion)를 각각 잰다.
+// 코루틴 빌드(ENABLE_COROUTINES)에서는 RecvAsync 에코 코루틴과, 3단계 핸들러 체인을
+// 콜백/코루틴으로 각각 돌린 체인당 할당 수도 잰다.
+//
+// 사용법: AllocationTest [--messages N] [--port P]
+
+#if defined(__linux__) || defined(__APPLE__)
+
+#include "Concurrency/KeyedDispatcher.h"
+#include "Network/Core/NetworkEngine.h"
+#include "Network/Core/PacketDefine.h"
+#include "Network/Core/Session.h"
+#include "Network/Core/SessionManager.h"
+#include "Utils/AllocationTag.h"
+#include "Utils/ConfigManager.h"
+#include "Utils/Logger.h"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace Network;
+using namespace Network::Core;
+using Network::Utils::AllocTag;
+
+// =============================================================================
+// 할당 카운터 — operator new 교체
+// =============================================================================
+
+namespace
+{
+constexpr size_t kTagCount = static_cast<size_t>(AllocTag::Count);
+
+std::atomic<bool>     gCounting{false};
+std::atomic<uint64_t> gAllocCount[kTagCount];
+std::atomic<uint64_t> gAllocBytes[kTagCount];
+
+void CountAllocation(size_t size)
+{
+	if (!gCounting.load(std::memory_order_relaxed))
+		return;
+	const size_t tag = static_cast<size_t>(Utils::GetCurrentAllocTag());
+	gAllocCount[tag].fetch_add(1, std::memory_order_relaxed);
+	gAllocBytes[tag].fetch_add(size, std::memory_order_relaxed);
+}
+
+void *CountedAlloc(size_t size)
+{
+	CountAllocation(size);
+	return std::malloc(size ? size : 1);
+}
+
+void *CountedAlignedAlloc(size_t size, std::align_val_t alignment)
+{
+	CountAllocation(size);
+	const size_t align = (std::max)(static_cast<size_t>(alignment), sizeof(void *));
+	void *ptr = nullptr;
+	if (posix_memalign(&ptr, align, size ? size : 1) != 0)
+		return nullptr;
+	return ptr;
+}
+
+void ResetCounters()
+{
+	for (size_t i = 0; i < kTagCount; ++i)
+	{
+		gAllocCount[i].store(0);
+		gAllocBytes[i].store(0);
+	}
+}
+} // namespace
+
+void *operator new(size_t size)
+{
+	if (void *ptr = CountedAlloc(size))
+		return ptr;
+	throw std::bad_alloc();
+}
+
+void *operator new[](size_t size)
+{
+	if (void *ptr = CountedAlloc(size))
+		return ptr;
+	throw std::bad_alloc();
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return CountedAlloc(size); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return CountedAlloc(size); }
+
+void *operator new(size_t size, std::align_val_t alignment)
+{
+	if (void *ptr = CountedAlignedAlloc(size, alignment))
+		return ptr;
+	throw std::bad_alloc();
+}
+
+void *operator new[](size_t size, std::align_val_t alignment)
+{
+	if (void *ptr = CountedAlignedAlloc(size, alignment))
+		return ptr;
+	throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, const std::nothrow_t &) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, size_t, std::align_val_t) noexcept { std::free(ptr); }
+
+// =============================================================================
+// 예산 — 메시지(ping 1 + pong 1)당 허용 할당 수
+// =============================================================================
+
+namespace
+{
+struct Budget
+{
+	AllocTag mTag;
+	double   mMaxPerMessage;
+	const char *mSource;  // 현재 할당 출처 (예산을 내릴 때 갱신)
+};
+
+// 측정값(epoll, 1 연결 closed loop) + 여유 0.5. Other는 타이머/로그 백엔드 등 배경 스레드 잡음 흡수용.
+const Budget kDispatcherBudgets[] = {
+	{AllocTag::Io,       3.5, "epoll_event[] per ProcessCompletions x2, pending recv map node"},
+	{AllocTag::Recv,     2.5, "make_shared<vector> recv copy (control block + data)"},
+	{AllocTag::Dispatch, 1.5, "AsyncScope std::function closure"},
+	{AllocTag::Handler,  0.5, "test echo handler (none)"},
+	{AllocTag::Send,     1.5, "pending send map node (send buffers reused from SharedSendBuffer pool)"},
+	{AllocTag::EventBus, 2.5, "FireEvent unique_ptr copy + NetworkBusEventData vector"},
+	{AllocTag::Logger,   0.5, "none on the ping path"},
+	{AllocTag::Other,    0.5, "background threads"},
+};
+
+// run-to-completion: 핸들러가 I/O 스레드에서 recv 버퍼를 그대로 읽으므로 복사와 디스패치가 없다
+const Budget kRunToCompletionBudgets[] = {
+	{AllocTag::Io,       3.5, "epoll_event[] per ProcessCompletions x2, pending recv map node"},
+	{AllocTag::Recv,     0.5, "none (chunk handled in place on the I/O thread)"},
+	{AllocTag::Dispatch, 0.5, "none (no dispatcher hop)"},
+	{AllocTag::Handler,  0.5, "test echo handler (none)"},
+	{AllocTag::Send,     1.5, "pending send map node (send buffers reused from SharedSendBuffer pool)"},
+	{AllocTag::EventBus, 2.5, "FireEvent unique_ptr copy + NetworkBusEventData vector"},
+	{AllocTag::Logger,   0.5, "none on the ping path"},
+	{AllocTag::Other,    0.5, "background threads"},
+};
+
+#if NETWORK_ENABLE_COROUTINES
+// 코루틴 에코: 패킷은 세션 키에서 기다리던 코루틴을 인라인 재개 — 핸들러 경로 추가 할당 없음
+const Budget kCoroutineBudgets[] = {
+	{AllocTag::Io,       3.5, "epoll_event[] per ProcessCompletions x2, pending recv map node"},
+	{AllocTag::Recv,     2.5, "make_shared<vector> recv copy (control block + data)"},
+	{AllocTag::Dispatch, 1.5, "AsyncScope std::function closure"},
+	{AllocTag::Handler,  0.5, "none (RecvAsync resumes the echo coroutine in place)"},
+	{AllocTag::Send,     1.5, "pending send map node (send buffers reused from SharedSendBuffer pool)"},
+	{AllocTag::EventBus, 2.5, "FireEvent unique_ptr copy + NetworkBusEventData vector"},
+	{AllocTag::Logger,   0.5, "none on the ping path"},
+	{AllocTag::Other,    0.5, "background threads"},
+};
+#endif
+
+enum class HandlerMode
+{
+	Dispatcher,       // SetOnRecv, 로직 디스패처 경유
+	RunToCompletion,  // SetOnRecv, I/O 스레드 인라인
+	Coroutine,        // EnableRecvAsync + Spawn한 에코 코루틴
+};
+
+int gPassed = 0;
+int gFailed = 0;
+
+void Pass(const char *name)
+{
+	std::cout << "[PASS] " << name << "\n";
+	++gPassed;
+}
+
+void Fail(const char *name, const std::string &reason)
+{
+	std::cout << "[FAIL] " << name << " - " << reason << "\n";
+	++gFailed;
+}
+
+// 테스트 전용 에코 핸들러 — ClientPacketHandler의 Ping 경로와 같은 모양 (로그 없음)
+void EchoPing(Session *session, const char *data, uint32_t size)
+{
+	if (size < sizeof(PKT_PingReq))
+		return;
+	const auto *header = reinterpret_cast<const PacketHeader *>(data);
+	if (header->id != static_cast<uint16_t>(PacketType::PingReq))
+		return;
+	const auto *ping = reinterpret_cast<const PKT_PingReq *>(data);
+	session->SendInPlace<PKT_PongRes>([ping](PKT_PongRes &pong) {
+		pong.clientTime = ping->clientTime;
+		pong.sequence   = ping->sequence;
+	});
+}
+
+bool RecvAll(int fd, char *buffer, size_t size)
+{
+	size_t received = 0;
+	while (received < size)
+	{
+		const ssize_t n = recv(fd, buffer + received, size - received, 0);
+		if (n <= 0)
+			return false;
+		received += static_cast<size_t>(n);
+	}
+	return true;
+}
+
+bool RoundTrip(int fd, uint32_t sequence)
+{
+	PKT_PingReq ping;
+	ping.clientTime = sequence;
+	ping.sequence   = sequence;
+	if (send(fd, &ping, sizeof(ping), 0) != static_cast<ssize_t>(sizeof(ping)))
+		return false;
+	PKT_PongRes pong;
+	if (!RecvAll(fd, reinterpret_cast<char *>(&pong), sizeof(pong)))
+		return false;
+	return pong.sequence == sequence;
+}
+
+int ConnectLoopback(uint16_t port)
+{
+	for (int attempt = 0; attempt < 50; ++attempt)
+	{
+		const int fd = socket(AF_INET, SOCK_STREAM, 0);
+		sockaddr_in addr{};
+		addr.sin_family = AF_INET;
+		addr.sin_port   = htons(port);
+		inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+		if (connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0)
+		{
+			int noDelay = 1;
+			setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+			timeval timeout{5, 0};
+			setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+			return fd;
+		}
+		close(fd);
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}
+	return -1;
+}
+
+#if NETWORK_ENABLE_COROUTINES
+// 세션 수명 동안 도는 에코 코루틴 — 패킷 뷰는 다음 co_await 전까지 유효
+Concurrency::Task<void> CoroutineEcho(Session *session)
+{
+	for (;;)
+	{
+		const Session::RecvPacket packet = co_await session->RecvAsync();
+		if (!packet.data)
+			co_return;
+		EchoPing(session, packet.data, packet.size);
+	}
+}
+#endif
+
+template <size_t N>
+void TestPingPongAllocationBudget(const char *name, HandlerMode mode, const Budget (&budgets)[N],
+                                  uint16_t port, uint32_t messages)
+{
+	// 엔진은 Initialize에서 설정을 읽는다
+	Utils::ConfigManager::Instance().Network().RunToCompletion = mode == HandlerMode::RunToCompletion;
+
+	auto engine = CreateNetworkEngine("auto");
+#if NETWORK_ENABLE_COROUTINES
+	if (mode == HandlerMode::Coroutine)
+	{
+		SessionManager::Instance().SetSessionConfigurator([](Session *session) { session->EnableRecvAsync(); });
+		if (engine)
+		{
+			engine->RegisterEventCallback(NetworkEvent::Connected, [](const NetworkEventData &event) {
+				SessionRef session = SessionManager::Instance().GetSession(event.connectionId);
+				if (session)
+					session->Spawn(CoroutineEcho(session.get()));
+			});
+		}
+	}
+	else
+#endif
+	{
+		SessionManager::Instance().SetSessionConfigurator(
+			[](Session *session) { session->SetOnRecv(EchoPing); });
+	}
+
+	if (!engine || !engine->Initialize(16, port) || !engine->Start())
+	{
+		Fail(name, "engine start failed (port " + std::to_string(port) + " in use?)");
+		return;
+	}
+
+	const int fd = ConnectLoopback(port);
+	if (fd < 0)
+	{
+		Fail(name, "connect failed");
+		engine->Stop();
+		return;
+	}
+
+	// 워밍업: 풀/큐/스레드 로컬 버퍼가 정상 상태 크기에 도달하도록
+	constexpr uint32_t kWarmup = 2000;
+	bool ok = true;
+	for (uint32_t i = 0; i < kWarmup && ok; ++i)
+		ok = RoundTrip(fd, i);
+
+	ResetCounters();
+	gCounting.store(true);
+	for (uint32_t i = 0; i < messages && ok; ++i)
+		ok = RoundTrip(fd, kWarmup + i);
+	// 마지막 pong의 송신 완료 처리(DataSent 이벤트)까지 포함
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	gCounting.store(false);
+
+	close(fd);
+	engine->Stop();
+
+	if (!ok)
+	{
+		Fail(name, "round trip failed");
+		return;
+	}
+
+	std::printf("\n  %-10s %12s %10s %10s %8s  %s\n", "Subsystem", "allocs", "per msg", "bytes/msg", "budget",
+	            "source");
+	uint64_t total = 0;
+	std::string overBudget;
+	for (const Budget &budget : budgets)
+	{
+		const size_t tag = static_cast<size_t>(budget.mTag);
+		const uint64_t count = gAllocCount[tag].load();
+		const double perMessage = static_cast<double>(count) / messages;
+		const double bytesPerMessage = static_cast<double>(gAllocBytes[tag].load()) / messages;
+		total += count;
+		const bool over = perMessage > budget.mMaxPerMessage;
+		std::printf("  %-10s %12llu %10.2f %10.1f %8.1f  %s%s\n", Utils::AllocTagName(budget.mTag),
+		            static_cast<unsigned long long>(count), perMessage, bytesPerMessage, budget.mMaxPerMessage,
+		            budget.mSource, over ? "  <-- over budget" : "");
+		if (over)
+			overBudget += std::string(overBudget.empty() ? "" : ", ") + Utils::AllocTagName(budget.mTag);
+	}
+	std::printf("  %-10s %12llu %10.2f  (%u messages)\n\n", "Total", static_cast<unsigned long long>(total),
+	            static_cast<double>(total) / messages, messages);
+
+	if (overBudget.empty())
+		Pass(name);
+	else
+		Fail(name, "over budget: " + overBudget);
+}
+
+#if NETWORK_ENABLE_COROUTINES
+// 3단계 핸들러 체인(단계마다 같은 세션 키로 한 번 건너감)을 콜백과 코루틴으로 각각 돌린다.
+// 콜백: 단계마다 상태를 캡처한 클로저를 새로 만든다. 코루틴: 프레임 1개가 체인 전체를 담는다.
+constexpr int kChainSteps = 3;
+
+struct CallbackChain
+{
+	Concurrency::KeyedDispatcher *mDispatcher;
+	uint64_t                      mKey;
+	std::atomic<uint32_t>        *mDone;
+	uint64_t                      mSum = 0;
+};
+
+void RunCallbackStep(std::shared_ptr<CallbackChain> chain, int step)
+{
+	chain->mSum += static_cast<uint64_t>(step);
+	if (step == kChainSteps)
+	{
+		chain->mDone->fetch_add(1, std::memory_order_release);
+		return;
+	}
+	Concurrency::KeyedDispatcher &dispatcher = *chain->mDispatcher;
+	const uint64_t key = chain->mKey;
+	dispatcher.Dispatch(key, [chain = std::move(chain), step]() mutable { RunCallbackStep(std::move(chain), step + 1); });
+}
+
+Concurrency::Task<uint64_t> CoroutineStep(int step)
+{
+	co_await Concurrency::Yield();
+	co_return static_cast<uint64_t>(step);
+}
+
+Concurrency::Task<void> CoroutineChain(std::atomic<uint32_t> *done)
+{
+	uint64_t sum = 0;
+	for (int step = 1; step <= kChainSteps; ++step)
+		sum += co_await CoroutineStep(step);
+	if (sum != 0)
+		done->fetch_add(1, std::memory_order_release);
+}
+
+bool WaitForChains(std::atomic<uint32_t> &done, uint32_t expected)
+{
+	for (int i = 0; i < 5000 && done.load(std::memory_order_acquire) < expected; ++i)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	return done.load(std::memory_order_acquire) == expected;
+}
+
+void TestCoroutineChainAllocations(uint32_t chains)
+{
+	const char *name = "CoroutineChainAllocations";
+	// 정상 상태 0 — 프레임은 풀에서, 재개 클로저는 std::function 내부 버퍼에
+	constexpr double kCoroutineBudget = 0.5;
+
+	Concurrency::KeyedDispatcher dispatcher;
+	Concurrency::KeyedDispatcher::Options options;
+	options.mWorkerCount = 1;
+	options.mName        = "ChainDispatcher";
+	dispatcher.Initialize(options);
+	Concurrency::AsyncScope scope;
+
+	// 체인을 하나씩 돌려 큐·풀이 1개 체인 분량으로 정상 상태에 머물게 한다
+	auto runCallback = [&](uint32_t count) {
+		std::atomic<uint32_t> done{0};
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			auto chain = std::make_shared<CallbackChain>();
+			chain->mDispatcher = &dispatcher;
+			chain->mKey        = 1;
+			chain->mDone       = &done;
+			dispatcher.Dispatch(1, [chain]() mutable { RunCallbackStep(std::move(chain), 1); });
+			if (!WaitForChains(done, i + 1))
+				return false;
+		}
+		return true;
+	};
+	auto runCoroutine = [&](uint32_t count) {
+		std::atomic<uint32_t> done{0};
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			if (!Concurrency::Spawn(dispatcher, 1, scope, CoroutineChain(&done)) || !WaitForChains(done, i + 1))
+				return false;
+		}
+		return true;
+	};
+
+	bool ok = runCallback(100) && runCoroutine(100);
+
+	auto countAllocations = [](uint64_t &total) {
+		total = 0;
+		for (size_t tag = 0; tag < kTagCount; ++tag)
+			total += gAllocCount[tag].load();
+	};
+
+	uint64_t callbackAllocs  = 0;
+	uint64_t coroutineAllocs = 0;
+	if (ok)
+	{
+		ResetCounters();
+		gCounting.store(true);
+		ok = runCallback(chains);
+		gCounting.store(false);
+		countAllocations(callbackAllocs);
+	}
+	if (ok)
+	{
+		ResetCounters();
+		gCounting.store(true);
+		ok = runCoroutine(chains);
+		gCounting.store(false);
+		countAllocations(coroutineAllocs);
+	}
+
+	scope.Cancel();
+	scope.WaitForDrain(1000);
+	dispatcher.Shutdown();
+
+	if (!ok)
+	{
+		Fail(name, "chains did not complete");
+		return;
+	}
+
+	const double callbackPerChain  = static_cast<double>(callbackAllocs) / chains;
+	const double coroutinePerChain = static_cast<double>(coroutineAllocs) / chains;
+	std::printf("\n  %-10s %12s %10s %8s  %s\n", "Chain", "allocs", "per chain", "budget", "source");
+	std::printf("  %-10s %12llu %10.2f %8s  %s\n", "Callback", static_cast<unsigned long long>(callbackAllocs),
+	            callbackPerChain, "-", "make_shared state + one heap closure per hop");
+	std::printf("  %-10s %12llu %10.2f %8.1f  %s\n\n", "Coroutine", static_cast<unsigned long long>(coroutineAllocs),
+	            coroutinePerChain, kCoroutineBudget, "frames from CoroutineFramePool, inline resume closures");
+
+	if (coroutinePerChain <= kCoroutineBudget)
+		Pass(name);
+	else
+		Fail(name, "coroutine chain over budget");
+}
+#endif
+} // namespace
+
+int main(int argc, char *argv[])
+{
+	uint32_t messages = 20000;
+	uint16_t port     = 29870;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		if (arg == "--messages" && i + 1 < argc)
+			messages = static_cast<uint32_t>((std::max)(1ul, std::stoul(argv[++i])));
+		else if (arg == "--port" && i + 1 < argc)
+			port = static_cast<uint16_t>(std::stoi(argv[++i]));
+	}
+
+	std::cout << "=== Ping/Pong Allocation Budget Test ===\n\n";
+	// 운영 기본값(INFO)과 같은 레벨 — 패킷마다 찍히는 Info 로그가 있으면 Logger 예산에 잡힌다
+	Utils::Logger::SetLevel(Utils::LogLevel::Info);
+
+	TestPingPongAllocationBudget("PingPongAllocationBudget", HandlerMode::Dispatcher, kDispatcherBudgets, port,
+	                             messages);
+	TestPingPongAllocationBudget("PingPongAllocationBudget/RunToCompletion", HandlerMode::RunToCompletion,
+	                             kRunToCompletionBudgets, static_cast<uint16_t>(port + 1), messages);
+#if NETWORK_ENABLE_COROUTINES
+	TestPingPongAllocationBudget("PingPongAllocationBudget/Coroutine", HandlerMode::Coroutine, kCoroutineBudgets,
+	                             static_cast<uint16_t>(port + 2), messages);
+	TestCoroutineChainAllocations(messages);
+#endif
+
+	std::cout << "Result: " << gPassed << " passed, " << gFailed << " failed\n";
+	return gFailed > 0 ? 1 : 0;
+}
+
+#else
+
+#include <iostream>
+
+int main()
+{
+	std::cout << "[SKIP] AllocationTest: Linux/macOS only\n";
+	return 0;
+}
+
+#endif
@@ -0,0 +1,192 @@
+// ConnectionPool 크기 정책 테스트 (Mock 백엔드).
+//
+// - 초기화 시 mMinPoolSize만큼 미리 연결을 만든다.
+// - mMaxPoolSize에 도달하면 GetConnection()은 반환을 기다리고, 기한을 넘기면 타임아웃으로 실패한다.
+// - 유지보수 스레드는 mIdleTimeout을 넘긴 유휴 연결을 회수하되 mMinPoolSize 아래로는 내리지 않는다.
+//
+// 사용법: ConnectionPoolTest
+
+#include "Database/ConnectionPool.h"
+
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Network::Database;
+
+namespace
+{
+
+int gPassed = 0;
+int gFailed = 0;
+
+void Pass(const char *name)
+{
+	std::cout << "[PASS] " << name << "\n";
+	++gPassed;
+}
+
+void Fail(const char *name, const std::string &reason)
+{
+	std::cout << "[FAIL] " << name << " - " << reason << "\n";
+	++gFailed;
+}
+
+DatabaseConfig MockConfig(int minSize, int maxSize)
+{
+	DatabaseConfig config;
+	config.mType        = DatabaseType::Mock;
+	config.mMinPoolSize = minSize;
+	config.mMaxPoolSize = maxSize;
+	return config;
+}
+
+void TestMinSizePrewarm()
+{
+	const char *name = "Pool/MinSizePrewarm";
+
+	ConnectionPool pool;
+	if (!pool.Initialize(MockConfig(3, 5)))
+	{
+		Fail(name, "initialize failed");
+		return;
+	}
+
+	const size_t total     = pool.GetTotalConnections();
+	const size_t available = pool.GetAvailableConnections();
+
+	// 미리 만든 연결은 새로 만들지 않고 바로 대여된다
+	auto conn = pool.GetConnection();
+	const bool open = conn && conn->IsOpen();
+	const size_t totalAfterGet = pool.GetTotalConnections();
+	pool.ReturnConnection(conn);
+	pool.Shutdown();
+
+	if (total != 3 || available != 3)
+		Fail(name, "expected 3 prewarmed idle connections, got total " + std::to_string(total) +
+		               " idle " + std::to_string(available));
+	else if (!open || totalAfterGet != 3)
+		Fail(name, "checkout did not reuse a prewarmed connection");
+	else
+		Pass(name);
+}
+
+void TestMaxSizeWait()
+{
+	const char *name = "Pool/MaxSizeWait";
+
+	ConnectionPool pool;
+	if (!pool.Initialize(MockConfig(1, 2)))
+	{
+		Fail(name, "initialize failed");
+		return;
+	}
+	pool.SetConnectionTimeout(1);
+
+	auto first  = pool.GetConnection();
+	auto second = pool.GetConnection();
+
+	// 상한에 걸린 호출은 반환을 기다렸다가 그 연결을 받는다
+	auto waiter = std::async(std::launch::async, [&pool] {
+		const auto start = std::chrono::steady_clock::now();
+		auto conn = pool.GetConnection();
+		return std::make_pair(conn, std::chrono::steady_clock::now() - start);
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	const bool blocked = waiter.wait_for(std::chrono::seconds(0)) == std::future_status::timeout;
+	pool.ReturnConnection(first);
+	auto [third, waited] = waiter.get();
+
+	// 아무도 반환하지 않으면 기한(1초) 후 타임아웃
+	bool timedOut = false;
+	const auto timeoutStart = std::chrono::steady_clock::now();
+	try
+	{
+		pool.GetConnection();
+	}
+	catch (const DatabaseException &)
+	{
+		timedOut = true;
+	}
+	const auto timeoutWaited = std::chrono::steady_clock::now() - timeoutStart;
+
+	const size_t   total    = pool.GetTotalConnections();
+	const uint64_t timeouts = pool.GetWaitHistogram().mTimeouts;
+	pool.ReturnConnection(second);
+	pool.ReturnConnection(third);
+	pool.Shutdown();
+
+	if (!blocked)
+		Fail(name, "checkout above max size did not wait");
+	else if (third != first || waited < std::chrono::milliseconds(90))
+		Fail(name, "waiter did not receive the returned connection");
+	else if (!timedOut || timeoutWaited < std::chrono::milliseconds(900) || timeouts != 1)
+		Fail(name, "checkout at max size did not time out after the connection timeout");
+	else if (total != 2)
+		Fail(name, "pool grew past max size: " + std::to_string(total));
+	else
+		Pass(name);
+}
+
+void TestIdleExpiryKeepsMinimum()
+{
+	const char *name = "Pool/IdleExpiryKeepsMinimum";
+
+	ConnectionPool pool;
+	if (!pool.Initialize(MockConfig(2, 5)))
+	{
+		Fail(name, "initialize failed");
+		return;
+	}
+	pool.SetIdleTimeout(0);
+	pool.SetMaintenanceInterval(1);
+
+	std::vector<std::shared_ptr<IConnection>> held;
+	for (int i = 0; i < 5; ++i)
+		held.push_back(pool.GetConnection());
+	for (auto &conn : held)
+		pool.ReturnConnection(conn);
+	const size_t grown = pool.GetTotalConnections();
+
+	// 첫 주기는 Initialize 시점의 기본 주기(5초)로 잡혀 있으므로 넉넉히 기다린다
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+	while (pool.GetTotalConnections() > 2 && std::chrono::steady_clock::now() < deadline)
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	const size_t reaped = pool.GetTotalConnections();
+
+	// 한 주기 더 돌아도 하한 아래로 내려가지 않는다
+	std::this_thread::sleep_for(std::chrono::milliseconds(2500));
+	const size_t settled = pool.GetTotalConnections();
+	auto conn = pool.GetConnection();
+	const bool open = conn && conn->IsOpen();
+	pool.ReturnConnection(conn);
+	pool.Shutdown();
+
+	if (grown != 5)
+		Fail(name, "expected 5 connections before expiry, got " + std::to_string(grown));
+	else if (reaped != 2)
+		Fail(name, "idle connections were not reaped down to min size: " + std::to_string(reaped));
+	else if (settled != 2)
+		Fail(name, "idle expiry went below min size: " + std::to_string(settled));
+	else if (!open)
+		Fail(name, "remaining connection is not usable");
+	else
+		Pass(name);
+}
+
+} // namespace
+
+int main()
+{
+	std::cout << "=== ConnectionPool Tests ===\n\n";
+
+	TestMinSizePrewarm();
+	TestMaxSizeWait();
+	TestIdleExpiryKeepsMinimum();
+
+	std::cout << "\nResult: " << gPassed << " passed, " << gFailed << " failed\n";
+	return gFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,361 @@
+// DBServerTaskQueue 파이프라인/마감 테스트.
+//
+// 실제 DB 서버 대신 FakeDBServer가 송신 프레임을 디코드해 requestId를 모으고, 테스트가
+// 원하는 순서로 OnDBResponse를 호출한다 (응답 지연·역순·무응답을 마음대로 만든다).
+//   - 세션당 in-flight 윈도우: 윈도우만큼만 전송하고 응답이 와야 다음을 보낸다.
+//   - 역순 응답: 결과는 보관했다가 제출 순서대로 콜백한다.
+//   - 마감 만료: 응답 없는 요청은 DBServerTimeout으로 끝나고 늦은 응답은 무시된다.
+//   - 지연 취소 정리: 오래된 요청 하나가 heap top을 막아도 응답된 항목이 쌓이지 않는다.
+//
+// 사용법: DBServerTaskQueueTest
+
+#include "DBServerTaskQueue.h"
+#include "Network/Core/ServerPacketCodec.h"
+#include "Utils/Logger.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Network;
+using namespace Network::TestServer;
+
+namespace
+{
+
+int gPassed = 0;
+int gFailed = 0;
+
+void Pass(const char *name)
+{
+	std::cout << "[PASS] " << name << "\n";
+	++gPassed;
+}
+
+void Fail(const char *name, const std::string &reason)
+{
+	std::cout << "[FAIL] " << name << " - " << reason << "\n";
+	++gFailed;
+}
+
+constexpr auto kWaitLimit = std::chrono::seconds(3);
+
+// 송신 프레임에서 requestId를 꺼내 보관하는 가짜 DB 서버 (응답은 테스트가 직접 보낸다)
+class FakeDBServer
+{
+  public:
+	bool Send(const void *data, uint32_t size)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		Core::ForEachDBQueryReq(static_cast<const char *>(data), size,
+		                        [this](const Core::DBQueryReqEntry &entry, const char *, uint16_t) {
+			                        mSent.push_back(entry.queryId);
+		                        });
+		mCV.notify_all();
+		return true;
+	}
+
+	bool WaitForSent(size_t count)
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		return mCV.wait_for(lock, kWaitLimit, [&] { return mSent.size() >= count; });
+	}
+
+	size_t SentCount() const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mSent.size();
+	}
+
+	uint64_t SentAt(size_t index) const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mSent.at(index);
+	}
+
+  private:
+	mutable std::mutex      mMutex;
+	std::condition_variable mCV;
+	std::vector<uint64_t>   mSent;
+};
+
+// 콜백 도착 순서 기록
+class Completions
+{
+  public:
+	struct Record
+	{
+		int         tag;
+		ResultCode  result;
+		std::string detail;
+	};
+
+	std::function<void(ResultCode, const std::string &)> Callback(int tag)
+	{
+		return [this, tag](ResultCode result, const std::string &detail) {
+			std::lock_guard<std::mutex> lock(mMutex);
+			mRecords.push_back({tag, result, detail});
+			mCV.notify_all();
+		};
+	}
+
+	bool WaitFor(size_t count)
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		return mCV.wait_for(lock, kWaitLimit, [&] { return mRecords.size() >= count; });
+	}
+
+	std::vector<Record> Snapshot() const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mRecords;
+	}
+
+	size_t Count() const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mRecords.size();
+	}
+
+  private:
+	mutable std::mutex      mMutex;
+	std::condition_variable mCV;
+	std::vector<Record>     mRecords;
+};
+
+bool StartQueue(DBServerTaskQueue &queue, FakeDBServer &server, size_t window)
+{
+	return queue.Initialize(1, [&server](const void *data, uint32_t size) { return server.Send(data, size); },
+	                        window);
+}
+
+void Submit(DBServerTaskQueue &queue, Completions &completions, ConnectionId sessionId, int tag)
+{
+	DBServerTask task;
+	task.type      = DBServerTaskType::SavePlayerProgress;
+	task.sessionId = sessionId;
+	task.data      = "{\"tag\":" + std::to_string(tag) + "}";
+	task.callback  = completions.Callback(tag);
+	queue.EnqueueTask(std::move(task));
+}
+
+bool InSubmissionOrder(const std::vector<Completions::Record> &records)
+{
+	for (size_t i = 0; i < records.size(); ++i)
+	{
+		if (records[i].tag != static_cast<int>(i))
+			return false;
+	}
+	return true;
+}
+
+void TestInflightWindow()
+{
+	const char *name = "Pipeline/InflightWindow";
+
+	Completions       completions;
+	FakeDBServer      server;
+	DBServerTaskQueue queue;
+	if (!StartQueue(queue, server, 2))
+	{
+		Fail(name, "initialize failed");
+		return;
+	}
+
+	for (int i = 0; i < 5; ++i)
+		Submit(queue, completions, 7, i);
+
+	// 윈도우(2)만큼만 나가고 나머지는 응답을 기다린다
+	const bool firstTwo = server.WaitForSent(2);
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	const size_t sentBeforeReply = server.SentCount();
+	const size_t inflight        = queue.GetInflightCount();
+
+	// 응답 하나마다 정확히 하나씩 더 나간다
+	bool refilled = true;
+	for (size_t i = 0; i < 5; ++i)
+	{
+		queue.OnDBResponse(server.SentAt(i), ResultCode::Success, "ok");
+		if (i + 2 < 5 && !server.WaitForSent(i + 3))
+			refilled = false;
+	}
+	const bool allDone = completions.WaitFor(5);
+	const auto records = completions.Snapshot();
+	queue.Shutdown();
+
+	if (!firstTwo || sentBeforeReply != 2 || inflight != 2)
+		Fail(name, "expected exactly 2 requests on the wire, saw " + std::to_string(sentBeforeReply) +
+		               " (inflight " + std::to_string(inflight) + ")");
+	else if (!refilled || server.SentCount() != 5)
+		Fail(name, "window did not refill one request per response");
+	else if (!allDone || !InSubmissionOrder(records))
+		Fail(name, "callbacks missing or out of submission order");
+	else
+		Pass(name);
+}
+
+void TestOutOfOrderCompletion()
+{
+	const char *name = "Pipeline/OutOfOrderCompletion";
+
+	Completions       completions;
+	FakeDBServer      server;
+	DBServerTaskQueue queue;
+	if (!StartQueue(queue, server, 4))
+	{
+		Fail(name, "initialize failed");
+		return;
+	}
+
+	for (int i = 0; i < 4; ++i)
+		Submit(queue, completions, 9, i);
+	const bool allSent = server.WaitForSent(4);
+
+	// 뒤에서부터 응답 — head(0)가 끝나기 전에는 아무 콜백도 나가지 않는다
+	for (size_t i = 3; i >= 1; --i)
+		queue.OnDBResponse(server.SentAt(i), ResultCode::Success, "r" + std::to_string(i));
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	const size_t heldBack = completions.Count();
+
+	queue.OnDBResponse(server.SentAt(0), ResultCode::DBQueryFailed, "r0");
+	const bool allDone = completions.WaitFor(4);
+	const auto records = completions.Snapshot();
+	queue.Shutdown();
+
+	bool resultsMatch = records.size() == 4 && records[0].result == ResultCode::DBQueryFailed;
+	for (size_t i = 0; resultsMatch && i < records.size(); ++i)
+		resultsMatch = records[i].detail == "r" + std::to_string(i);
+
+	if (!allSent)
+		Fail(name, "window of 4 did not send all requests");
+	else if (heldBack != 0)
+		Fail(name, std::to_string(heldBack) + " callback(s) fired before the head request completed");
+	else if (!allDone || !InSubmissionOrder(records))
+		Fail(name, "callbacks missing or out of submission order");
+	else if (!resultsMatch)
+		Fail(name, "parked results were delivered to the wrong requests");
+	else
+		Pass(name);
+}
+
+void TestDeadlineExpiry()
+{
+	const char *name = "Deadline/Expiry";
+
+	Completions       completions;
+	FakeDBServer      server;
+	DBServerTaskQueue queue;
+	queue.SetRequestTimeout(std::chrono::milliseconds(100));
+	if (!StartQueue(queue, server, 1))
+	{
+		Fail(name, "initialize failed");
+		return;
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	Submit(queue, completions, 11, 0);
+	Submit(queue, completions, 11, 1);
+	server.WaitForSent(1);
+
+	// 첫 요청은 응답하지 않는다 — 마감이 지나면 Timeout으로 끝나고 윈도우가 다음 요청에 넘어간다
+	const bool expired  = completions.WaitFor(1);
+	const auto elapsed  = std::chrono::steady_clock::now() - start;
+	const bool nextSent = server.WaitForSent(2);
+
+	// 늦게 온 응답은 무시되고, 다음 요청의 응답은 정상 전달된다
+	queue.OnDBResponse(server.SentAt(0), ResultCode::Success, "late");
+	if (nextSent)
+		queue.OnDBResponse(server.SentAt(1), ResultCode::Success, "ok");
+	completions.WaitFor(2);
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	const auto records  = completions.Snapshot();
+	const size_t inflight = queue.GetInflightCount();
+	queue.Shutdown();
+
+	if (!expired || records.empty() || records[0].result != ResultCode::DBServerTimeout)
+		Fail(name, "unanswered request did not complete with DBServerTimeout");
+	else if (elapsed < std::chrono::milliseconds(90))
+		Fail(name, "request timed out before its deadline");
+	else if (!nextSent)
+		Fail(name, "timed-out request did not free its window slot");
+	else if (records.size() != 2 || records[1].tag != 1 || records[1].result != ResultCode::Success)
+		Fail(name, "late response was delivered or the next response was lost (" +
+		               std::to_string(records.size()) + " callbacks)");
+	else if (inflight != 0)
+		Fail(name, "inflight count did not drain: " + std::to_string(inflight));
+	else
+		Pass(name);
+}
+
+void TestDeadlineCompaction()
+{
+	const char *name = "Deadline/CompactCancelled";
+
+	Completions       completions;
+	FakeDBServer      server;
+	DBServerTaskQueue queue;
+	if (!StartQueue(queue, server, 1))
+	{
+		Fail(name, "initialize failed");
+		return;
+	}
+
+	// 세션 1의 요청은 끝까지 응답하지 않아 heap top을 막는다 (5초 마감)
+	Submit(queue, completions, 1, 0);
+	server.WaitForSent(1);
+
+	// 세션 2는 보내는 족족 응답 — 마감 항목이 top 뒤에서 지연 취소 상태로 쌓인다
+	constexpr int kAnswered = 300;
+	bool ok = true;
+	for (int i = 0; ok && i < kAnswered; ++i)
+	{
+		Submit(queue, completions, 2, i + 1);
+		ok = server.WaitForSent(static_cast<size_t>(i) + 2);
+		if (ok)
+		{
+			queue.OnDBResponse(server.SentAt(static_cast<size_t>(i) + 1), ResultCode::Success, "ok");
+			ok = completions.WaitFor(static_cast<size_t>(i) + 1);
+		}
+	}
+
+	// 살아있는 요청 1개 → 재구성 기준 (1 + 16) × 4 를 넘지 않아야 한다
+	const auto deadline = std::chrono::steady_clock::now() + kWaitLimit;
+	size_t heapSize = queue.GetDeadlineCount();
+	while (heapSize > 68 && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		heapSize = queue.GetDeadlineCount();
+	}
+	const size_t inflight = queue.GetInflightCount();
+	queue.Shutdown();
+
+	if (!ok)
+		Fail(name, "answered requests did not complete");
+	else if (heapSize > 68)
+		Fail(name, "cancelled deadlines were not compacted: heap holds " + std::to_string(heapSize) +
+		               " entries for 1 live request");
+	else if (inflight != 1)
+		Fail(name, "compaction dropped the live request (inflight " + std::to_string(inflight) + ")");
+	else
+		Pass(name);
+}
+
+} // namespace
+
+int main()
+{
+	std::cout << "=== DBServerTaskQueue Tests ===\n\n";
+	Utils::Logger::SetLevel(Utils::LogLevel::Err);
+
+	TestInflightWindow();
+	TestOutOfOrderCompletion();
+	TestDeadlineExpiry();
+	TestDeadlineCompaction();
+
+	std::cout << "\nResult: " << gPassed << " passed, " << gFailed << " failed\n";
+	return gFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,175 @@
+// KeyedDispatcher 대기 시간(sojourn) 과부하 판정 테스트.
+//
+// 워커 1개에 느린 Bulk 작업을 적체시키고 IsOverloaded(key)가 켜지는지 본다.
+// Control 작업을 함께 흘리는 경우가 핵심 — Control은 적체를 앞질러 바로 꺼내지므로
+// 판정에 섞이면 창 최소 대기 시간이 0 근처로 내려가 Bulk 적체가 보이지 않는다.
+// 적체가 빠지면(큐가 비면) 판정이 풀리는지도 확인한다.
+//
+// 사용법: DispatcherTest
+
+#include "Concurrency/KeyedDispatcher.h"
+#include "Utils/Logger.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace Network;
+using namespace Network::Concurrency;
+
+namespace
+{
+
+int gPassed = 0;
+int gFailed = 0;
+
+void Pass(const char *name)
+{
+	std::cout << "[PASS] " << name << "\n";
+	++gPassed;
+}
+
+void Fail(const char *name, const std::string &reason)
+{
+	std::cout << "[FAIL] " << name << " - " << reason << "\n";
+	++gFailed;
+}
+
+constexpr uint64_t kKey           = 1;
+constexpr uint32_t kTargetMs      = 5;
+constexpr uint32_t kIntervalMs    = 20;
+constexpr int      kBulkTasks     = 150;  // 작업당 2ms → 약 300ms 적체
+constexpr auto     kBulkWork      = std::chrono::milliseconds(2);
+constexpr auto     kControlPeriod = std::chrono::microseconds(500);
+
+bool StartDispatcher(KeyedDispatcher &dispatcher)
+{
+	KeyedDispatcher::Options options;
+	options.mWorkerCount         = 1;
+	options.mSojourn.mTargetMs   = kTargetMs;
+	options.mSojourn.mIntervalMs = kIntervalMs;
+	options.mName                = "DispatcherTest";
+	return dispatcher.Initialize(options);
+}
+
+// 적체가 빠질 때까지 IsOverloaded를 관찰한다. 한 번이라도 켜졌으면 true.
+bool WatchForOverload(KeyedDispatcher &dispatcher, const std::atomic<int> &bulkDone)
+{
+	bool seen = false;
+	while (bulkDone.load(std::memory_order_acquire) < kBulkTasks)
+	{
+		seen = seen || dispatcher.IsOverloaded(kKey);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	return seen;
+}
+
+// 큐가 빈 뒤 워커의 OnIdle로 판정이 풀리는가
+bool WaitForRecovery(KeyedDispatcher &dispatcher)
+{
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+	while (std::chrono::steady_clock::now() < deadline)
+	{
+		if (!dispatcher.IsOverloaded(kKey))
+			return true;
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+	return false;
+}
+
+void SubmitBulkBacklog(KeyedDispatcher &dispatcher, std::atomic<int> &bulkDone)
+{
+	for (int i = 0; i < kBulkTasks; ++i)
+	{
+		dispatcher.Dispatch(kKey, TaskPriority::Bulk, [&bulkDone] {
+			std::this_thread::sleep_for(kBulkWork);
+			bulkDone.fetch_add(1, std::memory_order_release);
+		});
+	}
+}
+
+void TestBulkBacklogDetected()
+{
+	const char *name = "SojournOverload/BulkOnly";
+
+	KeyedDispatcher dispatcher;
+	if (!StartDispatcher(dispatcher))
+	{
+		Fail(name, "dispatcher start failed");
+		return;
+	}
+
+	std::atomic<int> bulkDone{0};
+	SubmitBulkBacklog(dispatcher, bulkDone);
+	const bool overloaded = WatchForOverload(dispatcher, bulkDone);
+	const bool recovered  = WaitForRecovery(dispatcher);
+	dispatcher.Shutdown();
+
+	if (!overloaded)
+		Fail(name, "bulk backlog never reported as overloaded");
+	else if (!recovered)
+		Fail(name, "overload did not clear after the queue drained");
+	else
+		Pass(name);
+}
+
+void TestControlTrafficDoesNotMaskBacklog()
+{
+	const char *name = "SojournOverload/ControlAndBulk";
+
+	KeyedDispatcher dispatcher;
+	if (!StartDispatcher(dispatcher))
+	{
+		Fail(name, "dispatcher start failed");
+		return;
+	}
+
+	// Control 작업은 Drop 정책이어도 stale 판정을 받지 않으므로 모두 실행돼야 한다
+	std::atomic<int>  controlSubmitted{0};
+	std::atomic<int>  controlRan{0};
+	std::atomic<bool> stopControl{false};
+	std::thread controlProducer([&] {
+		while (!stopControl.load(std::memory_order_acquire))
+		{
+			if (dispatcher.Dispatch(kKey, TaskPriority::Control, DropPolicy::Drop,
+			                        [&controlRan] { controlRan.fetch_add(1, std::memory_order_relaxed); }))
+				controlSubmitted.fetch_add(1, std::memory_order_relaxed);
+			std::this_thread::sleep_for(kControlPeriod);
+		}
+	});
+
+	std::atomic<int> bulkDone{0};
+	SubmitBulkBacklog(dispatcher, bulkDone);
+	const bool overloaded = WatchForOverload(dispatcher, bulkDone);
+
+	stopControl.store(true, std::memory_order_release);
+	controlProducer.join();
+	const bool recovered = WaitForRecovery(dispatcher);
+	dispatcher.Shutdown();
+
+	if (!overloaded)
+		Fail(name, "control traffic masked the bulk backlog (never overloaded)");
+	else if (!recovered)
+		Fail(name, "overload did not clear after the queue drained");
+	else if (controlRan.load() != controlSubmitted.load())
+		Fail(name, "control tasks were shed: ran " + std::to_string(controlRan.load()) + " of " +
+		               std::to_string(controlSubmitted.load()));
+	else
+		Pass(name);
+}
+
+} // namespace
+
+int main()
+{
+	std::cout << "=== KeyedDispatcher Sojourn Tests ===\n\n";
+	Utils::Logger::SetLevel(Utils::LogLevel::Warn);
+
+	TestBulkBacklogDetected();
+	TestControlTrafficDoesNotMaskBacklog();
+
+	std::cout << "\nResult: " << gPassed << " passed, " << gFailed << " failed\n";
+	return gFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,329 @@
+// ExecutionQueue 우선순위 레인 테스트.
+//
+// - 꺼내는 순서: Control → Normal → Bulk, 레인 안에서는 FIFO.
+// - 상위 레인이 계속 차 있어도 하위 레인은 mLaneBurstLimit번 밀린 뒤 한 번씩 꺼내진다.
+// - 용량은 레인별 — Normal이 가득 차도 Control 제출은 거부/블로킹되지 않는다.
+// - 가득 찬 레인에서 한 번 꺼내면 블로킹된 생산자 하나만 들어오고, 연속으로 빈자리가 여럿
+//   생기면 들어온 생산자가 다음 대기자에게 깨움을 넘긴다.
+//
+// 사용법: ExecutionQueueTest
+
+#include "Concurrency/ExecutionQueue.h"
+
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+using namespace Network::Concurrency;
+
+namespace
+{
+
+int gPassed = 0;
+int gFailed = 0;
+
+void Pass(const char *name)
+{
+	std::cout << "[PASS] " << name << "\n";
+	++gPassed;
+}
+
+void Fail(const char *name, const std::string &reason)
+{
+	std::cout << "[FAIL] " << name << " - " << reason << "\n";
+	++gFailed;
+}
+
+struct Item
+{
+	TaskPriority lane = TaskPriority::Normal;
+	int          seq  = 0;
+};
+
+ExecutionQueueOptions<Item> MakeOptions(BackpressurePolicy policy, size_t capacity, size_t burstLimit)
+{
+	ExecutionQueueOptions<Item> options;
+	options.mBackpressure   = policy;
+	options.mCapacity       = capacity;
+	options.mLaneBurstLimit = burstLimit;
+	return options;
+}
+
+// "C0 N0 B0 ..." — 실패 메시지용
+std::string Describe(const std::vector<Item> &items)
+{
+	std::string text;
+	for (const Item &item : items)
+	{
+		if (!text.empty())
+			text += ' ';
+		text += static_cast<char>(std::toupper(static_cast<unsigned char>(TaskPriorityName(item.lane)[0])));
+		text += std::to_string(item.seq);
+	}
+	return text;
+}
+
+std::vector<Item> PopAll(ExecutionQueue<Item> &queue)
+{
+	std::vector<Item> items;
+	Item item;
+	while (queue.TryPop(item))
+		items.push_back(item);
+	return items;
+}
+
+bool WaitFor(const std::function<bool()> &condition, int timeoutMs)
+{
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+	while (!condition())
+	{
+		if (std::chrono::steady_clock::now() >= deadline)
+			return false;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	return true;
+}
+
+// =============================================================================
+// 테스트
+// =============================================================================
+
+void TestLaneOrder()
+{
+	const char *name = "Lanes/ControlNormalBulkOrder";
+
+	// 레인마다 섞어 넣는다 — 상한(8)에 닿지 않는 개수라 순수 우선순위 순서가 나와야 한다
+	ExecutionQueue<Item> queue(MakeOptions(BackpressurePolicy::RejectNewest, 0, 8));
+	const TaskPriority pushOrder[] = {TaskPriority::Bulk,    TaskPriority::Normal, TaskPriority::Control,
+	                                  TaskPriority::Bulk,    TaskPriority::Control, TaskPriority::Normal,
+	                                  TaskPriority::Control, TaskPriority::Bulk};
+	int seq[kTaskPriorityCount] = {};
+	for (TaskPriority lane : pushOrder)
+		queue.TryPush(Item{lane, seq[static_cast<size_t>(lane)]++}, lane);
+
+	const std::vector<Item> popped = PopAll(queue);
+	const std::string expected = "C0 C1 C2 N0 N1 B0 B1 B2";
+	if (Describe(popped) != expected)
+		Fail(name, "expected " + expected + ", got " + Describe(popped));
+	else
+		Pass(name);
+}
+
+void TestBurstLimitTwoLanes()
+{
+	const char *name = "Lanes/BurstLimit/BulkUnderControlFlood";
+
+	// 상한 3: Control이 3번 연속 나간 뒤 Bulk가 한 번 끼어든다
+	ExecutionQueue<Item> queue(MakeOptions(BackpressurePolicy::RejectNewest, 0, 3));
+	for (int i = 0; i < 10; ++i)
+		queue.TryPush(Item{TaskPriority::Control, i}, TaskPriority::Control);
+	for (int i = 0; i < 2; ++i)
+		queue.TryPush(Item{TaskPriority::Bulk, i}, TaskPriority::Bulk);
+
+	const std::vector<Item> popped = PopAll(queue);
+	const std::string expected = "C0 C1 C2 B0 C3 C4 C5 B1 C6 C7 C8 C9";
+	if (Describe(popped) != expected)
+		Fail(name, "expected " + expected + ", got " + Describe(popped));
+	else
+		Pass(name);
+}
+
+void TestBurstLimitThreeLanes()
+{
+	const char *name = "Lanes/BurstLimit/BulkUnderControlAndNormal";
+
+	// Control·Normal이 계속 차 있는 동안에도 Bulk는 유한한 간격으로 꺼내져야 한다.
+	// 한 번에 한 레인만 양보받으므로 Bulk의 간격은 상한 + 2 이내 (Normal이 먼저 양보받는 경우).
+	constexpr size_t kLimit = 2;
+	ExecutionQueue<Item> queue(MakeOptions(BackpressurePolicy::RejectNewest, 0, kLimit));
+	for (int i = 0; i < 40; ++i)
+	{
+		queue.TryPush(Item{TaskPriority::Control, i}, TaskPriority::Control);
+		queue.TryPush(Item{TaskPriority::Normal, i}, TaskPriority::Normal);
+	}
+	for (int i = 0; i < 5; ++i)
+		queue.TryPush(Item{TaskPriority::Bulk, i}, TaskPriority::Bulk);
+
+	// Control이 바닥나기 전 구간만 본다
+	std::vector<Item> popped;
+	Item item;
+	int controlLeft = 40;
+	while (controlLeft > 0 && queue.TryPop(item))
+	{
+		popped.push_back(item);
+		if (item.lane == TaskPriority::Control)
+			--controlLeft;
+	}
+
+	int bulkSeen = 0;
+	size_t lastBulk = 0;
+	size_t worstGap = 0;
+	bool bulkInOrder = true;
+	for (size_t i = 0; i < popped.size(); ++i)
+	{
+		if (popped[i].lane != TaskPriority::Bulk)
+			continue;
+		const size_t gap = i + 1 - lastBulk;
+		worstGap = gap > worstGap ? gap : worstGap;
+		lastBulk = i + 1;
+		bulkInOrder = bulkInOrder && popped[i].seq == bulkSeen;
+		++bulkSeen;
+	}
+
+	if (bulkSeen != 5)
+		Fail(name, "only " + std::to_string(bulkSeen) + " / 5 bulk items popped while control was pending: " +
+		               Describe(popped));
+	else if (worstGap > kLimit + 2)
+		Fail(name, "bulk waited " + std::to_string(worstGap) + " pops (limit " + std::to_string(kLimit) + ")");
+	else if (!bulkInOrder)
+		Fail(name, "bulk lane lost FIFO order");
+	else
+		Pass(name);
+}
+
+void TestFullNormalDoesNotRejectControl()
+{
+	const char *name = "Capacity/FullNormalAcceptsControl/Reject";
+
+	ExecutionQueue<Item> queue(MakeOptions(BackpressurePolicy::RejectNewest, 2, 8));
+	const bool normalFilled = queue.TryPush(Item{TaskPriority::Normal, 0}, TaskPriority::Normal) &&
+	                          queue.TryPush(Item{TaskPriority::Normal, 1}, TaskPriority::Normal);
+	const bool normalRejected = !queue.TryPush(Item{TaskPriority::Normal, 2}, TaskPriority::Normal);
+	const bool controlAccepted = queue.TryPush(Item{TaskPriority::Control, 0}, TaskPriority::Control);
+	const bool bulkAccepted = queue.TryPush(Item{TaskPriority::Bulk, 0}, TaskPriority::Bulk);
+
+	if (!normalFilled || !normalRejected)
+		Fail(name, "normal lane capacity not enforced");
+	else if (!controlAccepted || !bulkAccepted)
+		Fail(name, "push to another lane rejected because the normal lane is full");
+	else if (queue.Size(TaskPriority::Control) != 1 || queue.Size(TaskPriority::Normal) != 2)
+		Fail(name, "lane sizes wrong");
+	else
+		Pass(name);
+}
+
+void TestFullNormalDoesNotBlockControl()
+{
+	const char *name = "Capacity/FullNormalAcceptsControl/Block";
+
+	ExecutionQueue<Item> queue(MakeOptions(BackpressurePolicy::Block, 2, 8));
+	queue.Push(Item{TaskPriority::Normal, 0}, 0, TaskPriority::Normal);
+	queue.Push(Item{TaskPriority::Normal, 1}, 0, TaskPriority::Normal);
+
+	// Normal이 가득 찬 상태에서 Control Push는 타임아웃을 기다리지 않고 곧바로 들어가야 한다
+	const auto start = std::chrono::steady_clock::now();
+	const bool controlPushed = queue.Push(Item{TaskPriority::Control, 0}, 1000, TaskPriority::Control);
+	const auto controlMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now() - start).count();
+	const bool normalTimedOut = !queue.Push(Item{TaskPriority::Normal, 2}, 20, TaskPriority::Normal);
+
+	Item first;
+	queue.TryPop(first);
+
+	if (!controlPushed || controlMs >= 500)
+		Fail(name, "control push blocked behind the full normal lane (" + std::to_string(controlMs) + " ms)");
+	else if (!normalTimedOut)
+		Fail(name, "normal push succeeded past capacity");
+	else if (first.lane != TaskPriority::Control)
+		Fail(name, "control item not popped first");
+	else
+		Pass(name);
+}
+
+// 호출 스레드를 다른 스레드가 모두 쉴 때만 돌게 한다. 단일 코어에서는 notify_one으로 깨어난
+// 생산자가 곧바로 선점해 연속 Pop 사이에 끼어들므로, 넘김이 없어도 매 Pop이 가득 찬 레인에서
+// 꺼낸 것이 되어 넘김 경로를 건너뛴다. 다른 플랫폼에서는 소비자가 보통 먼저 도는 타이밍에 맡긴다.
+void RunAfterConsumer()
+{
+#if defined(__linux__)
+	sched_param param{};
+	sched_setscheduler(0, SCHED_IDLE, &param);
+#endif
+}
+
+void TestSingleWakeAndPassOn()
+{
+	const char *singleName = "Wake/OnePopAdmitsOneProducer";
+	const char *passName   = "Wake/AdmittedProducerPassesOn";
+
+	constexpr int kProducers = 3;
+	ExecutionQueue<Item> queue(MakeOptions(BackpressurePolicy::Block, 2, 8));
+	queue.Push(Item{TaskPriority::Normal, 0}, 0, TaskPriority::Normal);
+	queue.Push(Item{TaskPriority::Normal, 1}, 0, TaskPriority::Normal);
+
+	std::atomic<int> started{0};
+	std::atomic<int> admitted{0};
+	std::vector<std::thread> producers;
+	for (int i = 0; i < kProducers; ++i)
+	{
+		producers.emplace_back([&queue, &started, &admitted, i] {
+			RunAfterConsumer();
+			started.fetch_add(1);
+			if (queue.Push(Item{TaskPriority::Normal, 100 + i}, 5000, TaskPriority::Normal))
+				admitted.fetch_add(1);
+		});
+	}
+
+	// 모두 가득 찬 레인에서 대기하게 한다
+	WaitFor([&] { return started.load() == kProducers; }, 2000);
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	const int admittedWhileFull = admitted.load();
+
+	// 1) 가득 찬 레인에서 1개 — 생산자 1명만 들어와 다시 가득 찬다
+	Item item;
+	queue.TryPop(item);
+	const bool one = WaitFor([&] { return admitted.load() == 1; }, 2000);
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	const int admittedAfterOne = admitted.load();
+	const size_t sizeAfterOne = queue.Size(TaskPriority::Normal);
+
+	// 2) 연속 2개 — 두 번째 Pop은 가득 찬 레인에서 꺼낸 것이 아니라 깨우지 않는다.
+	//    첫 Pop으로 들어온 생산자가 남은 빈자리를 보고 마지막 대기자를 깨워야 둘 다 들어온다.
+	queue.TryPop(item);
+	queue.TryPop(item);
+	const bool all = WaitFor([&] { return admitted.load() == kProducers; }, 2000);
+
+	queue.Shutdown();
+	for (auto &producer : producers)
+		producer.join();
+
+	if (admittedWhileFull != 0)
+		Fail(singleName, "producer admitted into a full lane");
+	else if (!one || admittedAfterOne != 1 || sizeAfterOne != 2)
+		Fail(singleName, "one pop admitted " + std::to_string(admittedAfterOne) + " producers (lane size " +
+		                     std::to_string(sizeAfterOne) + ")");
+	else
+		Pass(singleName);
+
+	if (!all)
+		Fail(passName, "only " + std::to_string(admitted.load()) + " / " + std::to_string(kProducers) +
+		                   " producers admitted after two free slots");
+	else
+		Pass(passName);
+}
+
+} // namespace
+
+int main()
+{
+	std::cout << "=== ExecutionQueue Tests ===\n\n";
+
+	TestLaneOrder();
+	TestBurstLimitTwoLanes();
+	TestBurstLimitThreeLanes();
+	TestFullNormalDoesNotRejectControl();
+	TestFullNormalDoesNotBlockControl();
+	TestSingleWakeAndPassOn();
+
+	std::cout << "\nResult: " << gPassed << " passed, " << gFailed << " failed\n";
+	return gFailed > 0 ? 1 : 0;
+}
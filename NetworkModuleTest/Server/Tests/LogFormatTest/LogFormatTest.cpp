@@ -0,0 +1,159 @@
+// 지연 포맷 로그(LogFormat.h / Logger.h) 테스트.
+//
+// - 자리표시자는 "{}"와 "{:.Nf}"만 인정하고, "{{" / "}}"는 중괄호 한 글자로 바뀐다.
+// - "{id}" 같은 그 밖의 중괄호 조각은 인자를 소비하지 않고 글자 그대로 남는다.
+// - 인자가 모자라면 자리표시자를 그대로 두고, 남는 인자는 버린다.
+// - 문자열 인자는 값으로 복사되고, 인라인 버퍼를 넘겨도 잘리지 않는다.
+// - const가 아닌 char 버퍼를 포맷으로 넘기면 포맷도 복사된다 (호출 후 버퍼를 덮어써도 안전).
+//
+// 사용법: LogFormatTest
+
+#include "Utils/LogFormat.h"
+#include "Utils/Logger.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace Network::Utils;
+
+namespace
+{
+
+int gPassed = 0;
+int gFailed = 0;
+
+void Pass(const char *name)
+{
+	std::cout << "[PASS] " << name << "\n";
+	++gPassed;
+}
+
+void Fail(const char *name, const std::string &reason)
+{
+	std::cout << "[FAIL] " << name << " - " << reason << "\n";
+	++gFailed;
+}
+
+template <typename... Args>
+std::string Format(const char *format, const Args &...args)
+{
+	LogArgBuffer buffer;
+	buffer.Capture(args...);
+	std::string out;
+	AppendLogFormat(out, format, buffer);
+	return out;
+}
+
+void Expect(const char *name, const std::string &actual, const std::string &expected)
+{
+	if (actual != expected)
+		Fail(name, "expected \"" + expected + "\", got \"" + actual + "\"");
+	else
+		Pass(name);
+}
+
+// =============================================================================
+// 포맷 문법
+// =============================================================================
+
+void TestPlaceholders()
+{
+	Expect("Format/Basic", Format("id {} name {} ok {}", 42, "alice", true), "id 42 name alice ok true");
+	Expect("Format/Precision", Format("{:.2f} ms / {:.0f}", 1.23456, 2.5), "1.23 ms / 2");
+	Expect("Format/TypeMix", Format("{} {} {} {}", -7, 7u, 'c', 0.5), "-7 7 c 0.5");
+	Expect("Format/NoArgsVerbatim", Format("keep {} and {{ as is"), "keep {} and {{ as is");
+}
+
+void TestBraceEscapes()
+{
+	Expect("Escape/Double", Format("{{{}}}", 5), "{5}");
+	Expect("Escape/Json", Format("{{\"hp\":{}}}", 10), "{\"hp\":10}");
+	Expect("Escape/LoneClose", Format("a } b {}", 1), "a } b 1");
+}
+
+void TestNonPlaceholderBraces()
+{
+	// 이름 있는 중괄호나 잘못된 형식 지정자는 인자를 소비하지 않는다
+	Expect("Literal/Named", Format("{id} = {}", 3), "{id} = 3");
+	Expect("Literal/BadSpec", Format("{:x} {:.f} {:.2} {}", 9), "{:x} {:.f} {:.2} 9");
+	Expect("Literal/Unclosed", Format("value {} {", 1), "value 1 {");
+	Expect("Literal/LongPrecision", Format("{:.123f} {}", 1), "{:.123f} 1");
+}
+
+void TestArgCountMismatch()
+{
+	Expect("Args/TooFew", Format("{} {} {:.1f}", 1), "1 {} {:.1f}");
+	Expect("Args/TooMany", Format("only {}", 1, 2, 3), "only 1");
+}
+
+void TestStringArgs()
+{
+	std::string owned = "before";
+	LogArgBuffer buffer;
+	buffer.Capture(owned);
+	owned = "after";
+	std::string out;
+	AppendLogFormat(out, "{}", buffer);
+	Expect("String/CapturedByValue", out, "before");
+
+	// kInlineBytes를 넘으면 힙으로 옮겨지며 앞쪽 인자도 보존된다
+	const std::string big(LogArgBuffer::kInlineBytes * 2, 'x');
+	Expect("String/Spill", Format("{}:{}:{}", 1, big, 2), "1:" + big + ":2");
+	Expect("String/Null", Format("{}", static_cast<const char *>(nullptr)), "(null)");
+}
+
+// =============================================================================
+// Logger — 비-const 버퍼 포맷
+// =============================================================================
+
+void TestMutableFormatBuffer()
+{
+	const char *name = "Logger/MutableFormatCopied";
+
+	const std::string path = "LogFormatTest.log";
+	std::remove(path.c_str());
+	Logger::SetConsoleOutput(false);
+	Logger::SetLogFile(path);
+
+	// 호출 직후 버퍼를 덮어써도 기록은 호출 시점의 포맷을 따라야 한다
+	char buffer[32];
+	std::snprintf(buffer, sizeof(buffer), "mutable {} {{ok}}");
+	Logger::Info(buffer, 7);
+	std::snprintf(buffer, sizeof(buffer), "XXXXXXXXXXXXXXXX");
+	Logger::Info("literal {}", 8);
+	Logger::Flush();
+	Logger::SetLogFile("");
+
+	std::ifstream file(path);
+	std::stringstream text;
+	text << file.rdbuf();
+	const std::string contents = text.str();
+	std::remove(path.c_str());
+
+	if (contents.find("mutable 7 {ok}") == std::string::npos)
+		Fail(name, "mutable buffer format was not copied: \"" + contents + "\"");
+	else if (contents.find("literal 8") == std::string::npos)
+		Fail(name, "literal format record missing");
+	else
+		Pass(name);
+}
+
+} // namespace
+
+int main()
+{
+	std::cout << "=== LogFormat Tests ===\n\n";
+
+	TestPlaceholders();
+	TestBraceEscapes();
+	TestNonPlaceholderBraces();
+	TestArgCountMismatch();
+	TestStringArgs();
+	TestMutableFormatBuffer();
+
+	std::cout << "\nResult: " << gPassed << " passed, " << gFailed << " failed\n";
+	return gFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,500 @@
+// 세션 recv 일시 중지 테스트.
+//
+// 보유 횟수 (모든 플랫폼, 엔진 없이 세션 하나로):
+// - 같은 사유를 쓰는 두 원천이 번갈아 중지/재개해도 마지막 보유가 풀릴 때만 재개된다.
+// - 두 스레드가 같은 사유로 동시에 중지/재개를 반복해도 보유가 남거나 새지 않는다.
+// - 사유당 255회를 넘는 중지는 버려지고 다른 사유의 횟수로 넘치지 않는다.
+//
+// RecvAsync 보관 큐 (Linux/macOS 코루틴 빌드(ENABLE_COROUTINES), 실제 엔진을 루프백에 띄운다):
+// - 코루틴이 기다리기 전에 RECV_ASYNC_PENDING_LIMIT를 넘게 보내면 recv가
+//   RecvPauseReason::RecvAsync로 멈추고, 코루틴이 소비하면 재개되어 전부 순서대로 도착한다.
+// - 대기 중인 코루틴은 연결이 닫히면 프레임이 파괴된다.
+// - 보관 큐가 recv를 잡고 있는 동안 서버가 연결을 닫아도 닫히고, 같은 풀 슬롯을 다시 쓰는
+//   다음 연결은 보유 없이 시작해 다시 상한에서 멈추고 재개된다.
+//
+// 사용법: RecvPauseTest [--port P]
+
+#if (defined(__linux__) || defined(__APPLE__)) && NETWORK_ENABLE_COROUTINES
+#define RECV_PAUSE_TEST_ASYNC 1
+#else
+#define RECV_PAUSE_TEST_ASYNC 0
+#endif
+
+#include "Network/Core/Session.h"
+#include "Utils/Logger.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if RECV_PAUSE_TEST_ASYNC
+#include "Network/Core/NetworkEngine.h"
+#include "Network/Core/PacketDefine.h"
+#include "Network/Core/SessionManager.h"
+#include "Network/Core/SessionPool.h"
+#include "Utils/NetworkTypes.h"
+
+#include <arpa/inet.h>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <functional>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+using namespace Network;
+using namespace Network::Core;
+
+namespace
+{
+
+int gPassed = 0;
+int gFailed = 0;
+
+void Pass(const char *name)
+{
+	std::cout << "[PASS] " << name << "\n";
+	++gPassed;
+}
+
+void Fail(const char *name, const std::string &reason)
+{
+	std::cout << "[FAIL] " << name << " - " << reason << "\n";
+	++gFailed;
+}
+
+// =============================================================================
+// 보유 횟수
+// =============================================================================
+
+// 다른 사유가 같이 바뀌지 않았는지 — 기대값과 다른 사유 이름을 돌려준다
+std::string CheckPaused(const Session &session, bool overload, bool flowControl, bool recvAsync)
+{
+	if (session.IsRecvPaused(RecvPauseReason::Overload) != overload)
+		return "Overload";
+	if (session.IsRecvPaused(RecvPauseReason::FlowControl) != flowControl)
+		return "FlowControl";
+	if (session.IsRecvPaused(RecvPauseReason::RecvAsync) != recvAsync)
+		return "RecvAsync";
+	return std::string();
+}
+
+void TestInterleavedSources()
+{
+	const char *name = "Holds/InterleavedSameReason";
+
+	// 원천 A, B가 FlowControl을 번갈아 잡고 놓는다: A+ B+ A- A+ B- A-
+	auto session = std::make_shared<Session>();
+	struct Step
+	{
+		const char *label;
+		bool        pause;
+		bool        pausedAfter;
+	};
+	const Step steps[] = {
+		{"A pause", true, true},   {"B pause", true, true},   {"A resume", false, true},
+		{"A pause", true, true},   {"B resume", false, true}, {"A resume", false, false},
+		{"B resume (no hold)", false, false},
+	};
+	for (const Step &step : steps)
+	{
+		if (step.pause)
+			session->PauseRecv(RecvPauseReason::FlowControl);
+		else
+			session->ResumeRecv(RecvPauseReason::FlowControl);
+		const std::string wrong = CheckPaused(*session, false, step.pausedAfter, false);
+		if (!wrong.empty())
+		{
+			Fail(name, std::string("after ") + step.label + ": " + wrong + " hold wrong");
+			return;
+		}
+	}
+
+	// 다른 사유를 잡은 채 같은 순서를 반복 — 사유끼리 섞이지 않고, 보관된 recv는 마지막 재개로 풀린다
+	session->PauseRecv(RecvPauseReason::Overload);
+	session->PauseRecv(RecvPauseReason::FlowControl);
+	session->PauseRecv(RecvPauseReason::FlowControl);
+	const bool parked = session->ParkRecvIfPaused();
+	session->ResumeRecv(RecvPauseReason::FlowControl);
+	session->ResumeRecv(RecvPauseReason::Overload);
+	const bool stillHeld = session->ParkRecvIfPaused();
+	session->ResumeRecv(RecvPauseReason::FlowControl);
+	const bool released = !session->ParkRecvIfPaused();
+
+	if (!parked || !stillHeld)
+		Fail(name, "recv not parked while a hold remains");
+	else if (!released)
+		Fail(name, "recv still parked after the last hold was released");
+	else if (!CheckPaused(*session, false, false, false).empty())
+		Fail(name, "holds left after every source resumed");
+	else
+		Pass(name);
+}
+
+void TestConcurrentSources()
+{
+	const char *name = "Holds/ConcurrentSameReason";
+
+	// 두 스레드가 같은 사유로 중지/재개를 반복하는 동안 다른 사유 보유 하나는 그대로여야 한다
+	constexpr int kRounds = 100000;
+	auto session = std::make_shared<Session>();
+	session->PauseRecv(RecvPauseReason::Overload);
+
+	bool sawReleaseWhileHeld = false;
+	std::vector<std::thread> sources;
+	for (int i = 0; i < 2; ++i)
+	{
+		sources.emplace_back([&session] {
+			for (int round = 0; round < kRounds; ++round)
+			{
+				session->PauseRecv(RecvPauseReason::FlowControl);
+				session->ResumeRecv(RecvPauseReason::FlowControl);
+			}
+		});
+	}
+	for (int round = 0; round < kRounds / 10; ++round)
+	{
+		if (!session->IsRecvPaused(RecvPauseReason::Overload))
+			sawReleaseWhileHeld = true;
+	}
+	for (auto &source : sources)
+		source.join();
+
+	const std::string wrong = CheckPaused(*session, true, false, false);
+	session->ResumeRecv(RecvPauseReason::Overload);
+
+	if (sawReleaseWhileHeld)
+		Fail(name, "Overload hold lost while FlowControl sources ran");
+	else if (!wrong.empty())
+		Fail(name, wrong + " hold wrong after both sources finished");
+	else if (!CheckPaused(*session, false, false, false).empty())
+		Fail(name, "holds left after the last resume");
+	else
+		Pass(name);
+}
+
+void TestHoldSaturation()
+{
+	const char *name = "Holds/SaturateAt255";
+
+	// 사유 필드는 8비트 — 넘는 중지가 다음 사유(FlowControl) 횟수로 올라가면 안 된다.
+	// 버린 보유는 Error 로그 한 줄로 남는다 (rate-limited).
+	auto session = std::make_shared<Session>();
+	for (int i = 0; i < 300; ++i)
+		session->PauseRecv(RecvPauseReason::Overload);
+	const std::string carried = CheckPaused(*session, true, false, false);
+
+	int resumes = 0;
+	while (session->IsRecvPaused(RecvPauseReason::Overload) && resumes < 300)
+	{
+		session->ResumeRecv(RecvPauseReason::Overload);
+		++resumes;
+	}
+	session->ResumeRecv(RecvPauseReason::Overload);
+
+	if (!carried.empty())
+		Fail(name, "overflowing Overload holds changed " + carried);
+	else if (resumes != 255)
+		Fail(name, "released after " + std::to_string(resumes) + " resumes (255 expected)");
+	else if (!CheckPaused(*session, false, false, false).empty())
+		Fail(name, "holds left after release");
+	else
+		Pass(name);
+}
+
+#if RECV_PAUSE_TEST_ASYNC
+
+// 보관 상한의 여러 배, 그리고 recv 버퍼(RECV_BUFFER_SIZE) 여러 번 분량 — 중지 없이는 한 번에 다 읽을 수 없다
+constexpr uint32_t kBurst = 8000;
+
+std::atomic<Utils::ConnectionId> gConnectedId{0};
+
+bool WaitFor(const std::function<bool()> &condition, int timeoutMs)
+{
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+	while (!condition())
+	{
+		if (std::chrono::steady_clock::now() >= deadline)
+			return false;
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+	return true;
+}
+
+int ConnectLoopback(uint16_t port)
+{
+	for (int attempt = 0; attempt < 50; ++attempt)
+	{
+		const int fd = socket(AF_INET, SOCK_STREAM, 0);
+		sockaddr_in addr{};
+		addr.sin_family = AF_INET;
+		addr.sin_port   = htons(port);
+		inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+		if (connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0)
+		{
+			timeval timeout{5, 0};
+			setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+			return fd;
+		}
+		close(fd);
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}
+	return -1;
+}
+
+// 연결 후 엔진이 세션을 만들 때까지 기다린다 (Connected 이벤트)
+SessionRef Accept(uint16_t port, int &outFd)
+{
+	gConnectedId.store(0);
+	outFd = ConnectLoopback(port);
+	if (outFd < 0 || !WaitFor([] { return gConnectedId.load() != 0; }, 2000))
+		return nullptr;
+	return SessionManager::Instance().GetSession(gConnectedId.load());
+}
+
+bool SendPings(int fd, uint32_t count)
+{
+	std::vector<PKT_PingReq> pings(count);
+	for (uint32_t i = 0; i < count; ++i)
+		pings[i].sequence = i;
+	const char *data = reinterpret_cast<const char *>(pings.data());
+	size_t remaining = pings.size() * sizeof(PKT_PingReq);
+	while (remaining > 0)
+	{
+		const ssize_t n = send(fd, data, remaining, 0);
+		if (n <= 0)
+			return false;
+		data += n;
+		remaining -= static_cast<size_t>(n);
+	}
+	return true;
+}
+
+struct DrainState
+{
+	std::atomic<uint32_t> received{0};
+	std::atomic<bool>     outOfOrder{false};
+	std::atomic<bool>     frameDestroyed{false};
+};
+
+// 코루틴 프레임이 끝나거나 취소로 파괴될 때 표시
+struct FrameGuard
+{
+	DrainState *state;
+	~FrameGuard() { state->frameDestroyed.store(true); }
+};
+
+// 세션이 닫힐 때까지 핑을 받아 순서를 확인한다 — 패킷 뷰는 다음 co_await 전까지 유효
+Concurrency::Task<void> Drain(Session *session, DrainState *state)
+{
+	FrameGuard guard{state};
+	uint32_t next = 0;
+	for (;;)
+	{
+		const Session::RecvPacket packet = co_await session->RecvAsync();
+		if (!packet.data)
+			co_return;
+		const auto *ping = reinterpret_cast<const PKT_PingReq *>(packet.data);
+		if (packet.size != sizeof(PKT_PingReq) || ping->sequence != next)
+			state->outOfOrder.store(true);
+		++next;
+		state->received.fetch_add(1);
+	}
+}
+
+// 매니저에서 빠지고 마지막 참조까지 놓여 풀 슬롯이 반납될 때까지
+bool WaitForNoSessions()
+{
+	return WaitFor([] { return SessionManager::Instance().GetSessionCount() == 0 &&
+	                           SessionPool::Instance().ActiveCount() == 0; },
+	               3000);
+}
+
+// 상한을 넘겨 멈춘 뒤, 코루틴이 소비하면 재개되어 전부 도착하는지 본다. 실패 사유를 돌려준다.
+std::string RunBacklogCycle(int fd, const SessionRef &session, DrainState &state)
+{
+	if (!SendPings(fd, kBurst))
+		return "send failed";
+	if (!WaitFor([&] { return session->IsRecvPaused(RecvPauseReason::RecvAsync); }, 3000))
+		return "recv not paused with " + std::to_string(kBurst) + " packets pending";
+
+	// 기다리는 코루틴이 없으면 계속 멈춰 있어야 한다
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	if (!session->IsRecvPaused(RecvPauseReason::RecvAsync))
+		return "pause released without a consumer";
+
+	if (!session->Spawn(Drain(session.get(), &state)))
+		return "spawn failed";
+	if (!WaitFor([&] { return state.received.load() == kBurst; }, 5000))
+		return "only " + std::to_string(state.received.load()) + " / " + std::to_string(kBurst) +
+		       " packets arrived (recv not resumed?)";
+	if (state.outOfOrder.load())
+		return "packets out of order or resized";
+	if (session->IsRecvPaused(RecvPauseReason::RecvAsync))
+		return "still paused after the backlog drained";
+	return std::string();
+}
+
+// =============================================================================
+// 테스트
+// =============================================================================
+
+void TestBacklogCapAndCancel(uint16_t port)
+{
+	const char *capName    = "RecvAsync/BacklogCap";
+	const char *cancelName = "RecvAsync/CancelParkedWaiter";
+
+	int fd = -1;
+	SessionRef session = Accept(port, fd);
+	if (!session)
+	{
+		Fail(capName, "connect/accept failed");
+		if (fd >= 0)
+			close(fd);
+		return;
+	}
+
+	DrainState state;
+	const std::string error = RunBacklogCycle(fd, session, state);
+	if (error.empty())
+		Pass(capName);
+	else
+		Fail(capName, error);
+
+	// 코루틴은 RecvAsync에서 대기 중 — 클라이언트가 닫으면 프레임이 파괴되어야 한다
+	close(fd);
+	if (!WaitFor([&] { return state.frameDestroyed.load(); }, 3000))
+		Fail(cancelName, "coroutine frame not destroyed after close");
+	else
+		Pass(cancelName);
+
+	session.reset();
+	WaitForNoSessions();
+}
+
+void TestCloseWhilePaused(INetworkEngine &engine, uint16_t port)
+{
+	const char *closeName = "RecvAsync/CloseWhilePaused";
+	const char *reuseName = "RecvAsync/ReusedSlotStartsClean";
+
+	int fd = -1;
+	SessionRef session = Accept(port, fd);
+	if (!session)
+	{
+		Fail(closeName, "connect/accept failed");
+		if (fd >= 0)
+			close(fd);
+		return;
+	}
+
+	// 소비자 없이 상한을 넘긴다 — recv가 멈춘 상태에서 서버가 닫는다
+	const bool sent   = SendPings(fd, kBurst);
+	const bool paused = WaitFor([&] { return session->IsRecvPaused(RecvPauseReason::RecvAsync); }, 3000);
+	const Session *slot = session.get();
+	engine.CloseConnection(session->GetId());
+	session.reset();
+
+	// 서버 수신 버퍼에 읽지 않은 데이터가 남아 있으므로 커널은 FIN 대신 RST를 보낸다 — 둘 다 종료
+	char byte;
+	ssize_t n;
+	while ((n = recv(fd, &byte, 1, 0)) > 0)
+	{
+	}
+	const bool ended = n == 0 || errno == ECONNRESET;
+	close(fd);
+	const bool released = WaitForNoSessions();
+
+	if (!sent || !paused)
+		Fail(closeName, "recv not paused before close");
+	else if (!ended)
+		Fail(closeName, "connection still open after CloseConnection");
+	else if (!released)
+		Fail(closeName, "session not released");
+	else
+		Pass(closeName);
+
+	// 풀 용량 1 — 다음 연결은 같은 세션 객체를 다시 쓴다. Reset이 보유와 보관 큐를 비웠다면
+	// 처음부터 읽고, 상한에서 다시 멈췄다가 재개된다.
+	session = Accept(port, fd);
+	if (!session)
+	{
+		Fail(reuseName, "reconnect failed");
+		if (fd >= 0)
+			close(fd);
+		return;
+	}
+
+	DrainState state;
+	const bool        wasPaused = session->IsRecvPaused(RecvPauseReason::RecvAsync);
+	const bool        reused    = session.get() == slot;
+	const std::string error     = wasPaused ? std::string() : RunBacklogCycle(fd, session, state);
+	close(fd);
+	WaitFor([&] { return state.frameDestroyed.load(); }, 3000);
+	session.reset();
+	WaitForNoSessions();
+
+	if (!reused)
+		Fail(reuseName, "pool slot was not reused (capacity 1 expected)");
+	else if (wasPaused)
+		Fail(reuseName, "reused session starts with a RecvAsync hold");
+	else if (!error.empty())
+		Fail(reuseName, error);
+	else
+		Pass(reuseName);
+}
+
+#endif // RECV_PAUSE_TEST_ASYNC
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+	uint16_t port = 29890;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		if (arg == "--port" && i + 1 < argc)
+			port = static_cast<uint16_t>(std::stoi(argv[++i]));
+	}
+
+	std::cout << "=== RecvPause Tests ===\n\n";
+	Utils::Logger::SetLevel(Utils::LogLevel::Warn);
+
+	TestInterleavedSources();
+	TestConcurrentSources();
+	TestHoldSaturation();
+
+#if RECV_PAUSE_TEST_ASYNC
+	SessionManager::Instance().SetSessionConfigurator([](Session *session) { session->EnableRecvAsync(); });
+	auto engine = CreateNetworkEngine("auto");
+	if (engine)
+	{
+		engine->RegisterEventCallback(NetworkEvent::Connected,
+		                              [](const NetworkEventData &event) { gConnectedId.store(event.connectionId); });
+	}
+
+	// 풀 용량 1 — 닫힌 세션의 슬롯이 다음 연결에 재사용된다
+	if (!engine || !engine->Initialize(1, port) || !engine->Start())
+	{
+		Fail("RecvPause/Start", "engine start failed (port " + std::to_string(port) + " in use?)");
+	}
+	else
+	{
+		TestBacklogCapAndCancel(port);
+		TestCloseWhilePaused(*engine, port);
+	}
+
+	if (engine)
+		engine->Stop();
+#else
+	(void)port;
+	std::cout << "[SKIP] RecvAsync cases: Linux/macOS coroutine build only\n";
+#endif
+
+	std::cout << "\nResult: " << gPassed << " passed, " << gFailed << " failed\n";
+	return gFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,313 @@
+// 서버 간 DB 쿼리 프레임 인코더/디코더 테스트.
+//
+// DBQueryFrameBuilder로 만든 단일/배치 프레임이 ForEachDBQueryEntry로 그대로 되돌아오는지,
+// 그리고 네트워크에서 들어올 수 있는 잘못된 프레임(잘린 헤더, 프레임 끝을 넘는 엔트리 길이,
+// 엔트리 수 0, 실제보다 큰 엔트리 수, 남는 바이트)을 콜백 없이 거부하는지 본다.
+// 잘못된 프레임은 정확한 크기의 힙 버퍼에 담아 넘기므로 경계 밖 읽기는 ASan 빌드에서 바로 드러난다.
+//
+// 사용법: ServerPacketCodecTest
+
+#include "Network/Core/ServerPacketCodec.h"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Network::Core;
+
+namespace
+{
+
+int gPassed = 0;
+int gFailed = 0;
+
+void Pass(const char *name)
+{
+	std::cout << "[PASS] " << name << "\n";
+	++gPassed;
+}
+
+void Fail(const char *name, const std::string &reason)
+{
+	std::cout << "[FAIL] " << name << " - " << reason << "\n";
+	++gFailed;
+}
+
+struct DecodedReq
+{
+	uint64_t    queryId;
+	uint8_t     taskType;
+	std::string payload;
+};
+
+// 디코드 결과와 콜백 횟수 — 거부된 프레임은 콜백이 0이어야 한다
+struct DecodeResult
+{
+	bool                    ok = false;
+	std::vector<DecodedReq> entries;
+};
+
+DecodeResult DecodeReq(const std::vector<char> &frame)
+{
+	DecodeResult result;
+	result.ok = ForEachDBQueryReq(frame.data(), static_cast<uint32_t>(frame.size()),
+	                              [&result](const DBQueryReqEntry &entry, const char *payload, uint16_t length) {
+		                              result.entries.push_back({entry.queryId, entry.taskType,
+		                                                        std::string(payload, length)});
+	                              });
+	return result;
+}
+
+// 빌더 출력을 정확한 크기의 소유 버퍼로 복사 (이후 변조용)
+std::vector<char> FinishFrame(DBQueryReqBuilder &builder)
+{
+	uint32_t    size  = 0;
+	const char *frame = builder.Finish(size);
+	return std::vector<char>(frame, frame + size);
+}
+
+std::vector<char> BuildReqFrame(const std::vector<std::string> &payloads)
+{
+	DBQueryReqBuilder builder;
+	for (size_t i = 0; i < payloads.size(); ++i)
+	{
+		DBQueryReqEntry entry{};
+		entry.queryId  = 1000 + i;
+		entry.taskType = static_cast<uint8_t>(i % 2);
+		builder.Append(entry, payloads[i].data(), payloads[i].size());
+	}
+	return FinishFrame(builder);
+}
+
+uint16_t PacketIdOf(const std::vector<char> &frame)
+{
+	ServerPacketHeader header;
+	std::memcpy(&header, frame.data(), sizeof(header));
+	return header.id;
+}
+
+void SetHeaderSize(std::vector<char> &frame, uint16_t size)
+{
+	ServerPacketHeader header;
+	std::memcpy(&header, frame.data(), sizeof(header));
+	header.size = size;
+	std::memcpy(frame.data(), &header, sizeof(header));
+}
+
+void SetBatchCount(std::vector<char> &frame, uint16_t count)
+{
+	std::memcpy(frame.data() + sizeof(ServerPacketHeader), &count, sizeof(count));
+}
+
+void SetFirstDataLength(std::vector<char> &frame, size_t entryOffset, uint16_t length)
+{
+	DBQueryReqEntry entry;
+	std::memcpy(&entry, frame.data() + entryOffset, sizeof(entry));
+	entry.dataLength = length;
+	std::memcpy(frame.data() + entryOffset, &entry, sizeof(entry));
+}
+
+void ExpectRejected(const char *name, const std::vector<char> &frame)
+{
+	const DecodeResult result = DecodeReq(frame);
+	if (result.ok)
+		Fail(name, "malformed frame was accepted");
+	else if (!result.entries.empty())
+		Fail(name, std::to_string(result.entries.size()) + " entries delivered from a rejected frame");
+	else
+		Pass(name);
+}
+
+// =============================================================================
+// 왕복
+// =============================================================================
+
+void TestRoundTripSingle()
+{
+	const char *name = "RoundTrip/Single";
+
+	const std::vector<char> frame  = BuildReqFrame({"{\"hp\":10}"});
+	const DecodeResult      result = DecodeReq(frame);
+
+	if (PacketIdOf(frame) != static_cast<uint16_t>(PKT_DBQueryReq::PacketId))
+		Fail(name, "one entry should encode as PKT_DBQueryReq");
+	else if (!result.ok || result.entries.size() != 1)
+		Fail(name, "decode failed");
+	else if (result.entries[0].queryId != 1000 || result.entries[0].taskType != 0 ||
+	         result.entries[0].payload != "{\"hp\":10}")
+		Fail(name, "decoded entry does not match");
+	else
+		Pass(name);
+}
+
+void TestRoundTripBatch()
+{
+	const char *name = "RoundTrip/Batch";
+
+	const std::vector<std::string> payloads = {"first", "", std::string(300, 'x')};
+	const std::vector<char>        frame    = BuildReqFrame(payloads);
+	const DecodeResult             result   = DecodeReq(frame);
+
+	bool match = result.ok && result.entries.size() == payloads.size();
+	for (size_t i = 0; match && i < payloads.size(); ++i)
+	{
+		match = result.entries[i].queryId == 1000 + i &&
+		        result.entries[i].taskType == static_cast<uint8_t>(i % 2) &&
+		        result.entries[i].payload == payloads[i];
+	}
+
+	if (PacketIdOf(frame) != static_cast<uint16_t>(PKT_DBQueryBatchReq::PacketId))
+		Fail(name, "several entries should encode as PKT_DBQueryBatchReq");
+	else if (!match)
+		Fail(name, "decoded batch does not match (ok " + std::to_string(result.ok) + ", " +
+		               std::to_string(result.entries.size()) + " entries)");
+	else
+		Pass(name);
+}
+
+void TestRoundTripFullFrame()
+{
+	const char *name = "RoundTrip/FullFrame";
+
+	// 프레임 상한까지 채우면 Append가 false — 그때까지의 엔트리는 모두 되돌아와야 한다
+	DBQueryReqBuilder builder;
+	const std::string payload(200, 'p');
+	size_t appended = 0;
+	for (;; ++appended)
+	{
+		DBQueryReqEntry entry{};
+		entry.queryId = appended;
+		if (!builder.Append(entry, payload.data(), payload.size()))
+			break;
+	}
+	const std::vector<char> frame  = FinishFrame(builder);
+	const DecodeResult      result = DecodeReq(frame);
+
+	// Res 빌더도 같은 코덱 — 최대 페이로드 한 건 왕복
+	DBQueryResBuilder resBuilder;
+	const std::string detail(DBQueryResBuilder::kMaxEntryPayload, 'd');
+	DBQueryResEntry   resEntry{};
+	resEntry.queryId = 77;
+	resEntry.result  = 3;
+	const bool resAppended = resBuilder.Append(resEntry, detail.data(), detail.size());
+	uint32_t    resSize  = 0;
+	const char *resFrame = resBuilder.Finish(resSize);
+	size_t      resSeen  = 0;
+	const bool  resOk    = ForEachDBQueryRes(resFrame, resSize,
+	                                         [&](const DBQueryResEntry &entry, const char *, uint16_t length) {
+		                                         if (entry.queryId == 77 && entry.result == 3 &&
+		                                             length == detail.size())
+			                                         ++resSeen;
+	                                         });
+
+	if (appended < 2 || frame.size() > MAX_SERVER_PACKET_SIZE)
+		Fail(name, "builder did not stop at the frame limit");
+	else if (!result.ok || result.entries.size() != appended)
+		Fail(name, "full frame did not decode all " + std::to_string(appended) + " entries");
+	else if (!resAppended || !resOk || resSeen != 1 || resSize > MAX_SERVER_PACKET_SIZE)
+		Fail(name, "max-payload response entry did not round-trip");
+	else
+		Pass(name);
+}
+
+// =============================================================================
+// 잘못된 프레임
+// =============================================================================
+
+void TestTruncatedHeader()
+{
+	// 헤더보다 짧은 버퍼
+	std::vector<char> frame = BuildReqFrame({"abc"});
+	frame.resize(sizeof(ServerPacketHeader) - 1);
+	ExpectRejected("Reject/TruncatedHeader", frame);
+
+	// 헤더의 size가 실제로 받은 바이트보다 크다 (프레임이 잘림)
+	std::vector<char> cut = BuildReqFrame({"abc", "def"});
+	cut.resize(cut.size() - 2);
+	ExpectRejected("Reject/FrameCut", cut);
+
+	// 헤더의 size가 헤더 자신보다 작다
+	std::vector<char> tiny = BuildReqFrame({"abc"});
+	SetHeaderSize(tiny, sizeof(ServerPacketHeader) - 2);
+	ExpectRejected("Reject/HeaderSizeBelowHeader", tiny);
+
+	// 배치 고정부(count)까지 닿지 않는 배치 프레임
+	std::vector<char> batch = BuildReqFrame({"a", "b"});
+	batch.resize(sizeof(ServerPacketHeader) + 1);
+	SetHeaderSize(batch, static_cast<uint16_t>(batch.size()));
+	ExpectRejected("Reject/BatchHeadTruncated", batch);
+}
+
+void TestEntryLengthPastEnd()
+{
+	std::vector<char> single = BuildReqFrame({"abcdef"});
+	SetFirstDataLength(single, sizeof(ServerPacketHeader), 7);
+	ExpectRejected("Reject/EntryLengthPastEnd/Single", single);
+
+	// 배치의 첫 엔트리가 길이를 부풀리면 두 번째 엔트리 헤더를 페이로드로 먹고 끝을 넘는다
+	std::vector<char> batch = BuildReqFrame({"abc", "def"});
+	SetFirstDataLength(batch, sizeof(PKT_DBQueryBatchReq), 0xFFFF);
+	ExpectRejected("Reject/EntryLengthPastEnd/Batch", batch);
+
+	// 엔트리 헤더 자체가 잘림
+	std::vector<char> cutEntry = BuildReqFrame({""});
+	cutEntry.resize(cutEntry.size() - 1);
+	SetHeaderSize(cutEntry, static_cast<uint16_t>(cutEntry.size()));
+	ExpectRejected("Reject/EntryHeaderTruncated", cutEntry);
+}
+
+void TestZeroCount()
+{
+	std::vector<char> batch = BuildReqFrame({"abc", "def"});
+	batch.resize(sizeof(PKT_DBQueryBatchReq));
+	SetHeaderSize(batch, static_cast<uint16_t>(batch.size()));
+	SetBatchCount(batch, 0);
+	ExpectRejected("Reject/ZeroCount", batch);
+}
+
+void TestOversizeCount()
+{
+	// 실제 엔트리는 2개인데 count는 3 — 앞의 2개도 전달되면 안 된다
+	std::vector<char> batch = BuildReqFrame({"abc", "def"});
+	SetBatchCount(batch, 3);
+	ExpectRejected("Reject/OversizeCount", batch);
+
+	std::vector<char> huge = BuildReqFrame({"abc", "def"});
+	SetBatchCount(huge, 0xFFFF);
+	ExpectRejected("Reject/OversizeCount/Max", huge);
+
+	// 반대로 count보다 바이트가 남는 경우 (엔트리 수를 줄여 보냄)
+	std::vector<char> trailing = BuildReqFrame({"abc", "def"});
+	SetBatchCount(trailing, 1);
+	ExpectRejected("Reject/TrailingBytes", trailing);
+}
+
+void TestUnknownPacketId()
+{
+	std::vector<char> frame = BuildReqFrame({"abc"});
+	ServerPacketHeader header;
+	std::memcpy(&header, frame.data(), sizeof(header));
+	header.id = static_cast<uint16_t>(PKT_DBQueryRes::PacketId);
+	std::memcpy(frame.data(), &header, sizeof(header));
+	ExpectRejected("Reject/WrongPacketId", frame);
+}
+
+} // namespace
+
+int main()
+{
+	std::cout << "=== ServerPacketCodec Tests ===\n\n";
+
+	TestRoundTripSingle();
+	TestRoundTripBatch();
+	TestRoundTripFullFrame();
+	TestTruncatedHeader();
+	TestEntryLengthPastEnd();
+	TestZeroCount();
+	TestOversizeCount();
+	TestUnknownPacketId();
+
+	std::cout << "\nResult: " << gPassed << " passed, " << gFailed << " failed\n";
+	return gFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,320 @@
+#!/usr/bin/env bash
+
+# 한글: 루프백 종단간(E2E) 벤치마크 매트릭스
+# 한글: TestServer(선택적으로 TestDBServer)를 127.0.0.1에 띄우고 TestClient 부하 모드로 구동한다.
+# 한글: 엔진 x DB 모드 x DB 워커 수 x 페이로드 크기 조합마다 처리량, 지연 백분위,
+# 한글: 메시지당 서버 CPU, 서버 RSS를 모아 CSV와 Markdown 비교 보고서를 만든다.
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+ROOT_DIR="$(cd "${SCRIPT_DIR}/.." && pwd)"
+
+BIN_DIR="${ROOT_DIR}/build/bin"
+OUT_DIR=""
+ENGINES="epoll io_uring"
+DB_MODES="mock sqlite"
+WORKERS="1 3"
+PAYLOADS="16 256 1024"
+CLIENTS=100
+THREADS=1
+RATE=0
+DURATION=10
+WARMUP=2
+CHURN=0
+PORT=29500
+WITH_DBSERVER="OFF"
+
+print_usage() {
+    cat <<EOF
+사용법: $(basename "$0") [옵션]
+옵션:
+  --bin-dir <경로>         TestServer/TestClient 위치 (기본값: ./build/bin)
+  --out-dir <경로>         결과 디렉터리 (기본값: <bin-dir>/../e2e_bench/<시각>)
+  --engines "<목록>"       네트워크 엔진 (기본값: "epoll io_uring")
+  --db-modes "<목록>"      mock | sqlite (기본값: "mock sqlite")
+  --workers "<목록>"       TestServer DB 작업 워커 수 -w (기본값: "1 3")
+  --payloads "<목록>"      요청 패킷 크기(바이트) (기본값: "16 256 1024")
+  --clients <n>            동시 연결 수 (기본값: 100)
+  --threads <n>            TestClient 워커 스레드 (기본값: 1)
+  --rate <req/s>           open loop 목표 요청률, 0 = closed loop (기본값: 0)
+  --duration <초>          조합당 부하 시간 (기본값: 10)
+  --warmup <초>            측정 제외 구간 (기본값: 2)
+  --churn <n/s>            초당 재연결 수 — 접속/해제 DB 기록 경로 부하 (기본값: 0)
+  --port <port>            시작 포트, 조합마다 1씩 증가 (기본값: 29500)
+  --with-dbserver          TestDBServer도 띄우고 TestServer를 --db로 연결
+  --quick                  축소 매트릭스 (epoll/io_uring x mock x 워커 3 x 16B, 3초)
+  -h, --help               도움말 출력
+
+참고:
+  - io_uring 미지원 빌드(liburing 없음)는 epoll로 폴백하며 보고서에 "io_uring->epoll"로 표시된다.
+  - CPU/메시지 = 서버 프로세스 (utime+stime) 증가분 / 송신 요청 수 (warmup 포함).
+  - RSS = 부하 종료 시점 VmRSS와 최대값 VmHWM.
+EOF
+}
+
+while [[ $# -gt 0 ]]; do
+    case "$1" in
+        --bin-dir)       BIN_DIR="$2"; shift 2 ;;
+        --out-dir)       OUT_DIR="$2"; shift 2 ;;
+        --engines)       ENGINES="$2"; shift 2 ;;
+        --db-modes)      DB_MODES="$2"; shift 2 ;;
+        --workers)       WORKERS="$2"; shift 2 ;;
+        --payloads)      PAYLOADS="$2"; shift 2 ;;
+        --clients)       CLIENTS="$2"; shift 2 ;;
+        --threads)       THREADS="$2"; shift 2 ;;
+        --rate)          RATE="$2"; shift 2 ;;
+        --duration)      DURATION="$2"; shift 2 ;;
+        --warmup)        WARMUP="$2"; shift 2 ;;
+        --churn)         CHURN="$2"; shift 2 ;;
+        --port)          PORT="$2"; shift 2 ;;
+        --with-dbserver) WITH_DBSERVER="ON"; shift ;;
+        --quick)
+            DB_MODES="mock"; WORKERS="3"; PAYLOADS="16"; DURATION=3; WARMUP=1
+            shift
+            ;;
+        -h|--help)
+            print_usage
+            exit 0
+            ;;
+        *)
+            echo "알 수 없는 옵션: $1"
+            print_usage
+            exit 1
+            ;;
+    esac
+done
+
+if [[ "$(uname -s)" != "Linux" ]]; then
+    echo "Linux 전용 스크립트입니다 (/proc 기반 CPU/RSS 측정)."
+    exit 1
+fi
+
+BIN_DIR="$(cd "${BIN_DIR}" && pwd)"
+for exe in TestServer TestClient; do
+    if [[ ! -x "${BIN_DIR}/${exe}" ]]; then
+        echo "${BIN_DIR}/${exe} 가 없습니다. 먼저 빌드하세요 (scripts/build_unix.sh --config Release)."
+        exit 1
+    fi
+done
+if [[ "${WITH_DBSERVER}" == "ON" && ! -x "${BIN_DIR}/TestDBServer" ]]; then
+    echo "${BIN_DIR}/TestDBServer 가 없습니다."
+    exit 1
+fi
+
+if [[ -z "${OUT_DIR}" ]]; then
+    OUT_DIR="${BIN_DIR}/../e2e_bench/$(date +%Y%m%d_%H%M%S)"
+fi
+mkdir -p "${OUT_DIR}"
+OUT_DIR="$(cd "${OUT_DIR}" && pwd)"
+# 한글: TestServer는 cwd에서 상위로 올라가며 Server/TestServer/DB/*.sql을 찾는다 — 저장소 밖 결과 경로 대비
+if [[ ! -e "${OUT_DIR}/Server" ]]; then
+    ln -s "${ROOT_DIR}/Server" "${OUT_DIR}/Server"
+fi
+
+CLK_TCK="$(getconf CLK_TCK)"
+CSV="${OUT_DIR}/results.csv"
+REPORT="${OUT_DIR}/report.md"
+echo "engine,effective_engine,db_mode,db_workers,payload,connections,rate,status,throughput_rps,p50_us,p90_us,p99_us,p999_us,max_us,responses,lost,cpu_us_per_msg,cpu_util_pct,rss_kb,hwm_kb" > "${CSV}"
+
+SERVER_PID=""
+DBSERVER_PID=""
+
+stop_process() {
+    local pid="$1"
+    if [[ -n "${pid}" ]] && kill -0 "${pid}" 2>/dev/null; then
+        kill -TERM "${pid}" 2>/dev/null || true
+        for _ in $(seq 1 50); do
+            kill -0 "${pid}" 2>/dev/null || return 0
+            sleep 0.1
+        done
+        kill -KILL "${pid}" 2>/dev/null || true
+    fi
+}
+
+cleanup() {
+    stop_process "${SERVER_PID}"
+    stop_process "${DBSERVER_PID}"
+}
+trap cleanup EXIT INT TERM
+
+# 한글: 포트가 열릴 때까지 대기 (최대 10초)
+wait_for_port() {
+    local port="$1" pid="$2"
+    for _ in $(seq 1 100); do
+        kill -0 "${pid}" 2>/dev/null || return 1
+        if (exec 3<>"/dev/tcp/127.0.0.1/${port}") 2>/dev/null; then
+            return 0
+        fi
+        sleep 0.1
+    done
+    return 1
+}
+
+# 한글: /proc/<pid>/stat의 utime+stime (clock tick). comm에 공백이 있어도 ')' 이후로 자른다.
+cpu_ticks() {
+    local stat
+    stat="$(cat "/proc/$1/stat")"
+    stat="${stat##*) }"
+    awk '{ print $12 + $13 }' <<< "${stat}"
+}
+
+proc_status_kb() {
+    awk -v key="$2:" '$1 == key { print $2 }' "/proc/$1/status"
+}
+
+# 한글: TestClient JSON에서 숫자 필드 추출 — 평평한 키는 첫 일치, 지연은 "corrected" 행에서
+json_number() {
+    grep -o "\"$2\": [0-9.]*" "$1" | head -n 1 | awk '{ print $2 }'
+}
+
+latency_number() {
+    grep '"corrected"' "$1" | grep -v uncorrected | grep -o "\"$2\": [0-9.]*" | awk '{ print $2 }'
+}
+
+if [[ "${WITH_DBSERVER}" == "ON" ]]; then
+    DB_PORT=$((PORT - 1))
+    mkdir -p "${OUT_DIR}/dbserver"
+    (cd "${OUT_DIR}/dbserver" && exec "${BIN_DIR}/TestDBServer" -p "${DB_PORT}" -l WARN > dbserver.log 2>&1) &
+    DBSERVER_PID=$!
+    if ! wait_for_port "${DB_PORT}" "${DBSERVER_PID}"; then
+        echo "TestDBServer 시작 실패 — ${OUT_DIR}/dbserver/dbserver.log 확인"
+        exit 1
+    fi
+fi
+
+echo "E2E 벤치마크:"
+echo "  BIN_DIR=${BIN_DIR}"
+echo "  OUT_DIR=${OUT_DIR}"
+echo "  ENGINES=${ENGINES} | DB_MODES=${DB_MODES} | WORKERS=${WORKERS} | PAYLOADS=${PAYLOADS}"
+echo "  CLIENTS=${CLIENTS} THREADS=${THREADS} RATE=${RATE} DURATION=${DURATION}s WARMUP=${WARMUP}s CHURN=${CHURN}/s"
+
+RUN_PORT="${PORT}"
+for engine in ${ENGINES}; do
+for dbMode in ${DB_MODES}; do
+for workers in ${WORKERS}; do
+for payload in ${PAYLOADS}; do
+    name="${engine}_${dbMode}_w${workers}_p${payload}"
+    runDir="${OUT_DIR}/${name}"
+    mkdir -p "${runDir}"
+    echo ""
+    echo "[${name}] port ${RUN_PORT}"
+
+    # 한글: 작업 디렉터리를 조합마다 분리 — db_tasks.wal / SQLite 파일이 섞이지 않게
+    serverArgs=(-p "${RUN_PORT}" --engine "${engine}" -w "${workers}" -l WARN)
+    if [[ "${dbMode}" == "sqlite" ]]; then
+        serverArgs+=(-d "${runDir}/bench.db")
+    fi
+    if [[ "${WITH_DBSERVER}" == "ON" ]]; then
+        serverArgs+=(--db --db-host 127.0.0.1 --db-port "${DB_PORT}")
+    fi
+    (cd "${runDir}" && exec "${BIN_DIR}/TestServer" "${serverArgs[@]}" > server.log 2>&1) &
+    SERVER_PID=$!
+
+    status="ok"
+    if ! wait_for_port "${RUN_PORT}" "${SERVER_PID}"; then
+        status="server_failed"
+    fi
+
+    effective="${engine}"
+    if grep -q "falling back to epoll" "${runDir}/server.log" 2>/dev/null; then
+        effective="${engine}->epoll"
+    fi
+
+    if [[ "${status}" == "ok" ]]; then
+        ticksBefore="$(cpu_ticks "${SERVER_PID}")"
+        startNs="$(date +%s%N)"
+        if ! "${BIN_DIR}/TestClient" --host 127.0.0.1 --port "${RUN_PORT}" -l WARN \
+            --clients "${CLIENTS}" --threads "${THREADS}" --rate "${RATE}" \
+            --duration "${DURATION}" --warmup "${WARMUP}" --churn "${CHURN}" \
+            --payload "${payload}" --json "${runDir}/client.json" > "${runDir}/client.log" 2>&1; then
+            status="client_failed"
+        fi
+        elapsedNs=$(( $(date +%s%N) - startNs ))
+        if kill -0 "${SERVER_PID}" 2>/dev/null; then
+            ticksAfter="$(cpu_ticks "${SERVER_PID}")"
+            rssKb="$(proc_status_kb "${SERVER_PID}" VmRSS)"
+            hwmKb="$(proc_status_kb "${SERVER_PID}" VmHWM)"
+        else
+            status="server_died"
+        fi
+    fi
+    stop_process "${SERVER_PID}"
+    SERVER_PID=""
+
+    if [[ "${status}" != "ok" && "${status}" != "client_failed" ]] || [[ ! -s "${runDir}/client.json" ]]; then
+        echo "  ${status} — ${runDir} 로그 확인"
+        echo "${engine},${effective},${dbMode},${workers},${payload},${CLIENTS},${RATE},${status},,,,,,,,,,,," >> "${CSV}"
+        RUN_PORT=$((RUN_PORT + 1))
+        continue
+    fi
+
+    json="${runDir}/client.json"
+    rps="$(json_number "${json}" throughput_rps)"
+    sent="$(json_number "${json}" sent)"
+    responses="$(json_number "${json}" responses)"
+    lost="$(json_number "${json}" lost)"
+    p50="$(latency_number "${json}" p50)"
+    p90="$(latency_number "${json}" p90)"
+    p99="$(latency_number "${json}" p99)"
+    p999="$(latency_number "${json}" p999)"
+    maxUs="$(latency_number "${json}" max)"
+    read -r cpuPerMsg cpuUtil < <(awk -v t="$((ticksAfter - ticksBefore))" -v hz="${CLK_TCK}" \
+        -v n="${sent}" -v ns="${elapsedNs}" \
+        'BEGIN { cpu = t / hz; printf "%.2f %.1f\n", (n > 0 ? cpu * 1e6 / n : 0), (ns > 0 ? cpu * 1e9 * 100 / ns : 0) }')
+
+    echo "  ${rps} req/s, p50 ${p50}us, p99 ${p99}us, CPU ${cpuPerMsg}us/msg (${cpuUtil}%), RSS ${rssKb}KB (peak ${hwmKb}KB)"
+    echo "${engine},${effective},${dbMode},${workers},${payload},${CLIENTS},${RATE},${status},${rps},${p50},${p90},${p99},${p999},${maxUs},${responses},${lost},${cpuPerMsg},${cpuUtil},${rssKb},${hwmKb}" >> "${CSV}"
+    RUN_PORT=$((RUN_PORT + 1))
+done
+done
+done
+done
+
+stop_process "${DBSERVER_PID}"
+DBSERVER_PID=""
+
+# =============================================================================
+# 한글: Markdown 보고서 — 전체 표 + 엔진 간 비교 (같은 db/워커/페이로드 조합끼리)
+# =============================================================================
+{
+    echo "# E2E Loopback Benchmark"
+    echo ""
+    echo "- Date: $(date '+%Y-%m-%d %H:%M:%S')"
+    echo "- Host: $(uname -srm), $(nproc) CPUs"
+    echo "- Load: ${CLIENTS} connections, ${THREADS} client threads, rate ${RATE} (0 = closed loop), ${DURATION}s (warmup ${WARMUP}s), churn ${CHURN}/s"
+    echo "- TestDBServer: ${WITH_DBSERVER}"
+    echo "- Latency = coordinated-omission corrected; CPU/msg = server CPU time per request sent"
+    echo ""
+    echo "| Engine | DB | Workers | Payload (B) | Status | req/s | p50 (us) | p90 (us) | p99 (us) | p99.9 (us) | Lost | CPU/msg (us) | CPU (%) | RSS (KB) | Peak RSS (KB) |"
+    echo "|---|---|---:|---:|---|---:|---:|---:|---:|---:|---:|---:|---:|---:|---:|"
+    awk -F, 'NR > 1 { printf "| %s | %s | %s | %s | %s | %s | %s | %s | %s | %s | %s | %s | %s | %s | %s |\n", $2, $3, $4, $5, $8, $9, $10, $11, $12, $13, $16, $17, $18, $19, $20 }' "${CSV}"
+    echo ""
+    echo "## Engine comparison"
+    echo ""
+    echo "Ratios against the first engine in the list for the same DB / workers / payload (req/s: higher is better; p99, CPU/msg: lower is better)."
+    echo ""
+    echo "| DB | Workers | Payload (B) | Engine | req/s ratio | p99 ratio | CPU/msg ratio |"
+    echo "|---|---:|---:|---|---:|---:|---:|"
+    awk -F, -v base="${ENGINES%% *}" '
+        NR > 1 && $8 == "ok" {
+            key = $3 "|" $4 "|" $5
+            if ($1 == base) { rps[key] = $9; p99[key] = $12; cpu[key] = $17 }
+            else { rows[++n] = $0 }
+        }
+        END {
+            for (i = 1; i <= n; ++i) {
+                split(rows[i], f, ",")
+                key = f[3] "|" f[4] "|" f[5]
+                if (!(key in rps)) continue
+                printf "| %s | %s | %s | %s | %.2f | %.2f | %.2f |\n", f[3], f[4], f[5], f[2],
+                    (rps[key] > 0 ? f[9] / rps[key] : 0), (p99[key] > 0 ? f[12] / p99[key] : 0),
+                    (cpu[key] > 0 ? f[17] / cpu[key] : 0)
+            }
+        }' "${CSV}"
+} > "${REPORT}"
+
+echo ""
+echo "완료:"
+echo "  ${CSV}"
+echo "  ${REPORT}"